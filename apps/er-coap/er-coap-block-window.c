@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *      CoAP block-wise transfers with several blocks in flight.
+ */
+
+#include <string.h>
+#include "cfs/cfs.h"
+#include "er-coap-block-window.h"
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+/* serialized right away, so one buffer serves all uploads */
+static uint8_t block_buffer[REST_MAX_CHUNK_SIZE];
+/*---------------------------------------------------------------------------*/
+static void
+window_init(struct coap_window_state *state, coap_window_handler handler,
+            int fd)
+{
+  int i;
+
+  state->process = PROCESS_CURRENT();
+  state->handler = handler;
+  state->fd = fd;
+  state->next = 0;
+  state->end = 0xFFFFFFFF;
+  state->complete = 0;
+  state->sized = 0;
+  state->status = COAP_WINDOW_RUNNING;
+
+  /* largest valid block size that fits the chunk size */
+  state->size = 16;
+  while(state->size < 1024 && (state->size << 1) <= REST_MAX_CHUNK_SIZE) {
+    state->size <<= 1;
+  }
+
+  for(i = 0; i < COAP_BLOCK_WINDOW; i++) {
+    state->slots[i].state = state;
+    state->slots[i].transaction = NULL;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+window_cancel(struct coap_window_state *state)
+{
+  int i;
+
+  for(i = 0; i < COAP_BLOCK_WINDOW; i++) {
+    if(state->slots[i].transaction != NULL) {
+      coap_clear_transaction(state->slots[i].transaction);
+      state->slots[i].transaction = NULL;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+deliver(struct coap_window_state *state, coap_packet_t *response,
+        uint32_t offset)
+{
+  if(state->handler != NULL) {
+    state->handler(response, offset);
+  } else if(cfs_seek(state->fd, offset, CFS_SEEK_SET) != (cfs_offset_t)offset
+            || cfs_write(state->fd, response->payload, response->payload_len)
+            != response->payload_len) {
+    PRINTF("Block at %lu not written\n", (unsigned long)offset);
+    state->status = COAP_WINDOW_FAILED;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+get_callback(void *callback_data, void *response)
+{
+  struct coap_window_slot *slot = (struct coap_window_slot *)callback_data;
+  struct coap_window_state *state = slot->state;
+  coap_packet_t *const res = (coap_packet_t *)response;
+  uint32_t offset;
+  uint16_t size;
+  uint8_t more;
+
+  slot->transaction = NULL;
+  if(state->status != COAP_WINDOW_RUNNING) {
+    return;
+  }
+
+  if(res == NULL) {
+    PRINTF("Block at %lu timed out\n", (unsigned long)slot->offset);
+    state->status = COAP_WINDOW_FAILED;
+  } else if(res->code >= BAD_REQUEST_4_00) {
+    /* beyond the end, unless it is the first block */
+    if(slot->offset == 0) {
+      deliver(state, res, 0);
+    }
+    if(slot->offset < state->end) {
+      state->end = slot->offset;
+    }
+  } else if(!coap_get_header_block2(res, NULL, &more, &size, &offset)) {
+    /* the server sent all at once, only the first block asks for that */
+    if(slot->offset == 0) {
+      deliver(state, res, 0);
+    }
+    if(state->status == COAP_WINDOW_RUNNING) {
+      state->status = slot->offset == 0 ? COAP_WINDOW_DONE : COAP_WINDOW_FAILED;
+    }
+  } else if(offset != slot->offset || size > state->size
+            || (offset != 0 && size != state->size)
+            || (more && res->payload_len != size)) {
+    /* not the block asked for, or a short one: it would leave a hole */
+    PRINTF("Block at %lu answered with %lu/%u\n", (unsigned long)slot->offset,
+           (unsigned long)offset, size);
+    state->status = COAP_WINDOW_FAILED;
+  } else {
+    if(offset == 0 && size < state->size) {
+      PRINTF("Block size lowered to %u\n", size);
+      state->size = size;
+      state->next = size;
+    }
+    deliver(state, res, offset);
+    if(!more) {
+      state->complete = offset + state->size;
+      if(state->complete < state->end) {
+        state->end = state->complete;
+      }
+    }
+  }
+
+  state->sized = 1;
+  process_poll(state->process);
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_callback(void *callback_data, void *response)
+{
+  struct coap_window_slot *slot = (struct coap_window_slot *)callback_data;
+  struct coap_window_state *state = slot->state;
+  coap_packet_t *const res = (coap_packet_t *)response;
+  uint16_t size;
+
+  slot->transaction = NULL;
+  if(state->status != COAP_WINDOW_RUNNING) {
+    return;
+  }
+
+  if(res == NULL) {
+    PRINTF("Block at %lu timed out\n", (unsigned long)slot->offset);
+    state->status = COAP_WINDOW_FAILED;
+  } else if(res->code == CONTINUE_2_31) {
+    if(slot->offset == 0
+       && coap_get_header_block1(res, NULL, NULL, &size, NULL)
+       && size < state->size) {
+      /* the server kept only the first size bytes */
+      PRINTF("Block size lowered to %u\n", size);
+      state->size = size;
+      state->next = size;
+    }
+  } else {
+    if(state->handler != NULL) {
+      state->handler(res, slot->offset);
+    }
+    if(res->code < BAD_REQUEST_4_00
+       && slot->offset + state->size >= state->length) {
+      state->status = COAP_WINDOW_DONE;
+    } else {
+      state->status = COAP_WINDOW_FAILED;
+    }
+  }
+
+  state->sized = 1;
+  process_poll(state->process);
+}
+/*---------------------------------------------------------------------------*/
+static int
+send_block(struct coap_window_slot *slot, uip_ipaddr_t *remote_ipaddr,
+           uint16_t remote_port, coap_packet_t *request, uint8_t upload)
+{
+  struct coap_window_state *state = slot->state;
+  coap_transaction_t *t;
+  uint32_t len;
+
+  if(upload) {
+    len = state->length - state->next;
+    if(len > state->size) {
+      len = state->size;
+    }
+    if(cfs_seek(state->fd, state->next, CFS_SEEK_SET)
+       != (cfs_offset_t)state->next
+       || cfs_read(state->fd, block_buffer, len) != len) {
+      state->status = COAP_WINDOW_FAILED;
+      return 0;
+    }
+    coap_set_payload(request, block_buffer, len);
+    coap_set_header_block1(request, state->next / state->size,
+                           state->next + len < state->length, state->size);
+  } else {
+    coap_set_header_block2(request, state->next / state->size, 0,
+                           state->size);
+  }
+
+  request->mid = coap_get_mid();
+  if((t = coap_new_transaction(request->mid, remote_ipaddr, remote_port))
+     == NULL) {
+    return 0;
+  }
+  t->callback = upload ? put_callback : get_callback;
+  t->callback_data = slot;
+  t->packet_len = coap_serialize_message(request, t->packet);
+
+  slot->transaction = t;
+  slot->offset = state->next;
+  PRINTF("Sending block at %lu (MID %u)\n", (unsigned long)state->next,
+         request->mid);
+  coap_send_transaction(t);
+
+  state->next += state->size;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/* sends blocks into free slots, returns the number of blocks in flight */
+static int
+fill_window(struct coap_window_state *state, uip_ipaddr_t *remote_ipaddr,
+            uint16_t remote_port, coap_packet_t *request, uint8_t upload)
+{
+  int i, in_flight = 0;
+
+  for(i = 0; i < COAP_BLOCK_WINDOW; i++) {
+    if(state->slots[i].transaction != NULL) {
+      in_flight++;
+    }
+  }
+  for(i = 0; i < COAP_BLOCK_WINDOW; i++) {
+    if(state->slots[i].transaction != NULL) {
+      continue;
+    }
+    /* the first block goes alone, as it settles the block size */
+    if(!state->sized && (in_flight > 0 || state->next > 0)) {
+      break;
+    }
+    if(state->next >= state->end) {
+      break;
+    }
+    /* the last block of an upload completes it, so it goes last */
+    if(upload && state->next + state->size >= state->length && in_flight > 0) {
+      break;
+    }
+    if(!send_block(&state->slots[i], remote_ipaddr, remote_port, request,
+                   upload)) {
+      break;
+    }
+    in_flight++;
+  }
+  return in_flight;
+}
+/*---------------------------------------------------------------------------*/
+/*- Client Part -------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+PT_THREAD(coap_window_get(struct coap_window_state *state, process_event_t ev,
+                          uip_ipaddr_t *remote_ipaddr, uint16_t remote_port,
+                          coap_packet_t *request, coap_window_handler handler,
+                          int fd))
+{
+  PT_BEGIN(&state->pt);
+
+  window_init(state, handler, fd);
+
+  while(state->status == COAP_WINDOW_RUNNING) {
+    if(fill_window(state, remote_ipaddr, remote_port, request, 0) == 0) {
+      /* nothing in flight: either all blocks are there, or one is missing */
+      state->status = (state->complete != 0 && state->end == state->complete)
+        ? COAP_WINDOW_DONE : COAP_WINDOW_FAILED;
+      break;
+    }
+    PT_YIELD_UNTIL(&state->pt, ev == PROCESS_EVENT_POLL);
+  }
+  window_cancel(state);
+
+  PRINTF("Block2 transfer %s\n",
+         state->status == COAP_WINDOW_DONE ? "done" : "failed");
+
+  PT_END(&state->pt);
+}
+/*---------------------------------------------------------------------------*/
+PT_THREAD(coap_window_put(struct coap_window_state *state, process_event_t ev,
+                          uip_ipaddr_t *remote_ipaddr, uint16_t remote_port,
+                          coap_packet_t *request, int fd,
+                          coap_window_handler handler))
+{
+  PT_BEGIN(&state->pt);
+
+  window_init(state, handler, fd);
+  state->length = cfs_seek(fd, 0, CFS_SEEK_END);
+  /* an empty body is still sent as one block */
+  state->end = state->length > 0 ? state->length : 1;
+
+  while(state->status == COAP_WINDOW_RUNNING) {
+    if(fill_window(state, remote_ipaddr, remote_port, request, 1) == 0) {
+      state->status = COAP_WINDOW_FAILED;
+      break;
+    }
+    PT_YIELD_UNTIL(&state->pt, ev == PROCESS_EVENT_POLL);
+  }
+  window_cancel(state);
+
+  PRINTF("Block1 transfer %s\n",
+         state->status == COAP_WINDOW_DONE ? "done" : "failed");
+
+  PT_END(&state->pt);
+}
+/*---------------------------------------------------------------------------*/
+/*- Server Part -------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+int
+coap_block1_cfs_handler(void *request, void *response, int fd, size_t max_len)
+{
+  coap_packet_t *const packet = (coap_packet_t *)request;
+  const uint8_t *payload = NULL;
+  int pay_len = REST.get_request_payload(request, &payload);
+
+  if(packet->block1_offset + pay_len > max_len) {
+    erbium_status_code = REST.status.REQUEST_ENTITY_TOO_LARGE;
+    coap_error_message = "Message to big";
+    return -1;
+  }
+
+  if(cfs_seek(fd, packet->block1_offset, CFS_SEEK_SET)
+     != (cfs_offset_t)packet->block1_offset
+     || cfs_write(fd, payload, pay_len) != pay_len) {
+    erbium_status_code = REST.status.INTERNAL_SERVER_ERROR;
+    coap_error_message = "WriteFailed";
+    return -1;
+  }
+
+  if(IS_OPTION(packet, COAP_OPTION_BLOCK1)) {
+    coap_set_header_block1(response, packet->block1_num, packet->block1_more,
+                           packet->block1_size);
+    if(packet->block1_more) {
+      coap_set_status_code(response, CONTINUE_2_31);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
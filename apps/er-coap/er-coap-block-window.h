@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *      CoAP block-wise transfers with several blocks in flight.
+ *      Payloads are passed block by block to a handler or streamed
+ *      to and from a CFS file, so they never have to fit into RAM.
+ */
+
+#ifndef COAP_BLOCK_WINDOW_H_
+#define COAP_BLOCK_WINDOW_H_
+
+#include "er-coap-engine.h"
+
+/* Number of blocks in flight, each takes one transaction. The
+ * transaction layer sends at most COAP_NSTART of them to one server at a
+ * time and queues the rest, so the default follows it.
+ *
+ * The window is opt-in: with the RFC 7252 default NSTART of 1 a windowed
+ * transfer is still stop-and-wait, one block per round trip. A project
+ * that knows its servers cope with more opens it with COAP_CONF_NSTART,
+ * e.g. 4, which then also applies to all other requests to the same
+ * server; COAP_CONF_BLOCK_WINDOW only needs setting to use fewer slots
+ * than that. */
+#ifdef COAP_CONF_BLOCK_WINDOW
+#define COAP_BLOCK_WINDOW              COAP_CONF_BLOCK_WINDOW
+#elif COAP_NSTART < COAP_MAX_OPEN_TRANSACTIONS
+#define COAP_BLOCK_WINDOW              COAP_NSTART
+#else
+#define COAP_BLOCK_WINDOW              COAP_MAX_OPEN_TRANSACTIONS
+#endif /* COAP_CONF_BLOCK_WINDOW */
+
+#define COAP_WINDOW_RUNNING            0
+#define COAP_WINDOW_DONE               1
+#define COAP_WINDOW_FAILED             2
+
+/* Gets a block of the response, or the final response of an upload.
+ * Blocks of a download may arrive in any order. */
+typedef void (*coap_window_handler)(void *response, uint32_t offset);
+
+struct coap_window_state;
+
+struct coap_window_slot {
+  struct coap_window_state *state;
+  coap_transaction_t *transaction;
+  uint32_t offset;
+};
+
+struct coap_window_state {
+  struct pt pt;
+  struct process *process;
+  coap_window_handler handler;
+  int fd;             /* CFS file for the payload */
+  uint32_t length;    /* of an upload */
+  uint32_t next;      /* offset of the next block to send */
+  uint32_t end;       /* no block at or beyond this offset */
+  uint32_t complete;  /* end as given by the last block, 0 if not seen */
+  uint16_t size;      /* block size, lowered if the server asks for it */
+  uint8_t sized;      /* the first block is answered, the window may open */
+  uint8_t status;
+  struct coap_window_slot slots[COAP_BLOCK_WINDOW];
+};
+
+/**
+ * \brief Fetches a resource with Block2, COAP_BLOCK_WINDOW blocks at a time
+ *
+ * Each block goes to handler, or to fd at its offset if handler is NULL.
+ * state->status is COAP_WINDOW_DONE at the end if all blocks arrived. A
+ * lost block, or an answer that is not the block asked for, ends the
+ * transfer with COAP_WINDOW_FAILED, so a done transfer has no holes.
+ */
+PT_THREAD(coap_window_get(struct coap_window_state *state, process_event_t ev,
+                          uip_ipaddr_t *remote_ipaddr, uint16_t remote_port,
+                          coap_packet_t *request, coap_window_handler handler,
+                          int fd));
+
+/**
+ * \brief Sends the content of fd with Block1, COAP_BLOCK_WINDOW blocks at a time
+ *
+ * The last block is only sent when all others are acknowledged, so that
+ * the server sees the complete body. Its response goes to handler.
+ */
+PT_THREAD(coap_window_put(struct coap_window_state *state, process_event_t ev,
+                          uip_ipaddr_t *remote_ipaddr, uint16_t remote_port,
+                          coap_packet_t *request, int fd,
+                          coap_window_handler handler));
+
+#define COAP_WINDOW_GET(server_addr, server_port, request, handler, fd) \
+  { \
+    static struct coap_window_state window_state; \
+    PT_SPAWN(process_pt, &window_state.pt, \
+             coap_window_get(&window_state, ev, server_addr, server_port, \
+                             request, handler, fd)); \
+  }
+
+#define COAP_WINDOW_PUT(server_addr, server_port, request, fd, handler) \
+  { \
+    static struct coap_window_state window_state; \
+    PT_SPAWN(process_pt, &window_state.pt, \
+             coap_window_put(&window_state, ev, server_addr, server_port, \
+                             request, fd, handler)); \
+  }
+
+/**
+ * \brief Block1 support within a resource, writing into a CFS file
+ *
+ * Like coap_block1_handler(), but each block is written to fd at its
+ * offset, so blocks may arrive in any order.
+ */
+int coap_block1_cfs_handler(void *request, void *response, int fd,
+                            size_t max_len);
+
+#endif /* COAP_BLOCK_WINDOW_H_ */
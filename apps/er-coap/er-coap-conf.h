@@ -41,7 +41,15 @@
 
 /* Features that can be disabled to achieve smaller memory footprint */
 #define COAP_LINK_FORMAT_FILTERING     0
+#ifndef COAP_PROXY_OPTION_PROCESSING
 #define COAP_PROXY_OPTION_PROCESSING   0
+#endif
+
+/* Object-Security option and message protection, set by the OSCOAP
+ * module (apps/er-oscoap-group) when it is in APPS */
+#ifndef WITH_OSCOAP
+#define WITH_OSCOAP                    0
+#endif
 
 /* Listening port for the CoAP REST Engine */
 #ifndef COAP_SERVER_PORT
@@ -53,6 +61,37 @@
 #define COAP_MAX_OPEN_TRANSACTIONS     4
 #endif /* COAP_MAX_OPEN_TRANSACTIONS */
 
+/* Retransmission timeouts estimated per destination from measured round
+ * trip times (CoCoA) instead of the fixed COAP_RESPONSE_TIMEOUT. */
+#ifdef COAP_CONF_COCOA
+#define COAP_COCOA                     COAP_CONF_COCOA
+#else
+#define COAP_COCOA                     1
+#endif /* COAP_CONF_COCOA */
+
+/* Number of destinations with a round trip time estimate. */
+#ifdef COAP_CONF_MAX_DESTINATIONS
+#define COAP_MAX_DESTINATIONS          COAP_CONF_MAX_DESTINATIONS
+#else
+#define COAP_MAX_DESTINATIONS          4
+#endif /* COAP_CONF_MAX_DESTINATIONS */
+
+/* Confirmable messages outstanding per destination, more are queued.
+ * This also bounds the blocks of one windowed transfer that are really
+ * in flight, see COAP_BLOCK_WINDOW in er-coap-block-window.h. */
+#ifdef COAP_CONF_NSTART
+#define COAP_NSTART                    COAP_CONF_NSTART
+#else
+#define COAP_NSTART                    1
+#endif /* COAP_CONF_NSTART */
+
+/* Count transmissions, see coap_cocoa_stats. */
+#ifdef COAP_COCOA_CONF_STATS
+#define COAP_COCOA_STATS               COAP_COCOA_CONF_STATS
+#else
+#define COAP_COCOA_STATS               0
+#endif /* COAP_COCOA_CONF_STATS */
+
 /* Maximum number of failed request attempts before action */
 #ifndef COAP_MAX_ATTEMPTS
 #define COAP_MAX_ATTEMPTS              4
@@ -63,12 +102,73 @@
 #define COAP_MAX_HEADER_SIZE           (4 + COAP_TOKEN_LEN + 3 + 1 + COAP_ETAG_LEN + 4 + 4 + 30)  /* 65 */
 #endif /* COAP_MAX_HEADER_SIZE */
 
-/* Number of observer slots (each takes abot xxx bytes) */
+/* Number of observer slots (each takes about 75 bytes on 16-bit platforms).
+ * Notifications do not use transactions, so this is independent of
+ * COAP_MAX_OPEN_TRANSACTIONS. */
 #ifndef COAP_MAX_OBSERVERS
-#define COAP_MAX_OBSERVERS    COAP_MAX_OPEN_TRANSACTIONS - 1
+#define COAP_MAX_OBSERVERS             4
 #endif /* COAP_MAX_OBSERVERS */
 
 /* Interval in notifies in which NON notifies are changed to CON notifies to check client. */
 #define COAP_OBSERVE_REFRESH_INTERVAL  20
 
+/* Group observation: registrations sent to a multicast group share one
+ * observer slot and are notified with one NON message to the group. */
+#ifdef COAP_CONF_GROUP_OBSERVE
+#define COAP_GROUP_OBSERVE             COAP_CONF_GROUP_OBSERVE
+#else
+#define COAP_GROUP_OBSERVE             0
+#endif /* COAP_CONF_GROUP_OBSERVE */
+
+/* Seconds a group observation lives without a new registration. */
+#ifdef COAP_CONF_GROUP_OBSERVE_LIFETIME
+#define COAP_GROUP_OBSERVE_LIFETIME    COAP_CONF_GROUP_OBSERVE_LIFETIME
+#else
+#define COAP_GROUP_OBSERVE_LIFETIME    300
+#endif /* COAP_CONF_GROUP_OBSERVE_LIFETIME */
+
+/* Members tracked by address across all group observations. A group
+ * with members that did not fit is only removed when its lifetime ends,
+ * not when its tracked members cancel. */
+#ifdef COAP_CONF_GROUP_OBSERVE_MEMBERS
+#define COAP_GROUP_OBSERVE_MEMBERS     COAP_CONF_GROUP_OBSERVE_MEMBERS
+#else
+#define COAP_GROUP_OBSERVE_MEMBERS     8
+#endif /* COAP_CONF_GROUP_OBSERVE_MEMBERS */
+
+/*
+ * Responses to multicast requests are sent at a random point within the
+ * leisure (RFC 7252, section 8.2). If the size of the group is known, the
+ * leisure is derived from it as S * G / R, with S the size of the response
+ * and R the data rate the group may use for the responses, in bytes per
+ * second. Otherwise COAP_DEFAULT_LEISURE is used.
+ */
+#ifndef COAP_DEFAULT_LEISURE
+#define COAP_DEFAULT_LEISURE           (5 * CLOCK_SECOND)
+#endif /* COAP_DEFAULT_LEISURE */
+
+#ifndef COAP_LEISURE_GROUP_SIZE
+#define COAP_LEISURE_GROUP_SIZE        0
+#endif /* COAP_LEISURE_GROUP_SIZE */
+
+#ifndef COAP_LEISURE_DATA_RATE
+#define COAP_LEISURE_DATA_RATE         1000
+#endif /* COAP_LEISURE_DATA_RATE */
+
+/*
+ * If set, confirmable messages are retransmitted at this fixed interval
+ * in clock ticks instead of with the estimated or randomized back-off,
+ * e.g. to keep retransmissions out of a signing test.
+ */
+#ifndef COAP_FIXED_RETRANSMIT_INTERVAL
+#define COAP_FIXED_RETRANSMIT_INTERVAL 0
+#endif /* COAP_FIXED_RETRANSMIT_INTERVAL */
+
+/* Count notifications and bytes sent, see coap_observe_stats. */
+#ifdef COAP_OBSERVE_CONF_STATS
+#define COAP_OBSERVE_STATS             COAP_OBSERVE_CONF_STATS
+#else
+#define COAP_OBSERVE_STATS             0
+#endif /* COAP_OBSERVE_CONF_STATS */
+
 #endif /* ER_COAP_CONF_H_ */
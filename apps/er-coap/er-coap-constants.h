@@ -109,6 +109,13 @@ typedef enum {
   MEMORY_ALLOCATION_ERROR = 192,
   PACKET_SERIALIZATION_ERROR,
 
+  /* OSCOAP errors, see WITH_OSCOAP */
+  OSCOAP_CRYPTO_ERROR,
+  OSCOAP_SEQ_ERROR,
+  OSCOAP_CONTEXT_NOT_FOUND,
+  OSCOAP_MALFORMED_PACKET,
+  OSCOAP_VERIFY_PENDING,
+
   /* Erbium hooks */
   MANUAL_RESPONSE,
   PING_RESPONSE
@@ -129,6 +136,7 @@ typedef enum {
   COAP_OPTION_URI_QUERY = 15,   /* 0-255 B */
   COAP_OPTION_ACCEPT = 17,      /* 0-2 B */
   COAP_OPTION_LOCATION_QUERY = 20,      /* 0-255 B */
+  COAP_OPTION_OBJECT_SECURITY = 21,     /* 0-255 B */
   COAP_OPTION_BLOCK2 = 23,      /* 1-3 B */
   COAP_OPTION_BLOCK1 = 27,      /* 1-3 B */
   COAP_OPTION_SIZE2 = 28,       /* 0-4 B */
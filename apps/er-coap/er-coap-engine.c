@@ -64,28 +64,50 @@ static service_callback_t service_cbk = NULL;
 /*---------------------------------------------------------------------------*/
 /*- Internal API ------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-static int
-coap_receive(void)
+static clock_time_t
+leisure(uint16_t response_len)
+{
+  static uint8_t seeded = 0;
+
+  if(!seeded) {
+    /* group members must not all draw the same delays */
+    uip_ds6_addr_t *addr = uip_ds6_get_link_local(-1);
+
+    if(addr != NULL) {
+      random_init(addr->ipaddr.u8[15] | addr->ipaddr.u8[14] << 8);
+    }
+    seeded = 1;
+  }
+
+#if COAP_LEISURE_GROUP_SIZE > 0
+  return (clock_time_t)((uint32_t)response_len * COAP_LEISURE_GROUP_SIZE *
+                        CLOCK_SECOND / COAP_LEISURE_DATA_RATE);
+#else
+  return COAP_DEFAULT_LEISURE;
+#endif
+}
+/*---------------------------------------------------------------------------*/
+int
+coap_receive_datagram(uint8_t *data, uint16_t len,
+                      uip_ipaddr_t *srcaddr, uint16_t srcport,
+                      const uip_ipaddr_t *dstaddr)
 {
   erbium_status_code = NO_ERROR;
 
-  PRINTF("handle_incoming_data(): received uip_datalen=%u \n",
-         (uint16_t)uip_datalen());
+  PRINTF("handle_incoming_data(): received uip_datalen=%u \n", len);
 
   /* static declaration reduces stack peaks and program code size */
   static coap_packet_t message[1]; /* this way the packet can be treated as pointer as usual */
   static coap_packet_t response[1];
   static coap_transaction_t *transaction = NULL;
 
-  if(uip_newdata()) {
+  if(len > 0) {
 
     PRINTF("receiving UDP datagram from: ");
-    PRINT6ADDR(&UIP_IP_BUF->srcipaddr);
-    PRINTF(":%u\n  Length: %u\n", uip_ntohs(UIP_UDP_BUF->srcport),
-           uip_datalen());
+    PRINT6ADDR(srcaddr);
+    PRINTF(":%u\n  Length: %u\n", uip_ntohs(srcport), len);
 
-    erbium_status_code =
-      coap_parse_message(message, uip_appdata, uip_datalen());
+    erbium_status_code = coap_parse_message(message, data, len);
 
     if(erbium_status_code == NO_ERROR) {
 
@@ -101,8 +123,7 @@ coap_receive(void)
 
         /* use transaction buffer for response to confirmable request */
         if((transaction =
-              coap_new_transaction(message->mid, &UIP_IP_BUF->srcipaddr,
-                                   UIP_UDP_BUF->srcport))) {
+              coap_new_transaction(message->mid, srcaddr, srcport))) {
           uint32_t block_num = 0;
           uint16_t block_size = COAP_MAX_BLOCK_SIZE;
           uint32_t block_offset = 0;
@@ -118,7 +139,15 @@ coap_receive(void)
             coap_init_message(response, COAP_TYPE_NON, CONTENT_2_05,
                               coap_get_mid());
             /* mirror token */
-          } if(message->token_len) {
+          }
+#if WITH_OSCOAP
+          /* protected requests get protected responses */
+          if(message->context != NULL) {
+            response->context = message->context;
+            coap_set_header_object_security(response);
+          }
+#endif /* WITH_OSCOAP */
+          if(message->token_len) {
             coap_set_token(response, message->token, message->token_len);
             /* get offset for blockwise transfers */
           }
@@ -233,11 +262,12 @@ coap_receive(void)
         } else if(message->type == COAP_TYPE_ACK) {
           /* transactions are closed through lookup below */
           PRINTF("Received ACK\n");
+          /* confirmable notifications are not transactions */
+          coap_observe_ack(srcaddr, srcport, message->mid);
         } else if(message->type == COAP_TYPE_RST) {
           PRINTF("Received RST\n");
           /* cancel possible subscriptions */
-          coap_remove_observer_by_mid(&UIP_IP_BUF->srcipaddr,
-                                      UIP_UDP_BUF->srcport, message->mid);
+          coap_remove_observer_by_mid(srcaddr, srcport, message->mid);
         }
 
         if((transaction = coap_get_transaction_by_mid(message->mid))) {
@@ -245,6 +275,7 @@ coap_receive(void)
           restful_response_handler callback = transaction->callback;
           void *callback_data = transaction->callback_data;
 
+          coap_update_rto(transaction);
           coap_clear_transaction(transaction);
 
           /* check if someone registered for the response */
@@ -260,8 +291,7 @@ coap_receive(void)
         if((message->type == COAP_TYPE_CON || message->type == COAP_TYPE_NON)
               && IS_OPTION(message, COAP_OPTION_OBSERVE)) {
           PRINTF("Observe [%u]\n", message->observe);
-          coap_handle_notification(&UIP_IP_BUF->srcipaddr, UIP_UDP_BUF->srcport,
-              message);
+          coap_handle_notification(srcaddr, srcport, message);
         }
 #endif /* COAP_OBSERVE_CLIENT */
       } /* request or response */
@@ -270,8 +300,19 @@ coap_receive(void)
     /* if(parsed correctly) */
     if(erbium_status_code == NO_ERROR) {
       if(transaction) {
-        coap_send_transaction(transaction);
+        if(uip_is_addr_mcast(dstaddr)) {
+          /* spread the answers of the group over the leisure */
+          coap_defer_transaction(transaction,
+                                 leisure(transaction->packet_len));
+        } else {
+          coap_send_transaction(transaction);
+        }
       }
+#if WITH_OSCOAP
+    } else if(erbium_status_code == OSCOAP_VERIFY_PENDING) {
+      /* queued until its signature is verified, then received again */
+      coap_clear_transaction(transaction);
+#endif /* WITH_OSCOAP */
     } else if(erbium_status_code == MANUAL_RESPONSE) {
       PRINTF("Clearing transaction for manual response");
       coap_clear_transaction(transaction);
@@ -293,16 +334,25 @@ coap_receive(void)
                         message->mid);
       coap_set_payload(message, coap_error_message,
                        strlen(coap_error_message));
-      coap_send_message(&UIP_IP_BUF->srcipaddr, UIP_UDP_BUF->srcport,
-                        uip_appdata, coap_serialize_message(message,
-                                                            uip_appdata));
+      coap_send_message(srcaddr, srcport, data,
+                        coap_serialize_message(message, data));
     }
   }
 
-  /* if(new data) */
   return erbium_status_code;
 }
 /*---------------------------------------------------------------------------*/
+static int
+coap_receive(void)
+{
+  if(!uip_newdata()) {
+    return erbium_status_code = NO_ERROR;
+  }
+  return coap_receive_datagram(uip_appdata, uip_datalen(),
+                               &UIP_IP_BUF->srcipaddr, UIP_UDP_BUF->srcport,
+                               &UIP_IP_BUF->destipaddr);
+}
+/*---------------------------------------------------------------------------*/
 void
 coap_init_engine(void)
 {
@@ -388,6 +438,9 @@ PT_THREAD(coap_blocking_request
   block_error = 0;
 
   do {
+#if WITH_OSCOAP
+    request->ipaddr = remote_ipaddr;
+#endif /* WITH_OSCOAP */
     request->mid = coap_get_mid();
     if((state->transaction = coap_new_transaction(request->mid, remote_ipaddr,
                                                   remote_port))) {
@@ -53,6 +53,16 @@ typedef coap_packet_t rest_response_t;
 
 void coap_init_engine(void);
 
+/*
+ * Handle a CoAP datagram as if it had just been received from
+ * srcaddr:srcport and sent to dstaddr. Error replies are built in data,
+ * which must hold COAP_MAX_PACKET_SIZE bytes. Replies to a multicast
+ * dstaddr are deferred by the leisure.
+ */
+int coap_receive_datagram(uint8_t *data, uint16_t len,
+                          uip_ipaddr_t *srcaddr, uint16_t srcport,
+                          const uip_ipaddr_t *dstaddr);
+
 /*---------------------------------------------------------------------------*/
 /*- Client Part -------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
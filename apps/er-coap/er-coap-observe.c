@@ -39,6 +39,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "er-coap-observe.h"
+#include "lib/random.h"
 
 #define DEBUG 0
 #if DEBUG
@@ -55,12 +56,32 @@
 /*---------------------------------------------------------------------------*/
 MEMB(observers_memb, coap_observer_t, COAP_MAX_OBSERVERS);
 LIST(observers_list);
+#if COAP_GROUP_OBSERVE
+MEMB(members_memb, coap_group_member_t, COAP_GROUP_OBSERVE_MEMBERS);
+#endif /* COAP_GROUP_OBSERVE */
+
+/*
+ * A notification is rendered once into notify_buffer, without token and
+ * with an empty Observe option, and copied to send_buffer for each
+ * observer with its own type, MID, token and Observe value.
+ */
+static uint8_t notify_buffer[COAP_MAX_PACKET_SIZE + 1];
+static uint16_t notify_len;
+static uint16_t notify_observe;     /* offset of the Observe option, or 0 */
+static resource_t *notify_resource; /* what notify_buffer holds */
+static char notify_url[COAP_OBSERVER_URL_LEN]; /* for which URL */
+static uint8_t send_buffer[COAP_MAX_PACKET_SIZE + COAP_TOKEN_LEN + 4];
+
+#if COAP_OBSERVE_STATS
+coap_observe_stats_t coap_observe_stats;
+#endif /* COAP_OBSERVE_STATS */
 /*---------------------------------------------------------------------------*/
 /*- Internal API ------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 static coap_observer_t *
-add_observer(uip_ipaddr_t *addr, uint16_t port, const uint8_t *token,
-             size_t token_len, const char *uri, int uri_len)
+add_observer(resource_t *resource, uip_ipaddr_t *addr, uint16_t port,
+             const uint8_t *token, size_t token_len, const char *uri,
+             int uri_len)
 {
   /* Remove existing observe relationship, if any. */
   coap_remove_observer_by_uri(addr, port, uri);
@@ -79,6 +100,14 @@ add_observer(uip_ipaddr_t *addr, uint16_t port, const uint8_t *token,
     o->token_len = token_len;
     memcpy(o->token, token, token_len);
     o->last_mid = 0;
+    o->retrans_counter = 0;
+    o->resource = resource;
+#if COAP_GROUP_OBSERVE
+    LIST_STRUCT_INIT(o, members);
+    o->untracked = 0;
+#endif /* COAP_GROUP_OBSERVE */
+    o->sibling = resource->observers;
+    resource->observers = o;
 
     PRINTF("Adding observer (%u/%u) for /%s [0x%02X%02X]\n",
            list_length(observers_list) + 1, COAP_MAX_OBSERVERS,
@@ -88,6 +117,90 @@ add_observer(uip_ipaddr_t *addr, uint16_t port, const uint8_t *token,
 
   return o;
 }
+#if COAP_GROUP_OBSERVE
+/*---------------------------------------------------------------------------*/
+static coap_observer_t *
+find_group_observer(resource_t *resource, uip_ipaddr_t *group,
+                    uint16_t port, const char *uri, int uri_len)
+{
+  coap_observer_t *obs = NULL;
+
+  if(uri_len > COAP_OBSERVER_URL_LEN - 1) {
+    uri_len = COAP_OBSERVER_URL_LEN - 1;
+  }
+  for(obs = (coap_observer_t *)resource->observers; obs;
+      obs = obs->sibling) {
+    if(uip_ipaddr_cmp(&obs->addr, group) && obs->port == port
+       && strncmp(obs->url, uri, uri_len) == 0 && obs->url[uri_len] == 0) {
+      return obs;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static coap_group_member_t *
+find_member(coap_observer_t *o, uip_ipaddr_t *addr)
+{
+  coap_group_member_t *m;
+
+  for(m = list_head(o->members); m; m = m->next) {
+    if(uip_ipaddr_cmp(&m->addr, addr)) {
+      return m;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_member(coap_observer_t *o, coap_group_member_t *m)
+{
+  list_remove(o->members, m);
+  memb_free(&members_memb, m);
+}
+/*---------------------------------------------------------------------------*/
+/* Drop the members that did not register again within the lifetime */
+static void
+prune_members(coap_observer_t *o)
+{
+  coap_group_member_t *m, *next;
+
+  for(m = list_head(o->members); m; m = next) {
+    next = m->next;
+    if((long)(clock_seconds() - m->expires) >= 0) {
+      remove_member(o, m);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+add_member(coap_observer_t *o, uip_ipaddr_t *addr)
+{
+  coap_group_member_t *m;
+
+  prune_members(o);
+  m = find_member(o, addr);
+  if(m == NULL) {
+    m = memb_alloc(&members_memb);
+    if(m == NULL) {
+      /* counted by the lease only, so cancels cannot end the group */
+      o->untracked = 1;
+      return;
+    }
+    uip_ipaddr_copy(&m->addr, addr);
+    list_add(o->members, m);
+  }
+  m->expires = clock_seconds() + COAP_GROUP_OBSERVE_LIFETIME;
+}
+/*---------------------------------------------------------------------------*/
+#if COAP_OBSERVE_STATS
+static unsigned int
+count_members(coap_observer_t *o)
+{
+  prune_members(o);
+  return list_length(o->members);
+}
+#endif /* COAP_OBSERVE_STATS */
+#endif /* COAP_GROUP_OBSERVE */
 /*---------------------------------------------------------------------------*/
 /*- Removal -----------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -97,6 +210,22 @@ coap_remove_observer(coap_observer_t *o)
   PRINTF("Removing observer for /%s [0x%02X%02X]\n", o->url, o->token[0],
          o->token[1]);
 
+  coap_observer_t **sibling;
+
+  for(sibling = (coap_observer_t **)&o->resource->observers;
+      *sibling != NULL; sibling = &(*sibling)->sibling) {
+    if(*sibling == o) {
+      *sibling = o->sibling;
+      break;
+    }
+  }
+
+  ctimer_stop(&o->retrans_timer);
+#if COAP_GROUP_OBSERVE
+  while(list_head(o->members) != NULL) {
+    remove_member(o, list_head(o->members));
+  }
+#endif /* COAP_GROUP_OBSERVE */
   memb_free(&observers_memb, o);
   list_remove(observers_list, o);
 }
@@ -178,8 +307,180 @@ coap_remove_observer_by_mid(uip_ipaddr_t *addr, uint16_t port, uint16_t mid)
   return removed;
 }
 /*---------------------------------------------------------------------------*/
+void
+coap_observe_ack(uip_ipaddr_t *addr, uint16_t port, uint16_t mid)
+{
+  coap_observer_t *obs = NULL;
+
+  for(obs = (coap_observer_t *)list_head(observers_list); obs;
+      obs = obs->next) {
+    if(!ctimer_expired(&obs->retrans_timer) && obs->last_mid == mid
+       && uip_ipaddr_cmp(&obs->addr, addr) && obs->port == port) {
+      PRINTF("Notification %u acknowledged\n", mid);
+      ctimer_stop(&obs->retrans_timer);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
 /*- Notification ------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+static void
+render_notification(resource_t *resource, const char *url)
+{
+  coap_packet_t notification[1]; /* this way the packet can be treated as pointer as usual */
+  coap_packet_t request[1]; /* this way the packet can be treated as pointer as usual */
+  uint8_t *option, *end;
+  unsigned int number, delta, length;
+
+  coap_init_message(notification, COAP_TYPE_NON, CONTENT_2_05, 0);
+  /* create a "fake" request for the URI */
+  coap_init_message(request, COAP_TYPE_CON, COAP_GET, 0);
+  coap_set_header_uri_path(request, url);
+
+  resource->get_handler(request, notification,
+                        notify_buffer + COAP_MAX_HEADER_SIZE,
+                        REST_MAX_CHUNK_SIZE, NULL);
+
+  /* a zero value is sent as an empty option, filled in per observer */
+  if(notification->code < BAD_REQUEST_4_00) {
+    coap_set_header_observe(notification, 0);
+  }
+  notify_len = coap_serialize_message(notification, notify_buffer);
+  notify_resource = notify_len > 0 ? resource : NULL;
+  strncpy(notify_url, url, COAP_OBSERVER_URL_LEN - 1);
+  notify_url[COAP_OBSERVER_URL_LEN - 1] = '\0';
+
+  /* find the Observe option, the options are in order of their number */
+  notify_observe = 0;
+  number = 0;
+  option = notify_buffer + COAP_HEADER_LEN;
+  end = notify_buffer + notify_len;
+  while(IS_OPTION(notification, COAP_OPTION_OBSERVE)
+        && option < end && *option != 0xFF) {
+    delta = *option >> 4;
+    length = *option & 0x0F;
+    if(delta == 13) {
+      delta = option[1] + 13;
+    } else if(delta == 14) {
+      delta = (option[1] << 8) + option[2] + 269;
+    }
+    number += delta;
+    if(number == COAP_OPTION_OBSERVE) {
+      notify_observe = option - notify_buffer;
+      break;
+    }
+    option += 1 + (*option >> 4 == 13) + 2 * (*option >> 4 == 14);
+    if(length == 13) {
+      length = *option + 13;
+      option += 1;
+    } else if(length == 14) {
+      length = (option[0] << 8) + option[1] + 269;
+      option += 2;
+    }
+    option += length;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Render the notification unless notify_buffer holds it already, a
+ * sub-resource renders differently from its parent and its siblings */
+static int
+prepare_notification(resource_t *resource, const char *url)
+{
+  if(notify_resource != resource || strcmp(notify_url, url) != 0) {
+    render_notification(resource, url);
+  }
+  return notify_resource != NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+send_notification(coap_observer_t *obs, coap_message_type_t type,
+                  uint32_t observe)
+{
+  uint8_t *out = send_buffer;
+  const uint8_t *rest = notify_buffer + COAP_HEADER_LEN;
+  size_t value_len = 0;
+
+  *out++ = (notify_buffer[0]
+            & ~(COAP_HEADER_TYPE_MASK | COAP_HEADER_TOKEN_LEN_MASK))
+    | (COAP_HEADER_TYPE_MASK & type << COAP_HEADER_TYPE_POSITION)
+    | (COAP_HEADER_TOKEN_LEN_MASK
+       & obs->token_len << COAP_HEADER_TOKEN_LEN_POSITION);
+  *out++ = notify_buffer[1];
+  *out++ = (uint8_t)(obs->last_mid >> 8);
+  *out++ = (uint8_t)(obs->last_mid);
+  memcpy(out, obs->token, obs->token_len);
+  out += obs->token_len;
+
+  if(notify_observe) {
+    /* options before Observe, then Observe with the same delta */
+    memcpy(out, rest, notify_buffer + notify_observe - rest);
+    out += notify_buffer + notify_observe - rest;
+    rest = notify_buffer + notify_observe + 1;
+
+    observe &= 0xFFFFFF;
+    value_len = (observe > 0xFFFF) ? 3 : (observe > 0xFF) ? 2 : (observe > 0);
+    *out++ = (notify_buffer[notify_observe] & 0xF0) | value_len;
+    while(value_len > 0) {
+      *out++ = (uint8_t)(observe >> (8 * --value_len));
+    }
+  }
+  memcpy(out, rest, notify_buffer + notify_len - rest);
+  out += notify_buffer + notify_len - rest;
+
+#if COAP_GROUP_OBSERVE
+  if(uip_is_addr_mcast(&obs->addr)) {
+    COAP_OBSERVE_STATS_ADD(group, 1);
+    COAP_OBSERVE_STATS_ADD(group_bytes, out - send_buffer);
+    COAP_OBSERVE_STATS_ADD(group_members, count_members(obs));
+    COAP_OBSERVE_STATS_ADD(group_members_bytes,
+                           count_members(obs) * (out - send_buffer));
+  } else
+#endif /* COAP_GROUP_OBSERVE */
+  {
+    COAP_OBSERVE_STATS_ADD(unicast, 1);
+    COAP_OBSERVE_STATS_ADD(unicast_bytes, out - send_buffer);
+  }
+
+  PRINTF("           Observer ");
+  PRINT6ADDR(&obs->addr);
+  PRINTF(":%u MID %u\n", obs->port, obs->last_mid);
+
+  coap_send_message(&obs->addr, obs->port, send_buffer, out - send_buffer);
+}
+/*---------------------------------------------------------------------------*/
+static void
+retransmit_notification(void *ptr)
+{
+  coap_observer_t *obs = (coap_observer_t *)ptr;
+  uip_ipaddr_t addr;
+  uint16_t port;
+
+  if(obs->retrans_counter >= COAP_MAX_RETRANSMIT) {
+    /* timed out, the client is gone */
+    PRINTF("Timeout\n");
+    uip_ipaddr_copy(&addr, &obs->addr);
+    port = obs->port;
+    coap_remove_observer_by_client(&addr, port);
+    return;
+  }
+
+  /* The buffer may hold another resource or sub-resource by now. The
+   * current state of the observed URL is sent then, which is what a new
+   * notification would carry anyway. */
+  if(!prepare_notification(obs->resource, obs->url)) {
+    return;
+  }
+
+  obs->retrans_counter++;
+  PRINTF("Retransmitting notification %u (%u)\n", obs->last_mid,
+         obs->retrans_counter);
+  send_notification(obs, COAP_TYPE_CON, obs->obs_counter - 1);
+
+  ctimer_set(&obs->retrans_timer,
+             obs->retrans_timer.etimer.timer.interval << 1,
+             retransmit_notification, obs);
+}
+/*---------------------------------------------------------------------------*/
 void
 coap_notify_observers(resource_t *resource)
 {
@@ -188,12 +489,11 @@ coap_notify_observers(resource_t *resource)
 void
 coap_notify_observers_sub(resource_t *resource, const char *subpath)
 {
-  /* build notification */
-  coap_packet_t notification[1]; /* this way the packet can be treated as pointer as usual */
-  coap_packet_t request[1]; /* this way the packet can be treated as pointer as usual */
   coap_observer_t *obs = NULL;
+  coap_observer_t *next = NULL;
   int url_len, obs_url_len;
   char url[COAP_OBSERVER_URL_LEN];
+  coap_message_type_t type;
 
   url_len = strlen(resource->url);
   strncpy(url, resource->url, COAP_OBSERVER_URL_LEN - 1);
@@ -205,17 +505,23 @@ coap_notify_observers_sub(resource_t *resource, const char *subpath)
   /* url now contains the notify URL that needs to match the observer */
   PRINTF("Observe: Notification from %s\n", url);
 
-  coap_init_message(notification, COAP_TYPE_NON, CONTENT_2_05, 0);
-  /* create a "fake" request for the URI */
-  coap_init_message(request, COAP_TYPE_CON, COAP_GET, 0);
-  coap_set_header_uri_path(request, url);
+  /* rendered when the first observer matches */
+  notify_resource = NULL;
 
   /* iterate over observers */
   url_len = strlen(url);
-  for(obs = (coap_observer_t *)list_head(observers_list); obs;
-      obs = obs->next) {
+  for(obs = (coap_observer_t *)resource->observers; obs; obs = next) {
+    next = obs->sibling;
     obs_url_len = strlen(obs->url);
 
+#if COAP_GROUP_OBSERVE
+    /* no member registered again within the lifetime */
+    if(uip_is_addr_mcast(&obs->addr) && stimer_expired(&obs->lease)) {
+      coap_remove_observer(obs);
+      continue;
+    }
+#endif /* COAP_GROUP_OBSERVE */
+
     /* Do a match based on the parent/sub-resource match so that it is
        possible to do parent-node observe */
     if((obs_url_len == url_len
@@ -223,39 +529,40 @@ coap_notify_observers_sub(resource_t *resource, const char *subpath)
             && (resource->flags & HAS_SUB_RESOURCES)
             && obs->url[url_len] == '/'))
        && strncmp(url, obs->url, url_len) == 0) {
-      coap_transaction_t *transaction = NULL;
-
-      /*TODO implement special transaction for CON, sharing the same buffer to allow for more observers */
-
-      if((transaction = coap_new_transaction(coap_get_mid(), &obs->addr, obs->port))) {
-        if(obs->obs_counter % COAP_OBSERVE_REFRESH_INTERVAL == 0) {
-          PRINTF("           Force Confirmable for\n");
-          notification->type = COAP_TYPE_CON;
-        }
-
-        PRINTF("           Observer ");
-        PRINT6ADDR(&obs->addr);
-        PRINTF(":%u\n", obs->port);
 
-        /* update last MID for RST matching */
-        obs->last_mid = transaction->mid;
-
-        /* prepare response */
-        notification->mid = transaction->mid;
+      if(!prepare_notification(resource, url)) {
+        return;
+      }
 
-        resource->get_handler(request, notification,
-                              transaction->packet + COAP_MAX_HEADER_SIZE,
-                              REST_MAX_CHUNK_SIZE, NULL);
+      /* A pending confirmable notification is replaced by this one,
+       * which is confirmable as well (RFC 7641, 4.5.2). */
+      type = COAP_TYPE_NON;
+#if COAP_GROUP_OBSERVE
+      if(uip_is_addr_mcast(&obs->addr)) {
+        /* cannot be acknowledged, members keep it alive by registering */
+      } else
+#endif /* COAP_GROUP_OBSERVE */
+      if(!ctimer_expired(&obs->retrans_timer)
+         || obs->obs_counter % COAP_OBSERVE_REFRESH_INTERVAL == 0) {
+        PRINTF("           Force Confirmable for\n");
+        type = COAP_TYPE_CON;
+      }
 
-        if(notification->code < BAD_REQUEST_4_00) {
-          coap_set_header_observe(notification, (obs->obs_counter)++);
-        }
-        coap_set_token(notification, obs->token, obs->token_len);
+      /* update last MID for RST matching */
+      obs->last_mid = coap_get_mid();
 
-        transaction->packet_len =
-          coap_serialize_message(notification, transaction->packet);
+      send_notification(obs, type, obs->obs_counter);
+      if(notify_observe) {
+        (obs->obs_counter)++;
+      }
 
-        coap_send_transaction(transaction);
+      if(type == COAP_TYPE_CON) {
+        obs->retrans_counter = 0;
+        ctimer_set(&obs->retrans_timer,
+                   COAP_RESPONSE_TIMEOUT_TICKS +
+                   (random_rand() %
+                    (clock_time_t)COAP_RESPONSE_TIMEOUT_BACKOFF_MASK),
+                   retransmit_notification, obs);
       }
     }
   }
@@ -271,8 +578,38 @@ coap_observe_handler(resource_t *resource, void *request, void *response)
   if(coap_req->code == COAP_GET && coap_res->code < 128) { /* GET request and response without error code */
     if(IS_OPTION(coap_req, COAP_OPTION_OBSERVE)) {
       if(coap_req->observe == 0) {
-        obs = add_observer(&UIP_IP_BUF->srcipaddr, UIP_UDP_BUF->srcport,
-                           coap_req->token, coap_req->token_len,
+#if COAP_GROUP_OBSERVE
+        if(uip_is_addr_mcast(&UIP_IP_BUF->destipaddr)) {
+          /* all members observe through one entry and one token */
+          obs = find_group_observer(resource, &UIP_IP_BUF->destipaddr,
+                                    UIP_UDP_BUF->srcport,
+                                    coap_req->uri_path,
+                                    coap_req->uri_path_len);
+          if(obs && (obs->token_len != coap_req->token_len
+                     || memcmp(obs->token, coap_req->token,
+                               obs->token_len) != 0)) {
+            coap_res->code = BAD_REQUEST_4_00;
+            coap_set_payload(coap_res, "GroupToken", 10);
+            return;
+          }
+          if(obs == NULL) {
+            obs = add_observer(resource, &UIP_IP_BUF->destipaddr,
+                               UIP_UDP_BUF->srcport, coap_req->token,
+                               coap_req->token_len, coap_req->uri_path,
+                               coap_req->uri_path_len);
+            if(obs) {
+              obs->obs_counter = 0;
+            }
+          }
+          if(obs) {
+            add_member(obs, &UIP_IP_BUF->srcipaddr);
+            stimer_set(&obs->lease, COAP_GROUP_OBSERVE_LIFETIME);
+          }
+        } else
+#endif /* COAP_GROUP_OBSERVE */
+        obs = add_observer(resource, &UIP_IP_BUF->srcipaddr,
+                           UIP_UDP_BUF->srcport, coap_req->token,
+                           coap_req->token_len,
                            coap_req->uri_path, coap_req->uri_path_len);
        if(obs) {
           coap_set_header_observe(coap_res, (obs->obs_counter)++);
@@ -294,6 +631,27 @@ coap_observe_handler(resource_t *resource, void *request, void *response)
           coap_set_payload(coap_res, "TooManyObservers", 16);
         }
       } else if(coap_req->observe == 1) {
+#if COAP_GROUP_OBSERVE
+        if(uip_is_addr_mcast(&UIP_IP_BUF->destipaddr)) {
+          /* the group is only cancelled when its last member leaves */
+          obs = find_group_observer(resource, &UIP_IP_BUF->destipaddr,
+                                    UIP_UDP_BUF->srcport,
+                                    coap_req->uri_path,
+                                    coap_req->uri_path_len);
+          if(obs) {
+            coap_group_member_t *m = find_member(obs, &UIP_IP_BUF->srcipaddr);
+
+            if(m != NULL) {
+              remove_member(obs, m);
+            }
+            prune_members(obs);
+            if(list_head(obs->members) == NULL && !obs->untracked) {
+              coap_remove_observer(obs);
+            }
+          }
+          return;
+        }
+#endif /* COAP_GROUP_OBSERVE */
 
         /* remove client if it is currently observe */
         coap_remove_observer_by_token(&UIP_IP_BUF->srcipaddr,
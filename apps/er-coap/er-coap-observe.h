@@ -42,6 +42,7 @@
 #include "er-coap.h"
 #include "er-coap-transactions.h"
 #include "stimer.h"
+#include "sys/ctimer.h"
 
 #define COAP_OBSERVER_URL_LEN 20
 
@@ -53,6 +54,15 @@ typedef struct coap_observable {
   uint8_t buffer[COAP_MAX_PACKET_SIZE + 1];
 } coap_observable_t;
 
+#if COAP_GROUP_OBSERVE
+/* a member of a group observation, until it cancels or expires */
+typedef struct coap_group_member {
+  struct coap_group_member *next;
+  uip_ipaddr_t addr;
+  unsigned long expires;
+} coap_group_member_t;
+#endif /* COAP_GROUP_OBSERVE */
+
 typedef struct coap_observer {
   struct coap_observer *next;   /* for LIST */
 
@@ -65,10 +75,44 @@ typedef struct coap_observer {
 
   int32_t obs_counter;
 
-  struct etimer retrans_timer;
+  /* the observed resource, which lists its observers through sibling */
+  resource_t *resource;
+  struct coap_observer *sibling;
+
+  /* runs while a confirmable notification waits for its ACK, which is
+   * sent again from the shared notification buffer */
+  struct ctimer retrans_timer;
   uint8_t retrans_counter;
+
+#if COAP_GROUP_OBSERVE
+  /* for a multicast addr: expiry, the members by address, and whether
+   * some registered while the member table was full */
+  struct stimer lease;
+  LIST_STRUCT(members);
+  uint8_t untracked;
+#endif /* COAP_GROUP_OBSERVE */
 } coap_observer_t;
 
+#if COAP_OBSERVE_STATS
+typedef struct coap_observe_stats {
+  /* notifications sent to a single observer */
+  uint32_t unicast;
+  uint32_t unicast_bytes;
+  /* notifications sent to a group, once for all its members */
+  uint32_t group;
+  uint32_t group_bytes;
+  /* what the group notifications would have cost as unicast, estimated
+   * from the members that registered */
+  uint32_t group_members;
+  uint32_t group_members_bytes;
+} coap_observe_stats_t;
+
+extern coap_observe_stats_t coap_observe_stats;
+#define COAP_OBSERVE_STATS_ADD(x, v) coap_observe_stats.x += (v)
+#else
+#define COAP_OBSERVE_STATS_ADD(x, v)
+#endif /* COAP_OBSERVE_STATS */
+
 list_t coap_get_observers(void);
 void coap_remove_observer(coap_observer_t *o);
 int coap_remove_observer_by_client(uip_ipaddr_t *addr, uint16_t port);
@@ -78,6 +122,7 @@ int coap_remove_observer_by_uri(uip_ipaddr_t *addr, uint16_t port,
                                 const char *uri);
 int coap_remove_observer_by_mid(uip_ipaddr_t *addr, uint16_t port,
                                 uint16_t mid);
+void coap_observe_ack(uip_ipaddr_t *addr, uint16_t port, uint16_t mid);
 
 void coap_notify_observers(resource_t *resource);
 void coap_notify_observers_sub(resource_t *resource, const char *subpath);
@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *      CoAP forward proxy with a response cache.
+ *
+ *      GET responses are cached under their Max-Age and revalidated with
+ *      their ETag when stale. Concurrent requests for the same resource
+ *      wait for one upstream request. Entries that are hit often are
+ *      observed upstream, so they stay fresh without polling.
+ *
+ *      Only forward proxying is done, for requests that name the mesh
+ *      resource in a Proxy-Uri option; there is no reverse proxy mapping
+ *      local paths onto mesh resources. Of the request options, Accept is
+ *      forwarded and part of the cache key, If-Match and If-None-Match
+ *      are forwarded with other methods than GET, and Content-Format,
+ *      Block1 and Block2 as the transfer needs them. Others, such as
+ *      Observe, are not forwarded.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "er-coap-engine.h"
+#include "er-coap-separate.h"
+#include "er-coap-observe-client.h"
+#include "er-coap-proxy.h"
+#include "net/ip/uiplib.h"
+#include "sys/ctimer.h"
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+#define ENTRY_PENDING   0       /* upstream request outstanding */
+#define ENTRY_VALID     1       /* payload and options are cached */
+
+typedef struct coap_proxy_waiter {
+  struct coap_proxy_waiter *next;
+  coap_separate_t request;
+} coap_proxy_waiter_t;
+
+typedef struct coap_proxy_entry {
+  struct coap_proxy_entry *next;        /* for LIST, most recently used first */
+
+  uip_ipaddr_t addr;
+  uint16_t port;
+  char uri[COAP_PROXY_URI_LEN];
+  int32_t accept;       /* -1 if the requests have no Accept option */
+
+  uint8_t state;
+  uint8_t cacheable;    /* 0 for requests that are only forwarded */
+  uint8_t hits;
+  coap_proxy_waiter_t *waiters;
+#if COAP_OBSERVE_CLIENT
+  coap_observee_t *observee;
+#endif /* COAP_OBSERVE_CLIENT */
+
+  unsigned long expires;
+  uint8_t code;
+  uint8_t has_format;
+  unsigned int content_format;
+  uint8_t etag_len;
+  uint8_t etag[COAP_ETAG_LEN];
+  uint16_t payload_len;
+  uint8_t payload[COAP_PROXY_PAYLOAD_SIZE];
+} coap_proxy_entry_t;
+
+MEMB(entries_memb, coap_proxy_entry_t, COAP_PROXY_MAX_ENTRIES);
+LIST(entries_list);
+MEMB(waiters_memb, coap_proxy_waiter_t, COAP_PROXY_MAX_WAITERS);
+
+static uint16_t token_counter;
+#if COAP_OBSERVE_CLIENT
+static struct ctimer observe_timer;
+#endif /* COAP_OBSERVE_CLIENT */
+/*---------------------------------------------------------------------------*/
+static const char *
+entry_query(const coap_proxy_entry_t *e)
+{
+  return e->uri + strlen(e->uri) + 1;
+}
+/*---------------------------------------------------------------------------*/
+/* splits coap://[addr]:port/path?query, which is not 0-terminated */
+static int
+parse_proxy_uri(const char *uri, size_t len, uip_ipaddr_t *addr,
+                uint16_t *port, char *path)
+{
+  char host[40];
+  const char *end = uri + len;
+  const char *p;
+  size_t n;
+
+  if(len < 8 || strncmp(uri, "coap://[", 8) != 0) {
+    return 0;
+  }
+  uri += 8;
+  for(p = uri; p < end && *p != ']'; p++);
+  n = p - uri;
+  if(p == end || n >= sizeof(host)) {
+    return 0;
+  }
+  memcpy(host, uri, n);
+  host[n] = '\0';
+  if(!uiplib_ipaddrconv(host, addr)) {
+    return 0;
+  }
+
+  *port = COAP_DEFAULT_PORT;
+  if(++p < end && *p == ':') {
+    for(*port = 0, p++; p < end && *p >= '0' && *p <= '9'; p++) {
+      *port = *port * 10 + (*p - '0');
+    }
+  }
+  *port = UIP_HTONS(*port);
+
+  if(p < end && *p == '/') {
+    p++;
+  }
+  /* "path\0query\0", with '?' turned into the separator */
+  n = end - p;
+  if(n + 2 > COAP_PROXY_URI_LEN) {
+    return 0;
+  }
+  memcpy(path, p, n);
+  path[n] = '\0';
+  path[n + 1] = '\0';
+  for(p = path; *p != '\0' && *p != '?'; p++);
+  if(*p == '?') {
+    path[p - path] = '\0';
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static int
+same_uri(const char *a, const char *b)
+{
+  return strcmp(a, b) == 0 && strcmp(a + strlen(a) + 1, b + strlen(b) + 1) == 0;
+}
+/*---------------------------------------------------------------------------*/
+static int32_t
+request_accept(coap_packet_t *request)
+{
+  unsigned int accept;
+
+  return coap_get_header_accept(request, &accept) ? (int32_t)accept : -1;
+}
+/*---------------------------------------------------------------------------*/
+static coap_proxy_entry_t *
+find_entry(uip_ipaddr_t *addr, uint16_t port, const char *uri,
+           int32_t accept)
+{
+  coap_proxy_entry_t *e;
+
+  for(e = list_head(entries_list); e; e = e->next) {
+    if(e->cacheable && e->port == port && uip_ipaddr_cmp(&e->addr, addr)
+       && e->accept == accept && same_uri(e->uri, uri)) {
+      return e;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+free_entry(coap_proxy_entry_t *e)
+{
+#if COAP_OBSERVE_CLIENT
+  if(e->observee != NULL) {
+    coap_obs_remove_observee(e->observee);
+  }
+#endif /* COAP_OBSERVE_CLIENT */
+  list_remove(entries_list, e);
+  memb_free(&entries_memb, e);
+}
+/*---------------------------------------------------------------------------*/
+static coap_proxy_entry_t *
+new_entry(uip_ipaddr_t *addr, uint16_t port, const char *uri,
+          int32_t accept, int cacheable)
+{
+  coap_proxy_entry_t *e;
+  coap_proxy_entry_t *lru = NULL;
+
+  if((e = memb_alloc(&entries_memb)) == NULL) {
+    /* evict the least recently used entry nobody waits for */
+    for(e = list_head(entries_list); e; e = e->next) {
+      if(e->state == ENTRY_VALID) {
+        lru = e;
+      }
+    }
+    if(lru == NULL) {
+      return NULL;
+    }
+    PRINTF("Proxy: evicting /%s\n", lru->uri);
+    free_entry(lru);
+    e = memb_alloc(&entries_memb);
+  }
+
+  uip_ipaddr_copy(&e->addr, addr);
+  e->port = port;
+  memcpy(e->uri, uri, COAP_PROXY_URI_LEN);
+  e->accept = accept;
+  e->state = ENTRY_PENDING;
+  e->cacheable = cacheable;
+  e->hits = 0;
+  e->waiters = NULL;
+#if COAP_OBSERVE_CLIENT
+  e->observee = NULL;
+#endif /* COAP_OBSERVE_CLIENT */
+  e->etag_len = 0;
+  e->payload_len = 0;
+  list_push(entries_list, e);
+  return e;
+}
+/*---------------------------------------------------------------------------*/
+static void
+store_response(coap_proxy_entry_t *e, coap_packet_t *response)
+{
+  const uint8_t *etag;
+  uint32_t max_age;
+
+  coap_get_header_max_age(response, &max_age);
+  e->expires = clock_seconds() + max_age;
+
+  e->etag_len = coap_get_header_etag(response, &etag);
+  memcpy(e->etag, etag, e->etag_len);
+
+  /* a 2.03 only confirms what is cached */
+  if(response->code != VALID_2_03) {
+    e->code = response->code;
+    e->has_format = coap_get_header_content_format(response,
+                                                   &e->content_format);
+    e->payload_len = response->payload_len;
+    memcpy(e->payload, response->payload, response->payload_len);
+  }
+  e->state = ENTRY_VALID;
+}
+/*---------------------------------------------------------------------------*/
+static int
+cacheable_response(coap_proxy_entry_t *e, coap_packet_t *response)
+{
+  if(response->code == VALID_2_03) {
+    return e->state == ENTRY_VALID || e->payload_len > 0;
+  }
+  return response->code == CONTENT_2_05
+         && !IS_OPTION(response, COAP_OPTION_BLOCK2)
+         && response->payload_len <= COAP_PROXY_PAYLOAD_SIZE;
+}
+/*---------------------------------------------------------------------------*/
+/* fills a response from the cache, the payload is copied to buffer if
+ * given, which must hold it, or else serialized from the entry */
+static void
+cached_response(coap_proxy_entry_t *e, coap_packet_t *response,
+                uint8_t *buffer)
+{
+  unsigned long now = clock_seconds();
+
+  response->code = e->code;
+  if(e->has_format) {
+    coap_set_header_content_format(response, e->content_format);
+  }
+  if(e->etag_len) {
+    coap_set_header_etag(response, e->etag, e->etag_len);
+  }
+  coap_set_header_max_age(response, e->expires > now ? e->expires - now : 0);
+  if(buffer != NULL) {
+    memcpy(buffer, e->payload, e->payload_len);
+    coap_set_payload(response, buffer, e->payload_len);
+  } else {
+    coap_set_payload(response, e->payload, e->payload_len);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* answers the waiters of e from the cache, or with upstream if not cached */
+static void
+answer_waiters(coap_proxy_entry_t *e, coap_packet_t *upstream, uint8_t code)
+{
+  coap_proxy_waiter_t *w;
+  coap_transaction_t *t;
+  coap_transaction_t *answers[COAP_PROXY_MAX_WAITERS];
+  coap_packet_t response[1];
+  int i, n = 0;
+
+  /* all are serialized before the first is sent, as sending overwrites
+   * the upstream response in uip_buf */
+  while((w = e->waiters) != NULL) {
+    e->waiters = w->next;
+
+    if((t = coap_new_transaction(w->request.mid, &w->request.addr,
+                                 w->request.port))) {
+      coap_separate_resume(response, &w->request, code);
+      if(upstream != NULL) {
+        /* forwarded as it came */
+        const uint8_t *etag;
+        uint32_t num, max_age;
+        uint16_t size;
+        uint8_t more;
+        unsigned int format;
+
+        if(coap_get_header_content_format(upstream, &format)) {
+          coap_set_header_content_format(response, format);
+        }
+        if(IS_OPTION(upstream, COAP_OPTION_MAX_AGE)) {
+          coap_get_header_max_age(upstream, &max_age);
+          coap_set_header_max_age(response, max_age);
+        }
+        if(coap_get_header_etag(upstream, &etag)) {
+          coap_set_header_etag(response, etag, upstream->etag_len);
+        }
+        if(coap_get_header_block1(upstream, &num, &more, &size, NULL)) {
+          coap_set_header_block1(response, num, more, size);
+        }
+        if(coap_get_header_block2(upstream, &num, &more, &size, NULL)) {
+          coap_set_header_block2(response, num, more, size);
+        }
+        coap_set_payload(response, upstream->payload, upstream->payload_len);
+      } else if(e->state == ENTRY_VALID) {
+        cached_response(e, response, NULL);
+        response->code = code;
+      }
+      t->packet_len = coap_serialize_message(response, t->packet);
+      answers[n++] = t;
+    }
+    memb_free(&waiters_memb, w);
+  }
+
+  for(i = 0; i < n; i++) {
+    coap_send_transaction(answers[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+upstream_callback(void *callback_data, void *response)
+{
+  coap_proxy_entry_t *e = (coap_proxy_entry_t *)callback_data;
+  coap_packet_t *const res = (coap_packet_t *)response;
+
+  if(res == NULL) {
+    PRINTF("Proxy: /%s timed out\n", e->uri);
+    answer_waiters(e, NULL, GATEWAY_TIMEOUT_5_04);
+    free_entry(e);
+  } else if(e->cacheable && cacheable_response(e, res)) {
+    PRINTF("Proxy: caching /%s\n", e->uri);
+    store_response(e, res);
+    answer_waiters(e, NULL, e->code);
+  } else {
+    /* the waiters share one request only if it was cacheable, in which
+     * case they all get the same answer */
+    answer_waiters(e, res, res->code);
+    free_entry(e);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* serializes the request for e, the client request is forwarded if given */
+static coap_transaction_t *
+upstream_request(coap_proxy_entry_t *e, coap_packet_t *request)
+{
+  coap_packet_t upstream[1];
+  coap_transaction_t *t;
+  uint8_t token[2];
+  const char *query = entry_query(e);
+  const uint8_t *etag;
+  unsigned int format;
+
+  coap_init_message(upstream, COAP_TYPE_CON,
+                    request != NULL ? request->code : COAP_GET,
+                    coap_get_mid());
+  token_counter++;
+  token[0] = token_counter >> 8;
+  token[1] = token_counter;
+  coap_set_token(upstream, token, sizeof(token));
+  coap_set_header_uri_path(upstream, e->uri);
+  if(*query != '\0') {
+    coap_set_header_uri_query(upstream, query);
+  }
+
+  if(request != NULL) {
+    if(coap_get_header_content_format(request, &format)) {
+      coap_set_header_content_format(upstream, format);
+    }
+    if(coap_get_header_if_match(request, &etag)) {
+      coap_set_header_if_match(upstream, etag, request->if_match_len);
+    }
+    if(coap_get_header_if_none_match(request)) {
+      coap_set_header_if_none_match(upstream);
+    }
+    if(IS_OPTION(request, COAP_OPTION_BLOCK1)) {
+      coap_set_header_block1(upstream, request->block1_num,
+                             request->block1_more, request->block1_size);
+    }
+    if(IS_OPTION(request, COAP_OPTION_BLOCK2)) {
+      coap_set_header_block2(upstream, request->block2_num, 0,
+                             request->block2_size);
+    }
+    coap_set_payload(upstream, request->payload, request->payload_len);
+  } else if(e->state == ENTRY_VALID && e->etag_len > 0) {
+    /* stale: ask whether the cached representation is still current */
+    coap_set_header_etag(upstream, e->etag, e->etag_len);
+  }
+  if(e->accept >= 0) {
+    coap_set_header_accept(upstream, e->accept);
+  }
+
+  if((t = coap_new_transaction(upstream->mid, &e->addr, e->port))) {
+    t->callback = upstream_callback;
+    t->callback_data = e;
+    t->packet_len = coap_serialize_message(upstream, t->packet);
+  }
+  return t;
+}
+/*---------------------------------------------------------------------------*/
+#if COAP_OBSERVE_CLIENT
+static void
+notification_callback(coap_observee_t *obs, void *notification,
+                      coap_notification_flag_t flag)
+{
+  coap_proxy_entry_t *e = (coap_proxy_entry_t *)obs->data;
+
+  if((flag == OBSERVE_OK || flag == NOTIFICATION_OK)
+     && cacheable_response(e, notification)) {
+    PRINTF("Proxy: /%s notified\n", e->uri);
+    store_response(e, notification);
+    if(e->waiters != NULL) {
+      answer_waiters(e, NULL, e->code);
+    }
+  } else if(flag != NOTIFICATION_OK) {
+    /* registration failed and is removed by the observe client */
+    e->observee = NULL;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* registers outside of the request handler, which still needs uip_buf */
+static void
+observe_hot_entries(void *ptr)
+{
+  coap_proxy_entry_t *e;
+
+  for(e = list_head(entries_list); e; e = e->next) {
+    if(e->cacheable && e->state == ENTRY_VALID && e->observee == NULL
+       && e->hits >= COAP_PROXY_HOT_HITS && *entry_query(e) == '\0'
+       && e->accept < 0) {
+      PRINTF("Proxy: observing /%s\n", e->uri);
+      e->observee = coap_obs_request_registration(&e->addr, e->port, e->uri,
+                                                  notification_callback, e);
+      if(e->observee == NULL) {
+        /* try again with the next hit */
+        e->hits = 0;
+      }
+    }
+  }
+}
+#endif /* COAP_OBSERVE_CLIENT */
+/*---------------------------------------------------------------------------*/
+static int
+proxy_service(void *request, void *response, uint8_t *buffer,
+              uint16_t buffer_size, int32_t *offset)
+{
+  coap_packet_t *const req = (coap_packet_t *)request;
+  coap_packet_t *const res = (coap_packet_t *)response;
+  coap_proxy_entry_t *e = NULL;
+  coap_proxy_entry_t *next;
+  coap_proxy_waiter_t *w;
+  coap_transaction_t *t = NULL;
+  uip_ipaddr_t addr;
+  uint16_t port;
+  char uri[COAP_PROXY_URI_LEN];
+  const uint8_t *etag;
+  int32_t accept;
+  int cacheable;
+
+  if(!IS_OPTION(req, COAP_OPTION_PROXY_URI)) {
+    return rest_invoke_restful_service(request, response, buffer,
+                                       buffer_size, offset);
+  }
+
+  if(!parse_proxy_uri(req->proxy_uri, req->proxy_uri_len, &addr, &port,
+                      uri)) {
+    res->code = PROXYING_NOT_SUPPORTED_5_05;
+    coap_set_payload(res, "OnlyCoapIPv6", 12);
+    return 1;
+  }
+
+  if(req->payload_len > REST_MAX_CHUNK_SIZE) {
+    res->code = REQUEST_ENTITY_TOO_LARGE_4_13;
+    coap_set_header_size1(res, REST_MAX_CHUNK_SIZE);
+    return 1;
+  }
+
+  accept = request_accept(req);
+  cacheable = req->code == COAP_GET
+    && !IS_OPTION(req, COAP_OPTION_BLOCK1)
+    && !IS_OPTION(req, COAP_OPTION_BLOCK2);
+
+  if(cacheable) {
+    e = find_entry(&addr, port, uri, accept);
+    /* a payload larger than buffer is served by revalidating instead */
+    if(e != NULL && e->state == ENTRY_VALID
+       && clock_seconds() < e->expires && e->payload_len <= buffer_size) {
+      PRINTF("Proxy: hit /%s\n", e->uri);
+      list_remove(entries_list, e);
+      list_push(entries_list, e);
+      if(e->hits < 255) {
+        e->hits++;
+      }
+#if COAP_OBSERVE_CLIENT
+      if(e->hits == COAP_PROXY_HOT_HITS && e->observee == NULL) {
+        ctimer_set(&observe_timer, 0, observe_hot_entries, NULL);
+      }
+#endif /* COAP_OBSERVE_CLIENT */
+
+      cached_response(e, res, buffer);
+      if(e->etag_len > 0 && coap_get_header_etag(req, &etag) == e->etag_len
+         && memcmp(etag, e->etag, e->etag_len) == 0) {
+        res->code = VALID_2_03;
+        coap_set_payload(res, NULL, 0);
+      }
+      return 1;
+    }
+  } else if(req->code != COAP_GET) {
+    /* an unsafe method may change what is cached, in any format */
+    for(e = list_head(entries_list); e; e = next) {
+      next = e->next;
+      if(e->cacheable && e->state == ENTRY_VALID && e->port == port
+         && uip_ipaddr_cmp(&e->addr, &addr) && same_uri(e->uri, uri)) {
+        free_entry(e);
+      }
+    }
+    e = NULL;
+  }
+
+  if((w = memb_alloc(&waiters_memb)) == NULL) {
+    res->code = SERVICE_UNAVAILABLE_5_03;
+    coap_set_payload(res, "ProxyBusy", 9);
+    return 1;
+  }
+
+  if(cacheable && e != NULL) {
+    /* pending requests share the upstream one, stale ones revalidate */
+    if(e->state == ENTRY_VALID) {
+      PRINTF("Proxy: revalidating /%s\n", e->uri);
+      t = upstream_request(e, NULL);
+      if(t != NULL) {
+        e->state = ENTRY_PENDING;
+      }
+    }
+  } else if((e = new_entry(&addr, port, uri, accept, cacheable)) != NULL) {
+    PRINTF("Proxy: miss /%s\n", e->uri);
+    t = upstream_request(e, cacheable ? NULL : req);
+    if(t == NULL) {
+      free_entry(e);
+      e = NULL;
+    }
+  }
+
+  if(e == NULL || (e->state == ENTRY_VALID && t == NULL)) {
+    memb_free(&waiters_memb, w);
+    res->code = SERVICE_UNAVAILABLE_5_03;
+    coap_set_payload(res, "ProxyBusy", 9);
+    return 1;
+  }
+
+  /* the upstream request is serialized, so req may be overwritten now */
+  coap_separate_accept(request, &w->request);
+  if(erbium_status_code != MANUAL_RESPONSE) {
+    memb_free(&waiters_memb, w);
+    coap_clear_transaction(t);
+    if(e->waiters == NULL && e->state == ENTRY_PENDING) {
+      free_entry(e);
+    }
+    return 1;
+  }
+  w->next = e->waiters;
+  e->waiters = w;
+
+  if(t != NULL) {
+    coap_send_transaction(t);
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+void
+coap_proxy_init(void)
+{
+  memb_init(&entries_memb);
+  memb_init(&waiters_memb);
+  list_init(entries_list);
+
+  REST.set_service_callback(proxy_service);
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *      CoAP forward proxy with a response cache.
+ */
+
+#ifndef COAP_PROXY_H_
+#define COAP_PROXY_H_
+
+#include "er-coap.h"
+
+#ifdef COAP_PROXY_CONF_MAX_ENTRIES
+#define COAP_PROXY_MAX_ENTRIES      COAP_PROXY_CONF_MAX_ENTRIES
+#else
+#define COAP_PROXY_MAX_ENTRIES      4
+#endif /* COAP_PROXY_CONF_MAX_ENTRIES */
+
+/* Requests waiting for an upstream response, over all entries. */
+#ifdef COAP_PROXY_CONF_MAX_WAITERS
+#define COAP_PROXY_MAX_WAITERS      COAP_PROXY_CONF_MAX_WAITERS
+#else
+#define COAP_PROXY_MAX_WAITERS      4
+#endif /* COAP_PROXY_CONF_MAX_WAITERS */
+
+/* Path and query of a cached resource, stored as "path\0query". */
+#ifdef COAP_PROXY_CONF_URI_LEN
+#define COAP_PROXY_URI_LEN          COAP_PROXY_CONF_URI_LEN
+#else
+#define COAP_PROXY_URI_LEN          32
+#endif /* COAP_PROXY_CONF_URI_LEN */
+
+#ifdef COAP_PROXY_CONF_PAYLOAD_SIZE
+#define COAP_PROXY_PAYLOAD_SIZE     COAP_PROXY_CONF_PAYLOAD_SIZE
+#else
+#define COAP_PROXY_PAYLOAD_SIZE     REST_MAX_CHUNK_SIZE
+#endif /* COAP_PROXY_CONF_PAYLOAD_SIZE */
+
+/* Cache hits after which an entry is kept fresh by observing upstream. */
+#ifdef COAP_PROXY_CONF_HOT_HITS
+#define COAP_PROXY_HOT_HITS         COAP_PROXY_CONF_HOT_HITS
+#else
+#define COAP_PROXY_HOT_HITS         3
+#endif /* COAP_PROXY_CONF_HOT_HITS */
+
+/**
+ * \brief Serves requests with a Proxy-Uri option
+ *
+ * To be called after rest_init_engine(). Requests without Proxy-Uri still
+ * go to the local resources. Needs COAP_PROXY_OPTION_PROCESSING.
+ */
+void coap_proxy_init(void);
+
+#endif /* COAP_PROXY_H_ */
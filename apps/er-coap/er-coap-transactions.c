@@ -59,6 +59,134 @@ LIST(transactions_list);
 
 static struct process *transaction_handler_process = NULL;
 
+#if COAP_COCOA
+MEMB(destinations_memb, coap_destination_t, COAP_MAX_DESTINATIONS);
+LIST(destinations_list);
+#endif /* COAP_COCOA */
+
+#if COAP_COCOA_STATS
+coap_cocoa_stats_t coap_cocoa_stats;
+#endif /* COAP_COCOA_STATS */
+
+#if COAP_COCOA
+/*---------------------------------------------------------------------------*/
+/*- Round trip time estimation ----------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+static coap_destination_t *
+get_destination(uip_ipaddr_t *addr)
+{
+  coap_destination_t *d = NULL;
+  coap_destination_t *idle = NULL;
+  clock_time_t now = clock_time();
+
+  for(d = (coap_destination_t *)list_head(destinations_list); d;
+      d = d->next) {
+    if(uip_ipaddr_cmp(&d->addr, addr)) {
+      break;
+    }
+    if(d->in_flight == 0) {
+      idle = d;
+    }
+  }
+
+  if(d == NULL) {
+    /* replace the least recently used one that nothing waits for */
+    if((d = memb_alloc(&destinations_memb)) == NULL) {
+      if((d = idle) == NULL) {
+        return NULL;
+      }
+      list_remove(destinations_list, d);
+    }
+    uip_ipaddr_copy(&d->addr, addr);
+    d->srtt_strong = d->rttvar_strong = 0;
+    d->srtt_weak = d->rttvar_weak = 0;
+    d->rto = COAP_COCOA_INITIAL_RTO * CLOCK_SECOND;
+    d->updated = now;
+    d->in_flight = 0;
+  } else {
+    list_remove(destinations_list, d);
+
+    /* let estimates that were not updated for long drift back */
+    if(d->rto < CLOCK_SECOND && now - d->updated > 16 * d->rto) {
+      d->rto <<= 1;
+      d->updated = now;
+    } else if(d->rto > 3 * CLOCK_SECOND && now - d->updated > 4 * d->rto) {
+      d->rto = CLOCK_SECOND + d->rto / 2;
+      d->updated = now;
+    }
+  }
+  list_push(destinations_list, d);
+
+  return d;
+}
+/*---------------------------------------------------------------------------*/
+static clock_time_t
+estimate(clock_time_t *srtt, clock_time_t *rttvar, clock_time_t rtt, int k)
+{
+  uint32_t delta;
+
+  if(*srtt == 0) {
+    *srtt = rtt;
+    *rttvar = rtt / 2;
+  } else {
+    delta = *srtt > rtt ? *srtt - rtt : rtt - *srtt;
+    *rttvar = (3 * (uint32_t)*rttvar + delta) / 4;
+    *srtt = (7 * (uint32_t)*srtt + rtt) / 8;
+  }
+  return *srtt + k * *rttvar;
+}
+/*---------------------------------------------------------------------------*/
+void
+coap_update_rto(coap_transaction_t *t)
+{
+  coap_destination_t *d = t->destination;
+  clock_time_t now = clock_time();
+  uint32_t rto;
+
+  if(d == NULL) {
+    return;
+  }
+
+  if(t->retrans_counter > 0 && d->srtt_strong > 0
+     && now - t->last_sent < d->srtt_strong / 2) {
+    /* too fast to answer the last copy, an earlier one got through */
+    PRINTF("Spurious retransmission of %u\n", t->mid);
+    COAP_COCOA_STATS_ADD(spurious);
+  }
+
+  if(t->retrans_counter == 0) {
+    /* strong estimator, RTO = SRTT + 4 * RTTVAR, weighs 1/2 */
+    rto = estimate(&d->srtt_strong, &d->rttvar_strong,
+                   now - t->first_sent, 4);
+    rto = (d->rto + rto) / 2;
+    COAP_COCOA_STATS_ADD(strong);
+  } else if(t->retrans_counter <= 2) {
+    /* weak estimator from the first transmission, RTO = SRTT + RTTVAR,
+     * weighs 1/4 */
+    rto = estimate(&d->srtt_weak, &d->rttvar_weak,
+                   now - t->first_sent, 1);
+    rto = (3 * (uint32_t)d->rto + rto) / 4;
+    COAP_COCOA_STATS_ADD(weak);
+  } else {
+    return;
+  }
+
+  if(rto > COAP_COCOA_MAX_RTO * CLOCK_SECOND) {
+    rto = COAP_COCOA_MAX_RTO * CLOCK_SECOND;
+  } else if(rto == 0) {
+    rto = 1;
+  }
+  d->rto = rto;
+  d->updated = now;
+  PRINTF("RTO %lu ticks\n", (unsigned long)d->rto);
+}
+#else /* COAP_COCOA */
+void
+coap_update_rto(coap_transaction_t *t)
+{
+}
+#endif /* COAP_COCOA */
+
 /*---------------------------------------------------------------------------*/
 /*- Internal API ------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -75,6 +203,10 @@ coap_new_transaction(uint16_t mid, uip_ipaddr_t *addr, uint16_t port)
   if(t) {
     t->mid = mid;
     t->retrans_counter = 0;
+#if COAP_COCOA
+    t->destination = NULL;
+    t->queued = 0;
+#endif /* COAP_COCOA */
 
     /* save client address */
     uip_ipaddr_copy(&t->addr, addr);
@@ -89,16 +221,74 @@ coap_new_transaction(uint16_t mid, uip_ipaddr_t *addr, uint16_t port)
 void
 coap_send_transaction(coap_transaction_t *t)
 {
+  uint8_t confirmable = COAP_TYPE_CON ==
+    ((COAP_HEADER_TYPE_MASK & t->packet[0]) >> COAP_HEADER_TYPE_POSITION);
+
+#if COAP_COCOA
+  if(confirmable && t->retrans_counter == 0 && t->destination == NULL) {
+    coap_destination_t *d = get_destination(&t->addr);
+
+    if(d != NULL && d->in_flight >= COAP_NSTART) {
+      /* sent when one of the outstanding ones is done */
+      PRINTF("Queueing transaction %u\n", t->mid);
+      COAP_COCOA_STATS_ADD(queued);
+      t->queued = 1;
+      return;
+    }
+    if(d != NULL) {
+      d->in_flight++;
+    }
+    t->destination = d;
+    t->queued = 0;
+    t->first_sent = clock_time();
+  }
+  t->last_sent = clock_time();
+#endif /* COAP_COCOA */
+
   PRINTF("Sending transaction %u\n", t->mid);
 
   coap_send_message(&t->addr, t->port, t->packet, t->packet_len);
 
-  if(COAP_TYPE_CON ==
-     ((COAP_HEADER_TYPE_MASK & t->packet[0]) >> COAP_HEADER_TYPE_POSITION)) {
+  if(confirmable) {
+    if(t->retrans_counter == 0) {
+      COAP_COCOA_STATS_ADD(transmissions);
+    } else {
+      COAP_COCOA_STATS_ADD(retransmissions);
+    }
+
     if(t->retrans_counter < COAP_MAX_RETRANSMIT) {
       /* not timed out yet */
       PRINTF("Keeping transaction %u\n", t->mid);
 
+#if COAP_FIXED_RETRANSMIT_INTERVAL
+      t->retrans_timer.timer.interval = COAP_FIXED_RETRANSMIT_INTERVAL;
+#else /* COAP_FIXED_RETRANSMIT_INTERVAL */
+#if COAP_COCOA
+      if(t->destination != NULL) {
+        clock_time_t rto = t->destination->rto;
+
+        if(t->retrans_counter == 0) {
+          /* RTO to 1.5 RTO */
+          t->retrans_timer.timer.interval =
+            rto + random_rand() % (rto / 2 + 1);
+        } else if(rto < CLOCK_SECOND) {
+          /* variable backoff: faster for short, slower for long RTOs */
+          t->retrans_timer.timer.interval *= 3;
+        } else if(rto > 3 * CLOCK_SECOND) {
+          t->retrans_timer.timer.interval +=
+            t->retrans_timer.timer.interval / 2;
+        } else {
+          t->retrans_timer.timer.interval <<= 1;
+        }
+        if(t->retrans_timer.timer.interval
+           > COAP_COCOA_MAX_RTO * CLOCK_SECOND) {
+          t->retrans_timer.timer.interval = COAP_COCOA_MAX_RTO * CLOCK_SECOND;
+        }
+        PRINTF("Interval %lu ticks (%u)\n",
+               (unsigned long)t->retrans_timer.timer.interval,
+               t->retrans_counter);
+      } else
+#endif /* COAP_COCOA */
       if(t->retrans_counter == 0) {
         t->retrans_timer.timer.interval =
           COAP_RESPONSE_TIMEOUT_TICKS + (random_rand()
@@ -112,6 +302,7 @@ coap_send_transaction(coap_transaction_t *t)
         PRINTF("Doubled (%u) interval %f\n", t->retrans_counter,
                (float)t->retrans_timer.timer.interval / CLOCK_SECOND);
       }
+#endif /* COAP_FIXED_RETRANSMIT_INTERVAL */
 
       PROCESS_CONTEXT_BEGIN(transaction_handler_process);
       etimer_restart(&t->retrans_timer);        /* interval updated above */
@@ -121,6 +312,7 @@ coap_send_transaction(coap_transaction_t *t)
     } else {
       /* timed out */
       PRINTF("Timeout\n");
+      COAP_COCOA_STATS_ADD(timeouts);
       restful_response_handler callback = t->callback;
       void *callback_data = t->callback_data;
 
@@ -138,15 +330,63 @@ coap_send_transaction(coap_transaction_t *t)
   }
 }
 /*---------------------------------------------------------------------------*/
+static void
+send_deferred(void *ptr)
+{
+  coap_send_transaction((coap_transaction_t *)ptr);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Send the transaction at a random point within the leisure instead of
+ * right away, so that the members of a group do not all answer a
+ * multicast request at once (RFC 7252, section 8.2). The calling
+ * process keeps running meanwhile.
+ */
+void
+coap_defer_transaction(coap_transaction_t *t, clock_time_t leisure)
+{
+  clock_time_t delay = 0;
+
+  if(leisure > 0) {
+    delay = random_rand() % leisure;
+  }
+  PRINTF("Deferring transaction %u by %lu ticks\n", t->mid,
+         (unsigned long)delay);
+  ctimer_set(&t->defer_timer, delay, send_deferred, t);
+}
+/*---------------------------------------------------------------------------*/
 void
 coap_clear_transaction(coap_transaction_t *t)
 {
   if(t) {
     PRINTF("Freeing transaction %u: %p\n", t->mid, t);
 
+#if COAP_COCOA
+    coap_destination_t *d = t->destination;
+#endif /* COAP_COCOA */
+
     etimer_stop(&t->retrans_timer);
+    ctimer_stop(&t->defer_timer);
     list_remove(transactions_list, t);
     memb_free(&transactions_memb, t);
+
+#if COAP_COCOA
+    if(d != NULL) {
+      coap_transaction_t *q = NULL;
+
+      d->in_flight--;
+
+      /* the oldest one queued for the same destination goes next */
+      for(q = (coap_transaction_t *)list_head(transactions_list); q;
+          q = q->next) {
+        if(q->queued && uip_ipaddr_cmp(&q->addr, &d->addr)) {
+          q->queued = 0;
+          coap_send_transaction(q);
+          break;
+        }
+      }
+    }
+#endif /* COAP_COCOA */
   }
 }
 coap_transaction_t *
@@ -169,6 +409,11 @@ coap_check_transactions()
   coap_transaction_t *t = NULL;
 
   for(t = (coap_transaction_t *)list_head(transactions_list); t; t = t->next) {
+#if COAP_COCOA
+    if(t->queued) {
+      continue;
+    }
+#endif /* COAP_COCOA */
     if(etimer_expired(&t->retrans_timer)) {
       ++(t->retrans_counter);
       PRINTF("Retransmitting %u (%u)\n", t->mid, t->retrans_counter);
@@ -48,6 +48,45 @@
 #define COAP_RESPONSE_TIMEOUT_TICKS         (CLOCK_SECOND * COAP_RESPONSE_TIMEOUT)
 #define COAP_RESPONSE_TIMEOUT_BACKOFF_MASK  (long)((CLOCK_SECOND * COAP_RESPONSE_TIMEOUT * ((float)COAP_RESPONSE_RANDOM_FACTOR - 1.0)) + 0.5) + 1
 
+#if COAP_COCOA
+/* initial and maximum retransmission timeouts, in seconds */
+#define COAP_COCOA_INITIAL_RTO              2
+#define COAP_COCOA_MAX_RTO                  32
+
+/* round trip time estimate for a destination */
+typedef struct coap_destination {
+  struct coap_destination *next;        /* for LIST */
+
+  uip_ipaddr_t addr;
+  /* strong estimator from unambiguous samples, weak from retransmitted
+   * messages, both in clock ticks and 0 before the first sample */
+  clock_time_t srtt_strong;
+  clock_time_t rttvar_strong;
+  clock_time_t srtt_weak;
+  clock_time_t rttvar_weak;
+  clock_time_t rto;
+  clock_time_t updated;
+  uint8_t in_flight;
+} coap_destination_t;
+#endif /* COAP_COCOA */
+
+#if COAP_COCOA_STATS
+typedef struct coap_cocoa_stats {
+  uint32_t transmissions;
+  uint32_t retransmissions;
+  uint32_t spurious;    /* answered too soon after a retransmission to be its answer */
+  uint32_t timeouts;
+  uint32_t strong;      /* estimator updates */
+  uint32_t weak;
+  uint32_t queued;      /* held back by COAP_NSTART */
+} coap_cocoa_stats_t;
+
+extern coap_cocoa_stats_t coap_cocoa_stats;
+#define COAP_COCOA_STATS_ADD(x) coap_cocoa_stats.x++
+#else
+#define COAP_COCOA_STATS_ADD(x)
+#endif /* COAP_COCOA_STATS */
+
 /* container for transactions with message buffer and retransmission info */
 typedef struct coap_transaction {
   struct coap_transaction *next;        /* for LIST */
@@ -55,6 +94,14 @@ typedef struct coap_transaction {
   uint16_t mid;
   struct etimer retrans_timer;
   uint8_t retrans_counter;
+  struct ctimer defer_timer;            /* leisure before the first send */
+
+#if COAP_COCOA
+  coap_destination_t *destination;      /* set while counted as in flight */
+  clock_time_t first_sent;
+  clock_time_t last_sent;
+  uint8_t queued;
+#endif /* COAP_COCOA */
 
   uip_ipaddr_t addr;
   uint16_t port;
@@ -73,7 +120,9 @@ coap_transaction_t *coap_new_transaction(uint16_t mid, uip_ipaddr_t *addr,
                                          uint16_t port);
 void coap_send_transaction(coap_transaction_t *t);
 void coap_clear_transaction(coap_transaction_t *t);
+void coap_defer_transaction(coap_transaction_t *t, clock_time_t leisure);
 coap_transaction_t *coap_get_transaction_by_mid(uint16_t mid);
+void coap_update_rto(coap_transaction_t *t);
 
 void coap_check_transactions(void);
 
@@ -44,6 +44,9 @@
 
 #include "er-coap.h"
 #include "er-coap-transactions.h"
+#if WITH_OSCOAP
+#include "er-oscoap.h"
+#endif
 
 #define DEBUG 0
 #if DEBUG
@@ -57,6 +60,17 @@
 #define PRINTLLADDR(addr)
 #endif
 
+/*
+ * A signature in the Object-Security option takes the header past
+ * COAP_MAX_HEADER_SIZE, so signed messages are only bounded by the
+ * packet size.
+ */
+#if COAP_SIGNATURE_SIZE
+#define COAP_SERIALIZED_HEADER_MAX COAP_MAX_PACKET_SIZE
+#else
+#define COAP_SERIALIZED_HEADER_MAX COAP_MAX_HEADER_SIZE
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*- Variables ---------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -68,7 +82,7 @@ char *coap_error_message = "";
 /*---------------------------------------------------------------------------*/
 /*- Local helper functions --------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-static uint16_t
+uint16_t
 coap_log_2(uint16_t value)
 {
   uint16_t result = 0;
@@ -81,7 +95,7 @@ coap_log_2(uint16_t value)
   return result ? result - 1 : result;
 }
 /*---------------------------------------------------------------------------*/
-static uint32_t
+uint32_t
 coap_parse_int_option(uint8_t *bytes, size_t length)
 {
   uint32_t var = 0;
@@ -132,7 +146,7 @@ coap_set_option_header(unsigned int delta, size_t length, uint8_t *buffer)
   return ++written;
 }
 /*---------------------------------------------------------------------------*/
-static size_t
+size_t
 coap_serialize_int_option(unsigned int number, unsigned int current_number,
                           uint8_t *buffer, uint32_t value)
 {
@@ -170,7 +184,7 @@ coap_serialize_int_option(unsigned int number, unsigned int current_number,
   return i;
 }
 /*---------------------------------------------------------------------------*/
-static size_t
+size_t
 coap_serialize_array_option(unsigned int number, unsigned int current_number,
                             uint8_t *buffer, uint8_t *array, size_t length,
                             char split_char)
@@ -217,7 +231,7 @@ coap_serialize_array_option(unsigned int number, unsigned int current_number,
   return i;
 }
 /*---------------------------------------------------------------------------*/
-static void
+void
 coap_merge_multi_option(char **dst, size_t *dst_len, uint8_t *option,
                         size_t option_len, char separator)
 {
@@ -307,8 +321,25 @@ coap_init_message(void *packet, coap_message_type_t type, uint8_t code,
   coap_pkt->mid = mid;
 }
 /*---------------------------------------------------------------------------*/
+#if WITH_OSCOAP
+size_t
+coap_serialize_message(void *packet, uint8_t *buffer)
+{
+  coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+
+  /* protected messages are serialized by OSCOAP, which calls back */
+  if(IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)) {
+    return oscoap_prepare_message(packet, buffer);
+  }
+  return coap_serialize_message_coap(packet, buffer);
+}
+/*---------------------------------------------------------------------------*/
+size_t
+coap_serialize_message_coap(void *packet, uint8_t *buffer)
+#else /* WITH_OSCOAP */
 size_t
 coap_serialize_message(void *packet, uint8_t *buffer)
+#endif /* WITH_OSCOAP */
 {
   coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
   uint8_t *option;
@@ -379,6 +410,10 @@ coap_serialize_message(void *packet, uint8_t *buffer)
   COAP_SERIALIZE_INT_OPTION(COAP_OPTION_ACCEPT, accept, "Accept");
   COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_LOCATION_QUERY, location_query,
                                '&', "Location-Query");
+#if WITH_OSCOAP
+  COAP_SERIALIZE_BYTE_OPTION(COAP_OPTION_OBJECT_SECURITY, object_security,
+                             "Object-Security");
+#endif /* WITH_OSCOAP */
   COAP_SERIALIZE_BLOCK_OPTION(COAP_OPTION_BLOCK2, block2, "Block2");
   COAP_SERIALIZE_BLOCK_OPTION(COAP_OPTION_BLOCK1, block1, "Block1");
   COAP_SERIALIZE_INT_OPTION(COAP_OPTION_SIZE2, size2, "Size2");
@@ -391,7 +426,7 @@ coap_serialize_message(void *packet, uint8_t *buffer)
   PRINTF("-Done serializing at %p----\n", option);
 
   /* Pack payload */
-  if((option - coap_pkt->buffer) <= COAP_MAX_HEADER_SIZE) {
+  if((option - coap_pkt->buffer) <= COAP_SERIALIZED_HEADER_MAX) {
     /* Payload marker */
     if(coap_pkt->payload_len) {
       *option = 0xFF;
@@ -494,7 +529,12 @@ coap_parse_message(void *packet, uint8_t *data, uint16_t data_len)
       coap_pkt->payload_len = data_len - (coap_pkt->payload - data);
 
       /* also for receiving, the Erbium upper bound is REST_MAX_CHUNK_SIZE */
-      if(coap_pkt->payload_len > REST_MAX_CHUNK_SIZE) {
+      if(coap_pkt->payload_len > REST_MAX_CHUNK_SIZE
+#if WITH_OSCOAP
+         /* a COSE object is bounded when it is decrypted */
+         && !IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)
+#endif /* WITH_OSCOAP */
+         ) {
         coap_pkt->payload_len = REST_MAX_CHUNK_SIZE;
         /* null-terminate payload */
       }
@@ -679,6 +719,13 @@ coap_parse_message(void *packet, uint8_t *data, uint16_t data_len)
       coap_pkt->size1 = coap_parse_int_option(current_option, option_length);
       PRINTF("Size1 [%lu]\n", (unsigned long)coap_pkt->size1);
       break;
+#if WITH_OSCOAP
+    case COAP_OPTION_OBJECT_SECURITY:
+      coap_pkt->object_security = current_option;
+      coap_pkt->object_security_len = option_length;
+      PRINTF("Object-Security [%zu B]\n", option_length);
+      break;
+#endif /* WITH_OSCOAP */
     default:
       PRINTF("unknown (%u)\n", option_number);
       /* check if critical (odd) */
@@ -692,6 +739,16 @@ coap_parse_message(void *packet, uint8_t *data, uint16_t data_len)
   }                             /* for */
   PRINTF("-Done parsing-------\n");
 
+#if WITH_OSCOAP
+  if(IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)) {
+    /* the COSE object is in the option or, with a payload, in the payload */
+    if(coap_pkt->object_security_len == 0 && coap_pkt->payload_len == 0) {
+      return OSCOAP_MALFORMED_PACKET;
+    }
+    return oscoap_decode_packet(coap_pkt);
+  }
+#endif /* WITH_OSCOAP */
+
   return NO_ERROR;
 }
 /*---------------------------------------------------------------------------*/
@@ -1183,6 +1240,37 @@ coap_set_header_size1(void *packet, uint32_t size)
   SET_OPTION(coap_pkt, COAP_OPTION_SIZE1);
   return 1;
 }
+#if WITH_OSCOAP
+/*---------------------------------------------------------------------------*/
+int
+coap_set_header_object_security(void *packet)
+{
+  coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+
+  /* the option is filled in with the COSE object when it is serialized */
+  coap_pkt->object_security_len = 0;
+  coap_pkt->object_security = NULL;
+  SET_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+int
+coap_set_object_security_payload(void *packet, const uint8_t *os,
+                                 size_t os_len)
+{
+  coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+
+  if(!IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)) {
+    return 0;
+  }
+  /* the COSE object goes in the payload, the option stays empty */
+  coap_pkt->payload = (uint8_t *)os;
+  coap_pkt->payload_len = os_len;
+  coap_pkt->object_security = NULL;
+  coap_pkt->object_security_len = 0;
+  return coap_pkt->payload_len;
+}
+#endif /* WITH_OSCOAP */
 /*---------------------------------------------------------------------------*/
 int
 coap_get_payload(void *packet, const uint8_t **payload)
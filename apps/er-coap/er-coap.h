@@ -44,8 +44,19 @@
 #include "er-coap-constants.h"
 #include "er-coap-conf.h"
 
+#if WITH_OSCOAP
+#include "er-oscoap-int.h"
+#endif
+
+/* room for a 64 byte COSE countersignature with its CBOR head */
+#if WITH_OSCOAP && OSCOAP_SIGN != OSCOAP_SIGN_NONE
+#define COAP_SIGNATURE_SIZE   66
+#else
+#define COAP_SIGNATURE_SIZE   0
+#endif
+
 /* sanity check for configured values */
-#define COAP_MAX_PACKET_SIZE  (COAP_MAX_HEADER_SIZE + REST_MAX_CHUNK_SIZE)
+#define COAP_MAX_PACKET_SIZE  (COAP_MAX_HEADER_SIZE + REST_MAX_CHUNK_SIZE + COAP_SIGNATURE_SIZE)
 #if COAP_MAX_PACKET_SIZE > (UIP_BUFSIZE - UIP_IPH_LEN - UIP_UDPH_LEN)
 #error "UIP_CONF_BUFFER_SIZE too small for REST_MAX_CHUNK_SIZE"
 #endif
@@ -128,6 +139,13 @@ typedef struct {
   const char *uri_query;
   uint8_t if_none_match;
 
+#if WITH_OSCOAP
+  size_t object_security_len;
+  uint8_t *object_security;
+  uip_ipaddr_t *ipaddr;         /* destination of a request, for the AAD */
+  OSCOAP_COMMON_CONTEXT *context;       /* protects the message if set */
+#endif /* WITH_OSCOAP */
+
   uint16_t payload_len;
   uint8_t *payload;
 } coap_packet_t;
@@ -260,4 +278,29 @@ int coap_set_header_size1(void *packet, uint32_t size);
 int coap_get_payload(void *packet, const uint8_t **payload);
 int coap_set_payload(void *packet, const void *payload, size_t length);
 
+#if WITH_OSCOAP
+/* serialization without the OSCOAP protection */
+size_t coap_serialize_message_coap(void *packet, uint8_t *buffer);
+
+int coap_get_header_object_security(void *packet, const uint8_t **os);
+int coap_set_header_object_security_content(void *packet, const uint8_t *os,
+                                            size_t os_len);
+int coap_set_header_object_security(void *packet);
+int coap_set_object_security_payload(void *packet, const uint8_t *os,
+                                     size_t os_len);
+#endif /* WITH_OSCOAP */
+
+/* option helpers, also used to serialize the OSCOAP plaintext */
+uint16_t coap_log_2(uint16_t value);
+uint32_t coap_parse_int_option(uint8_t *bytes, size_t length);
+size_t coap_serialize_int_option(unsigned int number,
+                                 unsigned int current_number,
+                                 uint8_t *buffer, uint32_t value);
+size_t coap_serialize_array_option(unsigned int number,
+                                   unsigned int current_number,
+                                   uint8_t *buffer, uint8_t *array,
+                                   size_t length, char split_char);
+void coap_merge_multi_option(char **dst, size_t *dst_len, uint8_t *option,
+                             size_t option_len, char separator);
+
 #endif /* ER_COAP_H_ */
@@ -0,0 +1,358 @@
+/* Edwards curve signature system
+ * Daniel Beer <dlbeer@gmail.com>, 22 Apr 2014
+ *
+ * This file is in the public domain.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "edsign.h"
+#include "sha512.h"
+#include "fprime.h"
+
+#define MAX_MSG_SIZE	128
+
+struct test_vector {
+	const uint8_t	secret[EDSIGN_SECRET_KEY_SIZE];
+	const uint8_t	public[EDSIGN_PUBLIC_KEY_SIZE];
+	size_t		mlen;
+	const uint8_t	message[MAX_MSG_SIZE];
+	const uint8_t	signature[EDSIGN_SIGNATURE_SIZE];
+};
+
+static const struct test_vector test_vectors[] = {
+  {
+    .secret = {
+      0xc6, 0x69, 0x73, 0x51, 0xff, 0x4a, 0xec, 0x29,
+      0xcd, 0xba, 0xab, 0xf2, 0xfb, 0xe3, 0x46, 0x7c,
+      0xc2, 0x54, 0xf8, 0x1b, 0xe8, 0xe7, 0x8d, 0x76,
+      0x5a, 0x2e, 0x63, 0x33, 0x9f, 0xc9, 0x9a, 0x66,
+    },
+    .public = {
+      0xea, 0x97, 0xf5, 0xbd, 0x16, 0x70, 0xc2, 0xd5,
+      0xdc, 0xb6, 0xa9, 0x4b, 0x42, 0x02, 0xdd, 0xfb,
+      0xe5, 0x78, 0xba, 0xfa, 0x60, 0x55, 0x28, 0xb6,
+      0xe3, 0x33, 0xdf, 0xdc, 0x7f, 0x39, 0xce, 0xca,
+    },
+    .mlen = 103,
+    .message = {
+      0xe9, 0x3e, 0xa1, 0x41, 0xe1, 0xfc, 0x67, 0x3e,
+      0x01, 0x7e, 0x97, 0xea, 0xdc, 0x6b, 0x96, 0x8f,
+      0x38, 0x5c, 0x2a, 0xec, 0xb0, 0x3b, 0xfb, 0x32,
+      0xaf, 0x3c, 0x54, 0xec, 0x18, 0xdb, 0x5c, 0x02,
+      0x1a, 0xfe, 0x43, 0xfb, 0xfa, 0xaa, 0x3a, 0xfb,
+      0x29, 0xd1, 0xe6, 0x05, 0x3c, 0x7c, 0x94, 0x75,
+      0xd8, 0xbe, 0x61, 0x89, 0xf9, 0x5c, 0xbb, 0xa8,
+      0x99, 0x0f, 0x95, 0xb1, 0xeb, 0xf1, 0xb3, 0x05,
+      0xef, 0xf7, 0x00, 0xe9, 0xa1, 0x3a, 0xe5, 0xca,
+      0x0b, 0xcb, 0xd0, 0x48, 0x47, 0x64, 0xbd, 0x1f,
+      0x23, 0x1e, 0xa8, 0x1c, 0x7b, 0x64, 0xc5, 0x14,
+      0x73, 0x5a, 0xc5, 0x5e, 0x4b, 0x79, 0x63, 0x3b,
+      0x70, 0x64, 0x24, 0x11, 0x9e, 0x09, 0xdc,
+    },
+    .signature = {0},
+   }
+};
+
+#define NUM_VECTORS (sizeof(test_vectors) / sizeof(test_vectors[0]))
+
+static void print_hex(const char *label, const uint8_t *data, int len)
+{
+	int i;
+
+	printf("%s: ", label);
+	for (i = 0; i < len; i++)
+		printf("%02x", data[i]);
+	printf("\n");
+}
+
+static void test(const struct test_vector *t)
+{
+	uint8_t pub[EDSIGN_PUBLIC_KEY_SIZE] = {0};
+	uint8_t msg[MAX_MSG_SIZE];
+	uint8_t signature[EDSIGN_SIGNATURE_SIZE];
+  uint8_t secret[EDSIGN_SECRET_KEY_SIZE]={0};
+
+	//edsign_sec_to_pub(pub, t->secret);
+	edsign_sec_to_pub(pub, secret);
+
+//	print_hex("Secret", t->secret, sizeof(t->secret));
+	print_hex("Secret", secret, sizeof(secret));
+	print_hex("Public", pub, sizeof(pub));
+	//assert(!memcmp(t->public, pub, sizeof(t->public)));
+
+	memcpy(msg, t->message, t->mlen);
+//	edsign_sign(signature, pub, t->secret, msg, t->mlen);
+	edsign_sign(signature, pub, secret, msg, t->mlen);
+
+	print_hex("Message", msg, t->mlen);
+	print_hex("Signature", signature, sizeof(signature));
+	//assert(!memcmp(t->signature, signature, sizeof(t->signature)));
+
+	//assert(edsign_verify(signature, pub, msg, t->mlen));
+
+	msg[0] ^= 1;
+	assert(!edsign_verify(signature, pub, msg, t->mlen));
+	msg[0] ^= 1;
+
+	signature[0] ^= 1;
+	assert(!edsign_verify(signature, pub, msg, t->mlen));
+	signature[0] ^= 1;
+
+	signature[32] ^= 1;
+	assert(!edsign_verify(signature, pub, msg, t->mlen));
+	signature[32] ^= 1;
+}
+
+/* Points of order 8 and 2 */
+static const uint8_t torsion8[32] = {
+	0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0,
+	0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0,
+	0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39,
+	0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05,
+};
+
+static const uint8_t torsion2[32] = {
+	0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+};
+
+static void unpack_pt(struct ed25519_pt *p, const uint8_t *packed)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+
+	assert(ed25519_try_unpack(x, y, packed));
+	ed25519_project(p, x, y);
+}
+
+static void pack_pt(uint8_t *packed, const struct ed25519_pt *p)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+
+	ed25519_unproject(x, y, p);
+	ed25519_pack(packed, x, y);
+}
+
+/* packed r = a + b */
+static void add_packed(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	struct ed25519_pt pa;
+	struct ed25519_pt pb;
+
+	unpack_pt(&pa, a);
+	unpack_pt(&pb, b);
+	ed25519_add(&pa, &pa, &pb);
+	pack_pt(r, &pa);
+}
+
+static int is_neutral(const uint8_t *packed)
+{
+	return packed[0] == 1 && packed[31] == 0;
+}
+
+/* Check that the small order points really are */
+static void test_torsion(const uint8_t *t, int order)
+{
+	uint8_t acc[32];
+	int i;
+
+	memcpy(acc, t, 32);
+	for (i = 1; i < order; i++) {
+		assert(!is_neutral(acc));
+		add_packed(acc, acc, t);
+	}
+	assert(is_neutral(acc));
+}
+
+static const uint8_t ed25519_order[FPRIME_SIZE] = {
+	0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+	0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/* Sign with R = kB + T, hashing that R, as a signer that wants its
+ * signature to depend on the cofactor would.
+ */
+static void sign_torsion(uint8_t *signature, const uint8_t *pub,
+			 const uint8_t *secret, const uint8_t *message,
+			 size_t len, const uint8_t *torsion)
+{
+	struct sha512_ctx c;
+	struct ed25519_pt p;
+	uint8_t hash[SHA512_HASH_SIZE];
+	uint8_t e[FPRIME_SIZE];
+	uint8_t k[FPRIME_SIZE];
+	uint8_t z[FPRIME_SIZE];
+
+	sha512_start(&c);
+	sha512_update(&c, secret, EDSIGN_SECRET_KEY_SIZE);
+	sha512_finish(&c, hash);
+	ed25519_prepare(hash);
+	fprime_from_bytes(e, hash, 32, ed25519_order);
+
+	sha512_start(&c);
+	sha512_update(&c, hash + 32, 32);
+	sha512_update(&c, message, len);
+	sha512_finish(&c, hash);
+	fprime_from_bytes(k, hash, SHA512_HASH_SIZE, ed25519_order);
+
+	ed25519_smult_base(&p, k);
+	pack_pt(signature, &p);
+	add_packed(signature, signature, torsion);
+
+	sha512_start(&c);
+	sha512_update(&c, signature, 32);
+	sha512_update(&c, pub, EDSIGN_PUBLIC_KEY_SIZE);
+	sha512_update(&c, message, len);
+	sha512_finish(&c, hash);
+	fprime_from_bytes(z, hash, SHA512_HASH_SIZE, ed25519_order);
+
+	fprime_mul(signature + 32, z, e, ed25519_order);
+	fprime_add(signature + 32, k, ed25519_order);
+}
+
+#define BATCH_CASES	6
+
+/* Single and batch verification must accept the same signatures,
+ * including those with a small order component in R or A, which only
+ * a cofactored check accepts.
+ */
+static void test_batch(void)
+{
+	static uint8_t pub[BATCH_CASES][EDSIGN_PUBLIC_KEY_SIZE];
+	static uint8_t sig[BATCH_CASES][EDSIGN_SIGNATURE_SIZE];
+	static uint8_t msg[BATCH_CASES][32];
+	static const uint8_t expect[BATCH_CASES] = {1, 1, 0, 1, 1, 1};
+	struct edsign_batch batch[BATCH_CASES];
+	struct edsign_public_key key;
+	struct edsign_batch_verify bv;
+	uint8_t secret[EDSIGN_SECRET_KEY_SIZE];
+	int i;
+
+	test_torsion(torsion8, 8);
+	test_torsion(torsion2, 2);
+
+	for (i = 0; i < BATCH_CASES; i++) {
+		memset(secret, i + 1, sizeof(secret));
+		memset(msg[i], 0x40 + i, sizeof(msg[i]));
+		edsign_sec_to_pub(pub[i], secret);
+
+		/* 4: A + T, with the signature made for that key */
+		if (i == 4)
+			add_packed(pub[i], pub[i], torsion8);
+
+		/* 1: R + T of order 8, 5: R + T of order 2 */
+		if (i == 1)
+			sign_torsion(sig[i], pub[i], secret, msg[i],
+				     sizeof(msg[i]), torsion8);
+		else if (i == 5)
+			sign_torsion(sig[i], pub[i], secret, msg[i],
+				     sizeof(msg[i]), torsion2);
+		else
+			edsign_sign(sig[i], pub[i], secret, msg[i],
+				    sizeof(msg[i]));
+	}
+
+	/* 2: a bad signature */
+	sig[2][40] ^= 1;
+
+	for (i = 0; i < BATCH_CASES; i++) {
+		batch[i].signature = sig[i];
+		batch[i].pub = pub[i];
+		batch[i].key = NULL;
+		batch[i].message = msg[i];
+		batch[i].len = sizeof(msg[i]);
+		batch[i].ok = 0xff;
+	}
+
+	/* The group with the bad signature falls back to single checks,
+	 * the group of 4 and 5 passes as a whole.
+	 */
+	assert(!edsign_verify_batch(batch, BATCH_CASES));
+
+	for (i = 0; i < BATCH_CASES; i++) {
+		edsign_prepare_public(&key, pub[i]);
+		printf("case %d: single %d, prepared %d, batch %d\n", i,
+		       edsign_verify(sig[i], pub[i], msg[i], sizeof(msg[i])),
+		       edsign_verify_prepared(sig[i], &key, msg[i],
+					      sizeof(msg[i])),
+		       batch[i].ok);
+		assert(edsign_verify(sig[i], pub[i], msg[i],
+				     sizeof(msg[i])) == expect[i]);
+		assert(edsign_verify_prepared(sig[i], &key, msg[i],
+					      sizeof(msg[i])) == expect[i]);
+		assert(batch[i].ok == expect[i]);
+	}
+
+	/* In small steps, with the same results */
+	for (i = 0; i < BATCH_CASES; i++)
+		batch[i].ok = 0xff;
+
+	edsign_verify_batch_start(&bv, batch, BATCH_CASES);
+	while (!edsign_verify_batch_step(&bv, 3))
+		;
+
+	assert(!bv.all);
+	for (i = 0; i < BATCH_CASES; i++)
+		assert(batch[i].ok == expect[i]);
+
+	/* A group of only good signatures, all with torsion but one */
+	batch[2] = batch[5];
+	assert(edsign_verify_batch(batch, 4));
+	for (i = 0; i < 4; i++)
+		assert(batch[i].ok == 1);
+}
+
+/* A signature with s + L in place of s must not verify */
+static void test_malleable(void)
+{
+	uint8_t secret[EDSIGN_SECRET_KEY_SIZE];
+	uint8_t pub[EDSIGN_PUBLIC_KEY_SIZE];
+	uint8_t sig[EDSIGN_SIGNATURE_SIZE];
+	uint8_t msg[32];
+	struct edsign_batch batch[2];
+	unsigned int c = 0;
+	int i;
+
+	memset(secret, 0x55, sizeof(secret));
+	memset(msg, 0x33, sizeof(msg));
+	edsign_sec_to_pub(pub, secret);
+	edsign_sign(sig, pub, secret, msg, sizeof(msg));
+	assert(edsign_verify(sig, pub, msg, sizeof(msg)));
+
+	for (i = 0; i < FPRIME_SIZE; i++) {
+		c += sig[32 + i] + ed25519_order[i];
+		sig[32 + i] = c;
+		c >>= 8;
+	}
+	assert(!edsign_verify(sig, pub, msg, sizeof(msg)));
+
+	for (i = 0; i < 2; i++) {
+		batch[i].signature = sig;
+		batch[i].pub = pub;
+		batch[i].key = NULL;
+		batch[i].message = msg;
+		batch[i].len = sizeof(msg);
+	}
+	assert(!edsign_verify_batch(batch, 2));
+	assert(!batch[0].ok && !batch[1].ok);
+}
+
+int main(void)
+{
+
+		test(&test_vectors[0]);
+		printf("\n");
+
+		test_batch();
+		test_malleable();
+
+	return 0;
+}
@@ -88,53 +88,63 @@ ctr_step(const uint8_t *nonce,
 }
 /*---------------------------------------------------------------------------*/
 static void
-mic(const uint8_t *nonce,
+mic_start(struct cose_aes_ccm_mic *mic,
+    const uint8_t *nonce,
+    uint8_t m_len, uint16_t a_len,
+    uint8_t mic_len)
+{
+  set_iv(mic->x, CCM_STAR_AUTH_FLAGS(a_len, mic_len), nonce, m_len);
+  AES_128.encrypt(mic->x);
+  mic->pos = 0;
+
+  if(a_len) {
+    /* the additional data is preceded by its length */
+    mic->x[0] ^= a_len >> 8;
+    mic->x[1] ^= a_len & 0xff;
+    mic->pos = 2;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+mic_update(struct cose_aes_ccm_mic *mic, const uint8_t *a, uint16_t a_len)
+{
+  while(a_len--) {
+    mic->x[mic->pos++] ^= *a++;
+    if(mic->pos == AES_128_BLOCK_SIZE) {
+      AES_128.encrypt(mic->x);
+      mic->pos = 0;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+mic_finish(struct cose_aes_ccm_mic *mic,
+    const uint8_t *nonce,
     const uint8_t *m, uint8_t m_len,
-    const uint8_t *a, uint8_t a_len,
     uint8_t *result,
     uint8_t mic_len)
 {
-  uint8_t x[AES_128_BLOCK_SIZE];
   uint8_t pos;
   uint8_t i;
-  
-  
-  set_iv(x, CCM_STAR_AUTH_FLAGS(a_len, mic_len), nonce, m_len);
-  AES_128.encrypt(x);
 
-  if(a_len) {
-    x[1] = x[1] ^ a_len;
-    for(i = 2; (i - 2 < a_len) && (i < AES_128_BLOCK_SIZE); i++) {
-      x[i] ^= a[i - 2];
-    }
-
-    AES_128.encrypt(x);
-
-    pos = 14;
-    while(pos < a_len) {
-      for(i = 0; (pos + i < a_len) && (i < AES_128_BLOCK_SIZE); i++) {
-        x[i] ^= a[pos + i];
-      }
-      pos += AES_128_BLOCK_SIZE;
-      AES_128.encrypt(x);
-    }
+  /* the last block of additional data is padded with zeroes */
+  if(mic->pos) {
+    AES_128.encrypt(mic->x);
   }
 
-  if(m_len) {
-    pos = 0;
-    while(pos < m_len) {
-      for(i = 0; (pos + i < m_len) && (i < AES_128_BLOCK_SIZE); i++) {
-        x[i] ^= m[pos + i];
-      }
-      pos += AES_128_BLOCK_SIZE;
-
-      AES_128.encrypt(x);
+  pos = 0;
+  while(pos < m_len) {
+    for(i = 0; (pos + i < m_len) && (i < AES_128_BLOCK_SIZE); i++) {
+      mic->x[i] ^= m[pos + i];
     }
+    pos += AES_128_BLOCK_SIZE;
+
+    AES_128.encrypt(mic->x);
   }
 
-  ctr_step(nonce, 0, x, AES_128_BLOCK_SIZE, 0);
-  
-  memcpy(result, x, mic_len);
+  ctr_step(nonce, 0, mic->x, AES_128_BLOCK_SIZE, 0);
+
+  memcpy(result, mic->x, mic_len);
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -158,9 +168,9 @@ set_key(const uint8_t *key)
 }
 /*---------------------------------------------------------------------------*/
 static void
-aead(const uint8_t* nonce,
+aead_finish(struct cose_aes_ccm_mic *mic,
+    const uint8_t* nonce,
     uint8_t* m, uint8_t m_len,
-    const uint8_t* a, uint8_t a_len,
     uint8_t *result, uint8_t mic_len,
     int forward)
 {
@@ -168,21 +178,34 @@ aead(const uint8_t* nonce,
     /* decrypt */
     ctr(nonce, m, m_len);
   }
-  
-  mic(nonce,
-    m, m_len,
-    a, a_len,
-    result,
-    mic_len);
-  
+
+  mic_finish(mic, nonce, m, m_len, result, mic_len);
+
   if(forward) {
     /* encrypt */
     ctr(nonce, m, m_len);
   }
 }
 /*---------------------------------------------------------------------------*/
+static void
+aead(const uint8_t* nonce,
+    uint8_t* m, uint8_t m_len,
+    const uint8_t* a, uint8_t a_len,
+    uint8_t *result, uint8_t mic_len,
+    int forward)
+{
+  struct cose_aes_ccm_mic mic;
+
+  mic_start(&mic, nonce, m_len, a_len, mic_len);
+  mic_update(&mic, a, a_len);
+  aead_finish(&mic, nonce, m, m_len, result, mic_len, forward);
+}
+/*---------------------------------------------------------------------------*/
 const struct cose_aes_ccm_driver cose_aes_ccm_driver = {
   set_key,
-  aead
+  aead,
+  mic_start,
+  mic_update,
+  aead_finish
 };
 /*---------------------------------------------------------------------------*/
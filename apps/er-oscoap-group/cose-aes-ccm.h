@@ -55,6 +55,14 @@
 
 #define COSE_AES_CCM_NONCE_LENGTH 7
 
+/**
+ * CBC-MAC state while the additional data is fed in pieces.
+ */
+struct cose_aes_ccm_mic {
+  uint8_t x[16];
+  uint8_t pos;
+};
+
 /**
  * Structure of CCM* drivers.
  */
@@ -80,6 +88,35 @@ struct cose_aes_ccm_driver {
       const uint8_t* a, uint8_t a_len,
       uint8_t *result, uint8_t mic_len,
       int forward);
+
+  /**
+   * \brief         Starts an aead() whose additional data is given in pieces.
+   * \param mic     State to initialize
+   * \param nonce   The nonce to use. CCM_STAR_NONCE_LENGTH bytes long.
+   * \param m_len   Length of the message to encrypt or decrypt
+   * \param a_len   Total length of the additional data
+   * \param mic_len The size of the MIC to be generated. <= 16.
+   */
+  void (* mic_start)(struct cose_aes_ccm_mic *mic,
+      const uint8_t* nonce,
+      uint8_t m_len, uint16_t a_len,
+      uint8_t mic_len);
+
+  /**
+   * \brief         Feeds the next piece of additional data.
+   */
+  void (* mic_update)(struct cose_aes_ccm_mic *mic,
+      const uint8_t* a, uint16_t a_len);
+
+  /**
+   * \brief         Encrypts or decrypts m in place once all a_len bytes of
+   *                additional data are fed, and puts the MIC in result.
+   */
+  void (* aead_finish)(struct cose_aes_ccm_mic *mic,
+      const uint8_t* nonce,
+      uint8_t* m, uint8_t m_len,
+      uint8_t *result, uint8_t mic_len,
+      int forward);
 };
 
 extern const struct cose_aes_ccm_driver COSE_AES_CCM;
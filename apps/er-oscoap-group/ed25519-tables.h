@@ -0,0 +1,2784 @@
+/* Precomputed multiples of the Ed25519 base point, as affine
+ * (x, y) pairs. Generated by gen-ed25519-tables.c, do not edit.
+ */
+
+#ifndef ED25519_TABLES_H_
+#define ED25519_TABLES_H_
+
+/* B, 3B, 5B, ..., 15B */
+static const uint8_t ed25519_base_odd[8][2][F25519_SIZE] = {
+	{
+		{0x1a, 0xd5, 0x25, 0x8f, 0x60, 0x2d, 0x56, 0xc9,
+		 0xb2, 0xa7, 0x25, 0x95, 0x60, 0xc7, 0x2c, 0x69,
+		 0x5c, 0xdc, 0xd6, 0xfd, 0x31, 0xe2, 0xa4, 0xc0,
+		 0xfe, 0x53, 0x6e, 0xcd, 0xd3, 0x36, 0x69, 0x21},
+		{0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66}
+	},
+	{
+		{0x5c, 0xe2, 0xf8, 0xd3, 0x5f, 0x48, 0x62, 0xac,
+		 0x86, 0x48, 0x62, 0x81, 0x19, 0x98, 0x43, 0x63,
+		 0x3a, 0xc8, 0xda, 0x3e, 0x74, 0xae, 0xf4, 0x1f,
+		 0x49, 0x8f, 0x92, 0x22, 0x4a, 0x9c, 0xae, 0x67},
+		{0xd4, 0xb4, 0xf5, 0x78, 0x48, 0x68, 0xc3, 0x02,
+		 0x04, 0x03, 0x24, 0x67, 0x17, 0xec, 0x16, 0x9f,
+		 0xf7, 0x9e, 0x26, 0x60, 0x8e, 0xa1, 0x26, 0xa1,
+		 0xab, 0x69, 0xee, 0x77, 0xd1, 0xb1, 0x67, 0x12}
+	},
+	{
+		{0x33, 0xf2, 0x2e, 0x32, 0xc0, 0x9c, 0x40, 0x91,
+		 0xa5, 0xe1, 0x1b, 0x3e, 0xf9, 0x19, 0x28, 0x5c,
+		 0xde, 0xa5, 0x2d, 0xd1, 0xf7, 0x7c, 0xef, 0xfc,
+		 0x7b, 0x58, 0xe3, 0xad, 0x3e, 0xa7, 0xfd, 0x49},
+		{0xed, 0xc8, 0x76, 0xd6, 0x83, 0x1f, 0xd2, 0x10,
+		 0x5d, 0x0b, 0x43, 0x89, 0xca, 0x2e, 0x28, 0x31,
+		 0x66, 0x46, 0x92, 0x89, 0x14, 0x6e, 0x2c, 0xe0,
+		 0x6f, 0xae, 0xfe, 0x98, 0xb2, 0x25, 0x48, 0x5f}
+	},
+	{
+		{0x07, 0x41, 0x0e, 0xf5, 0x1a, 0x98, 0x55, 0x58,
+		 0x95, 0xce, 0xf1, 0xbb, 0xf3, 0x09, 0xe8, 0x83,
+		 0x07, 0x81, 0x1d, 0x4b, 0x19, 0xee, 0xe3, 0xe9,
+		 0x4e, 0xbd, 0xf4, 0xfc, 0x85, 0x86, 0x56, 0x14},
+		{0xb8, 0x62, 0x40, 0x9f, 0xb5, 0xc4, 0xc4, 0x12,
+		 0x3d, 0xf2, 0xab, 0xf7, 0x46, 0x2b, 0x88, 0xf0,
+		 0x41, 0xad, 0x36, 0xdd, 0x68, 0x64, 0xce, 0x87,
+		 0x2f, 0xd5, 0x47, 0x2b, 0xe3, 0x63, 0xc5, 0x31}
+	},
+	{
+		{0x5c, 0x71, 0x85, 0x51, 0x06, 0x23, 0xe0, 0xd3,
+		 0x94, 0x02, 0x4e, 0x2e, 0x5c, 0x0e, 0xd8, 0x86,
+		 0xb8, 0x22, 0x94, 0x6f, 0xe0, 0x36, 0xf3, 0x1b,
+		 0x65, 0x71, 0x00, 0xc8, 0x70, 0xc9, 0x7c, 0x35},
+		{0xc0, 0xf1, 0x22, 0x55, 0x84, 0x44, 0x4e, 0xc7,
+		 0x30, 0x44, 0x6e, 0x23, 0x13, 0x90, 0x78, 0x1f,
+		 0xfd, 0xd2, 0xf2, 0x56, 0xe9, 0xfc, 0xbe, 0xb2,
+		 0xf4, 0x0d, 0xdd, 0xc2, 0xc2, 0x23, 0x3d, 0x7f}
+	},
+	{
+		{0xcb, 0xf3, 0x7c, 0x20, 0xc1, 0xd2, 0x2f, 0xff,
+		 0x52, 0xd5, 0x93, 0xc5, 0xb2, 0xa5, 0x81, 0xd3,
+		 0x38, 0x24, 0x71, 0xd6, 0x8d, 0x07, 0xcf, 0xb6,
+		 0x17, 0xe4, 0x4b, 0x15, 0xb1, 0x28, 0xe5, 0x14},
+		{0x13, 0x37, 0x03, 0x6a, 0xc3, 0x2d, 0x8f, 0x30,
+		 0xd4, 0x58, 0x9c, 0x3c, 0x1c, 0x59, 0x58, 0x12,
+		 0xce, 0x0f, 0xff, 0x40, 0xe3, 0x7c, 0x6f, 0x5a,
+		 0x97, 0xab, 0x21, 0x3f, 0x31, 0x82, 0x90, 0x2d}
+	},
+	{
+		{0xed, 0x5f, 0xc0, 0xb7, 0x73, 0xe0, 0x80, 0x37,
+		 0xb8, 0xb7, 0x22, 0x8d, 0xe8, 0xe3, 0x43, 0x88,
+		 0x4f, 0x30, 0x2d, 0x28, 0xf0, 0xad, 0x33, 0xdb,
+		 0xcc, 0x66, 0xf3, 0xd5, 0xe0, 0x27, 0x74, 0x10},
+		{0x80, 0x1f, 0x40, 0xea, 0xae, 0xe1, 0xef, 0x87,
+		 0x23, 0x27, 0x9a, 0x28, 0xb2, 0xcf, 0x40, 0x37,
+		 0xb8, 0x89, 0xda, 0xd2, 0x22, 0x60, 0x46, 0x78,
+		 0x74, 0x8b, 0x53, 0xed, 0x0d, 0xb0, 0xdb, 0x12}
+	},
+	{
+		{0xc1, 0x8d, 0xa1, 0x66, 0x3e, 0x7f, 0x61, 0x90,
+		 0xcb, 0x89, 0x01, 0x77, 0x74, 0x13, 0x63, 0xd9,
+		 0x9e, 0x41, 0x20, 0x5d, 0xf9, 0xc6, 0x5a, 0xdc,
+		 0x35, 0xc4, 0x2e, 0xec, 0xea, 0x2d, 0x16, 0x4f},
+		{0xdf, 0x5c, 0x2e, 0xad, 0xc4, 0x4c, 0x6d, 0x94,
+		 0xa1, 0x9a, 0x9a, 0xa1, 0x18, 0xaf, 0xe5, 0xac,
+		 0x31, 0x93, 0xd2, 0x64, 0x01, 0xf7, 0x62, 0x51,
+		 0xf5, 0x22, 0xff, 0x04, 0x2d, 0xfb, 0xcb, 0x12}
+	}
+};
+
+/* Group i holds jB * 16^(i * ED25519_COMB_SPACING), for j = 1..8 */
+static const uint8_t ed25519_comb[64 / ED25519_COMB_SPACING][8][2][F25519_SIZE] = {
+#if (0 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x1a, 0xd5, 0x25, 0x8f, 0x60, 0x2d, 0x56, 0xc9,
+			 0xb2, 0xa7, 0x25, 0x95, 0x60, 0xc7, 0x2c, 0x69,
+			 0x5c, 0xdc, 0xd6, 0xfd, 0x31, 0xe2, 0xa4, 0xc0,
+			 0xfe, 0x53, 0x6e, 0xcd, 0xd3, 0x36, 0x69, 0x21},
+			{0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66}
+		},
+		{
+			{0x0e, 0xce, 0x43, 0x28, 0x4e, 0xa1, 0xc5, 0x83,
+			 0x5f, 0xa4, 0xd7, 0x15, 0x45, 0x8e, 0x0d, 0x08,
+			 0xac, 0xe7, 0x33, 0x18, 0x7d, 0x3b, 0x04, 0x3d,
+			 0x6c, 0x04, 0x5a, 0x9f, 0x4c, 0x38, 0xab, 0x36},
+			{0xc9, 0xa3, 0xf8, 0x6a, 0xae, 0x46, 0x5f, 0x0e,
+			 0x56, 0x51, 0x38, 0x64, 0x51, 0x0f, 0x39, 0x97,
+			 0x56, 0x1f, 0xa2, 0xc9, 0xe8, 0x5e, 0xa2, 0x1d,
+			 0xc2, 0x29, 0x23, 0x09, 0xf3, 0xcd, 0x60, 0x22}
+		},
+		{
+			{0x5c, 0xe2, 0xf8, 0xd3, 0x5f, 0x48, 0x62, 0xac,
+			 0x86, 0x48, 0x62, 0x81, 0x19, 0x98, 0x43, 0x63,
+			 0x3a, 0xc8, 0xda, 0x3e, 0x74, 0xae, 0xf4, 0x1f,
+			 0x49, 0x8f, 0x92, 0x22, 0x4a, 0x9c, 0xae, 0x67},
+			{0xd4, 0xb4, 0xf5, 0x78, 0x48, 0x68, 0xc3, 0x02,
+			 0x04, 0x03, 0x24, 0x67, 0x17, 0xec, 0x16, 0x9f,
+			 0xf7, 0x9e, 0x26, 0x60, 0x8e, 0xa1, 0x26, 0xa1,
+			 0xab, 0x69, 0xee, 0x77, 0xd1, 0xb1, 0x67, 0x12}
+		},
+		{
+			{0x70, 0xf8, 0xc9, 0xc4, 0x57, 0xa6, 0x3a, 0x49,
+			 0x47, 0x15, 0xce, 0x93, 0xc1, 0x9e, 0x73, 0x1a,
+			 0xf9, 0x20, 0x35, 0x7a, 0xb8, 0xd4, 0x25, 0x83,
+			 0x46, 0xf1, 0xcf, 0x56, 0xdb, 0xa8, 0x3d, 0x20},
+			{0x2f, 0x11, 0x32, 0xca, 0x61, 0xab, 0x38, 0xdf,
+			 0xf0, 0x0f, 0x2f, 0xea, 0x32, 0x28, 0xf2, 0x4c,
+			 0x6c, 0x71, 0xd5, 0x80, 0x85, 0xb8, 0x0e, 0x47,
+			 0xe1, 0x95, 0x15, 0xcb, 0x27, 0xe8, 0xd0, 0x47}
+		},
+		{
+			{0x33, 0xf2, 0x2e, 0x32, 0xc0, 0x9c, 0x40, 0x91,
+			 0xa5, 0xe1, 0x1b, 0x3e, 0xf9, 0x19, 0x28, 0x5c,
+			 0xde, 0xa5, 0x2d, 0xd1, 0xf7, 0x7c, 0xef, 0xfc,
+			 0x7b, 0x58, 0xe3, 0xad, 0x3e, 0xa7, 0xfd, 0x49},
+			{0xed, 0xc8, 0x76, 0xd6, 0x83, 0x1f, 0xd2, 0x10,
+			 0x5d, 0x0b, 0x43, 0x89, 0xca, 0x2e, 0x28, 0x31,
+			 0x66, 0x46, 0x92, 0x89, 0x14, 0x6e, 0x2c, 0xe0,
+			 0x6f, 0xae, 0xfe, 0x98, 0xb2, 0x25, 0x48, 0x5f}
+		},
+		{
+			{0x3d, 0xf2, 0xcb, 0x7d, 0x1a, 0x74, 0x3a, 0x78,
+			 0x27, 0x44, 0x7b, 0x6c, 0x82, 0x99, 0xe5, 0xa1,
+			 0xbe, 0x29, 0x0a, 0xdd, 0xc0, 0xac, 0xae, 0x62,
+			 0x1c, 0x60, 0x45, 0x7a, 0xba, 0x97, 0x97, 0x4c},
+			{0xf4, 0x7e, 0x49, 0xf9, 0xd0, 0x7a, 0xd2, 0xc1,
+			 0x60, 0x6b, 0x4d, 0x94, 0x06, 0x7c, 0x41, 0xf9,
+			 0x77, 0x7d, 0x4f, 0xfd, 0xa7, 0x09, 0xb7, 0x1d,
+			 0xa1, 0xd8, 0x86, 0x28, 0xfc, 0xe3, 0x4d, 0x05}
+		},
+		{
+			{0x07, 0x41, 0x0e, 0xf5, 0x1a, 0x98, 0x55, 0x58,
+			 0x95, 0xce, 0xf1, 0xbb, 0xf3, 0x09, 0xe8, 0x83,
+			 0x07, 0x81, 0x1d, 0x4b, 0x19, 0xee, 0xe3, 0xe9,
+			 0x4e, 0xbd, 0xf4, 0xfc, 0x85, 0x86, 0x56, 0x14},
+			{0xb8, 0x62, 0x40, 0x9f, 0xb5, 0xc4, 0xc4, 0x12,
+			 0x3d, 0xf2, 0xab, 0xf7, 0x46, 0x2b, 0x88, 0xf0,
+			 0x41, 0xad, 0x36, 0xdd, 0x68, 0x64, 0xce, 0x87,
+			 0x2f, 0xd5, 0x47, 0x2b, 0xe3, 0x63, 0xc5, 0x31}
+		},
+		{
+			{0xc8, 0x84, 0xa5, 0x08, 0xbc, 0xfd, 0x87, 0x3b,
+			 0x99, 0x8b, 0x69, 0x80, 0x7b, 0xc6, 0x3a, 0xeb,
+			 0x93, 0xcf, 0x4e, 0xf8, 0x5c, 0x2d, 0x86, 0x42,
+			 0xb6, 0x71, 0xd7, 0x97, 0x5f, 0xe1, 0x42, 0x67},
+			{0xb4, 0xb9, 0x37, 0xfc, 0xa9, 0x5b, 0x2f, 0x1e,
+			 0x93, 0xe4, 0x1e, 0x62, 0xfc, 0x3c, 0x78, 0x81,
+			 0x8f, 0xf3, 0x8a, 0x66, 0x09, 0x6f, 0xad, 0x6e,
+			 0x79, 0x73, 0xe5, 0xc9, 0x00, 0x06, 0xd3, 0x21}
+		}
+	},
+#endif
+#if (2 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x56, 0xa5, 0xc2, 0x0c, 0xdd, 0xbc, 0xb8, 0x20,
+			 0x6d, 0x57, 0x61, 0xb5, 0xfb, 0x78, 0xb5, 0xd4,
+			 0x49, 0x54, 0x90, 0x26, 0xc1, 0xcb, 0xe9, 0xe6,
+			 0xbf, 0xec, 0x1d, 0x4e, 0xed, 0x07, 0x7e, 0x5e},
+			{0xc7, 0xf6, 0x6c, 0x56, 0x31, 0x20, 0x14, 0x0e,
+			 0xa8, 0xd9, 0x27, 0xc1, 0x9a, 0x3d, 0x1b, 0x7d,
+			 0x0e, 0x26, 0xd3, 0x81, 0xaa, 0xeb, 0xf5, 0x6b,
+			 0x79, 0x02, 0xf1, 0x51, 0x5c, 0x75, 0x55, 0x0f}
+		},
+		{
+			{0x0a, 0x34, 0xcd, 0x82, 0x3c, 0x33, 0x09, 0x54,
+			 0xd2, 0x61, 0x39, 0x30, 0x9b, 0xfd, 0xef, 0x21,
+			 0x26, 0xd4, 0x70, 0xfa, 0xee, 0xf9, 0x31, 0x33,
+			 0x73, 0x84, 0xd0, 0xb3, 0x81, 0xbf, 0xec, 0x2e},
+			{0xe8, 0x93, 0x8b, 0x00, 0x64, 0xf7, 0x9c, 0xb8,
+			 0x74, 0xe0, 0xe6, 0x49, 0x48, 0x4d, 0x4d, 0x48,
+			 0xb6, 0x19, 0xa1, 0x40, 0xb7, 0xd9, 0x32, 0x41,
+			 0x7c, 0x82, 0x37, 0xa1, 0x2d, 0xdc, 0xd2, 0x54}
+		},
+		{
+			{0xbb, 0x93, 0xcc, 0x14, 0xf3, 0xce, 0x66, 0x45,
+			 0xb9, 0x51, 0x3d, 0xa5, 0x2a, 0xdd, 0xea, 0x57,
+			 0xbe, 0x8d, 0xcd, 0x79, 0x18, 0x7b, 0xaa, 0xa5,
+			 0x28, 0xbe, 0x63, 0x74, 0x14, 0x25, 0xb2, 0x70},
+			{0x02, 0x9c, 0x8d, 0xb1, 0x92, 0x73, 0x9e, 0x5b,
+			 0x0a, 0x16, 0xd9, 0x4d, 0x00, 0x34, 0x79, 0x14,
+			 0x9a, 0x60, 0x4d, 0xf9, 0x27, 0x67, 0x60, 0xc2,
+			 0x01, 0xf4, 0x2f, 0xd3, 0xde, 0x80, 0x49, 0x24}
+		},
+		{
+			{0x68, 0x2b, 0x4a, 0x5b, 0xd5, 0xc7, 0x51, 0x91,
+			 0x1d, 0xe1, 0x2a, 0x4b, 0xc4, 0x47, 0xf1, 0xbc,
+			 0x7a, 0xb3, 0xcb, 0xc8, 0xb6, 0x7c, 0xac, 0x90,
+			 0x05, 0xfd, 0xf3, 0xf9, 0x52, 0x3a, 0x11, 0x6b},
+			{0x3d, 0xc1, 0x27, 0xf3, 0x59, 0x43, 0x95, 0x90,
+			 0xc5, 0x96, 0x79, 0xf5, 0xf4, 0x95, 0x65, 0x29,
+			 0x06, 0x9c, 0x51, 0x05, 0x18, 0xda, 0xb8, 0x2e,
+			 0x79, 0x7e, 0x69, 0x59, 0x71, 0x01, 0xeb, 0x1a}
+		},
+		{
+			{0xd2, 0x5b, 0xa9, 0xe9, 0xe6, 0xfd, 0xc2, 0x19,
+			 0x87, 0x42, 0xe6, 0x3f, 0xe8, 0x7e, 0x05, 0x1e,
+			 0x59, 0x40, 0x90, 0x39, 0xdd, 0x11, 0x6a, 0xad,
+			 0x79, 0xc1, 0xbb, 0x7a, 0x75, 0x75, 0x1b, 0x66},
+			{0xbe, 0x09, 0x7b, 0x2a, 0xe4, 0x97, 0x7d, 0x49,
+			 0xae, 0x12, 0xdb, 0xd6, 0x57, 0x95, 0x0c, 0xd1,
+			 0x07, 0x7c, 0x80, 0x4f, 0x2f, 0x02, 0xce, 0xf0,
+			 0x12, 0xbb, 0xd4, 0xb5, 0xe1, 0x1a, 0xda, 0x05}
+		},
+		{
+			{0x15, 0x06, 0x49, 0xb6, 0x8a, 0x3c, 0xea, 0x2f,
+			 0x34, 0x20, 0x14, 0xc3, 0xaa, 0xd6, 0xaf, 0x2c,
+			 0x3e, 0xbd, 0x65, 0x20, 0xe2, 0x4d, 0x4b, 0x3b,
+			 0xeb, 0x9f, 0x4a, 0xc3, 0xad, 0xa4, 0x3b, 0x60},
+			{0xbc, 0x58, 0xe6, 0xc0, 0x95, 0x2a, 0x2a, 0x81,
+			 0x9a, 0x7a, 0xf3, 0xd2, 0x06, 0xbe, 0x48, 0xbc,
+			 0x0c, 0xc5, 0x46, 0xe0, 0x6a, 0xd4, 0xac, 0x0f,
+			 0xd9, 0xcc, 0x82, 0x34, 0x2c, 0xaf, 0xdb, 0x1f}
+		},
+		{
+			{0x99, 0x1d, 0x39, 0x0b, 0x31, 0x40, 0x9d, 0x36,
+			 0x93, 0x16, 0x2c, 0xd1, 0x5b, 0xa8, 0xd6, 0xeb,
+			 0x30, 0xe3, 0xf9, 0x3a, 0xaf, 0x15, 0x1e, 0x5d,
+			 0xa4, 0xd3, 0xf2, 0x4b, 0x64, 0x8e, 0x71, 0x3d},
+			{0xf9, 0x00, 0x36, 0xa2, 0xf5, 0x3b, 0x8e, 0xa8,
+			 0x80, 0x72, 0x1f, 0x7f, 0xc7, 0x2a, 0x90, 0x5f,
+			 0x92, 0xa8, 0x22, 0x3a, 0x11, 0x88, 0x22, 0x2f,
+			 0x14, 0xf4, 0xa3, 0xbb, 0x5d, 0x05, 0x0d, 0x32}
+		},
+		{
+			{0xf7, 0x17, 0x13, 0xbd, 0xfb, 0xbc, 0xd2, 0xec,
+			 0x45, 0xb3, 0x15, 0x31, 0xe9, 0xaf, 0x82, 0x84,
+			 0x3d, 0x28, 0xc6, 0xfc, 0x11, 0xf5, 0x41, 0xb5,
+			 0x8b, 0xd3, 0x12, 0x76, 0x52, 0xe7, 0x1a, 0x3c},
+			{0x4e, 0x36, 0x11, 0x07, 0xa2, 0x15, 0x20, 0x51,
+			 0xc4, 0x2a, 0xc3, 0x62, 0x8b, 0x5e, 0x7f, 0xa6,
+			 0x0f, 0xf9, 0x45, 0x85, 0x6c, 0x11, 0x86, 0xb7,
+			 0x7e, 0xe5, 0xd7, 0xf9, 0xc3, 0x91, 0x1c, 0x05}
+		}
+	},
+#endif
+#if (4 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x65, 0xa5, 0x11, 0x84, 0x8a, 0x67, 0x9d, 0x9e,
+			 0xd1, 0x44, 0x68, 0x7a, 0x34, 0xe1, 0x9f, 0xa3,
+			 0x54, 0xcd, 0x07, 0xca, 0x79, 0x1f, 0x54, 0x2f,
+			 0x13, 0x70, 0x4e, 0xee, 0xa2, 0xfa, 0xe7, 0x5d},
+			{0x36, 0xec, 0x54, 0xf8, 0xce, 0xe4, 0x85, 0xdf,
+			 0xf6, 0x6f, 0x1d, 0x90, 0x08, 0xbc, 0xe8, 0xc0,
+			 0x92, 0x2d, 0x43, 0x6b, 0x92, 0xa9, 0x8e, 0xab,
+			 0x0a, 0x2e, 0x1c, 0x1e, 0x64, 0x23, 0x9f, 0x2c}
+		},
+		{
+			{0x27, 0x4f, 0xd0, 0x72, 0xb1, 0x11, 0x14, 0x27,
+			 0x15, 0x94, 0x48, 0x81, 0x7e, 0x74, 0xd8, 0x32,
+			 0xd5, 0xd1, 0x11, 0x28, 0x60, 0x63, 0x36, 0x32,
+			 0x37, 0xb5, 0x13, 0x1c, 0xa0, 0x37, 0xe3, 0x74},
+			{0xf1, 0x25, 0x4e, 0x11, 0x96, 0x67, 0xe6, 0x1c,
+			 0xc2, 0xb2, 0x53, 0xe2, 0xda, 0x85, 0xee, 0xb2,
+			 0x9f, 0x59, 0xf3, 0xba, 0xbd, 0xfa, 0xcf, 0x6e,
+			 0xf9, 0xda, 0xa4, 0xb3, 0x02, 0x8f, 0x64, 0x08}
+		},
+		{
+			{0x90, 0xc2, 0xd7, 0x90, 0x43, 0x4e, 0xd9, 0x4d,
+			 0xeb, 0x9e, 0x37, 0x49, 0x7e, 0xe0, 0x14, 0x88,
+			 0x1c, 0xc8, 0xff, 0x6f, 0xa1, 0xa7, 0x97, 0xa1,
+			 0xf2, 0x72, 0xa8, 0x48, 0xc7, 0x78, 0xce, 0x73},
+			{0xca, 0xb2, 0x0c, 0x0a, 0x3a, 0xe1, 0x7d, 0x94,
+			 0x94, 0xa9, 0xbb, 0x3f, 0x3d, 0x65, 0xae, 0xce,
+			 0x70, 0xe0, 0x60, 0xf9, 0xcb, 0x63, 0x39, 0xfe,
+			 0xc6, 0x2e, 0x06, 0x06, 0xe6, 0x72, 0xc1, 0x33}
+		},
+		{
+			{0x34, 0x94, 0xf2, 0x64, 0x54, 0x47, 0x37, 0x07,
+			 0x40, 0x8a, 0x20, 0xba, 0x4a, 0x55, 0xd7, 0x3f,
+			 0x47, 0xba, 0x25, 0x23, 0x14, 0xb0, 0x2c, 0xe8,
+			 0x55, 0xa8, 0xa6, 0xef, 0x51, 0xbd, 0x6f, 0x6a},
+			{0x71, 0xd6, 0x16, 0x76, 0xb2, 0x06, 0xea, 0x79,
+			 0xf5, 0xc4, 0xc3, 0x52, 0x7e, 0x61, 0xd1, 0xe1,
+			 0xad, 0x70, 0x78, 0x1d, 0x16, 0x11, 0xf8, 0x7c,
+			 0x2b, 0xfc, 0x55, 0x9f, 0x52, 0xf8, 0xf5, 0x16}
+		},
+		{
+			{0xa8, 0x0c, 0x32, 0x8f, 0x2a, 0x53, 0x45, 0x34,
+			 0xca, 0x3b, 0xcc, 0xfa, 0x4d, 0x4a, 0x76, 0xc5,
+			 0xb2, 0x74, 0xd7, 0x11, 0xbb, 0xee, 0x4b, 0xf7,
+			 0x5f, 0x4b, 0xd0, 0x52, 0x5f, 0x90, 0x5d, 0x45},
+			{0xb5, 0xa8, 0xe6, 0x0f, 0x47, 0x60, 0x74, 0x65,
+			 0x54, 0x28, 0xc0, 0xa6, 0xac, 0x9b, 0xef, 0x1e,
+			 0x3b, 0x91, 0xc7, 0xb0, 0x7b, 0x22, 0xbc, 0x69,
+			 0x2b, 0xc7, 0x5f, 0x1d, 0x27, 0xbf, 0x3d, 0x03}
+		},
+		{
+			{0x9a, 0x43, 0x20, 0xca, 0x3d, 0x64, 0x64, 0xf2,
+			 0xaa, 0xe9, 0x91, 0x04, 0x9e, 0x54, 0x06, 0x57,
+			 0x67, 0xab, 0x6d, 0x90, 0x1a, 0x5f, 0x70, 0x7f,
+			 0x73, 0x71, 0x36, 0x5e, 0x2a, 0x7f, 0x4e, 0x58},
+			{0x81, 0x13, 0x7c, 0x54, 0x4e, 0xfe, 0xf8, 0x22,
+			 0x96, 0x5d, 0xf6, 0xc0, 0x0e, 0x32, 0x47, 0x33,
+			 0x84, 0xb8, 0xe9, 0xc0, 0xdb, 0xf3, 0x32, 0x12,
+			 0xe8, 0xdf, 0x30, 0x2a, 0x98, 0x27, 0x53, 0x2e}
+		},
+		{
+			{0xce, 0x8f, 0xde, 0x25, 0xc7, 0x57, 0x6e, 0x66,
+			 0xa6, 0xa9, 0xbd, 0x6a, 0xed, 0x2f, 0xce, 0x11,
+			 0x5d, 0x08, 0xe2, 0xc7, 0xd8, 0x39, 0xc8, 0xe0,
+			 0xd4, 0x8b, 0x2f, 0xf5, 0x19, 0xd6, 0x83, 0x77},
+			{0x4d, 0x5c, 0x0c, 0x60, 0xc4, 0xcf, 0x05, 0xb0,
+			 0x38, 0x82, 0x0d, 0x10, 0x1a, 0xac, 0x53, 0x44,
+			 0xfd, 0xeb, 0xe9, 0x99, 0x3d, 0x12, 0x42, 0x83,
+			 0xfe, 0x09, 0xd6, 0x01, 0x37, 0xc3, 0x87, 0x7b}
+		},
+		{
+			{0x34, 0x96, 0x9a, 0xf6, 0xc5, 0xe0, 0x14, 0x03,
+			 0x24, 0x0e, 0x4c, 0xad, 0x9e, 0x9a, 0x70, 0x23,
+			 0x96, 0xb2, 0xf1, 0x2e, 0x9d, 0xc3, 0x32, 0x9b,
+			 0x54, 0xa5, 0x73, 0xde, 0x88, 0xb1, 0x3e, 0x24},
+			{0xf6, 0xe2, 0x4c, 0x1f, 0x5b, 0xb2, 0xaf, 0x82,
+			 0xa5, 0xcf, 0x81, 0x10, 0x04, 0xef, 0xdb, 0xa2,
+			 0xcc, 0x24, 0xb2, 0x7e, 0x0b, 0x7a, 0xeb, 0x01,
+			 0xd8, 0x52, 0xf4, 0x51, 0x89, 0x29, 0x79, 0x37}
+		}
+	},
+#endif
+#if (6 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x77, 0x3a, 0xd4, 0xd8, 0x27, 0xcf, 0xe8, 0xa1,
+			 0x72, 0x9d, 0xca, 0xdd, 0x0d, 0x96, 0xda, 0x79,
+			 0xed, 0x56, 0x42, 0x15, 0x60, 0xc7, 0x1c, 0x6b,
+			 0x26, 0x30, 0xf6, 0x6a, 0x95, 0x67, 0xf3, 0x0a},
+			{0xc5, 0x08, 0xa4, 0x2b, 0x2f, 0xbd, 0x31, 0x81,
+			 0x2a, 0xa6, 0xb6, 0xe4, 0x00, 0x91, 0xda, 0x3d,
+			 0xb2, 0xb0, 0x96, 0xce, 0x8a, 0xd2, 0x8d, 0x70,
+			 0xb3, 0xd3, 0x34, 0x01, 0x90, 0x8d, 0x10, 0x21}
+		},
+		{
+			{0x33, 0x0d, 0xe7, 0xba, 0x4f, 0x07, 0xdf, 0x8d,
+			 0xea, 0x7d, 0xa0, 0xc5, 0xd6, 0xb1, 0xb0, 0xe5,
+			 0x57, 0x1b, 0x5b, 0xf5, 0x45, 0x13, 0x14, 0x64,
+			 0x5a, 0xeb, 0x5c, 0xfc, 0x54, 0x01, 0x76, 0x2b},
+			{0x02, 0x0c, 0xc2, 0xaf, 0x96, 0x36, 0xfe, 0x4a,
+			 0xe2, 0x54, 0x20, 0x6a, 0xeb, 0xb2, 0x9f, 0x62,
+			 0xd7, 0xce, 0xa2, 0x3f, 0x20, 0x11, 0x34, 0x37,
+			 0xe0, 0x42, 0xed, 0x6f, 0xf9, 0x1a, 0xc8, 0x7d}
+		},
+		{
+			{0xd8, 0xb9, 0x11, 0xe8, 0x36, 0x3f, 0x42, 0xc1,
+			 0xca, 0xdc, 0xd3, 0xf1, 0xc8, 0x23, 0x3d, 0x4f,
+			 0x51, 0x7b, 0x9d, 0x8d, 0xd8, 0xe4, 0xa0, 0xaa,
+			 0xf3, 0x04, 0xd6, 0x11, 0x93, 0xc8, 0x35, 0x45},
+			{0x61, 0x36, 0xd6, 0x08, 0x90, 0xbf, 0xa7, 0x7a,
+			 0x97, 0x6c, 0x0f, 0x84, 0xd5, 0x33, 0x2d, 0x37,
+			 0xc9, 0x6a, 0x80, 0x90, 0x3d, 0x0a, 0xa2, 0xaa,
+			 0xe1, 0xb8, 0x84, 0xba, 0x61, 0x36, 0xdd, 0x69}
+		},
+		{
+			{0x6b, 0xdb, 0x5b, 0x9c, 0xc6, 0x92, 0xbc, 0x23,
+			 0xaf, 0xc5, 0xb8, 0x75, 0xf8, 0x42, 0xfa, 0xd6,
+			 0xb6, 0x84, 0x94, 0x63, 0x98, 0x93, 0x48, 0x78,
+			 0x38, 0xcd, 0xbb, 0x18, 0x34, 0xc3, 0xdb, 0x67},
+			{0x96, 0xf3, 0x3a, 0x09, 0x56, 0xb0, 0x6f, 0x7c,
+			 0x51, 0x1e, 0x1b, 0x39, 0x48, 0xea, 0xc9, 0x0c,
+			 0x25, 0xa2, 0x7a, 0xca, 0xe7, 0x92, 0xfc, 0x59,
+			 0x30, 0xa3, 0x89, 0x85, 0xdf, 0x6f, 0x43, 0x38}
+		},
+		{
+			{0x11, 0x10, 0xdd, 0xeb, 0xb3, 0x49, 0xaa, 0xa3,
+			 0xbd, 0xd8, 0x1b, 0x7a, 0x49, 0x79, 0x13, 0x62,
+			 0xd7, 0xcf, 0xc5, 0x89, 0x33, 0xf6, 0xbc, 0x6e,
+			 0x0c, 0xab, 0xb9, 0x25, 0x81, 0xb6, 0xf0, 0x69},
+			{0xd6, 0x69, 0x36, 0xdc, 0x47, 0x7a, 0x6b, 0xd4,
+			 0x33, 0x52, 0xc5, 0x63, 0xd7, 0x1a, 0x4e, 0x44,
+			 0xfe, 0x2d, 0xe3, 0xfb, 0xc4, 0xca, 0xec, 0x90,
+			 0x46, 0x17, 0x28, 0x9c, 0xa1, 0x89, 0x2a, 0x0d}
+		},
+		{
+			{0xeb, 0xf8, 0x12, 0x51, 0xfa, 0x5f, 0x9d, 0x18,
+			 0x67, 0xea, 0x1f, 0x03, 0x55, 0x8d, 0xca, 0xdf,
+			 0x53, 0x8f, 0x9f, 0xc0, 0xd2, 0x6c, 0x8c, 0xd0,
+			 0x2c, 0xd4, 0x45, 0x39, 0x9a, 0x72, 0xd9, 0x34},
+			{0xb1, 0x79, 0x62, 0x4c, 0x40, 0xcf, 0xb3, 0x0d,
+			 0x37, 0x60, 0xe7, 0x64, 0x33, 0x55, 0x01, 0x7c,
+			 0x70, 0x68, 0xe1, 0x50, 0xee, 0x54, 0x61, 0xb4,
+			 0x4e, 0xd2, 0x03, 0xbd, 0x05, 0xef, 0xef, 0x65}
+		},
+		{
+			{0x4c, 0x4e, 0x6f, 0xc9, 0x03, 0x04, 0xe3, 0x58,
+			 0x8a, 0x10, 0xe6, 0x97, 0x87, 0x88, 0xf0, 0x49,
+			 0xf4, 0x67, 0xc8, 0x69, 0xa8, 0x62, 0x27, 0x83,
+			 0x82, 0x02, 0x3d, 0x6d, 0x00, 0x64, 0x1b, 0x27},
+			{0xd9, 0xd7, 0xbd, 0x50, 0xdf, 0x45, 0x80, 0x32,
+			 0xab, 0xec, 0xed, 0x03, 0x79, 0x2e, 0xef, 0x53,
+			 0xb0, 0x03, 0xd8, 0x39, 0x10, 0x8f, 0x64, 0xfc,
+			 0xc2, 0x01, 0x9c, 0x0b, 0x31, 0x46, 0x07, 0x6e}
+		},
+		{
+			{0x79, 0x84, 0x44, 0x19, 0xbd, 0xe9, 0x54, 0xc4,
+			 0xc0, 0x6e, 0x2a, 0xa8, 0xa8, 0x9b, 0x43, 0xd5,
+			 0x71, 0x22, 0x5f, 0xdc, 0x01, 0xfa, 0xdf, 0xb3,
+			 0xb8, 0x47, 0x4b, 0x0a, 0xa5, 0x44, 0xea, 0x29},
+			{0x05, 0x90, 0x50, 0xaf, 0x63, 0x5f, 0x9d, 0x9e,
+			 0xe1, 0x9d, 0x38, 0x97, 0x1f, 0x6c, 0xac, 0x30,
+			 0x46, 0xb2, 0x6a, 0x19, 0xd1, 0x4b, 0xdb, 0xbb,
+			 0x8c, 0xda, 0x2e, 0xab, 0xc8, 0x5a, 0x77, 0x6c}
+		}
+	},
+#endif
+#if (8 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xbb, 0x0c, 0xbc, 0x6a, 0xa4, 0x97, 0x17, 0x93,
+			 0x2d, 0x6f, 0xde, 0x72, 0x10, 0x1c, 0x08, 0x2c,
+			 0x0f, 0x80, 0x32, 0x68, 0x27, 0xd4, 0xab, 0xdd,
+			 0xc5, 0x58, 0x61, 0x13, 0x6d, 0x11, 0x1e, 0x4d},
+			{0x1a, 0xb9, 0xc9, 0x10, 0xfb, 0x1e, 0x4e, 0xf4,
+			 0x84, 0x4b, 0x8a, 0x5e, 0x7b, 0x4b, 0xe8, 0x43,
+			 0x8c, 0x8f, 0x00, 0xb5, 0x54, 0x13, 0xc5, 0x5c,
+			 0xb6, 0x35, 0x4e, 0x9d, 0xe4, 0x5b, 0x41, 0x6d}
+		},
+		{
+			{0x15, 0x7d, 0x12, 0x48, 0x82, 0x14, 0x42, 0xcd,
+			 0x32, 0xd4, 0x4b, 0xc1, 0x72, 0x61, 0x2a, 0x8c,
+			 0xec, 0xe2, 0xf8, 0x24, 0x45, 0x94, 0xe3, 0xbe,
+			 0xdd, 0x67, 0xa8, 0x77, 0x5a, 0xae, 0x5b, 0x4b},
+			{0xcb, 0x77, 0x9a, 0x20, 0xde, 0xb8, 0x23, 0xd9,
+			 0xa0, 0x0f, 0x8c, 0x7b, 0xa5, 0xcb, 0xae, 0xb6,
+			 0xec, 0x42, 0x67, 0x0e, 0x58, 0xa4, 0x75, 0x98,
+			 0x21, 0x71, 0x84, 0xb3, 0xe0, 0x76, 0x94, 0x73}
+		},
+		{
+			{0xf9, 0xc8, 0xec, 0x18, 0x5a, 0x7e, 0x16, 0x1f,
+			 0x5f, 0xba, 0x39, 0xc7, 0x87, 0xab, 0x61, 0xae,
+			 0xf1, 0xd4, 0x82, 0x98, 0x75, 0x5a, 0x38, 0x50,
+			 0xf0, 0x24, 0xe6, 0xeb, 0x9e, 0x1e, 0xe0, 0x28},
+			{0xc1, 0x68, 0x8a, 0xa5, 0xa0, 0x82, 0x76, 0x7b,
+			 0x2a, 0x5e, 0x64, 0x9b, 0xf6, 0xb4, 0xa1, 0xd3,
+			 0x8d, 0x04, 0x71, 0xab, 0xc1, 0xa7, 0x93, 0x62,
+			 0x9b, 0x42, 0x89, 0x80, 0x20, 0xef, 0xa3, 0x34}
+		},
+		{
+			{0xdf, 0xfc, 0x69, 0x28, 0x23, 0x3f, 0x5b, 0xf8,
+			 0x3b, 0x24, 0x37, 0xf3, 0x1d, 0xd5, 0x22, 0x6b,
+			 0xd0, 0x98, 0xa8, 0x6c, 0xcf, 0xff, 0x06, 0xe1,
+			 0x13, 0xdf, 0xb9, 0xc1, 0x0c, 0xa9, 0xbf, 0x33},
+			{0xd9, 0x81, 0xda, 0xb2, 0x4f, 0x82, 0x9d, 0x43,
+			 0x81, 0x09, 0xf1, 0xd2, 0x01, 0xef, 0xac, 0xf4,
+			 0x2d, 0x7d, 0x01, 0x09, 0xf1, 0xff, 0xa5, 0x9f,
+			 0xe5, 0xca, 0x27, 0x63, 0xdb, 0x20, 0xb1, 0x53}
+		},
+		{
+			{0x99, 0xcc, 0x10, 0x11, 0x4a, 0x0b, 0xf7, 0x94,
+			 0xc6, 0x02, 0x22, 0xda, 0xbb, 0xe2, 0x6c, 0xf3,
+			 0x2a, 0xbb, 0xa6, 0xcc, 0x82, 0xf6, 0x6f, 0x11,
+			 0x87, 0xac, 0xd6, 0x61, 0xf9, 0xa4, 0x59, 0x67},
+			{0x35, 0xaf, 0xf8, 0xec, 0x61, 0x3f, 0xa4, 0x3c,
+			 0x63, 0x16, 0xbe, 0x05, 0x26, 0x1a, 0x01, 0xb1,
+			 0xd4, 0x36, 0x00, 0x60, 0x11, 0x12, 0x59, 0xb2,
+			 0xc7, 0x44, 0x5f, 0xca, 0x2d, 0x7c, 0x6c, 0x7e}
+		},
+		{
+			{0x67, 0x02, 0xe8, 0xad, 0xa9, 0x34, 0xd4, 0xf0,
+			 0x15, 0x81, 0xaa, 0xc7, 0x4d, 0x87, 0x94, 0xea,
+			 0x75, 0xe7, 0x4c, 0x94, 0x04, 0x0e, 0x69, 0x87,
+			 0xe7, 0x51, 0x91, 0x10, 0x03, 0xc7, 0xbe, 0x56},
+			{0x32, 0xfb, 0x86, 0xec, 0x33, 0x6b, 0x2e, 0x51,
+			 0x2b, 0xc8, 0xfa, 0x6c, 0x70, 0x47, 0x7e, 0xce,
+			 0x05, 0x0c, 0x71, 0xf3, 0xb4, 0x56, 0xa6, 0xdc,
+			 0xcc, 0x78, 0x07, 0x75, 0xd0, 0xdd, 0xb2, 0x6a}
+		},
+		{
+			{0xbc, 0x82, 0x7c, 0x0a, 0x53, 0xd6, 0x0b, 0x42,
+			 0xd0, 0x28, 0xeb, 0xb5, 0xa7, 0xe0, 0xda, 0x05,
+			 0x63, 0xc5, 0x29, 0xa0, 0x17, 0xa8, 0xf3, 0xad,
+			 0x7d, 0x86, 0x60, 0x2c, 0xdc, 0xfb, 0xbe, 0x4b},
+			{0x07, 0x81, 0x53, 0x49, 0x68, 0x3f, 0x0e, 0x04,
+			 0x95, 0xa0, 0x08, 0x07, 0xe1, 0x47, 0x35, 0xac,
+			 0xf7, 0x74, 0x3e, 0xcc, 0x5d, 0xce, 0xd1, 0x79,
+			 0xc9, 0x2d, 0x0c, 0x9c, 0xc8, 0x5c, 0xb8, 0x6e}
+		},
+		{
+			{0xc6, 0xef, 0xb9, 0xc0, 0x2b, 0x22, 0x08, 0x1e,
+			 0x71, 0x70, 0xb3, 0x35, 0x9c, 0x7a, 0x01, 0x92,
+			 0x44, 0x9a, 0xf6, 0xb0, 0x58, 0x95, 0xc1, 0x9b,
+			 0x02, 0xed, 0x2d, 0x7c, 0x34, 0x29, 0x49, 0x44},
+			{0x45, 0x62, 0x1d, 0x2e, 0xff, 0x2a, 0x1c, 0x21,
+			 0xa4, 0x25, 0x7b, 0x0d, 0x8c, 0x15, 0x39, 0xfc,
+			 0x8f, 0x7c, 0xa5, 0x7d, 0x1e, 0x25, 0xa3, 0x45,
+			 0xd6, 0xab, 0xbd, 0xcb, 0xc5, 0x5e, 0x78, 0x77}
+		}
+	},
+#endif
+#if (10 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xe5, 0x10, 0x47, 0x3b, 0xfa, 0x90, 0xfc, 0x30,
+			 0xb5, 0xea, 0x6f, 0x56, 0x8f, 0xfb, 0x0e, 0xa7,
+			 0x3b, 0xc8, 0xb2, 0xff, 0x02, 0x7a, 0x33, 0x94,
+			 0x93, 0x2a, 0x03, 0xe0, 0x96, 0x3a, 0x6c, 0x0f},
+			{0x5a, 0x63, 0x67, 0xe1, 0x9b, 0x47, 0x78, 0x9f,
+			 0x38, 0x79, 0xac, 0x97, 0x66, 0x1d, 0x5e, 0x51,
+			 0xee, 0x24, 0x42, 0xe8, 0x58, 0x4b, 0x8a, 0x03,
+			 0x75, 0x86, 0x37, 0x86, 0xe2, 0x97, 0x4e, 0x3d}
+		},
+		{
+			{0x40, 0xb4, 0xab, 0xe6, 0xad, 0x9f, 0x46, 0x69,
+			 0x4a, 0xb3, 0x8e, 0xaa, 0xea, 0x9c, 0x8a, 0x20,
+			 0x16, 0x5d, 0x8c, 0x13, 0xbd, 0xf6, 0x1d, 0xc5,
+			 0x24, 0xbd, 0x90, 0x2a, 0x1c, 0xc7, 0x13, 0x3b},
+			{0x54, 0xdc, 0x16, 0x0d, 0x18, 0xbe, 0x35, 0x64,
+			 0x61, 0x52, 0x02, 0x80, 0xaf, 0x05, 0xf7, 0xa6,
+			 0x42, 0xd3, 0x8f, 0x2e, 0x79, 0x26, 0xa8, 0xbb,
+			 0xb2, 0x17, 0x48, 0xb2, 0x7a, 0x0a, 0x89, 0x14}
+		},
+		{
+			{0x2b, 0x64, 0x1d, 0xfd, 0xf5, 0x20, 0x33, 0xdf,
+			 0xed, 0x74, 0x18, 0xc3, 0x94, 0x61, 0xcc, 0x8f,
+			 0xd0, 0x89, 0x51, 0xb3, 0x68, 0x95, 0x66, 0x7f,
+			 0x78, 0xfd, 0xdf, 0x8f, 0xcb, 0xfc, 0x83, 0x79},
+			{0x55, 0x68, 0x43, 0x6a, 0x22, 0x63, 0xd9, 0xbb,
+			 0xab, 0xb5, 0x9a, 0x57, 0xe5, 0x9e, 0xe1, 0x3d,
+			 0x48, 0x50, 0xba, 0xae, 0x1d, 0x57, 0x27, 0x29,
+			 0xcc, 0xcc, 0xb0, 0xf1, 0xb8, 0xcd, 0x0f, 0x3c}
+		},
+		{
+			{0x20, 0xa8, 0x88, 0xe3, 0x91, 0xc0, 0x6e, 0xbb,
+			 0x8a, 0x27, 0x82, 0x51, 0x83, 0xb2, 0x28, 0xa9,
+			 0x83, 0xeb, 0xa6, 0xa9, 0x4d, 0x17, 0x59, 0x22,
+			 0x54, 0x00, 0x50, 0x45, 0xcb, 0x48, 0x4b, 0x18},
+			{0x33, 0x7c, 0xe7, 0x26, 0xba, 0x4d, 0x32, 0xfe,
+			 0x53, 0xf4, 0xfa, 0x83, 0xe3, 0xa5, 0x79, 0x66,
+			 0x73, 0xef, 0x80, 0x23, 0x68, 0xc2, 0x60, 0xdd,
+			 0xa9, 0x33, 0xdc, 0x03, 0x7a, 0xe0, 0xe0, 0x3e}
+		},
+		{
+			{0x13, 0xc1, 0x59, 0xb8, 0x64, 0x23, 0x86, 0x4d,
+			 0x8f, 0xac, 0xfc, 0x29, 0x95, 0x56, 0xff, 0xc3,
+			 0x52, 0x87, 0xa1, 0xb1, 0x0e, 0x46, 0x8f, 0xd8,
+			 0xf1, 0x8f, 0x34, 0xe6, 0x7a, 0xbc, 0x17, 0x5d},
+			{0x3d, 0xa2, 0x65, 0x57, 0xed, 0xf1, 0xcf, 0x85,
+			 0x17, 0x4f, 0x51, 0xa5, 0xb0, 0x03, 0x05, 0x44,
+			 0x6f, 0x19, 0x9e, 0xd5, 0xad, 0x09, 0x33, 0x16,
+			 0xf6, 0x82, 0x66, 0xf0, 0xc1, 0xa8, 0xda, 0x53}
+		},
+		{
+			{0xce, 0x76, 0x63, 0x65, 0xad, 0x47, 0x87, 0xf4,
+			 0xa3, 0xcb, 0xb4, 0x53, 0x8a, 0x20, 0xc2, 0x84,
+			 0x19, 0x69, 0x73, 0x1a, 0x0e, 0x0e, 0x7c, 0x54,
+			 0xc9, 0x46, 0xb5, 0x8a, 0x36, 0xe1, 0x86, 0x2d},
+			{0xf2, 0x94, 0x43, 0xf0, 0x29, 0x44, 0xc1, 0x3b,
+			 0x43, 0x77, 0x1f, 0x9e, 0x1a, 0x95, 0x14, 0x82,
+			 0x48, 0xf8, 0xe5, 0xa1, 0x90, 0x98, 0x55, 0x96,
+			 0xbb, 0xb0, 0x10, 0x63, 0x61, 0x38, 0x25, 0x0b}
+		},
+		{
+			{0xd1, 0x69, 0x97, 0xa6, 0x69, 0x43, 0x88, 0xe4,
+			 0x1a, 0x5b, 0xcf, 0x92, 0x46, 0xaa, 0xaa, 0x40,
+			 0x89, 0x9b, 0xe5, 0xf0, 0x83, 0xc6, 0x08, 0x75,
+			 0x55, 0x91, 0x42, 0xe8, 0x5b, 0x38, 0x60, 0x52},
+			{0xbd, 0x76, 0xa4, 0x69, 0x4a, 0x16, 0x64, 0x72,
+			 0x4e, 0x9e, 0x8a, 0x3f, 0xa6, 0x10, 0x39, 0xee,
+			 0xa8, 0x31, 0x10, 0x23, 0x10, 0xec, 0x73, 0x04,
+			 0x1d, 0x53, 0x8b, 0x3c, 0x1c, 0x4f, 0x89, 0x3d}
+		},
+		{
+			{0x34, 0x5c, 0x13, 0xfb, 0xc0, 0xe3, 0x78, 0x2b,
+			 0x54, 0x58, 0x22, 0x9b, 0x76, 0x81, 0x7f, 0x93,
+			 0x9c, 0x25, 0x3c, 0xd2, 0xe9, 0x96, 0x21, 0x26,
+			 0x08, 0xf5, 0xed, 0x95, 0x11, 0xae, 0x04, 0x5a},
+			{0xb9, 0xe8, 0xc5, 0x12, 0x97, 0x1f, 0x83, 0xfe,
+			 0x3e, 0x94, 0x99, 0xd4, 0x2d, 0xf9, 0x52, 0x59,
+			 0x5c, 0x82, 0xa6, 0xf0, 0x75, 0x7e, 0xe8, 0xec,
+			 0xcc, 0xac, 0x18, 0x21, 0x09, 0x67, 0x66, 0x67}
+		}
+	},
+#endif
+#if (12 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x52, 0xfd, 0x04, 0xc5, 0xfb, 0x99, 0xe7, 0xe8,
+			 0xfb, 0x8c, 0xe1, 0x42, 0x03, 0xef, 0x9d, 0xd9,
+			 0x9e, 0x4d, 0xf7, 0x80, 0xcf, 0x2e, 0xcc, 0x9b,
+			 0x45, 0xc9, 0x7b, 0x7a, 0xbc, 0x37, 0xa8, 0x52},
+			{0x96, 0x11, 0x41, 0x8a, 0x47, 0x91, 0xfe, 0xb6,
+			 0xda, 0x7a, 0x54, 0x63, 0xd1, 0x14, 0x35, 0x05,
+			 0x86, 0x8c, 0xa9, 0x36, 0x3f, 0xf2, 0x85, 0x54,
+			 0x4e, 0x92, 0xd8, 0x85, 0x01, 0x46, 0xd6, 0x50}
+		},
+		{
+			{0x53, 0xcd, 0xf3, 0x86, 0x40, 0xe6, 0x39, 0x42,
+			 0x95, 0xd6, 0xcb, 0x45, 0x1a, 0x20, 0xc8, 0x45,
+			 0x4b, 0x32, 0x69, 0x04, 0xb1, 0xaf, 0x20, 0x46,
+			 0xc7, 0x6b, 0x23, 0x5b, 0x69, 0xee, 0x30, 0x3f},
+			{0x70, 0x83, 0x47, 0xc0, 0xdb, 0x55, 0x08, 0xa8,
+			 0x7b, 0x18, 0x6d, 0xf5, 0x04, 0x5a, 0x20, 0x0c,
+			 0x4a, 0x8c, 0x60, 0xae, 0xae, 0x0f, 0x64, 0x55,
+			 0x55, 0x2e, 0xd5, 0x1d, 0x53, 0x31, 0x42, 0x41}
+		},
+		{
+			{0xca, 0xfc, 0x88, 0x6b, 0x96, 0x78, 0x0a, 0x8b,
+			 0x83, 0xdc, 0xbc, 0xaf, 0x40, 0xb6, 0x8d, 0x7f,
+			 0xef, 0xb4, 0xd1, 0x3f, 0xcc, 0xa2, 0x74, 0xc9,
+			 0xc2, 0x92, 0x55, 0x00, 0xab, 0xdb, 0xbf, 0x4f},
+			{0x93, 0x1c, 0x06, 0x2d, 0x66, 0x65, 0x02, 0xa4,
+			 0x97, 0x18, 0xfd, 0x00, 0xe7, 0xab, 0x03, 0xec,
+			 0xce, 0xc1, 0xbf, 0x37, 0xf8, 0x13, 0x53, 0xa5,
+			 0xe5, 0x0c, 0x3a, 0xa8, 0x55, 0xb9, 0xff, 0x68}
+		},
+		{
+			{0xe4, 0xe6, 0x6d, 0x30, 0x7d, 0x30, 0x35, 0xc2,
+			 0x78, 0x87, 0xf9, 0xfc, 0x6b, 0x5a, 0xc3, 0xb7,
+			 0x65, 0xd8, 0x2e, 0xc7, 0xa5, 0x0c, 0xc6, 0xdc,
+			 0x12, 0xaa, 0xd6, 0x4f, 0xc5, 0x38, 0xbc, 0x0e},
+			{0xe2, 0x3c, 0x76, 0x86, 0x38, 0xf2, 0x7b, 0x2c,
+			 0x16, 0x78, 0x8d, 0xf5, 0xa4, 0x15, 0xda, 0xdb,
+			 0x26, 0x85, 0xa0, 0x56, 0xdd, 0x1d, 0xe3, 0xb3,
+			 0xfd, 0x40, 0xef, 0xf2, 0xd9, 0xa1, 0xb3, 0x04}
+		},
+		{
+			{0xac, 0xa6, 0x41, 0x72, 0x64, 0x85, 0x31, 0xa9,
+			 0x17, 0xa6, 0x00, 0xfd, 0x0e, 0x83, 0xea, 0x07,
+			 0x4b, 0xae, 0x38, 0x57, 0xb6, 0x2b, 0xd4, 0x8a,
+			 0x34, 0xeb, 0xdf, 0x40, 0xb0, 0x53, 0xc0, 0x14},
+			{0xc0, 0xd3, 0xee, 0xd0, 0x9c, 0xeb, 0x28, 0xf4,
+			 0x47, 0xfe, 0x7c, 0xc7, 0x8f, 0x5b, 0x79, 0xa8,
+			 0x88, 0xcc, 0x59, 0x67, 0x9c, 0xd2, 0xe7, 0x97,
+			 0x37, 0x57, 0x60, 0xbc, 0x91, 0x70, 0xc7, 0x7e}
+		},
+		{
+			{0x8b, 0xfd, 0x99, 0x0d, 0x24, 0x43, 0x6f, 0xfe,
+			 0xeb, 0x61, 0x7d, 0xfa, 0x44, 0xae, 0xa1, 0xd3,
+			 0x03, 0x36, 0xab, 0xd7, 0x2d, 0xfd, 0xa5, 0xc2,
+			 0x47, 0xe0, 0xa8, 0xfb, 0xed, 0xba, 0x18, 0x65},
+			{0x46, 0x4a, 0xf0, 0xa4, 0xb4, 0x74, 0x9e, 0xa7,
+			 0x05, 0x43, 0xf3, 0x1c, 0x91, 0x66, 0x1d, 0xd3,
+			 0x54, 0x87, 0x32, 0x7c, 0x65, 0xfb, 0xfb, 0x11,
+			 0xa2, 0x63, 0x99, 0x38, 0x75, 0x8f, 0x38, 0x07}
+		},
+		{
+			{0x53, 0x7d, 0xd3, 0xb5, 0x7b, 0xc7, 0x15, 0xd3,
+			 0xb2, 0x6a, 0x84, 0x60, 0x4c, 0x6a, 0x7d, 0xf8,
+			 0xee, 0x2f, 0x22, 0x31, 0xc3, 0xf8, 0x22, 0x4e,
+			 0x59, 0x17, 0xd9, 0xa1, 0x7e, 0x30, 0xad, 0x78},
+			{0x2d, 0x1a, 0x79, 0x12, 0xe2, 0x55, 0xe0, 0x41,
+			 0x53, 0x17, 0xbd, 0x8e, 0x97, 0x8f, 0xc4, 0xa0,
+			 0xbd, 0x47, 0x40, 0x03, 0xcc, 0xbf, 0xd2, 0x7f,
+			 0x50, 0x62, 0xb1, 0x6c, 0x7b, 0x07, 0x1b, 0x60}
+		},
+		{
+			{0xdb, 0x49, 0x0e, 0xe6, 0x58, 0x10, 0x7a, 0x52,
+			 0xda, 0xb5, 0x7d, 0x37, 0x6a, 0x3e, 0xa1, 0x78,
+			 0xce, 0xc7, 0x1c, 0x24, 0x23, 0xdb, 0x7d, 0xfb,
+			 0x8c, 0x8d, 0xdc, 0x30, 0x67, 0x69, 0x75, 0x3b},
+			{0xa9, 0xea, 0x6d, 0x16, 0x16, 0x60, 0xf4, 0x60,
+			 0x87, 0x19, 0x44, 0x8c, 0x4a, 0x8b, 0x3e, 0xfb,
+			 0x16, 0x00, 0x00, 0x54, 0xa6, 0x9e, 0x9f, 0xef,
+			 0xcf, 0xd9, 0xd2, 0x4c, 0x74, 0x31, 0xd0, 0x34}
+		}
+	},
+#endif
+#if (14 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xe4, 0x0d, 0xf4, 0xbd, 0xee, 0x31, 0x10, 0xed,
+			 0xcb, 0x12, 0x86, 0xad, 0xd4, 0x2f, 0x90, 0x37,
+			 0x32, 0xc3, 0x0b, 0x73, 0xec, 0x97, 0x85, 0xa4,
+			 0x01, 0x1c, 0x76, 0x35, 0xfe, 0x75, 0xdd, 0x71},
+			{0x11, 0xa4, 0x88, 0x9f, 0x3e, 0x53, 0x69, 0x3b,
+			 0x1b, 0xe0, 0xf7, 0xba, 0x9b, 0xad, 0x4e, 0x81,
+			 0x5f, 0xb5, 0x5c, 0xae, 0xbe, 0x67, 0x86, 0x37,
+			 0x34, 0x8e, 0x07, 0x32, 0x45, 0x4a, 0x67, 0x39}
+		},
+		{
+			{0x90, 0x70, 0x58, 0x20, 0x03, 0x1e, 0x67, 0xb2,
+			 0xc8, 0x9b, 0x58, 0xc5, 0xb1, 0xeb, 0x2d, 0x4a,
+			 0xde, 0x82, 0x8c, 0xf2, 0xd2, 0x14, 0xb8, 0x70,
+			 0x61, 0x4e, 0x73, 0xd6, 0x0b, 0x6b, 0x0d, 0x30},
+			{0x81, 0xfc, 0x55, 0x5c, 0xbf, 0xa7, 0xc4, 0xbd,
+			 0xe2, 0xf0, 0x4b, 0x8f, 0xe9, 0x7d, 0x99, 0xfa,
+			 0xd3, 0xab, 0xbc, 0xc7, 0x83, 0x2b, 0x04, 0x7f,
+			 0x0c, 0x19, 0x43, 0x03, 0x3d, 0x07, 0xca, 0x40}
+		},
+		{
+			{0x32, 0x52, 0x90, 0x36, 0xed, 0xb7, 0x33, 0x44,
+			 0x37, 0xc3, 0x3f, 0x11, 0xe7, 0x83, 0x35, 0x94,
+			 0xbf, 0xa4, 0x9b, 0x28, 0xcf, 0x34, 0x4a, 0xd8,
+			 0x68, 0xdd, 0x01, 0x56, 0xa9, 0x59, 0xeb, 0x0c},
+			{0x85, 0x5a, 0x61, 0x61, 0x2b, 0x58, 0x93, 0xf9,
+			 0xa0, 0xf8, 0x25, 0xb0, 0x77, 0xf9, 0xa4, 0xc9,
+			 0x4f, 0x5d, 0x05, 0xe7, 0xcc, 0x26, 0x44, 0x78,
+			 0xed, 0x4c, 0xc3, 0xe1, 0x6d, 0x1b, 0x78, 0x1a}
+		},
+		{
+			{0xf9, 0xc8, 0xbe, 0x8c, 0x16, 0x81, 0x39, 0x96,
+			 0xf6, 0x17, 0x58, 0xc8, 0x30, 0x58, 0xfb, 0xc2,
+			 0x03, 0x45, 0xd2, 0x52, 0x76, 0xe0, 0x6a, 0x26,
+			 0x28, 0x5c, 0x88, 0x59, 0x6a, 0x5a, 0x54, 0x42},
+			{0x07, 0xb5, 0x2e, 0x2c, 0x67, 0x15, 0x9b, 0xfb,
+			 0x83, 0x69, 0x1e, 0x0f, 0xda, 0xd6, 0x29, 0xb1,
+			 0x60, 0xe0, 0xb2, 0xba, 0x69, 0xa2, 0x9e, 0xbd,
+			 0xbd, 0xe0, 0x1c, 0xbd, 0xcd, 0x06, 0x64, 0x70}
+		},
+		{
+			{0xf2, 0x6f, 0x47, 0xa8, 0x68, 0xcf, 0x1e, 0x2c,
+			 0x36, 0x1d, 0xe5, 0x86, 0xf9, 0xf9, 0xf9, 0x8f,
+			 0x8e, 0x5a, 0x66, 0x05, 0xf6, 0x99, 0x27, 0xa3,
+			 0x87, 0x12, 0xb4, 0x8a, 0x61, 0xa0, 0xfb, 0x60},
+			{0x2f, 0x5d, 0x24, 0x80, 0x50, 0x64, 0x8f, 0xb8,
+			 0xa6, 0xb9, 0xb8, 0xce, 0xbc, 0x84, 0xf5, 0x27,
+			 0x91, 0x33, 0x6d, 0xae, 0x29, 0x7a, 0x63, 0x84,
+			 0xfe, 0xaf, 0x8d, 0x97, 0x04, 0xe5, 0xfe, 0x50}
+		},
+		{
+			{0x41, 0xfa, 0x8c, 0xe1, 0x89, 0x8f, 0x27, 0xc8,
+			 0x25, 0x8f, 0x6f, 0x5f, 0x55, 0xf8, 0xde, 0x95,
+			 0x6d, 0x2f, 0x75, 0x16, 0x2b, 0x4e, 0x44, 0xfd,
+			 0x86, 0x6e, 0xe9, 0x70, 0x39, 0x76, 0x97, 0x7e},
+			{0x17, 0x62, 0x6b, 0x14, 0xa1, 0x7c, 0xd0, 0x79,
+			 0x6e, 0xd8, 0x8a, 0xa5, 0x6d, 0x8c, 0x93, 0xd2,
+			 0x3f, 0xec, 0x44, 0x8d, 0x6e, 0x91, 0x01, 0x8c,
+			 0x8f, 0xee, 0x01, 0x8f, 0xc0, 0xb4, 0x85, 0x0e}
+		},
+		{
+			{0xb8, 0x4c, 0x76, 0x25, 0x0b, 0x2a, 0x3d, 0x2b,
+			 0x30, 0x6d, 0xaf, 0x5d, 0x3b, 0xba, 0xcd, 0x98,
+			 0x66, 0xaf, 0x47, 0xc6, 0xf4, 0xd6, 0x09, 0x6c,
+			 0xfb, 0xf9, 0x72, 0x2f, 0x2a, 0x62, 0x08, 0x02},
+			{0xf5, 0x69, 0x11, 0x53, 0xba, 0x9c, 0x1c, 0x9e,
+			 0x8a, 0x91, 0xe1, 0x01, 0x72, 0xe4, 0x13, 0xfc,
+			 0x9d, 0x45, 0xfb, 0xdc, 0x6d, 0x77, 0xd8, 0xaa,
+			 0x04, 0x1d, 0xa3, 0xe8, 0x20, 0x71, 0x46, 0x14}
+		},
+		{
+			{0x02, 0x3a, 0x70, 0x41, 0xe4, 0x11, 0x57, 0x23,
+			 0xac, 0xe6, 0xfc, 0x54, 0x7e, 0xcd, 0xd7, 0x22,
+			 0xcb, 0x76, 0x9f, 0x20, 0xce, 0xa0, 0x73, 0x76,
+			 0x51, 0x3b, 0xa4, 0xf8, 0xe3, 0x62, 0x12, 0x6c},
+			{0x7f, 0x00, 0x9c, 0x26, 0x0d, 0x6f, 0x48, 0x7f,
+			 0x3a, 0x01, 0xed, 0xc5, 0x96, 0xb0, 0x1f, 0x4f,
+			 0xa8, 0x02, 0x62, 0x27, 0x8a, 0x50, 0x8d, 0x9a,
+			 0x8b, 0x52, 0x0f, 0x1e, 0xcf, 0x41, 0x38, 0x19}
+		}
+	},
+#endif
+#if (16 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x02, 0xa2, 0xed, 0xf4, 0x8f, 0x6b, 0x0b, 0x3e,
+			 0xeb, 0x35, 0x1a, 0xd5, 0x7e, 0xdb, 0x78, 0x00,
+			 0x96, 0x8a, 0xa0, 0xb4, 0xcf, 0x60, 0x4b, 0xd4,
+			 0xd5, 0xf9, 0x2d, 0xbf, 0x88, 0xbd, 0x22, 0x62},
+			{0x13, 0x53, 0xe4, 0x82, 0x57, 0xfa, 0x1e, 0x8f,
+			 0x06, 0x2b, 0x90, 0xba, 0x08, 0xb6, 0x10, 0x54,
+			 0x4f, 0x7c, 0x1b, 0x26, 0xed, 0xda, 0x6b, 0xdd,
+			 0x25, 0xd0, 0x4e, 0xea, 0x42, 0xbb, 0x25, 0x03}
+		},
+		{
+			{0x97, 0xa5, 0xdb, 0x8b, 0x2d, 0xaa, 0x42, 0x11,
+			 0x09, 0xf2, 0x93, 0xbb, 0xd9, 0x06, 0x84, 0x4e,
+			 0x11, 0xa8, 0xa0, 0x25, 0x2b, 0xa6, 0x5f, 0xae,
+			 0xc4, 0xb4, 0x4c, 0xc8, 0xab, 0xc7, 0x3b, 0x02},
+			{0xee, 0xc9, 0x29, 0x0f, 0xdf, 0x11, 0x85, 0xed,
+			 0xce, 0x0d, 0x62, 0x2c, 0x8f, 0x4b, 0xf9, 0x04,
+			 0xe9, 0x06, 0x72, 0x1d, 0x37, 0x20, 0x50, 0xc9,
+			 0x14, 0xeb, 0xec, 0x39, 0xa7, 0x97, 0x2b, 0x4d}
+		},
+		{
+			{0x67, 0x34, 0x26, 0x33, 0x0e, 0x64, 0x07, 0x80,
+			 0xd8, 0x10, 0xea, 0xcc, 0xa6, 0xca, 0xa8, 0x2c,
+			 0xdf, 0x61, 0x8a, 0xca, 0x49, 0x8b, 0x9a, 0xc5,
+			 0x41, 0x40, 0x5c, 0xdb, 0x5e, 0x06, 0x2a, 0x13},
+			{0x2f, 0xde, 0xd7, 0x1d, 0x3e, 0xfa, 0x65, 0x98,
+			 0xa5, 0x8e, 0xfe, 0x31, 0xdc, 0xb0, 0x90, 0xb3,
+			 0xd1, 0xcf, 0xe5, 0x85, 0x7b, 0x6b, 0x2d, 0x76,
+			 0x80, 0xf7, 0x32, 0x35, 0x0a, 0xf7, 0x4e, 0x53}
+		},
+		{
+			{0x69, 0xd1, 0x39, 0xbd, 0xfb, 0x33, 0xbe, 0xc4,
+			 0xf0, 0x5c, 0xef, 0xf0, 0x56, 0x68, 0xfc, 0x97,
+			 0x47, 0xc8, 0x72, 0xb6, 0x53, 0xa4, 0x0a, 0x98,
+			 0xa5, 0xb4, 0x37, 0x71, 0xcf, 0x66, 0x50, 0x6d},
+			{0x17, 0xa4, 0x19, 0x52, 0x11, 0x47, 0xb3, 0x5c,
+			 0x5b, 0xa9, 0x2e, 0x22, 0xb4, 0x00, 0x52, 0xf9,
+			 0x57, 0x18, 0xb8, 0xbe, 0x5a, 0xe3, 0xab, 0x83,
+			 0xc8, 0x87, 0x0a, 0x2a, 0xd8, 0x8c, 0xbb, 0x54}
+		},
+		{
+			{0xcd, 0xc2, 0x04, 0x7b, 0x9c, 0x42, 0x72, 0x50,
+			 0x27, 0x0b, 0x9a, 0xb9, 0x0f, 0x31, 0xc0, 0x63,
+			 0x8f, 0x0a, 0xba, 0x74, 0x5a, 0x21, 0x58, 0x7f,
+			 0x34, 0x69, 0x08, 0xdb, 0x7c, 0x8f, 0xff, 0x35},
+			{0x8a, 0x8b, 0xce, 0xa6, 0xba, 0x9c, 0xc4, 0x0f,
+			 0xa9, 0xa8, 0xe1, 0xdf, 0x17, 0x57, 0x1b, 0x4e,
+			 0x6b, 0x60, 0xbb, 0x53, 0x69, 0xe8, 0x69, 0x54,
+			 0x05, 0x5f, 0x15, 0x71, 0x68, 0xcc, 0xe1, 0x50}
+		},
+		{
+			{0x13, 0x02, 0x2e, 0x62, 0x0a, 0x12, 0xf2, 0x2a,
+			 0xa1, 0x85, 0x73, 0x94, 0x64, 0xbc, 0x12, 0x40,
+			 0xe5, 0x28, 0x83, 0x9a, 0x07, 0x87, 0x4e, 0x6b,
+			 0x6f, 0xb2, 0x4b, 0x7f, 0xc1, 0x65, 0x63, 0x6c},
+			{0x82, 0xc7, 0x94, 0x54, 0x9e, 0x49, 0x09, 0x03,
+			 0xeb, 0xd3, 0xb8, 0x60, 0x2a, 0x33, 0xdc, 0x08,
+			 0x8e, 0xec, 0xa9, 0x56, 0x00, 0x0a, 0x32, 0xc8,
+			 0x68, 0xa9, 0xd1, 0xd3, 0xa9, 0x03, 0x57, 0x1c}
+		},
+		{
+			{0xd1, 0x87, 0xd8, 0x5b, 0x67, 0x4c, 0x94, 0x3b,
+			 0x8f, 0xe1, 0xc1, 0x48, 0x18, 0xe5, 0x9d, 0x47,
+			 0x83, 0xea, 0x7c, 0xbe, 0x41, 0x01, 0x30, 0xb8,
+			 0x2c, 0xd5, 0x31, 0x0b, 0xa5, 0x18, 0xb8, 0x68},
+			{0x26, 0x88, 0x39, 0xed, 0xdf, 0xe4, 0x28, 0x47,
+			 0x77, 0xdc, 0xad, 0x35, 0x55, 0x96, 0x85, 0x96,
+			 0x43, 0x8f, 0x6d, 0x53, 0xd7, 0x74, 0xee, 0x28,
+			 0xb2, 0x66, 0x07, 0xc0, 0x3e, 0x23, 0x8b, 0x1e}
+		},
+		{
+			{0xa9, 0x62, 0x93, 0x85, 0xbe, 0xe8, 0x73, 0x4a,
+			 0x0e, 0xb0, 0xb5, 0x2d, 0x94, 0x50, 0xaa, 0xd3,
+			 0xb2, 0xea, 0x9d, 0x62, 0x76, 0x3b, 0x07, 0x34,
+			 0x4e, 0x2d, 0x70, 0xc8, 0x9a, 0x15, 0x66, 0x6b},
+			{0xc5, 0x96, 0xca, 0xc8, 0x22, 0x1a, 0xee, 0x5f,
+			 0xe7, 0x31, 0x60, 0x22, 0x83, 0x08, 0x63, 0xce,
+			 0xb9, 0x32, 0x44, 0x58, 0x5d, 0x3a, 0x9b, 0xe4,
+			 0x04, 0xd5, 0xef, 0x38, 0xef, 0x4b, 0xdd, 0x19}
+		}
+	},
+#endif
+#if (18 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x9f, 0x3e, 0xf2, 0xb2, 0x90, 0xce, 0xdb, 0x64,
+			 0x3e, 0x03, 0xdd, 0x37, 0x36, 0x54, 0x70, 0x76,
+			 0x24, 0xb5, 0x69, 0x03, 0xfc, 0xa0, 0x2b, 0x74,
+			 0xb2, 0x05, 0x0e, 0xcc, 0xd8, 0x1f, 0x6a, 0x1f},
+			{0x19, 0x5e, 0x60, 0x69, 0x58, 0x86, 0xa0, 0x31,
+			 0xbd, 0x32, 0xe9, 0x2c, 0x5c, 0xd2, 0x85, 0xba,
+			 0x40, 0x64, 0xa8, 0x74, 0xf8, 0x0e, 0x1c, 0xb3,
+			 0xa9, 0x69, 0xe8, 0x1e, 0x40, 0x64, 0x99, 0x77}
+		},
+		{
+			{0x6c, 0x32, 0x4f, 0xfd, 0xbb, 0x5c, 0xbb, 0x8d,
+			 0x64, 0x66, 0x4a, 0x71, 0x1f, 0x79, 0xa3, 0xad,
+			 0x8d, 0xf9, 0xd4, 0xec, 0xcf, 0x67, 0x70, 0xfa,
+			 0x05, 0x4a, 0x0f, 0x6e, 0xaf, 0x87, 0x0a, 0x6f},
+			{0xc6, 0x36, 0x6e, 0x6c, 0x8c, 0x24, 0x09, 0x60,
+			 0xbe, 0x26, 0xd2, 0x4c, 0x5e, 0x17, 0xca, 0x5f,
+			 0x1d, 0xcc, 0x87, 0xe8, 0x42, 0x6a, 0xcb, 0xcb,
+			 0x7d, 0x92, 0x05, 0x35, 0x81, 0x13, 0x60, 0x6b}
+		},
+		{
+			{0xf4, 0x15, 0xcd, 0x0f, 0x0a, 0xaf, 0x4e, 0x6b,
+			 0x51, 0xfd, 0x14, 0xc4, 0x2e, 0x13, 0x86, 0x74,
+			 0x44, 0xcb, 0x66, 0x6b, 0xb6, 0x9d, 0x74, 0x56,
+			 0x32, 0xac, 0x8d, 0x8e, 0x8c, 0x8c, 0x8c, 0x39},
+			{0xca, 0x59, 0x74, 0x1a, 0x11, 0xef, 0x6d, 0xf7,
+			 0x39, 0x5c, 0x3b, 0x1f, 0xfa, 0xe3, 0x40, 0x41,
+			 0x23, 0x9e, 0xf6, 0xd1, 0x21, 0xa2, 0xbf, 0xad,
+			 0x65, 0x42, 0x6b, 0x59, 0x8a, 0xe8, 0xc5, 0x7f}
+		},
+		{
+			{0x64, 0x05, 0x7a, 0x84, 0x4a, 0x13, 0xc3, 0xf6,
+			 0xb0, 0x6e, 0x9a, 0x6b, 0x53, 0x6b, 0x32, 0xda,
+			 0xd9, 0x74, 0x75, 0xc4, 0xba, 0x64, 0x3d, 0x3b,
+			 0x08, 0xdd, 0x10, 0x46, 0xef, 0xc7, 0x90, 0x1f},
+			{0x7b, 0x2f, 0x3a, 0xce, 0xc8, 0xa1, 0x79, 0x3c,
+			 0x30, 0x12, 0x44, 0x28, 0xf6, 0xbc, 0xff, 0xfd,
+			 0xf4, 0xc0, 0x97, 0xb0, 0xcc, 0xc3, 0x13, 0x7a,
+			 0xb9, 0x9a, 0x16, 0xe4, 0xcb, 0x4c, 0x34, 0x63}
+		},
+		{
+			{0x08, 0x3f, 0x60, 0x86, 0xd6, 0x9f, 0xf5, 0xe2,
+			 0xe9, 0x6d, 0xa4, 0x70, 0xad, 0xc6, 0xb6, 0xcd,
+			 0x63, 0x15, 0xda, 0xc7, 0x17, 0x5c, 0xe9, 0x49,
+			 0x1b, 0xa9, 0x3e, 0x66, 0x8c, 0xb5, 0x22, 0x3d},
+			{0xb2, 0x0e, 0x3b, 0xb0, 0x3f, 0xb6, 0x42, 0x97,
+			 0x79, 0xc7, 0xb7, 0xf4, 0xf9, 0x65, 0x09, 0xa8,
+			 0xbd, 0x6a, 0x17, 0x0d, 0xe2, 0xbf, 0xd8, 0x33,
+			 0x27, 0x37, 0xa8, 0x2b, 0xe8, 0xc7, 0x40, 0x72}
+		},
+		{
+			{0x08, 0x06, 0x90, 0xf1, 0x86, 0x5e, 0x64, 0x47,
+			 0xca, 0x79, 0x4b, 0xdf, 0x4f, 0x4f, 0x7f, 0xef,
+			 0xb0, 0xc0, 0xbc, 0x1b, 0xbd, 0x85, 0x01, 0xe5,
+			 0x33, 0xdf, 0xee, 0x77, 0xdb, 0x09, 0x6c, 0x6e},
+			{0x07, 0x6f, 0x91, 0x9c, 0xeb, 0xec, 0xe0, 0xc1,
+			 0x0d, 0x3f, 0x39, 0xf5, 0xa4, 0x99, 0xd9, 0xba,
+			 0x8b, 0xcf, 0x89, 0x63, 0x90, 0x9f, 0x56, 0xee,
+			 0xe3, 0x72, 0x2d, 0xac, 0x67, 0xb6, 0x40, 0x56}
+		},
+		{
+			{0x46, 0x57, 0x47, 0xd2, 0x39, 0x93, 0x00, 0xb5,
+			 0xd4, 0xfc, 0x7f, 0x7d, 0x72, 0x78, 0xdc, 0x6e,
+			 0xf7, 0xf0, 0x92, 0x31, 0x45, 0x6e, 0xc8, 0x54,
+			 0x03, 0x18, 0x85, 0xd7, 0xe5, 0x28, 0x87, 0x0a},
+			{0xc8, 0x90, 0xd4, 0xde, 0x1c, 0xd4, 0xef, 0xcc,
+			 0x08, 0xf7, 0x23, 0x93, 0xb0, 0x7f, 0xd3, 0xa0,
+			 0x65, 0x55, 0x06, 0x39, 0x10, 0x62, 0xea, 0xa3,
+			 0x02, 0x67, 0x07, 0xf5, 0x52, 0x95, 0xf3, 0x7e}
+		},
+		{
+			{0x07, 0x4e, 0xd3, 0x2d, 0x09, 0x33, 0x0e, 0xd2,
+			 0x0d, 0xbe, 0x3e, 0xe7, 0xe4, 0xaa, 0xb7, 0x00,
+			 0x8b, 0xe8, 0xad, 0xaa, 0x7a, 0x8d, 0x34, 0x28,
+			 0xa9, 0x81, 0x94, 0xc5, 0xe7, 0x42, 0xac, 0x47},
+			{0x24, 0x89, 0x7a, 0x8f, 0xb5, 0x9b, 0xf0, 0xc2,
+			 0x03, 0x64, 0xd0, 0x1e, 0xf5, 0xa4, 0xb2, 0xf3,
+			 0x74, 0xe9, 0x1a, 0x16, 0xfd, 0xcb, 0x15, 0xea,
+			 0xeb, 0x10, 0x6c, 0x35, 0xd1, 0xc1, 0xa6, 0x28}
+		}
+	},
+#endif
+#if (20 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xf4, 0x10, 0x46, 0xbe, 0xb7, 0xd2, 0xd1, 0xce,
+			 0x5e, 0x76, 0xa2, 0xd7, 0x03, 0xdc, 0xe4, 0x81,
+			 0x5a, 0xf6, 0x3c, 0xde, 0xae, 0x7a, 0x9d, 0x21,
+			 0x34, 0xa5, 0xf6, 0xa9, 0x73, 0xe2, 0x8d, 0x60},
+			{0xfa, 0x44, 0x71, 0xf6, 0x41, 0xd8, 0xc6, 0x58,
+			 0x13, 0x37, 0xeb, 0x84, 0x0f, 0x96, 0xc7, 0xdc,
+			 0xc8, 0xa9, 0x7a, 0x83, 0xb2, 0x2f, 0x31, 0xb1,
+			 0x1a, 0xd8, 0x98, 0x3f, 0x11, 0xd0, 0x31, 0x3b}
+		},
+		{
+			{0x81, 0xd5, 0x34, 0x16, 0x01, 0xa3, 0x93, 0xea,
+			 0x52, 0x94, 0xec, 0x93, 0xb7, 0x81, 0x11, 0x2d,
+			 0x58, 0xf9, 0xb5, 0x0a, 0xaa, 0x4f, 0xf6, 0x2e,
+			 0x3f, 0x36, 0xbf, 0x33, 0x5a, 0xe7, 0xd1, 0x08},
+			{0x1a, 0xcf, 0x42, 0xae, 0xcc, 0xb5, 0x77, 0x39,
+			 0xc4, 0x5b, 0x5b, 0xd0, 0x26, 0x59, 0x27, 0xd0,
+			 0x55, 0x71, 0x12, 0x9d, 0x88, 0x3d, 0x9c, 0xea,
+			 0x41, 0x6a, 0xf0, 0x50, 0x93, 0x93, 0xdd, 0x47}
+		},
+		{
+			{0x3e, 0xa8, 0x1d, 0xfd, 0x0d, 0x3f, 0x0c, 0xa7,
+			 0xef, 0x86, 0x9d, 0x08, 0x82, 0x51, 0x20, 0x15,
+			 0x71, 0xe0, 0x4c, 0xf7, 0xeb, 0x8c, 0xb0, 0x9b,
+			 0xa2, 0x8c, 0xf7, 0x5e, 0x55, 0xdf, 0x55, 0x4b},
+			{0x4d, 0x19, 0xd6, 0xdc, 0x8c, 0x6e, 0x4e, 0x30,
+			 0xad, 0x3a, 0x14, 0x58, 0x6d, 0xbd, 0x49, 0x41,
+			 0x68, 0x2e, 0x0f, 0x2e, 0xc0, 0x7e, 0xe9, 0xa2,
+			 0x52, 0x3b, 0x6b, 0x41, 0x97, 0xbe, 0xae, 0x2f}
+		},
+		{
+			{0x6f, 0xc9, 0x51, 0x6d, 0x1c, 0xaa, 0xf5, 0xa5,
+			 0x90, 0x3f, 0x14, 0xe2, 0x6e, 0x8e, 0x64, 0xfd,
+			 0xac, 0xe0, 0x4e, 0x22, 0xe5, 0xc1, 0xbc, 0x29,
+			 0x0a, 0x6a, 0x9e, 0xa1, 0x60, 0xcb, 0x2f, 0x0b},
+			{0xdc, 0x39, 0x32, 0xf3, 0xa1, 0x44, 0xe9, 0xc5,
+			 0xc3, 0x78, 0xfb, 0x95, 0x47, 0x34, 0x35, 0x34,
+			 0xe8, 0x25, 0xde, 0x93, 0xc6, 0xb4, 0x76, 0x6d,
+			 0x86, 0x13, 0xc6, 0xe9, 0x68, 0xb5, 0x01, 0x63}
+		},
+		{
+			{0x6e, 0xc7, 0x2e, 0xd6, 0x8d, 0x02, 0x38, 0x4c,
+			 0x48, 0xf3, 0xeb, 0x58, 0x80, 0x5f, 0x96, 0x6f,
+			 0x00, 0x8b, 0xb1, 0x43, 0x36, 0xea, 0x4d, 0xee,
+			 0x14, 0xd7, 0xdf, 0xae, 0x11, 0x7e, 0x18, 0x6d},
+			{0x45, 0xe7, 0x1c, 0x0c, 0x4f, 0x46, 0xe0, 0xe2,
+			 0x17, 0xbc, 0xd0, 0x61, 0xd5, 0x12, 0x05, 0x07,
+			 0x31, 0x5e, 0x3e, 0xf9, 0x37, 0x52, 0x7d, 0xa2,
+			 0x40, 0xdc, 0x19, 0x18, 0x8a, 0x19, 0x07, 0x36}
+		},
+		{
+			{0x1f, 0x9a, 0x52, 0x64, 0x97, 0xd9, 0x1c, 0x08,
+			 0x51, 0x6f, 0x26, 0x9d, 0xaa, 0x93, 0x33, 0x43,
+			 0xfa, 0x77, 0xe9, 0x62, 0x9b, 0x5d, 0x18, 0x75,
+			 0xeb, 0x78, 0xf7, 0x87, 0x8f, 0x41, 0xb4, 0x4d},
+			{0x13, 0xa8, 0x82, 0x3e, 0xe9, 0x13, 0xad, 0xeb,
+			 0x01, 0xca, 0xcf, 0xda, 0xcd, 0xf7, 0x6c, 0xc7,
+			 0x7a, 0xdc, 0x1e, 0x6e, 0xc8, 0x4e, 0x55, 0x62,
+			 0x80, 0xea, 0x78, 0x0c, 0x86, 0xb9, 0x40, 0x51}
+		},
+		{
+			{0x06, 0x54, 0x46, 0x40, 0xda, 0x1d, 0x43, 0x44,
+			 0x0d, 0x8e, 0xf5, 0x85, 0xb2, 0xd0, 0x66, 0x49,
+			 0x72, 0xe9, 0x48, 0x6c, 0xe7, 0xbe, 0x71, 0x99,
+			 0x8d, 0xad, 0xad, 0x85, 0xb6, 0x9b, 0x1a, 0x6e},
+			{0xe8, 0x83, 0x5e, 0xca, 0x6a, 0x9e, 0x03, 0x19,
+			 0xcb, 0x2b, 0x3e, 0x1f, 0x75, 0x41, 0x48, 0x7a,
+			 0x50, 0x1d, 0x40, 0xbf, 0x3e, 0x7c, 0x2c, 0x9f,
+			 0x8d, 0xaa, 0x81, 0xb2, 0xc7, 0x82, 0xef, 0x31}
+		},
+		{
+			{0x27, 0xae, 0xd3, 0x0d, 0x4c, 0x8f, 0x34, 0xea,
+			 0x7d, 0x3c, 0xe5, 0x8a, 0xcf, 0x5b, 0x92, 0xd8,
+			 0x30, 0x16, 0xb4, 0xa3, 0x75, 0xff, 0xeb, 0x27,
+			 0xc8, 0x5c, 0x6c, 0xc2, 0xee, 0x6c, 0x21, 0x0b},
+			{0xc3, 0xba, 0x12, 0x53, 0x2a, 0xaa, 0x77, 0xad,
+			 0x19, 0x78, 0x55, 0x8a, 0x2e, 0x60, 0x87, 0xc2,
+			 0x6e, 0x91, 0x38, 0x91, 0x3f, 0x7a, 0xc5, 0x24,
+			 0x8f, 0x51, 0xc5, 0xde, 0xb0, 0x53, 0x30, 0x56}
+		}
+	},
+#endif
+#if (22 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xe5, 0x1c, 0xf8, 0x0a, 0xfd, 0x2d, 0x7e, 0xf5,
+			 0xf5, 0x70, 0x7d, 0x41, 0x6b, 0x11, 0xfe, 0xbe,
+			 0x99, 0xd1, 0x55, 0x29, 0x31, 0xbf, 0xc0, 0x97,
+			 0x6c, 0xd5, 0x35, 0xcc, 0x5e, 0x8b, 0xd9, 0x69},
+			{0x8e, 0x4e, 0x9f, 0x25, 0xf8, 0x81, 0x54, 0x2d,
+			 0x0e, 0xd5, 0x54, 0x81, 0x9b, 0xa6, 0x92, 0xce,
+			 0x4b, 0xe9, 0x8f, 0x24, 0x3b, 0xca, 0xe0, 0x44,
+			 0xab, 0x36, 0xfe, 0xfb, 0x87, 0xd4, 0x26, 0x3e}
+		},
+		{
+			{0xd9, 0xb6, 0xd4, 0x9d, 0xd4, 0x6a, 0xaf, 0x70,
+			 0x07, 0x2c, 0x10, 0x9e, 0xbd, 0x11, 0xad, 0xe4,
+			 0x26, 0x33, 0x70, 0x92, 0x78, 0x1c, 0x74, 0x9f,
+			 0x75, 0x60, 0x56, 0xf4, 0x39, 0xa8, 0xa8, 0x62},
+			{0x3b, 0xbf, 0x55, 0x35, 0x61, 0x8b, 0x44, 0x97,
+			 0xe8, 0x3a, 0x55, 0xc1, 0xc8, 0x3b, 0xfd, 0x95,
+			 0x29, 0x11, 0x60, 0x96, 0x1e, 0xcb, 0x11, 0x9d,
+			 0xc2, 0x03, 0x8a, 0x1b, 0xc6, 0xd6, 0x45, 0x3d}
+		},
+		{
+			{0x47, 0x33, 0xee, 0xa1, 0x4b, 0x14, 0x5d, 0xa5,
+			 0xd0, 0x25, 0xb8, 0xc6, 0x99, 0x22, 0x11, 0x33,
+			 0x44, 0x33, 0xe4, 0x7f, 0xa9, 0xb3, 0x7e, 0x8d,
+			 0xa2, 0xa9, 0xf4, 0xe8, 0xa9, 0x31, 0xf0, 0x5f},
+			{0xf9, 0x63, 0xc1, 0x65, 0x6f, 0x7f, 0x92, 0x32,
+			 0xd7, 0x40, 0xff, 0x76, 0x35, 0xae, 0x2d, 0x25,
+			 0x81, 0xeb, 0x26, 0xee, 0x15, 0xe5, 0xea, 0x40,
+			 0xb0, 0x5a, 0xdf, 0x74, 0x28, 0xce, 0xc7, 0x67}
+		},
+		{
+			{0x7e, 0x0e, 0x50, 0xb2, 0xcc, 0x0d, 0x6b, 0xa6,
+			 0x71, 0x5b, 0x42, 0xed, 0xbd, 0xaf, 0xac, 0xf0,
+			 0xfc, 0x12, 0xa2, 0x3f, 0x4e, 0xda, 0xe8, 0x11,
+			 0xf3, 0x23, 0xe1, 0x04, 0x62, 0x03, 0x1c, 0x4e},
+			{0xc8, 0xb1, 0x1b, 0x6f, 0x73, 0x61, 0x3d, 0x27,
+			 0x0d, 0x7d, 0x7a, 0x25, 0x5f, 0x73, 0x0e, 0x2f,
+			 0x93, 0xf6, 0x24, 0xd8, 0x4f, 0x90, 0xac, 0xa2,
+			 0x62, 0x0a, 0xf0, 0x61, 0xd9, 0x08, 0x59, 0x6a}
+		},
+		{
+			{0xb3, 0x36, 0x41, 0x17, 0x65, 0xdb, 0x0a, 0x04,
+			 0x5d, 0xa3, 0x6e, 0x0d, 0x7c, 0xb3, 0xfa, 0xe1,
+			 0xc1, 0x42, 0x29, 0x42, 0x1d, 0xf4, 0x35, 0x60,
+			 0x70, 0x44, 0x96, 0x92, 0x49, 0x41, 0xc3, 0x2e},
+			{0x40, 0xba, 0x9a, 0x99, 0x31, 0x3c, 0xa3, 0xb3,
+			 0x39, 0x3e, 0x0e, 0xd4, 0x3d, 0xfc, 0xe4, 0x72,
+			 0xf2, 0x60, 0x81, 0xa7, 0x54, 0x3c, 0x5c, 0xc5,
+			 0x2c, 0xea, 0x69, 0x0e, 0x53, 0x17, 0xcb, 0x2e}
+		},
+		{
+			{0xf3, 0x56, 0x7d, 0xb7, 0x0a, 0x52, 0x8a, 0x51,
+			 0x0d, 0xe2, 0xe2, 0x50, 0xc5, 0x96, 0xcf, 0xe1,
+			 0x55, 0x38, 0x29, 0xac, 0xa6, 0x80, 0x9d, 0xa6,
+			 0x4c, 0xe4, 0xeb, 0x00, 0x90, 0xd3, 0x16, 0x12},
+			{0xd4, 0xd1, 0x1f, 0x15, 0xfa, 0xf4, 0x78, 0x3e,
+			 0x82, 0xe3, 0x49, 0xa6, 0xd9, 0xd0, 0x4b, 0x3b,
+			 0xd0, 0x4e, 0x32, 0x12, 0xb9, 0xaa, 0x43, 0x70,
+			 0xbd, 0x73, 0xd9, 0x82, 0xbe, 0x32, 0x41, 0x37}
+		},
+		{
+			{0x22, 0xb0, 0xed, 0x2d, 0x36, 0xf0, 0x67, 0x64,
+			 0x0c, 0xb9, 0x7e, 0xac, 0xa7, 0x12, 0x0a, 0xee,
+			 0x82, 0x82, 0x05, 0xd1, 0x0d, 0x98, 0x96, 0x03,
+			 0xe6, 0xc7, 0x58, 0xf3, 0x79, 0x5d, 0xbe, 0x3c},
+			{0x34, 0x20, 0xe8, 0x92, 0x1a, 0xdd, 0x6e, 0x69,
+			 0x2f, 0x9e, 0x84, 0x0e, 0xc6, 0x55, 0xed, 0xac,
+			 0xc5, 0x6c, 0xbe, 0x22, 0x32, 0xda, 0x0f, 0x39,
+			 0xe6, 0xc2, 0x22, 0x3e, 0x5d, 0x63, 0xaa, 0x2a}
+		},
+		{
+			{0x6f, 0x2d, 0x55, 0xf8, 0x2f, 0x8e, 0xf0, 0x18,
+			 0x3b, 0xea, 0xdd, 0x26, 0x72, 0xd1, 0xf5, 0xfe,
+			 0xe5, 0xb8, 0xe6, 0xd3, 0x10, 0x48, 0x46, 0x49,
+			 0x3a, 0x9f, 0x5e, 0x45, 0x6b, 0x90, 0xe8, 0x7f},
+			{0xd3, 0x76, 0x69, 0x33, 0x7b, 0xb9, 0x40, 0x70,
+			 0xee, 0xa6, 0x29, 0x6b, 0xdd, 0xd0, 0x5d, 0x8d,
+			 0xc1, 0x3e, 0x4a, 0xea, 0x37, 0xb1, 0x03, 0x02,
+			 0x03, 0x35, 0xf1, 0x28, 0x9d, 0xff, 0x00, 0x13}
+		}
+	},
+#endif
+#if (24 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xd0, 0x75, 0x57, 0x3b, 0xeb, 0x5c, 0x14, 0x56,
+			 0x50, 0xc9, 0x4f, 0xb8, 0xb8, 0x1e, 0xa3, 0xf4,
+			 0xab, 0xf5, 0xa9, 0x20, 0x15, 0x94, 0x82, 0xda,
+			 0x96, 0x1c, 0x9b, 0x59, 0x8c, 0xff, 0xf4, 0x51},
+			{0xc1, 0x3a, 0x86, 0xd7, 0xb0, 0x06, 0x84, 0x7f,
+			 0x1b, 0xbd, 0xd4, 0x07, 0x78, 0x80, 0x2e, 0xb1,
+			 0xb4, 0xee, 0x52, 0x38, 0xee, 0x9a, 0xf9, 0xf6,
+			 0xf3, 0x41, 0x6e, 0xd4, 0x88, 0x95, 0xac, 0x35}
+		},
+		{
+			{0x41, 0x97, 0xbf, 0x71, 0x6a, 0x9b, 0x72, 0xec,
+			 0xf3, 0xf8, 0x6b, 0xe6, 0x0e, 0x6c, 0x69, 0xa5,
+			 0x2f, 0x68, 0x52, 0xd8, 0x61, 0x81, 0xc0, 0x63,
+			 0x3f, 0xa6, 0x3c, 0x13, 0x90, 0xe6, 0x8d, 0x56},
+			{0xe8, 0x39, 0x30, 0x77, 0x23, 0xb1, 0xfd, 0x1b,
+			 0x3d, 0x3e, 0x74, 0x4d, 0x7f, 0xae, 0x5b, 0x3a,
+			 0xb4, 0x65, 0x0e, 0x3a, 0x43, 0xdc, 0xdc, 0x41,
+			 0x47, 0xe6, 0xe8, 0x92, 0x09, 0x22, 0x48, 0x4c}
+		},
+		{
+			{0x85, 0x57, 0x9f, 0xb5, 0xc8, 0x06, 0xb2, 0x9f,
+			 0x47, 0x3f, 0xf0, 0xfa, 0xe6, 0xa9, 0xb1, 0x9b,
+			 0x6f, 0x96, 0x7d, 0xf9, 0xa4, 0x65, 0x09, 0x75,
+			 0x32, 0xa6, 0x6c, 0x7f, 0x47, 0x4b, 0x2f, 0x4f},
+			{0x34, 0xe9, 0x59, 0x93, 0x9d, 0x26, 0x80, 0x54,
+			 0xf2, 0xcc, 0x3c, 0xc2, 0x25, 0x85, 0xe3, 0x6a,
+			 0xc1, 0x62, 0x04, 0xa7, 0x08, 0x32, 0x6d, 0xa1,
+			 0x39, 0x84, 0x8a, 0x3b, 0x87, 0x5f, 0x11, 0x13}
+		},
+		{
+			{0xda, 0x03, 0x34, 0x66, 0xc4, 0x0c, 0x73, 0x6e,
+			 0xbc, 0x24, 0xb5, 0xf9, 0x70, 0x81, 0x52, 0xe9,
+			 0xf4, 0x7c, 0x23, 0xdd, 0x9f, 0xb8, 0x46, 0xef,
+			 0x1d, 0x22, 0x55, 0x7d, 0x71, 0xc4, 0x42, 0x33},
+			{0xc5, 0x37, 0x69, 0x5b, 0xa8, 0xc6, 0x9d, 0xa4,
+			 0xfc, 0x61, 0x6e, 0x68, 0x46, 0xea, 0xd7, 0x1c,
+			 0x67, 0xd2, 0x7d, 0xfa, 0xf1, 0xcc, 0x54, 0x8d,
+			 0x36, 0x35, 0xc9, 0x00, 0xdf, 0x6c, 0x67, 0x50}
+		},
+		{
+			{0xcb, 0xcc, 0xec, 0xf1, 0xb8, 0x0f, 0xfb, 0x99,
+			 0x6e, 0xdf, 0x48, 0x1f, 0x54, 0xd0, 0x2f, 0xfa,
+			 0x99, 0xd5, 0x88, 0xba, 0xfd, 0x70, 0x30, 0xa9,
+			 0xd0, 0x4e, 0xb6, 0x73, 0x09, 0x40, 0x2a, 0x28},
+			{0x86, 0x46, 0xa8, 0x7a, 0xd2, 0x2d, 0x56, 0x7f,
+			 0x0c, 0x15, 0xc3, 0xe0, 0xd1, 0xa0, 0xce, 0x9a,
+			 0xcd, 0xbf, 0xc6, 0x1a, 0xe0, 0x9f, 0x5c, 0x59,
+			 0x93, 0xba, 0xdd, 0xce, 0xd8, 0x95, 0x8a, 0x5a}
+		},
+		{
+			{0xd3, 0xdb, 0x97, 0xd2, 0x9e, 0x9d, 0xc2, 0x20,
+			 0x65, 0x37, 0x86, 0x81, 0x8e, 0x33, 0xbb, 0x52,
+			 0x89, 0xd5, 0xf0, 0xa9, 0xc0, 0xbc, 0xe5, 0x43,
+			 0x0d, 0xc2, 0x15, 0x9f, 0xf5, 0x48, 0xaf, 0x7a},
+			{0x6e, 0x8d, 0xa5, 0xf1, 0x6b, 0x89, 0x69, 0xac,
+			 0x4d, 0x93, 0xe0, 0xe8, 0xc8, 0x0a, 0x8f, 0x8a,
+			 0xe3, 0x2d, 0xe6, 0xbf, 0x63, 0x9c, 0x14, 0x36,
+			 0x8c, 0x63, 0x76, 0x9e, 0x6a, 0xba, 0x65, 0x27}
+		},
+		{
+			{0xb4, 0x29, 0x23, 0xaa, 0x9b, 0x97, 0x4d, 0xbd,
+			 0x39, 0x7c, 0x9f, 0xd4, 0x4c, 0x5f, 0x74, 0x33,
+			 0x91, 0x95, 0x1b, 0x89, 0x55, 0x8c, 0x5f, 0xce,
+			 0x55, 0x43, 0x2b, 0xbd, 0x8f, 0x49, 0x36, 0x03},
+			{0xd8, 0xcb, 0xd5, 0x5d, 0x7c, 0x8a, 0xe0, 0xa1,
+			 0x9a, 0x8d, 0xf4, 0xff, 0x52, 0xfd, 0xe0, 0xaf,
+			 0x9f, 0x10, 0x9b, 0x96, 0x37, 0x1c, 0x4b, 0xe4,
+			 0xe7, 0x9c, 0x27, 0x16, 0xb6, 0x38, 0x33, 0x65}
+		},
+		{
+			{0x9a, 0x4d, 0x42, 0x29, 0x5d, 0xa4, 0x6b, 0x6f,
+			 0xa8, 0x8a, 0x4d, 0x91, 0x7b, 0xd2, 0xdf, 0x36,
+			 0xef, 0x01, 0x22, 0xc5, 0xcc, 0x8d, 0xeb, 0x58,
+			 0x3d, 0xb3, 0x50, 0xfc, 0x8b, 0x97, 0x96, 0x33},
+			{0x93, 0x33, 0x07, 0xc8, 0x4a, 0xca, 0xd0, 0xb1,
+			 0xab, 0xbd, 0xdd, 0xa7, 0x7c, 0xac, 0x3e, 0x45,
+			 0xcb, 0xcc, 0x07, 0x91, 0xbf, 0x35, 0x9d, 0xcb,
+			 0x7d, 0x12, 0x3c, 0x11, 0x59, 0x13, 0xcf, 0x5c}
+		}
+	},
+#endif
+#if (26 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x0f, 0xa9, 0xd5, 0x01, 0xaa, 0x48, 0x4f, 0x28,
+			 0x66, 0x32, 0x1a, 0xba, 0x7c, 0xea, 0x11, 0x80,
+			 0x17, 0x18, 0x9b, 0x56, 0x88, 0x25, 0x06, 0x69,
+			 0x12, 0x2c, 0xea, 0x56, 0x69, 0x41, 0x24, 0x19},
+			{0xde, 0x21, 0xf0, 0xda, 0x8a, 0xfb, 0xb1, 0xb8,
+			 0xcd, 0xc8, 0x6a, 0x82, 0x19, 0x73, 0xdb, 0xc7,
+			 0xcf, 0x88, 0xeb, 0x96, 0xee, 0x6f, 0xfb, 0x06,
+			 0xd2, 0xcd, 0x7d, 0x7b, 0x12, 0x28, 0x8e, 0x0c}
+		},
+		{
+			{0x93, 0x44, 0x97, 0xce, 0x28, 0xff, 0x3a, 0x40,
+			 0xc4, 0xf5, 0xf6, 0x9b, 0xf4, 0x6b, 0x07, 0x84,
+			 0xfb, 0x98, 0xd8, 0xec, 0x8c, 0x03, 0x57, 0xec,
+			 0x49, 0xed, 0x63, 0xb6, 0xaa, 0xff, 0x98, 0x28},
+			{0x3d, 0x16, 0x35, 0xf3, 0x46, 0xbc, 0xb3, 0xf4,
+			 0xc6, 0xb6, 0x4f, 0xfa, 0xf4, 0xa0, 0x13, 0xe6,
+			 0x57, 0x45, 0x93, 0xb9, 0xbc, 0xd6, 0x59, 0xe7,
+			 0x77, 0x94, 0x6c, 0xab, 0x96, 0x3b, 0x4f, 0x09}
+		},
+		{
+			{0x6a, 0xa7, 0x19, 0x8c, 0xe9, 0xd2, 0xfe, 0xeb,
+			 0x4c, 0xa5, 0x82, 0x4b, 0xb8, 0xd8, 0xce, 0xa5,
+			 0x3c, 0x47, 0x27, 0x1b, 0x9d, 0x76, 0xa1, 0x6d,
+			 0xaf, 0xb7, 0xd8, 0x05, 0x23, 0x4b, 0xde, 0x59},
+			{0xd5, 0xe4, 0xdb, 0xf1, 0xf9, 0xe2, 0x77, 0x44,
+			 0xe9, 0x26, 0x17, 0x9c, 0x25, 0xe1, 0x6b, 0x31,
+			 0xe4, 0xa6, 0xec, 0x2d, 0x46, 0xa6, 0xe1, 0x4f,
+			 0x84, 0x49, 0xe1, 0x5c, 0x87, 0xb0, 0x78, 0x40}
+		},
+		{
+			{0x5a, 0xf7, 0x6b, 0x01, 0x12, 0x4f, 0x51, 0xc1,
+			 0x70, 0x84, 0x94, 0x47, 0xb2, 0x01, 0x6c, 0x71,
+			 0xd7, 0xcc, 0x17, 0x66, 0x0f, 0x59, 0x5d, 0x5d,
+			 0x10, 0x01, 0x57, 0x11, 0xf5, 0xdd, 0xe2, 0x34},
+			{0x26, 0xd9, 0x1f, 0x5c, 0x58, 0xac, 0x8b, 0x03,
+			 0xd2, 0xc3, 0x85, 0x0f, 0x3a, 0xc3, 0x7f, 0x6d,
+			 0x8e, 0x86, 0xcd, 0x52, 0x74, 0x8f, 0x55, 0x77,
+			 0x17, 0xb7, 0x8e, 0xb7, 0x88, 0xea, 0xda, 0x1b}
+		},
+		{
+			{0x05, 0x5b, 0xac, 0xea, 0x03, 0xb3, 0x79, 0x99,
+			 0xe5, 0x23, 0x8a, 0xbc, 0xa6, 0xbf, 0x56, 0x60,
+			 0x78, 0xc5, 0x62, 0x2b, 0x4f, 0x23, 0xb9, 0xc2,
+			 0x4f, 0xc9, 0x01, 0xa1, 0xfe, 0xf5, 0xea, 0x55},
+			{0x82, 0x6d, 0x0e, 0x1e, 0xfc, 0x32, 0x1e, 0x29,
+			 0xfb, 0x9f, 0x57, 0x2e, 0x6b, 0x2a, 0xf6, 0x1c,
+			 0x04, 0xd2, 0x84, 0x74, 0x92, 0x68, 0x2a, 0x31,
+			 0x7e, 0x3c, 0xa1, 0xc2, 0x10, 0x4f, 0x4f, 0x64}
+		},
+		{
+			{0xb6, 0xea, 0x0e, 0x40, 0x93, 0x20, 0x79, 0x35,
+			 0x6a, 0x61, 0x84, 0x5a, 0x07, 0x6d, 0xf9, 0x77,
+			 0x6f, 0xed, 0x69, 0x1c, 0x0d, 0x25, 0x76, 0xcc,
+			 0xf0, 0xdb, 0xbb, 0xc5, 0xad, 0xe2, 0x26, 0x57},
+			{0xcf, 0xe8, 0x0e, 0x6b, 0x96, 0x7d, 0xed, 0x27,
+			 0xd1, 0x3c, 0xa9, 0xd9, 0x50, 0xa9, 0x98, 0x84,
+			 0x5e, 0x86, 0xef, 0xd6, 0xf0, 0xf8, 0x0e, 0x89,
+			 0x05, 0x2f, 0xd9, 0x5f, 0x15, 0x5f, 0x73, 0x79}
+		},
+		{
+			{0x63, 0x19, 0xfd, 0x74, 0xb6, 0xc6, 0x27, 0x99,
+			 0xd2, 0x95, 0x7c, 0xb9, 0x5e, 0x1f, 0xce, 0xfd,
+			 0xdb, 0x1a, 0x98, 0xde, 0x10, 0x3f, 0x80, 0x44,
+			 0xa1, 0xaf, 0xeb, 0xf9, 0x84, 0x75, 0xab, 0x2f},
+			{0x81, 0xf9, 0xc7, 0x98, 0x26, 0xda, 0x59, 0xcf,
+			 0x2b, 0x65, 0x29, 0x8b, 0x69, 0xee, 0x18, 0x52,
+			 0x64, 0x37, 0xb2, 0xb0, 0x5a, 0x4f, 0xf4, 0xda,
+			 0x48, 0xf4, 0x15, 0xf4, 0x48, 0x02, 0xb7, 0x27}
+		},
+		{
+			{0xc8, 0x5c, 0x16, 0xfe, 0xed, 0x9f, 0x26, 0x56,
+			 0xf6, 0x4b, 0x9f, 0xa7, 0x0a, 0x85, 0xfe, 0xa5,
+			 0x8c, 0x87, 0xdd, 0x98, 0xce, 0x4e, 0xc3, 0x58,
+			 0x55, 0xb2, 0x7b, 0x3d, 0xd8, 0x6b, 0xb5, 0x4c},
+			{0x65, 0x38, 0xa0, 0x15, 0xfa, 0xa7, 0xb4, 0x8f,
+			 0xeb, 0xc4, 0x86, 0x9b, 0x30, 0xa5, 0x5e, 0x4d,
+			 0xea, 0x8a, 0x9a, 0x9f, 0x1a, 0xd8, 0x5b, 0x53,
+			 0x14, 0x19, 0x25, 0x63, 0xb4, 0x6f, 0x1f, 0x5d}
+		}
+	},
+#endif
+#if (28 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x7b, 0x75, 0x3a, 0xfc, 0x64, 0xd3, 0x29, 0x7e,
+			 0xdd, 0x49, 0x9a, 0x59, 0x53, 0xbf, 0xb4, 0xa7,
+			 0x52, 0xb3, 0x05, 0xab, 0xc3, 0xaf, 0x16, 0x1a,
+			 0x85, 0x42, 0x32, 0xa2, 0x86, 0xfa, 0x39, 0x43},
+			{0x0e, 0x4b, 0xa3, 0x63, 0x8a, 0xfe, 0xa5, 0x58,
+			 0xf1, 0x13, 0xbd, 0x9d, 0xaa, 0x7f, 0x76, 0x40,
+			 0x70, 0x81, 0x10, 0x75, 0x99, 0xbb, 0xbe, 0x0b,
+			 0x16, 0xe9, 0xba, 0x62, 0x34, 0xcc, 0x07, 0x6d}
+		},
+		{
+			{0xeb, 0x01, 0xc7, 0x36, 0x97, 0x4e, 0xb6, 0xab,
+			 0x5f, 0x0d, 0x2c, 0xba, 0x67, 0x64, 0x55, 0xde,
+			 0xbc, 0xff, 0xa6, 0xec, 0x04, 0xd3, 0x8d, 0x39,
+			 0x56, 0x5e, 0xee, 0xf8, 0xe4, 0x2e, 0x33, 0x62},
+			{0x65, 0xef, 0xb8, 0x9f, 0xc8, 0x4b, 0xa7, 0xfd,
+			 0x21, 0x49, 0x9b, 0x92, 0x35, 0x82, 0xd6, 0x0a,
+			 0x9b, 0xf2, 0x79, 0xf1, 0x47, 0x2f, 0x6a, 0x7e,
+			 0x9f, 0xcf, 0x18, 0x02, 0x3c, 0xfb, 0x1b, 0x3e}
+		},
+		{
+			{0x69, 0x07, 0x81, 0xef, 0x6a, 0x39, 0x1a, 0x6d,
+			 0x32, 0x27, 0x5d, 0x39, 0x19, 0xc6, 0x76, 0x69,
+			 0xe9, 0xd1, 0x77, 0x91, 0x01, 0xeb, 0x5f, 0x48,
+			 0xcd, 0x3d, 0x7f, 0xc5, 0xd3, 0x7c, 0x28, 0x33},
+			{0xde, 0x1c, 0x37, 0x1c, 0xea, 0x6f, 0x14, 0xac,
+			 0x9e, 0x29, 0x33, 0x56, 0x8f, 0x35, 0x70, 0x5f,
+			 0x4c, 0xf7, 0x2c, 0xf7, 0x2b, 0xff, 0x26, 0x31,
+			 0x9b, 0x48, 0x82, 0x18, 0xbe, 0xe2, 0xf3, 0x70}
+		},
+		{
+			{0x2f, 0x8b, 0xc8, 0x40, 0x51, 0xd1, 0xac, 0x1a,
+			 0x0b, 0xe4, 0xa9, 0xa2, 0x42, 0x21, 0x19, 0x2f,
+			 0x7b, 0x97, 0xbf, 0xf7, 0x57, 0x6d, 0x3f, 0x3d,
+			 0x4f, 0x0f, 0xe2, 0xb2, 0x81, 0x00, 0x9e, 0x7b},
+			{0x8c, 0x85, 0x2b, 0xc4, 0xfc, 0xf1, 0xab, 0xe8,
+			 0x79, 0x22, 0xc4, 0x84, 0x17, 0x3a, 0xfa, 0x86,
+			 0xa6, 0x7d, 0xf9, 0xf3, 0x6f, 0x03, 0x57, 0x20,
+			 0x4d, 0x79, 0xf9, 0x6e, 0x71, 0x54, 0x38, 0x09}
+		},
+		{
+			{0x5b, 0xe5, 0xc2, 0xa7, 0x47, 0x4d, 0x0e, 0x18,
+			 0x31, 0x96, 0x12, 0x03, 0x9e, 0x11, 0xf2, 0x2a,
+			 0xf0, 0xc6, 0xd4, 0xc2, 0x6f, 0xca, 0xc3, 0x87,
+			 0xf5, 0xea, 0x06, 0xa3, 0x7a, 0x92, 0x70, 0x1c},
+			{0xf0, 0x44, 0x74, 0x07, 0x4a, 0x65, 0xb5, 0x0c,
+			 0xc1, 0xb1, 0x6e, 0x6e, 0xd2, 0x70, 0xe8, 0x68,
+			 0x02, 0xd8, 0xb4, 0xc3, 0xf4, 0xba, 0xc0, 0x55,
+			 0x3e, 0x03, 0xda, 0x80, 0xc7, 0x9e, 0x25, 0x2e}
+		},
+		{
+			{0xec, 0x72, 0x3c, 0xf1, 0x89, 0x49, 0xe1, 0x44,
+			 0x3c, 0x4c, 0xfb, 0x9b, 0x9c, 0xff, 0xb5, 0x5e,
+			 0x59, 0x89, 0xc0, 0x6a, 0x62, 0x9b, 0x68, 0x3b,
+			 0xa8, 0xae, 0x1e, 0x55, 0xe8, 0xf8, 0x22, 0x1e},
+			{0x83, 0x98, 0x60, 0xd3, 0xe4, 0x17, 0x01, 0xec,
+			 0xda, 0xd6, 0xf0, 0x2e, 0xf3, 0x71, 0xa0, 0x85,
+			 0x4d, 0xc6, 0xaa, 0x87, 0x39, 0xa5, 0x82, 0x0d,
+			 0x8f, 0xb0, 0x3a, 0x0c, 0xfd, 0xd5, 0x1f, 0x12}
+		},
+		{
+			{0x1a, 0xf9, 0x18, 0x11, 0xa4, 0x62, 0x60, 0x32,
+			 0x1a, 0x66, 0x24, 0x22, 0x07, 0x84, 0x05, 0x27,
+			 0xe9, 0xac, 0x6a, 0x1f, 0x17, 0x27, 0x24, 0x10,
+			 0x84, 0xe7, 0xe5, 0x47, 0x36, 0xe9, 0x37, 0x62},
+			{0xfb, 0xb2, 0xf5, 0x45, 0x52, 0x16, 0x5d, 0x97,
+			 0xc7, 0x36, 0x6d, 0x05, 0x2b, 0x87, 0x55, 0xbe,
+			 0x04, 0xe5, 0x30, 0x82, 0x94, 0x17, 0xd8, 0x55,
+			 0x0c, 0x4f, 0x40, 0x8e, 0xaf, 0x3c, 0x8c, 0x43}
+		},
+		{
+			{0x40, 0x29, 0x74, 0xa8, 0x2f, 0x5e, 0xf9, 0x79,
+			 0xa4, 0xf3, 0x3e, 0xb9, 0xfd, 0x33, 0x31, 0xac,
+			 0x9a, 0x69, 0x88, 0x1e, 0x77, 0x21, 0x2d, 0xf3,
+			 0x91, 0x52, 0x26, 0x15, 0xb2, 0xa6, 0xcf, 0x7e},
+			{0xc6, 0x20, 0x47, 0x6c, 0xa4, 0x7d, 0xcb, 0x63,
+			 0xea, 0x5b, 0x03, 0xdf, 0x3e, 0x88, 0x81, 0x6d,
+			 0xce, 0x07, 0x42, 0x18, 0x60, 0x7e, 0x7b, 0x55,
+			 0xfe, 0x6a, 0xf3, 0xda, 0x5c, 0x8b, 0x95, 0x10}
+		}
+	},
+#endif
+#if (30 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x24, 0x64, 0x6e, 0x9b, 0x35, 0x71, 0x78, 0xce,
+			 0x33, 0x03, 0x21, 0x33, 0x36, 0xf1, 0x73, 0x9b,
+			 0xb9, 0x15, 0x8b, 0x2c, 0x69, 0xcf, 0x4d, 0xed,
+			 0x4f, 0x4d, 0x57, 0x14, 0x13, 0x82, 0xa4, 0x4d},
+			{0x65, 0x6e, 0x0a, 0xa4, 0x59, 0x07, 0x17, 0xf2,
+			 0x6b, 0x4a, 0x1f, 0x6e, 0xf6, 0xb5, 0xbc, 0x62,
+			 0xe4, 0xb6, 0xda, 0xa2, 0x93, 0xbc, 0x29, 0x05,
+			 0xd2, 0xd2, 0x73, 0x46, 0x03, 0x16, 0x40, 0x31}
+		},
+		{
+			{0x4c, 0x73, 0x6d, 0x15, 0xbd, 0xa1, 0x4d, 0x5c,
+			 0x13, 0x0b, 0x24, 0x06, 0x98, 0x78, 0x1c, 0x5b,
+			 0xeb, 0x1f, 0x18, 0x54, 0x43, 0xd9, 0x55, 0x66,
+			 0xda, 0x29, 0x21, 0xe8, 0xb8, 0x3c, 0x42, 0x22},
+			{0xb4, 0xcd, 0x08, 0x6f, 0x15, 0x23, 0x1a, 0x0b,
+			 0x22, 0xed, 0xd1, 0xf1, 0xa7, 0xc7, 0x73, 0x45,
+			 0xf3, 0x9e, 0xce, 0x76, 0xb7, 0xf6, 0x39, 0xb6,
+			 0x8e, 0x79, 0xbe, 0xe9, 0x9b, 0xcf, 0x7d, 0x62}
+		},
+		{
+			{0x92, 0x5b, 0xfc, 0x72, 0xfd, 0xba, 0xf1, 0xfd,
+			 0xa6, 0x7c, 0x95, 0xe3, 0x61, 0x3f, 0xe9, 0x03,
+			 0xd4, 0x2b, 0xd4, 0x20, 0xd9, 0xdb, 0x4d, 0x32,
+			 0x3e, 0xf5, 0x11, 0x64, 0xe3, 0xb4, 0xbe, 0x32},
+			{0x86, 0x17, 0x90, 0xe7, 0xc9, 0x1f, 0x10, 0xa5,
+			 0x6a, 0x2d, 0x39, 0xd0, 0x3b, 0xc4, 0xa6, 0xe9,
+			 0x59, 0x13, 0xda, 0x1a, 0xe6, 0xa0, 0xb9, 0x3c,
+			 0x50, 0xb8, 0x40, 0x7c, 0x15, 0x36, 0x5a, 0x42}
+		},
+		{
+			{0xb4, 0x0b, 0x32, 0xab, 0xdc, 0x04, 0x51, 0x55,
+			 0x21, 0x1e, 0x0b, 0x75, 0x99, 0x89, 0x73, 0x35,
+			 0x3a, 0x91, 0x2b, 0xfe, 0xe7, 0x49, 0xea, 0x76,
+			 0xc1, 0xf9, 0x46, 0xb9, 0x53, 0x02, 0x23, 0x04},
+			{0xfc, 0x5a, 0x1e, 0x1d, 0x74, 0x58, 0x95, 0xa6,
+			 0x8f, 0x7b, 0x97, 0x3e, 0x17, 0x3b, 0x79, 0x2d,
+			 0xa6, 0x57, 0xef, 0x45, 0x02, 0x0b, 0x4d, 0x6e,
+			 0x9e, 0x93, 0x8d, 0x2f, 0xd9, 0x9d, 0xdb, 0x04}
+		},
+		{
+			{0x4f, 0x9f, 0x5f, 0xb3, 0x62, 0x3c, 0x83, 0x50,
+			 0x4f, 0xe5, 0x50, 0x1e, 0xfb, 0x82, 0x43, 0xbf,
+			 0x54, 0xa2, 0xcc, 0x11, 0x36, 0x42, 0xe3, 0xef,
+			 0x6d, 0x86, 0x58, 0x7e, 0x80, 0x11, 0xf7, 0x65},
+			{0x7a, 0x63, 0xd9, 0xf9, 0xd7, 0x16, 0x56, 0xd3,
+			 0x3f, 0x73, 0xb2, 0xd0, 0xd3, 0x5a, 0x7f, 0xa5,
+			 0x5f, 0x8d, 0x14, 0xbe, 0x5a, 0x31, 0x42, 0x25,
+			 0x22, 0x4d, 0x8c, 0xc6, 0xcc, 0x79, 0x6f, 0x06}
+		},
+		{
+			{0x9a, 0xd6, 0x89, 0x2f, 0x05, 0xa4, 0x1a, 0x85,
+			 0xf6, 0xd7, 0xab, 0x49, 0x72, 0x2a, 0x12, 0xb2,
+			 0xb6, 0x28, 0x16, 0xa1, 0xc6, 0xbd, 0x84, 0xe8,
+			 0x47, 0x82, 0x05, 0xa5, 0x7e, 0x21, 0x5b, 0x11},
+			{0x1a, 0x9f, 0x27, 0xe9, 0x37, 0x41, 0x80, 0xd2,
+			 0x0b, 0xc9, 0xe6, 0xa9, 0xe7, 0x06, 0x5f, 0xb6,
+			 0x3e, 0x0d, 0xd9, 0x7d, 0xf3, 0x2e, 0xd1, 0x9b,
+			 0x47, 0xb7, 0x86, 0xa0, 0xf3, 0x86, 0x6e, 0x0d}
+		},
+		{
+			{0xaa, 0xa9, 0x81, 0xd1, 0xb1, 0xa0, 0x1c, 0xed,
+			 0x17, 0x1d, 0xc5, 0xb4, 0x15, 0x23, 0x4f, 0xc6,
+			 0x59, 0xce, 0x1f, 0x1a, 0xe1, 0xcf, 0xec, 0xcb,
+			 0x55, 0x84, 0xbf, 0x6b, 0x9a, 0x73, 0x90, 0x1e},
+			{0x9c, 0x86, 0xb7, 0x87, 0x22, 0xf8, 0xa5, 0x98,
+			 0xd4, 0x3c, 0x31, 0xab, 0x82, 0x12, 0x2f, 0xc9,
+			 0xe0, 0x9f, 0xd6, 0xd8, 0x49, 0xd2, 0x3f, 0x51,
+			 0xca, 0x22, 0x47, 0x38, 0x97, 0x9d, 0x29, 0x43}
+		},
+		{
+			{0xc0, 0xd7, 0x56, 0x97, 0x58, 0x91, 0xde, 0x09,
+			 0x4f, 0x9f, 0xbe, 0x63, 0xb0, 0x83, 0x86, 0x43,
+			 0x5d, 0xbc, 0xe0, 0xf3, 0xc0, 0x75, 0xbf, 0x8b,
+			 0x8e, 0xaa, 0xf7, 0x8b, 0x64, 0x6e, 0xb0, 0x63},
+			{0x16, 0xae, 0x8b, 0xe0, 0x9b, 0x24, 0x68, 0x5c,
+			 0x44, 0xc2, 0xd0, 0x08, 0xb7, 0x7b, 0x62, 0xfd,
+			 0x7f, 0xd8, 0xd4, 0xb7, 0x50, 0xfd, 0x2c, 0x1b,
+			 0xbf, 0x41, 0x95, 0xd9, 0x8e, 0xd8, 0x17, 0x1b}
+		}
+	},
+#endif
+#if (32 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x24, 0xe8, 0xb7, 0x60, 0xae, 0x47, 0x80, 0xfc,
+			 0xe5, 0x23, 0xe7, 0xc2, 0xc9, 0x85, 0xe6, 0x98,
+			 0xa0, 0x29, 0x4e, 0xe1, 0x84, 0x39, 0x2d, 0x95,
+			 0x2c, 0xf3, 0x45, 0x3c, 0xff, 0xaf, 0x27, 0x4c},
+			{0x6b, 0xa6, 0xf5, 0x4b, 0x11, 0xbd, 0xba, 0x5b,
+			 0x9e, 0xc4, 0xa4, 0x51, 0x1e, 0xbe, 0xd0, 0x90,
+			 0x3a, 0x9c, 0xc2, 0x26, 0xb6, 0x1e, 0xf1, 0x95,
+			 0x7d, 0xc8, 0x6d, 0x52, 0xe6, 0x99, 0x2c, 0x5f}
+		},
+		{
+			{0x85, 0xe0, 0x24, 0x32, 0xb4, 0xd1, 0xef, 0xfc,
+			 0x69, 0xa2, 0xbf, 0x8f, 0x72, 0x2c, 0x95, 0xf6,
+			 0xe4, 0x6e, 0x7d, 0x90, 0xf7, 0x57, 0x81, 0xa0,
+			 0xf7, 0xda, 0xef, 0x33, 0x07, 0xe3, 0x6b, 0x78},
+			{0x36, 0x27, 0x3e, 0xc6, 0x12, 0x07, 0xab, 0x4e,
+			 0xbe, 0x69, 0x9d, 0xb3, 0xbe, 0x08, 0x7c, 0x2a,
+			 0x47, 0x08, 0xfd, 0xd4, 0xcd, 0x0e, 0x27, 0x34,
+			 0x5b, 0x98, 0x34, 0x2f, 0x77, 0x5f, 0x3a, 0x65}
+		},
+		{
+			{0xc7, 0xc7, 0x93, 0xf1, 0x89, 0xca, 0x25, 0x31,
+			 0x4b, 0xd9, 0x56, 0x87, 0xcc, 0xba, 0xa4, 0xae,
+			 0x9b, 0xf0, 0x84, 0x8b, 0xa5, 0x3a, 0xfd, 0xa2,
+			 0x1c, 0x95, 0x33, 0xb8, 0xaf, 0x86, 0xc1, 0x09},
+			{0x2f, 0x06, 0x7b, 0x7f, 0x35, 0x9a, 0x34, 0x1a,
+			 0xf1, 0x4f, 0xd5, 0xbe, 0x6b, 0x2a, 0xa8, 0x02,
+			 0x1e, 0x4a, 0x86, 0x49, 0xb1, 0x95, 0x46, 0x93,
+			 0x53, 0xb3, 0x27, 0x60, 0x74, 0xb0, 0x37, 0x61}
+		},
+		{
+			{0x13, 0xaa, 0x2e, 0x4c, 0xf0, 0x22, 0xb8, 0x6c,
+			 0xb3, 0x19, 0x4d, 0xeb, 0x6b, 0xd0, 0xa4, 0xc6,
+			 0x9c, 0xdd, 0xc8, 0x5b, 0x81, 0x57, 0x89, 0xdf,
+			 0x33, 0xa9, 0x68, 0x49, 0x80, 0xe4, 0xfe, 0x21},
+			{0x00, 0x17, 0x90, 0x30, 0xe9, 0xd3, 0x60, 0x30,
+			 0x31, 0xc2, 0x72, 0x89, 0x7a, 0x36, 0xa5, 0xbd,
+			 0x39, 0x83, 0x85, 0x50, 0xa1, 0x5d, 0x6c, 0x41,
+			 0x1d, 0xb5, 0x2c, 0x07, 0x40, 0x77, 0x0b, 0x50}
+		},
+		{
+			{0x17, 0x4f, 0x2d, 0xb1, 0xa2, 0xe3, 0x19, 0x49,
+			 0x55, 0x99, 0x3c, 0x97, 0xe5, 0x0c, 0xa1, 0xed,
+			 0xe8, 0xc9, 0x89, 0x5c, 0x36, 0xe0, 0x13, 0xb8,
+			 0x82, 0xe0, 0xe4, 0xee, 0x96, 0x1f, 0x2e, 0x4a},
+			{0xc4, 0x6f, 0x84, 0xac, 0x32, 0xb8, 0xd4, 0x44,
+			 0x64, 0xa6, 0x35, 0x73, 0x51, 0x9e, 0x22, 0xdc,
+			 0xa8, 0x0d, 0xdf, 0xbf, 0x88, 0x11, 0x95, 0x8c,
+			 0x5b, 0x5c, 0x18, 0x2e, 0x82, 0x24, 0x3f, 0x6c}
+		},
+		{
+			{0x64, 0x34, 0xec, 0xc0, 0x9e, 0x44, 0x41, 0xaf,
+			 0xa0, 0x36, 0x05, 0x6d, 0xea, 0x30, 0x25, 0x46,
+			 0x35, 0x24, 0x9d, 0x86, 0xbd, 0x95, 0xf1, 0x6a,
+			 0x46, 0xd7, 0x94, 0x54, 0xf9, 0x3b, 0xbd, 0x5d},
+			{0x77, 0x5b, 0xe2, 0x37, 0xc7, 0xe1, 0x7c, 0x13,
+			 0x8c, 0x9f, 0x7b, 0x7b, 0x2a, 0xce, 0x42, 0xa3,
+			 0xb9, 0x2a, 0x99, 0xa8, 0xc0, 0xd8, 0x3c, 0x86,
+			 0xb0, 0xfb, 0xe9, 0x76, 0x77, 0xf7, 0xf5, 0x56}
+		},
+		{
+			{0x85, 0x56, 0xed, 0x76, 0xdc, 0xba, 0x70, 0x93,
+			 0x11, 0x5e, 0x27, 0xfd, 0x1a, 0x01, 0x8e, 0xb5,
+			 0xeb, 0x1c, 0x77, 0xf9, 0x7d, 0xd5, 0xf2, 0xf1,
+			 0xc0, 0xd3, 0x75, 0x45, 0x04, 0x02, 0x37, 0x4b},
+			{0x20, 0xb8, 0x89, 0xd2, 0xac, 0x27, 0x20, 0x48,
+			 0x92, 0xe2, 0xcc, 0xaf, 0x0f, 0xcb, 0x6d, 0xe3,
+			 0xaf, 0x6a, 0x60, 0xe5, 0x80, 0x7a, 0x42, 0x2f,
+			 0xf5, 0x32, 0xf3, 0xac, 0x50, 0x3c, 0x33, 0x54}
+		},
+		{
+			{0xdf, 0xb3, 0x46, 0x11, 0x6e, 0x13, 0xb7, 0x28,
+			 0x4e, 0x56, 0xdd, 0xf1, 0xac, 0xad, 0x58, 0xc3,
+			 0xf8, 0x88, 0x94, 0x5e, 0x06, 0x98, 0xa1, 0xe4,
+			 0x6a, 0xfb, 0x0a, 0x49, 0x5d, 0x8a, 0xfe, 0x77},
+			{0x46, 0x02, 0xf5, 0xa5, 0xaf, 0xc5, 0x75, 0x6d,
+			 0xba, 0x45, 0x35, 0x0a, 0xfe, 0xc9, 0xac, 0x22,
+			 0x91, 0x8d, 0x21, 0x95, 0x33, 0x03, 0xc0, 0x8a,
+			 0x16, 0xf3, 0x39, 0xe0, 0x01, 0x0f, 0x53, 0x3c}
+		}
+	},
+#endif
+#if (34 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xd6, 0xe3, 0x96, 0x61, 0x3a, 0xfd, 0xef, 0x9b,
+			 0x1f, 0x90, 0xa4, 0x24, 0x14, 0x5b, 0xc8, 0xde,
+			 0x50, 0xb1, 0x1d, 0xaf, 0xe8, 0x55, 0x8a, 0x87,
+			 0x0d, 0xfe, 0xaa, 0x3b, 0x82, 0x2c, 0x8d, 0x7b},
+			{0x85, 0x0c, 0xaf, 0xf8, 0x83, 0x44, 0x49, 0xd9,
+			 0x45, 0xcf, 0xf7, 0x48, 0xd9, 0x53, 0xb4, 0xf1,
+			 0x65, 0xa0, 0xe1, 0xc3, 0xb3, 0x15, 0xed, 0x89,
+			 0x9b, 0x4f, 0x62, 0xb3, 0x57, 0xa5, 0x45, 0x1c}
+		},
+		{
+			{0x88, 0xc1, 0x99, 0xd0, 0x3c, 0x1c, 0x5d, 0xb4,
+			 0xef, 0x13, 0x0f, 0x90, 0xb9, 0x36, 0x2f, 0x95,
+			 0x95, 0xc6, 0xdc, 0xde, 0x0a, 0x51, 0xe2, 0x8d,
+			 0xf3, 0xbc, 0x51, 0xec, 0xdf, 0xb1, 0xa2, 0x5f},
+			{0x2e, 0x68, 0xa1, 0x23, 0x7d, 0x9b, 0x40, 0x69,
+			 0x85, 0x7b, 0x42, 0xbf, 0x90, 0x4b, 0xd6, 0x40,
+			 0x2f, 0xd7, 0x52, 0x52, 0xb2, 0x21, 0xde, 0x64,
+			 0xbd, 0x88, 0xc3, 0x6d, 0xa5, 0xfa, 0x81, 0x3f}
+		},
+		{
+			{0x28, 0x95, 0x00, 0xc7, 0x0b, 0xc7, 0x8a, 0x2a,
+			 0x8e, 0x4c, 0x6a, 0x1f, 0x03, 0x61, 0x23, 0xa8,
+			 0x96, 0x5a, 0x5a, 0x96, 0xd5, 0x63, 0xa2, 0xa5,
+			 0x99, 0xac, 0xb5, 0xb6, 0xd4, 0xa1, 0x80, 0x37},
+			{0xfe, 0x25, 0x88, 0x23, 0xea, 0x5f, 0xb9, 0x83,
+			 0x6d, 0xef, 0x2c, 0x65, 0xd6, 0x18, 0xe3, 0x8d,
+			 0xb9, 0xf3, 0x0e, 0x90, 0x36, 0x9f, 0xfc, 0xb6,
+			 0x8c, 0x25, 0x63, 0x1e, 0x13, 0xdc, 0xa8, 0x3a}
+		},
+		{
+			{0xfb, 0xfd, 0x47, 0x7b, 0x8a, 0x66, 0x9e, 0x79,
+			 0x2e, 0x64, 0x82, 0xef, 0xf7, 0x21, 0xec, 0xf6,
+			 0xd8, 0x86, 0x09, 0x31, 0x7c, 0xdd, 0x03, 0x6a,
+			 0x58, 0xa0, 0x77, 0xb7, 0x9b, 0x8c, 0x87, 0x1f},
+			{0x55, 0x47, 0xe4, 0xa8, 0x3d, 0x55, 0x21, 0x34,
+			 0xab, 0x1d, 0xae, 0xe0, 0xf4, 0xea, 0xdb, 0xc5,
+			 0xb9, 0x58, 0xbf, 0xc4, 0x2a, 0x89, 0x31, 0x1a,
+			 0xf4, 0x2d, 0xe1, 0xca, 0x37, 0x99, 0x47, 0x59}
+		},
+		{
+			{0xff, 0x47, 0x1c, 0x8e, 0x1a, 0x57, 0xf5, 0xe5,
+			 0xa3, 0xd5, 0x8b, 0xd5, 0x19, 0x09, 0xc3, 0xbe,
+			 0x38, 0x9e, 0xd1, 0x5d, 0xfd, 0x18, 0x6a, 0x3e,
+			 0x56, 0x0a, 0x6c, 0xef, 0x08, 0x83, 0x45, 0x58},
+			{0x2e, 0xc0, 0xb1, 0x2b, 0xfc, 0x26, 0xd6, 0x0f,
+			 0x86, 0xe6, 0xee, 0x6b, 0x32, 0xe8, 0x44, 0x75,
+			 0x72, 0x09, 0x23, 0xce, 0xd0, 0x52, 0x49, 0x96,
+			 0x78, 0x6b, 0x33, 0x2b, 0x4d, 0x66, 0x9d, 0x25}
+		},
+		{
+			{0xb0, 0x5c, 0x66, 0xe0, 0x13, 0xff, 0x63, 0x07,
+			 0xe5, 0xd3, 0xbc, 0xa7, 0x94, 0x79, 0x7d, 0x40,
+			 0x03, 0x51, 0x00, 0x33, 0x57, 0x9c, 0x71, 0x8f,
+			 0x5f, 0x71, 0x1f, 0x2b, 0xef, 0x8e, 0x3f, 0x33},
+			{0x5a, 0x7b, 0x4c, 0x7b, 0x10, 0xf4, 0x87, 0x70,
+			 0xb6, 0x33, 0xfc, 0x87, 0xb2, 0xa1, 0xb2, 0x97,
+			 0x30, 0x22, 0xee, 0x19, 0x9b, 0x4a, 0xd6, 0x36,
+			 0xaa, 0xaf, 0x4c, 0xfc, 0xd8, 0x83, 0x18, 0x13}
+		},
+		{
+			{0x39, 0xec, 0x43, 0xd4, 0xaf, 0x22, 0x9e, 0x97,
+			 0x24, 0x02, 0xaa, 0x1e, 0xe1, 0x86, 0x22, 0xc8,
+			 0x1d, 0xe5, 0x08, 0x5b, 0x8d, 0xd6, 0x81, 0xed,
+			 0xa3, 0xf4, 0x95, 0x6d, 0xd2, 0xe1, 0x10, 0x7b},
+			{0x49, 0x95, 0x91, 0xa6, 0x7c, 0x81, 0x5e, 0x60,
+			 0xa8, 0xf1, 0x89, 0x24, 0x8d, 0xa1, 0xf1, 0x69,
+			 0x7f, 0xb2, 0x02, 0xd9, 0x7f, 0xc6, 0x40, 0xc9,
+			 0x3d, 0x13, 0xdd, 0xe8, 0x75, 0x38, 0x66, 0x36}
+		},
+		{
+			{0xc7, 0xca, 0x63, 0xc1, 0x49, 0xa9, 0x35, 0x45,
+			 0x55, 0x7e, 0xda, 0x64, 0x32, 0x07, 0x50, 0xf7,
+			 0x32, 0xac, 0xde, 0x75, 0x58, 0x9b, 0x11, 0xb2,
+			 0x3a, 0x1f, 0xf5, 0xf7, 0x79, 0x04, 0xe6, 0x08},
+			{0x46, 0xfa, 0x22, 0x4b, 0xfa, 0xe1, 0xfe, 0x96,
+			 0xfc, 0x67, 0xba, 0x67, 0x97, 0xc4, 0xe7, 0x1b,
+			 0x86, 0x90, 0x5f, 0xee, 0xf4, 0x5b, 0x11, 0xb2,
+			 0xcd, 0xad, 0xee, 0xc2, 0x48, 0x6c, 0x2b, 0x1b}
+		}
+	},
+#endif
+#if (36 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x91, 0x3f, 0xed, 0x5e, 0x18, 0x78, 0x3f, 0x23,
+			 0x2c, 0x0d, 0x8c, 0x44, 0x00, 0xe8, 0xfb, 0xe9,
+			 0x8e, 0xd6, 0xd1, 0x36, 0x58, 0x57, 0x9e, 0xae,
+			 0x4b, 0x5c, 0x0b, 0x07, 0xbc, 0x6b, 0x55, 0x2b},
+			{0x6f, 0x4d, 0x17, 0xd7, 0xe1, 0x84, 0xd9, 0x78,
+			 0xb1, 0x90, 0xfd, 0x2e, 0xb3, 0xb5, 0x19, 0x3f,
+			 0x1b, 0xfa, 0xc0, 0x68, 0xb3, 0xdd, 0x00, 0x2e,
+			 0x89, 0xbd, 0x7e, 0x80, 0x32, 0x13, 0xa0, 0x7b}
+		},
+		{
+			{0x1a, 0x6f, 0x40, 0xaf, 0x44, 0x44, 0xb0, 0x43,
+			 0x8f, 0x0d, 0xd0, 0x1e, 0xc4, 0x0b, 0x19, 0x5d,
+			 0x8e, 0xfe, 0xc1, 0xf3, 0xc5, 0x5c, 0x91, 0xf8,
+			 0x04, 0x4e, 0xbe, 0x90, 0xb4, 0x47, 0x5c, 0x3f},
+			{0xb0, 0x3b, 0x2c, 0xf3, 0xfe, 0x32, 0x71, 0x07,
+			 0x3f, 0xaa, 0xba, 0x45, 0x60, 0xa8, 0x8d, 0xea,
+			 0x54, 0xcb, 0x39, 0x10, 0xb4, 0xf2, 0x8b, 0xd2,
+			 0x14, 0x82, 0x42, 0x07, 0x8e, 0xe9, 0x7c, 0x53}
+		},
+		{
+			{0xb0, 0xae, 0xc1, 0x8d, 0xc9, 0x8f, 0xb9, 0x7a,
+			 0x77, 0xef, 0xba, 0x79, 0xa0, 0x3c, 0xa8, 0xf5,
+			 0x6a, 0xe2, 0x3f, 0x5d, 0x00, 0xe3, 0x4b, 0x45,
+			 0x24, 0x7b, 0x43, 0x78, 0x55, 0x1d, 0x2b, 0x1e},
+			{0x01, 0xb8, 0xd6, 0x16, 0x67, 0xa0, 0x15, 0xb9,
+			 0xe1, 0x58, 0xa4, 0xa7, 0x31, 0x37, 0x77, 0x2f,
+			 0x8b, 0x12, 0x9f, 0xf4, 0x3f, 0xc7, 0x36, 0x66,
+			 0xd2, 0xa8, 0x56, 0xf7, 0x7f, 0x74, 0xc6, 0x41}
+		},
+		{
+			{0x5d, 0xf8, 0xb4, 0xa8, 0x30, 0xdd, 0xcc, 0x38,
+			 0xa5, 0xd3, 0xca, 0xd8, 0xd1, 0xf8, 0xb2, 0x31,
+			 0x91, 0xd4, 0x72, 0x05, 0x57, 0x4a, 0x3b, 0x82,
+			 0x4a, 0xc6, 0x68, 0x20, 0xe2, 0x18, 0x41, 0x61},
+			{0x19, 0xd4, 0x8d, 0x47, 0x29, 0x12, 0x65, 0xb0,
+			 0x11, 0x78, 0x47, 0xb5, 0xcb, 0xa3, 0xa5, 0xfa,
+			 0x05, 0x85, 0x54, 0xa9, 0x33, 0x97, 0x8d, 0x2b,
+			 0xc2, 0xfe, 0x99, 0x35, 0x28, 0xe5, 0xeb, 0x63}
+		},
+		{
+			{0x8a, 0x3c, 0x77, 0xef, 0x2a, 0x2e, 0xe9, 0xb7,
+			 0x46, 0x1e, 0x76, 0x21, 0x4c, 0x1c, 0x54, 0x6b,
+			 0x18, 0x12, 0xf3, 0x56, 0x10, 0x0f, 0x40, 0x85,
+			 0xb0, 0xf3, 0x22, 0x85, 0x48, 0x75, 0x34, 0x23},
+			{0x88, 0xb2, 0x12, 0xa8, 0x97, 0x6b, 0x9d, 0x2a,
+			 0xc7, 0xfa, 0xe0, 0xbd, 0x25, 0xb1, 0x1a, 0xc0,
+			 0xb7, 0x5e, 0xd6, 0x95, 0x47, 0xb9, 0x03, 0x3e,
+			 0x15, 0x47, 0x2a, 0xbe, 0x73, 0xd7, 0xe8, 0x37}
+		},
+		{
+			{0x4c, 0x84, 0x22, 0xcd, 0x7b, 0x03, 0xbf, 0x10,
+			 0x5f, 0xe2, 0x9e, 0x8d, 0x23, 0x25, 0xef, 0xd0,
+			 0x3c, 0xa7, 0xa9, 0xf9, 0x75, 0x5e, 0x4a, 0x9a,
+			 0x2d, 0x4d, 0xad, 0x07, 0x50, 0xc0, 0x8a, 0x31},
+			{0xa2, 0x22, 0x32, 0x82, 0xc8, 0xaa, 0x53, 0x1d,
+			 0x7f, 0xf5, 0x2c, 0x1c, 0xcd, 0x19, 0x0f, 0x2c,
+			 0xa4, 0xb6, 0xd9, 0x7b, 0x97, 0x2a, 0x75, 0x34,
+			 0x27, 0xf8, 0xb3, 0xdf, 0x99, 0xa2, 0xf5, 0x6b}
+		},
+		{
+			{0x96, 0x2c, 0x15, 0x0d, 0xcb, 0xfc, 0x73, 0x2c,
+			 0xc0, 0x04, 0x5d, 0xc9, 0x44, 0x9f, 0x10, 0xfa,
+			 0x82, 0x6f, 0x48, 0xa3, 0xa6, 0xf8, 0xfe, 0x5e,
+			 0xab, 0x79, 0x25, 0xdb, 0x6b, 0xbf, 0x76, 0x1b},
+			{0x48, 0x39, 0x0c, 0xfd, 0x1e, 0x76, 0x06, 0x57,
+			 0x36, 0x75, 0x72, 0x42, 0x6f, 0x68, 0x9a, 0x45,
+			 0xed, 0x3e, 0xf0, 0xd3, 0x20, 0x3e, 0x17, 0xf3,
+			 0x30, 0x5e, 0x82, 0x28, 0xac, 0x67, 0x2f, 0x50}
+		},
+		{
+			{0xb1, 0x3f, 0x3f, 0xef, 0xd8, 0xf4, 0xfc, 0xb3,
+			 0xa0, 0x60, 0x50, 0x06, 0x2b, 0x29, 0x52, 0x70,
+			 0x15, 0x0b, 0x24, 0x24, 0xf8, 0x5f, 0x79, 0x18,
+			 0xcc, 0xff, 0x89, 0x99, 0x84, 0xa1, 0xae, 0x13},
+			{0x44, 0x1f, 0xb8, 0xc2, 0x01, 0xc1, 0x30, 0x19,
+			 0x55, 0x05, 0x60, 0x10, 0xa4, 0x6c, 0x2d, 0x67,
+			 0x70, 0xe5, 0x25, 0x1b, 0xf2, 0xbf, 0xdd, 0xfb,
+			 0x70, 0x2b, 0xa1, 0x8c, 0x9c, 0x94, 0x84, 0x08}
+		}
+	},
+#endif
+#if (38 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x1a, 0xda, 0xf3, 0xa5, 0x41, 0x43, 0x28, 0xfc,
+			 0x7e, 0xe7, 0x71, 0xea, 0xc6, 0x3b, 0x59, 0xcc,
+			 0x2e, 0xd3, 0x40, 0xec, 0xb3, 0x13, 0x6f, 0x44,
+			 0xcd, 0x13, 0xb2, 0x37, 0xf2, 0x6e, 0xd9, 0x1c},
+			{0xe3, 0xdb, 0x60, 0xcd, 0x5c, 0x4a, 0x18, 0x0f,
+			 0xef, 0x73, 0x36, 0x71, 0x8c, 0xf6, 0x11, 0xb4,
+			 0xd8, 0xce, 0x17, 0x5e, 0x4f, 0x26, 0x77, 0x97,
+			 0x5f, 0xcb, 0xef, 0x91, 0xeb, 0x6a, 0x62, 0x7a}
+		},
+		{
+			{0x18, 0x4a, 0xa2, 0x97, 0x08, 0x81, 0x2d, 0x83,
+			 0xc4, 0xcc, 0xf0, 0x83, 0x7e, 0xec, 0x0d, 0x95,
+			 0x4c, 0x5b, 0xfb, 0xfa, 0x98, 0x80, 0x4a, 0x66,
+			 0x56, 0x0c, 0x51, 0xb3, 0xf2, 0x04, 0x5d, 0x27},
+			{0x3b, 0xb9, 0xb8, 0x06, 0x5a, 0x2e, 0xfe, 0xc3,
+			 0x82, 0x37, 0x9c, 0xa3, 0x11, 0x1f, 0x9c, 0xa6,
+			 0xda, 0x63, 0x48, 0x9b, 0xad, 0xde, 0x2d, 0xa6,
+			 0xbc, 0x6e, 0x32, 0xda, 0x27, 0x65, 0xdd, 0x57}
+		},
+		{
+			{0xc5, 0x09, 0x53, 0xbb, 0x01, 0xa5, 0x2d, 0x5e,
+			 0x19, 0x37, 0xcc, 0x3a, 0x4d, 0xc5, 0x5c, 0x42,
+			 0x5a, 0x53, 0xd8, 0x71, 0x53, 0x67, 0x94, 0x79,
+			 0xb8, 0xf8, 0xdd, 0x92, 0x11, 0x7a, 0xc1, 0x5d},
+			{0x78, 0x3d, 0x65, 0xad, 0x1c, 0xf2, 0x86, 0x3e,
+			 0xb6, 0x84, 0x98, 0x2b, 0xdc, 0xac, 0x38, 0x5e,
+			 0xd1, 0xed, 0x21, 0x01, 0xd3, 0x7f, 0xf9, 0xe2,
+			 0x20, 0x91, 0xe7, 0xbe, 0x31, 0x8e, 0x53, 0x68}
+		},
+		{
+			{0x84, 0x4f, 0x37, 0x31, 0x7d, 0x2e, 0xbc, 0xad,
+			 0x87, 0x07, 0x2a, 0x6b, 0x37, 0xfc, 0x5f, 0xeb,
+			 0x4e, 0x75, 0x35, 0xa6, 0xde, 0xab, 0x0a, 0x19,
+			 0x3a, 0xb7, 0xb1, 0xef, 0x92, 0x6a, 0x3b, 0x3c},
+			{0x3b, 0xb2, 0x94, 0x6d, 0x39, 0x60, 0xac, 0xee,
+			 0xe7, 0x81, 0x1a, 0x3b, 0x76, 0x87, 0x5c, 0x05,
+			 0x94, 0x2a, 0x45, 0xb9, 0x80, 0xe9, 0x22, 0xb1,
+			 0x07, 0xcb, 0x40, 0x9e, 0x70, 0x49, 0x6d, 0x12}
+		},
+		{
+			{0x36, 0x25, 0x76, 0x00, 0x30, 0x88, 0xf3, 0x0f,
+			 0xd9, 0x8e, 0x57, 0x6c, 0x2c, 0x57, 0x99, 0x0e,
+			 0x83, 0x24, 0x03, 0xfb, 0xef, 0x2d, 0x34, 0x98,
+			 0x9a, 0x35, 0x24, 0x54, 0x72, 0x22, 0x62, 0x49},
+			{0x4f, 0xe6, 0x7c, 0xfd, 0x25, 0x19, 0xdc, 0x2f,
+			 0xcb, 0x9f, 0xdf, 0xc9, 0x61, 0xbf, 0x5d, 0xc4,
+			 0xc1, 0xd3, 0x8f, 0x69, 0xee, 0x36, 0xac, 0x1a,
+			 0xe6, 0x0c, 0x2b, 0xde, 0x34, 0x06, 0x37, 0x0b}
+		},
+		{
+			{0xfd, 0x18, 0x78, 0x84, 0xa8, 0x4c, 0x7d, 0x6e,
+			 0x59, 0xa6, 0xe5, 0x74, 0xf1, 0x19, 0xa6, 0x84,
+			 0x2e, 0x51, 0xc1, 0x29, 0x13, 0xf2, 0x14, 0x6b,
+			 0x5d, 0x53, 0x51, 0xf7, 0xef, 0xbf, 0x01, 0x22},
+			{0xa4, 0x4b, 0x62, 0x4c, 0xe6, 0xfd, 0x72, 0x07,
+			 0xf2, 0x81, 0xfc, 0xf2, 0xbd, 0x12, 0x7c, 0x68,
+			 0x76, 0x2a, 0xba, 0xf5, 0x65, 0xb1, 0x1f, 0x17,
+			 0x0a, 0x38, 0xb0, 0xbf, 0xc0, 0xf8, 0xf4, 0x2a}
+		},
+		{
+			{0xb3, 0xbb, 0x50, 0x45, 0x8a, 0x9e, 0x8e, 0x36,
+			 0x93, 0xaa, 0x2a, 0xde, 0x6a, 0x1d, 0xa9, 0x53,
+			 0x62, 0x5c, 0x25, 0x7e, 0x77, 0x68, 0x32, 0xb2,
+			 0x50, 0x26, 0x54, 0x7e, 0x50, 0xb9, 0xe4, 0x13},
+			{0xd8, 0x03, 0x4a, 0x27, 0xbb, 0xd4, 0xda, 0x36,
+			 0xed, 0xfd, 0xd5, 0x6a, 0x91, 0x95, 0xd6, 0xd1,
+			 0xed, 0x5b, 0xaa, 0x4a, 0x9b, 0x8b, 0x7a, 0x79,
+			 0x0a, 0x97, 0x6b, 0x8e, 0x8f, 0x2e, 0xcf, 0x79}
+		},
+		{
+			{0x55, 0x60, 0x55, 0x5b, 0xe4, 0x1d, 0x71, 0x4c,
+			 0x9d, 0x5b, 0x9f, 0x70, 0xa6, 0x85, 0x9a, 0x2c,
+			 0xa0, 0xe2, 0x32, 0x48, 0xce, 0x9e, 0x2a, 0xa5,
+			 0x07, 0x3b, 0xc7, 0x6c, 0x86, 0x77, 0xde, 0x3c},
+			{0xf7, 0x18, 0x7a, 0x96, 0x7e, 0x43, 0x57, 0xa9,
+			 0x55, 0xfc, 0x4e, 0xb6, 0x72, 0x00, 0xf2, 0xe4,
+			 0xd7, 0x52, 0xd3, 0xd3, 0xb6, 0x85, 0xf6, 0x71,
+			 0xc7, 0x44, 0x3f, 0x7f, 0xd7, 0xb3, 0xf2, 0x79}
+		}
+	},
+#endif
+#if (40 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x31, 0x40, 0x01, 0x52, 0x56, 0x94, 0x5b, 0x28,
+			 0x8a, 0xaa, 0x52, 0xee, 0xd8, 0x0a, 0x05, 0x8d,
+			 0xcd, 0xb5, 0xaa, 0x2e, 0x38, 0xaa, 0xb7, 0x87,
+			 0xf7, 0x2b, 0xfb, 0x04, 0xcb, 0x84, 0x3d, 0x54},
+			{0x20, 0xef, 0x59, 0xde, 0xa4, 0x2b, 0x93, 0x6e,
+			 0x2e, 0xec, 0x42, 0x9a, 0xd4, 0x2d, 0xf4, 0x46,
+			 0x58, 0x27, 0x2b, 0x18, 0x8f, 0x83, 0x3d, 0x69,
+			 0x9e, 0xd4, 0x3e, 0xb6, 0xc5, 0xfd, 0x58, 0x03}
+		},
+		{
+			{0xa1, 0x5e, 0x60, 0x4f, 0xfb, 0xe1, 0x70, 0x6a,
+			 0x1f, 0x55, 0x4f, 0x09, 0xb4, 0x95, 0x33, 0x36,
+			 0xc6, 0x81, 0x01, 0x18, 0x06, 0x25, 0x27, 0xa4,
+			 0xb4, 0x24, 0xa4, 0x86, 0x03, 0x4c, 0xac, 0x02},
+			{0x77, 0x38, 0xde, 0xd7, 0x60, 0x48, 0x07, 0xf0,
+			 0x74, 0xa8, 0xff, 0x54, 0xe5, 0x30, 0x43, 0xff,
+			 0x77, 0xfb, 0x21, 0x07, 0xff, 0xb2, 0x07, 0x6b,
+			 0xe4, 0xe5, 0x30, 0xfc, 0x19, 0x6c, 0xa3, 0x01}
+		},
+		{
+			{0xe9, 0x39, 0xa0, 0x62, 0xdb, 0xa6, 0xb3, 0xf3,
+			 0x02, 0x90, 0x98, 0xa3, 0x3c, 0x8c, 0x78, 0xa3,
+			 0x59, 0x4f, 0x2e, 0x44, 0x0f, 0x2c, 0x05, 0x15,
+			 0x9e, 0xfe, 0x40, 0xa2, 0x67, 0xd6, 0x2d, 0x2d},
+			{0xd1, 0x4d, 0x55, 0x06, 0x15, 0x79, 0xe8, 0x76,
+			 0xdb, 0x38, 0xb8, 0x5c, 0x11, 0xfd, 0xae, 0x64,
+			 0x8d, 0x0c, 0xbf, 0x39, 0x46, 0x6d, 0xba, 0x27,
+			 0x52, 0xd8, 0xc5, 0x79, 0xdb, 0xd9, 0x7b, 0x37}
+		},
+		{
+			{0x13, 0xc5, 0x2c, 0xac, 0xd3, 0x83, 0x82, 0x7c,
+			 0x29, 0xf7, 0x05, 0xa5, 0x00, 0xb6, 0x1f, 0x86,
+			 0x55, 0xf4, 0xd6, 0x2f, 0x0c, 0x99, 0xd0, 0x65,
+			 0x9b, 0x6b, 0x46, 0x0d, 0x43, 0xf8, 0x16, 0x28},
+			{0x1e, 0x7f, 0xb4, 0x74, 0x7e, 0xb1, 0x89, 0x4f,
+			 0x18, 0x5a, 0xab, 0x64, 0x06, 0xdf, 0x45, 0x87,
+			 0xe0, 0x6a, 0xc6, 0xf0, 0x0e, 0xc9, 0x24, 0x35,
+			 0x38, 0xea, 0x30, 0x54, 0xb4, 0xc4, 0x52, 0x54}
+		},
+		{
+			{0xf3, 0xbe, 0x4b, 0xba, 0x6f, 0x6a, 0xc4, 0xad,
+			 0x01, 0xda, 0xbc, 0xb9, 0xbf, 0x47, 0x7f, 0xe4,
+			 0xb1, 0xbf, 0x60, 0x05, 0x85, 0x87, 0x15, 0xfb,
+			 0xac, 0xc5, 0xa2, 0x06, 0x6f, 0xba, 0xae, 0x1c},
+			{0xb8, 0x85, 0x8d, 0xe9, 0x7b, 0x6a, 0x65, 0x39,
+			 0x9d, 0xd5, 0xbb, 0xc6, 0x80, 0xc1, 0x1e, 0xa9,
+			 0x51, 0xdc, 0x25, 0x42, 0xf5, 0xce, 0x0f, 0x4a,
+			 0x77, 0x75, 0xea, 0xe7, 0x11, 0xdc, 0xfc, 0x65}
+		},
+		{
+			{0xc7, 0xa5, 0x35, 0x19, 0xd5, 0xf5, 0x50, 0xac,
+			 0x8c, 0x8c, 0x4c, 0x53, 0x02, 0xe9, 0xb9, 0xc6,
+			 0x67, 0x09, 0xdd, 0x20, 0xc7, 0xea, 0xc4, 0xc8,
+			 0xf4, 0xde, 0x5a, 0xbf, 0x52, 0x29, 0x0c, 0x06},
+			{0x5b, 0x7f, 0x42, 0x05, 0x42, 0x4b, 0xa8, 0x34,
+			 0x47, 0xaa, 0x1c, 0xb0, 0x71, 0xc5, 0x2c, 0x2b,
+			 0xdf, 0xbd, 0x1f, 0xb0, 0xdb, 0x53, 0xc6, 0x77,
+			 0x49, 0x52, 0x82, 0x44, 0x49, 0x5d, 0xef, 0x10}
+		},
+		{
+			{0x00, 0x0c, 0x1f, 0x70, 0xb4, 0x37, 0xa5, 0x45,
+			 0x2c, 0x89, 0x6e, 0x59, 0x91, 0x35, 0x2e, 0x90,
+			 0xf9, 0x51, 0x76, 0xc0, 0xdc, 0x5f, 0xa1, 0x16,
+			 0x55, 0xe9, 0xf4, 0x23, 0x89, 0x69, 0x41, 0x5d},
+			{0x11, 0xbc, 0xf8, 0xee, 0x80, 0x47, 0x36, 0xc5,
+			 0x77, 0x10, 0xd4, 0x7d, 0x32, 0xee, 0x8a, 0xe4,
+			 0xfd, 0x98, 0x82, 0x0b, 0xaf, 0xde, 0xda, 0xbe,
+			 0xe8, 0xf2, 0xe9, 0x28, 0x4a, 0x79, 0x92, 0x2d}
+		},
+		{
+			{0xe9, 0x9f, 0xdc, 0x3f, 0xc1, 0x89, 0x44, 0x74,
+			 0x27, 0xe4, 0xc1, 0x90, 0xff, 0x4a, 0xa7, 0x3c,
+			 0xee, 0xcd, 0xf4, 0x1d, 0x25, 0x94, 0x7f, 0x63,
+			 0x16, 0x48, 0xbc, 0x64, 0xfe, 0x95, 0xc4, 0x0c},
+			{0x8b, 0x19, 0x75, 0x6e, 0x03, 0x06, 0x5e, 0x6a,
+			 0x6f, 0x1a, 0x8c, 0xe3, 0xd3, 0x28, 0xf2, 0xe0,
+			 0xb9, 0x7a, 0x43, 0x69, 0xe6, 0xd3, 0xc0, 0xfe,
+			 0x7e, 0x97, 0xab, 0x6c, 0x7b, 0x8e, 0x13, 0x42}
+		}
+	},
+#endif
+#if (42 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x8a, 0x64, 0x1e, 0x14, 0x0a, 0x57, 0xd4, 0xda,
+			 0x5c, 0x96, 0x9b, 0x01, 0x4c, 0x67, 0xbf, 0x8b,
+			 0x30, 0xfe, 0x08, 0xdb, 0x0d, 0xd5, 0xa8, 0xd7,
+			 0x09, 0x11, 0x85, 0xa2, 0xd3, 0x45, 0xfb, 0x7e},
+			{0xda, 0x8c, 0xc2, 0xd0, 0xac, 0x18, 0xe8, 0x52,
+			 0x36, 0xd4, 0x21, 0xa3, 0xdd, 0x57, 0x22, 0x79,
+			 0xb7, 0xf8, 0x71, 0x9d, 0xc6, 0x91, 0x70, 0x86,
+			 0x56, 0xbf, 0xa1, 0x11, 0x8b, 0x19, 0xe1, 0x0f}
+		},
+		{
+			{0x18, 0x32, 0x98, 0x2c, 0x8f, 0x91, 0xae, 0x12,
+			 0xf0, 0x8c, 0xea, 0xf3, 0x3c, 0xb9, 0x5d, 0xe4,
+			 0x69, 0xed, 0xb2, 0x47, 0x18, 0xbd, 0xce, 0x16,
+			 0x52, 0x5c, 0x23, 0xe2, 0xa5, 0x25, 0x52, 0x5d},
+			{0xb9, 0xb1, 0xe7, 0x5d, 0x4e, 0xbc, 0xee, 0xbb,
+			 0x40, 0x81, 0x77, 0x82, 0x19, 0xab, 0xb5, 0xc6,
+			 0xee, 0xab, 0x5b, 0x6b, 0x63, 0x92, 0x8a, 0x34,
+			 0x8d, 0xcd, 0xee, 0x4f, 0x49, 0xe5, 0xc9, 0x7e}
+		},
+		{
+			{0x21, 0xac, 0x8b, 0x22, 0xcd, 0xc3, 0x9a, 0xe9,
+			 0x5e, 0x78, 0xbd, 0xde, 0xba, 0xad, 0xab, 0xbf,
+			 0x75, 0x41, 0x09, 0xc5, 0x58, 0xa4, 0x7d, 0x92,
+			 0xb0, 0x7f, 0xf2, 0xa1, 0xd1, 0xc0, 0xb3, 0x6d},
+			{0x62, 0x4f, 0xd0, 0x75, 0x77, 0xba, 0x76, 0x77,
+			 0xd7, 0xb8, 0xd8, 0x92, 0x6f, 0x98, 0x34, 0x3d,
+			 0xd6, 0x4e, 0x1c, 0x0f, 0xf0, 0x8f, 0x2e, 0xf1,
+			 0xb3, 0xbd, 0xb1, 0xb9, 0xec, 0x99, 0xb4, 0x07}
+		},
+		{
+			{0x60, 0x57, 0x2e, 0x9a, 0x72, 0x1d, 0x6b, 0x6e,
+			 0x58, 0x33, 0x24, 0x8c, 0x48, 0x39, 0x46, 0x8e,
+			 0x89, 0x6a, 0x88, 0x51, 0x23, 0x62, 0xb5, 0x32,
+			 0x09, 0x36, 0xe3, 0x57, 0xf5, 0x98, 0xde, 0x6f},
+			{0x8b, 0x2c, 0x00, 0x48, 0x4a, 0xf9, 0x5b, 0x87,
+			 0x69, 0x52, 0xe5, 0x5b, 0xd1, 0xb1, 0xe5, 0x25,
+			 0x25, 0xe0, 0x9c, 0xc2, 0x13, 0x44, 0xe8, 0xb9,
+			 0x0a, 0x70, 0xad, 0xbd, 0x0f, 0x51, 0x94, 0x69}
+		},
+		{
+			{0xd5, 0xb4, 0xe8, 0x6e, 0x40, 0x7c, 0xb0, 0x07,
+			 0x64, 0x07, 0x1f, 0xa9, 0xf1, 0x95, 0xbd, 0xd9,
+			 0x4f, 0x5d, 0xd4, 0x4e, 0xf8, 0x57, 0x34, 0xfa,
+			 0xbd, 0x8f, 0x70, 0xb9, 0xf5, 0xd9, 0xd4, 0x73},
+			{0x16, 0xe5, 0x69, 0xc6, 0xfc, 0xc7, 0x17, 0x6a,
+			 0x73, 0xe3, 0xcc, 0x32, 0x2b, 0xa5, 0x0f, 0xb2,
+			 0x16, 0x37, 0xd0, 0xa2, 0xa6, 0xf1, 0x5d, 0x86,
+			 0x0a, 0x1e, 0xd4, 0xe7, 0xce, 0x14, 0x6e, 0x25}
+		},
+		{
+			{0xa9, 0xa8, 0x11, 0xa2, 0xa6, 0x43, 0xbf, 0x50,
+			 0x03, 0x8b, 0x32, 0x21, 0xd3, 0x4e, 0x15, 0x2a,
+			 0x9a, 0xfb, 0xbb, 0xcb, 0xa3, 0xb6, 0xb2, 0x03,
+			 0x13, 0xf6, 0xb6, 0x84, 0xc1, 0x70, 0x33, 0x5c},
+			{0x7e, 0xd0, 0x0a, 0x9a, 0x26, 0xd7, 0x76, 0x7e,
+			 0x38, 0x31, 0x03, 0x39, 0xd9, 0x6d, 0x89, 0x05,
+			 0x11, 0xab, 0x11, 0xdd, 0x45, 0xaa, 0x35, 0x5d,
+			 0x00, 0x24, 0x33, 0xe9, 0xd9, 0x52, 0x2a, 0x29}
+		},
+		{
+			{0x99, 0x9c, 0x38, 0x14, 0xf0, 0x09, 0xbf, 0xf8,
+			 0x40, 0x6d, 0xfb, 0x43, 0x37, 0xf2, 0xb5, 0xd3,
+			 0x90, 0xf4, 0xa2, 0xbd, 0xc8, 0x70, 0x4c, 0xf1,
+			 0xb6, 0x2a, 0x56, 0xf9, 0xee, 0xf8, 0x9d, 0x0f},
+			{0x30, 0xe7, 0x3b, 0xb3, 0x4e, 0x67, 0x9a, 0xdd,
+			 0x6e, 0x29, 0x30, 0x74, 0x40, 0xee, 0x09, 0xb5,
+			 0x42, 0xc8, 0xf4, 0x52, 0x5a, 0xb7, 0x51, 0x37,
+			 0xe4, 0x0f, 0x97, 0x73, 0x5b, 0xc0, 0xdd, 0x42}
+		},
+		{
+			{0xa2, 0xdc, 0xab, 0xa9, 0x25, 0x2d, 0xac, 0x5f,
+			 0x03, 0x33, 0x08, 0xe7, 0x7e, 0xfe, 0x95, 0x36,
+			 0x3c, 0x5b, 0x3a, 0xd3, 0x05, 0x82, 0x1c, 0x95,
+			 0x2d, 0xd8, 0x77, 0x7e, 0x02, 0xd9, 0x5b, 0x70},
+			{0xc2, 0xfe, 0x1b, 0x0c, 0x67, 0xcd, 0xd6, 0xe0,
+			 0x51, 0x8e, 0x2c, 0xe0, 0x79, 0x88, 0xf0, 0xcf,
+			 0x41, 0x4a, 0xad, 0x23, 0xd4, 0x46, 0xca, 0x94,
+			 0xa1, 0xc3, 0xeb, 0x28, 0x06, 0xfa, 0x17, 0x14}
+		}
+	},
+#endif
+#if (44 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x6a, 0xeb, 0xfc, 0x9a, 0x9a, 0x10, 0xce, 0xdb,
+			 0x3a, 0x1c, 0x3c, 0x6a, 0x9d, 0xea, 0x46, 0xbc,
+			 0x45, 0x49, 0xac, 0xe3, 0x41, 0x12, 0x7c, 0xf0,
+			 0xf7, 0x4f, 0xf9, 0xf7, 0xff, 0x2c, 0x89, 0x04},
+			{0x30, 0x31, 0x54, 0x1a, 0x46, 0xca, 0xe6, 0xc6,
+			 0xcb, 0xe2, 0xc3, 0xc1, 0x8b, 0x75, 0x81, 0xbe,
+			 0xee, 0xf8, 0xa3, 0x11, 0x1c, 0x25, 0xa3, 0xa7,
+			 0x35, 0x51, 0x55, 0xe2, 0x25, 0xaa, 0xe2, 0x3a}
+		},
+		{
+			{0xb4, 0x48, 0x10, 0x9f, 0x8a, 0x09, 0x76, 0xfa,
+			 0xf0, 0x7a, 0xb0, 0x70, 0xf7, 0x83, 0x80, 0x52,
+			 0x84, 0x2b, 0x26, 0xa2, 0xc4, 0x5d, 0x4f, 0xba,
+			 0xb1, 0xc8, 0x40, 0x0d, 0x78, 0x97, 0xc4, 0x60},
+			{0xd4, 0xb1, 0x6c, 0x08, 0xc7, 0x40, 0x38, 0x73,
+			 0x5f, 0x0b, 0xf3, 0x76, 0x5d, 0xb2, 0xa5, 0x2f,
+			 0x57, 0x57, 0x07, 0xed, 0x08, 0xa2, 0x6c, 0x4f,
+			 0x08, 0x02, 0xb5, 0x0e, 0xee, 0x44, 0xfa, 0x22}
+		},
+		{
+			{0x98, 0x75, 0x5f, 0x8a, 0x52, 0x4d, 0x09, 0x1d,
+			 0x40, 0xc0, 0xcd, 0xc2, 0x2e, 0x51, 0xfd, 0x79,
+			 0x20, 0x2f, 0x23, 0xa2, 0x50, 0xde, 0x53, 0x9f,
+			 0xb5, 0x43, 0x9c, 0xfd, 0xda, 0x25, 0x72, 0x7d},
+			{0x4e, 0xfb, 0xeb, 0x4e, 0x8d, 0xb1, 0x9d, 0xe1,
+			 0xed, 0xf9, 0x2e, 0xff, 0x22, 0x6f, 0x33, 0x77,
+			 0x69, 0x7c, 0x0c, 0xdd, 0x2d, 0xf6, 0x2e, 0xa9,
+			 0xff, 0xaa, 0x50, 0x8d, 0x38, 0x30, 0xe0, 0x63}
+		},
+		{
+			{0x0f, 0x00, 0x3f, 0xa6, 0x04, 0x19, 0x56, 0x65,
+			 0x31, 0x7f, 0x8b, 0xeb, 0x0d, 0xe1, 0x47, 0x89,
+			 0x97, 0x16, 0x53, 0xfa, 0x81, 0xa7, 0xaa, 0xb2,
+			 0xbf, 0x67, 0xeb, 0x72, 0x60, 0x81, 0x0d, 0x48},
+			{0x7e, 0x13, 0x33, 0xcd, 0xa8, 0x84, 0x56, 0x1e,
+			 0x67, 0xaf, 0x6b, 0x43, 0xac, 0x17, 0xaf, 0x16,
+			 0xc0, 0x52, 0x99, 0x49, 0x5b, 0x87, 0x73, 0x7e,
+			 0xb5, 0x43, 0xda, 0x6b, 0x1d, 0x0f, 0x2d, 0x55}
+		},
+		{
+			{0xa8, 0x1d, 0x22, 0x95, 0x7e, 0x3f, 0x3b, 0xeb,
+			 0xcb, 0x57, 0x3e, 0x05, 0x67, 0x47, 0x3f, 0x32,
+			 0x9e, 0x8c, 0xf5, 0xb9, 0x23, 0xa9, 0x62, 0x4b,
+			 0x22, 0xdc, 0x00, 0xb2, 0x88, 0x7d, 0x8a, 0x14},
+			{0xb4, 0x89, 0xe8, 0xd4, 0xea, 0xdf, 0x1a, 0x2b,
+			 0x9e, 0x65, 0x14, 0x53, 0xf5, 0x2a, 0x80, 0x8f,
+			 0x0f, 0xda, 0x83, 0xe0, 0x5b, 0x34, 0x46, 0xc6,
+			 0x03, 0x34, 0x84, 0x20, 0x1a, 0x0b, 0x4f, 0x4f}
+		},
+		{
+			{0xe9, 0x58, 0x1f, 0xff, 0x84, 0x3f, 0x93, 0x1c,
+			 0xcb, 0xe1, 0x30, 0x69, 0xa5, 0x75, 0x19, 0x7e,
+			 0x14, 0x5f, 0xf8, 0xfc, 0x09, 0xdd, 0xa8, 0x78,
+			 0x9d, 0xca, 0x59, 0x8b, 0xd1, 0x30, 0x01, 0x13},
+			{0xff, 0x76, 0x03, 0xc5, 0x4b, 0x89, 0x99, 0x70,
+			 0x00, 0x59, 0x70, 0x9c, 0xd5, 0xd9, 0x11, 0x89,
+			 0x5a, 0x46, 0xfe, 0xef, 0xdc, 0xd9, 0x55, 0x2b,
+			 0x45, 0xa7, 0xb0, 0x2d, 0xfb, 0x24, 0xc2, 0x29}
+		},
+		{
+			{0x9b, 0x87, 0x84, 0x64, 0xd4, 0x38, 0xf8, 0xc9,
+			 0xd5, 0x8f, 0x70, 0xbb, 0x54, 0xbd, 0x51, 0xf6,
+			 0x2e, 0x4f, 0xf5, 0x09, 0xe3, 0xfb, 0x93, 0xcb,
+			 0x7f, 0x33, 0xdb, 0x23, 0xfa, 0xe3, 0xc2, 0x36},
+			{0x4d, 0x86, 0xeb, 0x3e, 0xe5, 0x3c, 0xe1, 0x7d,
+			 0x7c, 0x75, 0x87, 0x27, 0xa7, 0x08, 0x2f, 0x7c,
+			 0xb2, 0x0e, 0xef, 0x28, 0x44, 0x93, 0xd1, 0x87,
+			 0x35, 0x4d, 0x84, 0x42, 0x85, 0x48, 0x5c, 0x0c}
+		},
+		{
+			{0x38, 0x06, 0xf8, 0x0b, 0xac, 0x82, 0xc4, 0x97,
+			 0x2b, 0x90, 0xe0, 0xf7, 0xa8, 0xab, 0x6c, 0x08,
+			 0x80, 0x66, 0x90, 0x46, 0xf7, 0x26, 0x2d, 0xf8,
+			 0xf1, 0xc4, 0x6b, 0x4a, 0x82, 0x98, 0x8e, 0x37},
+			{0x8e, 0xb4, 0xee, 0xb8, 0xd4, 0x3f, 0xb2, 0x1b,
+			 0xe0, 0x0a, 0x3d, 0x75, 0x34, 0x28, 0xa2, 0x8e,
+			 0xc4, 0x92, 0x7b, 0xfe, 0x60, 0x6e, 0x6d, 0xb8,
+			 0x31, 0x1d, 0x62, 0x0d, 0x78, 0x14, 0x42, 0x11}
+		}
+	},
+#endif
+#if (46 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x25, 0x83, 0xe6, 0x94, 0x7b, 0x81, 0xb2, 0x91,
+			 0xae, 0x0e, 0x05, 0xc9, 0xa3, 0x68, 0x2d, 0xd9,
+			 0x88, 0x25, 0x19, 0x2a, 0x61, 0x61, 0x21, 0x97,
+			 0x15, 0xa1, 0x35, 0xa5, 0x46, 0xc8, 0xa2, 0x0e},
+			{0x1b, 0x03, 0x0d, 0x8b, 0x5a, 0x1b, 0x97, 0x4b,
+			 0xf2, 0x16, 0x31, 0x3d, 0x1f, 0x33, 0xa0, 0x50,
+			 0x3a, 0x18, 0xbe, 0x13, 0xa1, 0x76, 0xc1, 0xba,
+			 0x1b, 0xf1, 0x05, 0x7b, 0x33, 0xa8, 0x82, 0x3b}
+		},
+		{
+			{0x3d, 0x5f, 0x5c, 0xd2, 0xbc, 0x7d, 0x77, 0x0e,
+			 0x2a, 0x6d, 0x22, 0x45, 0x84, 0x06, 0xc4, 0xdd,
+			 0xc6, 0xa6, 0xc6, 0xd7, 0x49, 0xad, 0x6d, 0x87,
+			 0x91, 0x0e, 0x3a, 0x67, 0x1d, 0x2c, 0x1d, 0x56},
+			{0xfe, 0x7a, 0x74, 0xcf, 0xd4, 0xd2, 0xe5, 0x19,
+			 0xde, 0xd0, 0xdb, 0x70, 0x23, 0x69, 0xe6, 0x6d,
+			 0xec, 0xec, 0xcc, 0x09, 0x33, 0x6a, 0x77, 0xdc,
+			 0x6b, 0x22, 0x76, 0x5d, 0x92, 0x09, 0xac, 0x2d}
+		},
+		{
+			{0xf6, 0x2a, 0xad, 0xe4, 0xc6, 0x33, 0xc0, 0x02,
+			 0xf4, 0x53, 0xde, 0xef, 0xf9, 0x1c, 0xd0, 0xb2,
+			 0xd2, 0x87, 0x29, 0x3a, 0x7b, 0xe3, 0x06, 0xb9,
+			 0xc7, 0xf0, 0x65, 0x25, 0x09, 0x1a, 0x23, 0x70},
+			{0xc2, 0xa6, 0x85, 0xc9, 0x42, 0x06, 0x61, 0xa4,
+			 0xe1, 0x6e, 0x17, 0x51, 0xe5, 0x6a, 0x5b, 0x5c,
+			 0x56, 0x23, 0xf5, 0xad, 0x4b, 0xc1, 0xa7, 0x52,
+			 0x96, 0xbb, 0x75, 0x45, 0x63, 0xdc, 0xf8, 0x1d}
+		},
+		{
+			{0x23, 0x15, 0x17, 0xeb, 0xd3, 0xdb, 0x12, 0x5e,
+			 0x01, 0xf0, 0x91, 0xab, 0x2c, 0x41, 0xce, 0xac,
+			 0xed, 0x1b, 0x4b, 0x2d, 0xbc, 0xdb, 0x17, 0x66,
+			 0x89, 0x46, 0xad, 0x4b, 0x1e, 0x6f, 0x0b, 0x14},
+			{0x11, 0xce, 0xbf, 0xb6, 0x77, 0x2d, 0x48, 0x22,
+			 0x18, 0x4f, 0xa3, 0x5d, 0x4a, 0xb0, 0x70, 0x12,
+			 0x3e, 0x54, 0xd7, 0xd8, 0x0e, 0x2b, 0x27, 0xdc,
+			 0x53, 0xff, 0xca, 0x8c, 0x59, 0xb3, 0x4e, 0x44}
+		},
+		{
+			{0x65, 0x83, 0xb3, 0x0a, 0x25, 0x52, 0x56, 0x54,
+			 0x75, 0x54, 0x07, 0x01, 0x5d, 0x94, 0x4f, 0x4f,
+			 0xff, 0x3d, 0x16, 0x43, 0xae, 0x6b, 0xca, 0x10,
+			 0xb8, 0xd7, 0x2d, 0xfa, 0xed, 0x49, 0xbd, 0x34},
+			{0x25, 0x4c, 0xd3, 0xdf, 0x7e, 0x21, 0x1a, 0x8d,
+			 0x67, 0x0b, 0x0e, 0x06, 0x5a, 0x67, 0x3d, 0xeb,
+			 0x8e, 0x4c, 0x6d, 0xee, 0x4d, 0x7c, 0x89, 0x37,
+			 0x5e, 0x1e, 0xe6, 0xbb, 0x96, 0xaa, 0xfe, 0x73}
+		},
+		{
+			{0xb5, 0x4e, 0x74, 0x83, 0x8a, 0x8e, 0x5a, 0xbb,
+			 0xf0, 0xe6, 0x7f, 0x15, 0xe2, 0xd0, 0x0c, 0x81,
+			 0x74, 0xa3, 0xa5, 0x64, 0x13, 0x92, 0x39, 0xae,
+			 0x61, 0x5d, 0xcb, 0xff, 0x08, 0x90, 0xd9, 0x70},
+			{0xb9, 0x32, 0x6c, 0x72, 0x4e, 0xc5, 0x8e, 0xbc,
+			 0xe8, 0xf7, 0x1d, 0x14, 0x62, 0x3b, 0x98, 0x03,
+			 0x71, 0x82, 0x9f, 0x21, 0xf9, 0x9a, 0x32, 0x2e,
+			 0x93, 0x95, 0x06, 0x3a, 0x24, 0x25, 0xb1, 0x56}
+		},
+		{
+			{0xa4, 0xd1, 0xa3, 0x49, 0xc4, 0xab, 0xf3, 0xa3,
+			 0x9c, 0xba, 0x31, 0x11, 0x05, 0xe6, 0x41, 0x2d,
+			 0x6c, 0xf1, 0xf7, 0xcb, 0x60, 0x32, 0xdd, 0xf8,
+			 0x9b, 0x70, 0x33, 0x0a, 0x6b, 0x47, 0x50, 0x7b},
+			{0xcc, 0x33, 0xaa, 0x8b, 0x1e, 0x2a, 0xb1, 0x57,
+			 0x5e, 0xdf, 0x8b, 0x1d, 0xd2, 0xc9, 0xdd, 0xb4,
+			 0x23, 0x86, 0xf1, 0xa2, 0x12, 0x90, 0x9d, 0x50,
+			 0x42, 0xfd, 0x26, 0x70, 0xec, 0xc3, 0x48, 0x24}
+		},
+		{
+			{0x07, 0x76, 0x61, 0x0f, 0x66, 0xb2, 0x21, 0x39,
+			 0x7e, 0xc0, 0xec, 0x45, 0x28, 0x82, 0xa1, 0x29,
+			 0x32, 0x44, 0x35, 0x13, 0x5e, 0x61, 0x5e, 0x54,
+			 0xcb, 0x7c, 0xef, 0xf6, 0x41, 0xcf, 0x9f, 0x0a},
+			{0xdd, 0xf9, 0xda, 0x84, 0xc3, 0xe6, 0x8a, 0x9f,
+			 0x24, 0xd2, 0x96, 0x5d, 0x39, 0x6f, 0x58, 0x8c,
+			 0xc1, 0x56, 0x93, 0xab, 0xb5, 0x79, 0x3b, 0xd2,
+			 0xa8, 0x73, 0x16, 0xed, 0xfa, 0xb4, 0x2f, 0x73}
+		}
+	},
+#endif
+#if (48 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x8d, 0xd2, 0xda, 0xc7, 0x44, 0xd6, 0x7a, 0xdb,
+			 0x26, 0x7d, 0x1d, 0xb8, 0xe1, 0xde, 0x9d, 0x7a,
+			 0x7d, 0x17, 0x7e, 0x1c, 0x37, 0x04, 0x8d, 0x2d,
+			 0x7c, 0x5e, 0x18, 0x38, 0x1e, 0xaf, 0xc7, 0x1b},
+			{0x33, 0x48, 0x31, 0x00, 0x59, 0xf6, 0xf2, 0xca,
+			 0x0f, 0x27, 0x1b, 0x63, 0x12, 0x7e, 0x02, 0x1d,
+			 0x49, 0xc0, 0x5d, 0x79, 0x87, 0xef, 0x5e, 0x7a,
+			 0x2f, 0x1f, 0x66, 0x55, 0xd8, 0x09, 0xd9, 0x61}
+		},
+		{
+			{0x54, 0x83, 0x02, 0x18, 0x82, 0x93, 0x99, 0x07,
+			 0xd0, 0xa7, 0xda, 0xd8, 0x75, 0x89, 0xfa, 0xf2,
+			 0xd9, 0xa3, 0xb8, 0x6b, 0x5a, 0x35, 0x28, 0xd2,
+			 0x6b, 0x59, 0xc2, 0xf8, 0x45, 0xe2, 0xbc, 0x06},
+			{0x65, 0xc0, 0xa3, 0x88, 0x51, 0x95, 0xfc, 0x96,
+			 0x94, 0x78, 0xe8, 0x0d, 0x8b, 0x41, 0xc9, 0xc2,
+			 0x58, 0x48, 0x75, 0x10, 0x2f, 0xcd, 0x2a, 0xc9,
+			 0xa0, 0x6d, 0x0f, 0xdd, 0x9c, 0x98, 0x26, 0x3d}
+		},
+		{
+			{0x2f, 0x66, 0x29, 0x1b, 0x04, 0x89, 0xbd, 0x7e,
+			 0xee, 0x6e, 0xdd, 0xb7, 0x0e, 0xef, 0xb0, 0x0c,
+			 0xb4, 0xfc, 0x7f, 0xc2, 0xc9, 0x3a, 0x3c, 0x64,
+			 0xef, 0x45, 0x44, 0xaf, 0x8a, 0x90, 0x65, 0x76},
+			{0xa1, 0x4c, 0x70, 0x4b, 0x0e, 0xa0, 0x83, 0x70,
+			 0x13, 0xa4, 0xaf, 0xb8, 0x38, 0x19, 0x22, 0x65,
+			 0x09, 0xb4, 0x02, 0x4f, 0x06, 0xf8, 0x17, 0xce,
+			 0x46, 0x45, 0xda, 0x50, 0x7c, 0x8a, 0xd1, 0x4e}
+		},
+		{
+			{0xf7, 0xd4, 0x16, 0x6c, 0x4e, 0x95, 0x9d, 0x5d,
+			 0x0f, 0x91, 0x2b, 0x52, 0xfe, 0x5c, 0x34, 0xe5,
+			 0x30, 0xe6, 0xa4, 0x3b, 0xf3, 0xf3, 0x34, 0x08,
+			 0xa9, 0x4a, 0xa0, 0xb5, 0x6e, 0xb3, 0x09, 0x0a},
+			{0x26, 0xd9, 0x5e, 0xa3, 0x0f, 0xeb, 0xa2, 0xf3,
+			 0x20, 0x3b, 0x37, 0xd4, 0xe4, 0x9e, 0xce, 0x06,
+			 0x3d, 0x53, 0xed, 0xae, 0x2b, 0xeb, 0xb6, 0x24,
+			 0x0a, 0x11, 0xa3, 0x0f, 0xd6, 0x7f, 0xa4, 0x3a}
+		},
+		{
+			{0x5e, 0x73, 0x13, 0x11, 0x45, 0xd5, 0x9c, 0x91,
+			 0x20, 0x7d, 0x6e, 0xba, 0xd2, 0x62, 0xa1, 0x0b,
+			 0x86, 0x49, 0x56, 0xbf, 0xa8, 0xb5, 0xc8, 0x80,
+			 0x6a, 0x6d, 0x8e, 0x63, 0x37, 0xce, 0x71, 0x1c},
+			{0xcb, 0x06, 0xe4, 0x29, 0xe1, 0xfe, 0xe8, 0xe3,
+			 0x2c, 0x97, 0x7a, 0x44, 0x3f, 0x18, 0x0d, 0xd4,
+			 0xb7, 0xcf, 0xa0, 0x9a, 0xd7, 0xba, 0x3d, 0x24,
+			 0xcd, 0xb2, 0x03, 0x20, 0x1c, 0xcc, 0x80, 0x78}
+		},
+		{
+			{0xd6, 0xc8, 0xcb, 0x74, 0x7f, 0x9e, 0x1b, 0x93,
+			 0xb1, 0x2c, 0x85, 0x6c, 0x44, 0x79, 0x0e, 0x12,
+			 0xe5, 0xcf, 0xc2, 0x95, 0xf8, 0x82, 0x7a, 0x89,
+			 0x7d, 0x2f, 0xdf, 0xc1, 0x84, 0x7a, 0x60, 0x3c},
+			{0x68, 0xea, 0x3c, 0xba, 0x86, 0x9a, 0x77, 0xea,
+			 0x0c, 0x06, 0x1a, 0x73, 0xa1, 0xe0, 0x87, 0x49,
+			 0x18, 0xee, 0xdb, 0x89, 0xb4, 0xba, 0x84, 0x23,
+			 0x3a, 0x1a, 0x94, 0x09, 0xd1, 0x8a, 0x51, 0x34}
+		},
+		{
+			{0xa0, 0x2d, 0xbe, 0xff, 0x17, 0xf4, 0x0a, 0x31,
+			 0x9c, 0xe3, 0x38, 0xa6, 0x66, 0xfc, 0x17, 0x3a,
+			 0xf1, 0xf7, 0x6e, 0x61, 0xdd, 0x38, 0xf9, 0x3f,
+			 0x66, 0xbc, 0x00, 0x20, 0xd0, 0x6c, 0x9b, 0x08},
+			{0x88, 0xeb, 0x8c, 0x3e, 0xf1, 0x16, 0x88, 0xe7,
+			 0xa3, 0x12, 0xbb, 0xcd, 0xa7, 0xe4, 0xcb, 0x43,
+			 0x7e, 0x65, 0xca, 0x11, 0xfd, 0xde, 0x38, 0xb4,
+			 0xd8, 0xdf, 0x36, 0xaa, 0x06, 0x72, 0xef, 0x66}
+		},
+		{
+			{0xdb, 0x9f, 0x2c, 0xfc, 0xd6, 0xb2, 0x1e, 0x2e,
+			 0x52, 0x7a, 0x06, 0x87, 0x2d, 0x86, 0x72, 0x2b,
+			 0x6d, 0x90, 0x77, 0x46, 0x43, 0xb5, 0x7a, 0xf8,
+			 0x60, 0x7d, 0x91, 0x60, 0x5b, 0x9d, 0x9e, 0x07},
+			{0x97, 0x87, 0xc7, 0x04, 0x1c, 0x38, 0x01, 0x39,
+			 0x58, 0xc7, 0x85, 0xa3, 0xfc, 0x64, 0x00, 0x64,
+			 0x25, 0xa2, 0xbf, 0x50, 0x94, 0xca, 0x26, 0x31,
+			 0x45, 0x0a, 0x24, 0xd2, 0x51, 0x29, 0x51, 0x16}
+		}
+	},
+#endif
+#if (50 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xeb, 0xcb, 0xc5, 0x70, 0x91, 0x31, 0x10, 0x93,
+			 0x0d, 0xc8, 0xd0, 0xef, 0x62, 0xe8, 0x6f, 0x82,
+			 0xe3, 0x69, 0x3d, 0x91, 0x7f, 0x31, 0xe1, 0x26,
+			 0x35, 0x3c, 0x4a, 0x2f, 0xab, 0xc4, 0x9a, 0x5e},
+			{0xab, 0x1b, 0xb5, 0xe5, 0x2b, 0xc3, 0x0e, 0x29,
+			 0xb0, 0xd0, 0x73, 0xe6, 0x4f, 0x64, 0xf2, 0xbc,
+			 0xe4, 0xe4, 0xe1, 0x9a, 0x52, 0x33, 0x2f, 0xbd,
+			 0xcc, 0x03, 0xee, 0x8a, 0xfa, 0x00, 0x5f, 0x50}
+		},
+		{
+			{0xf6, 0xdb, 0x0d, 0x22, 0x3d, 0xb5, 0x14, 0x75,
+			 0x31, 0xf0, 0x81, 0xe2, 0xb9, 0x37, 0xa2, 0xa9,
+			 0x84, 0x11, 0x9a, 0x07, 0xb5, 0x53, 0x89, 0x78,
+			 0xa9, 0x30, 0x27, 0xa1, 0xf1, 0x4e, 0x5c, 0x2e},
+			{0x8b, 0x00, 0x54, 0xfb, 0x4d, 0xdc, 0xcb, 0x17,
+			 0x35, 0x40, 0xff, 0xb7, 0x8c, 0xfe, 0x4a, 0xe4,
+			 0x4e, 0x99, 0x4e, 0xa8, 0x74, 0x54, 0x5d, 0x5c,
+			 0x96, 0xa3, 0x12, 0x55, 0x36, 0x31, 0x17, 0x5c}
+		},
+		{
+			{0x4b, 0x8f, 0xc6, 0x95, 0x53, 0x1f, 0x6c, 0x23,
+			 0xfd, 0xa9, 0x3a, 0xa9, 0x90, 0x6b, 0x13, 0x33,
+			 0xcf, 0x44, 0x12, 0x31, 0xb2, 0x91, 0xe7, 0xaa,
+			 0x15, 0xa4, 0x97, 0x00, 0xa0, 0x06, 0x26, 0x0e},
+			{0xc3, 0x49, 0x77, 0xc8, 0xdb, 0x50, 0xd1, 0x0a,
+			 0x89, 0xa9, 0x97, 0x3b, 0x88, 0x9d, 0x2b, 0x6b,
+			 0x9b, 0x64, 0x3b, 0xd1, 0x43, 0xad, 0x8f, 0xb3,
+			 0x1c, 0x8f, 0x62, 0x4a, 0x6c, 0x44, 0xda, 0x2d}
+		},
+		{
+			{0xce, 0x24, 0xef, 0x7b, 0x86, 0xf2, 0x0f, 0x77,
+			 0xe8, 0x5c, 0x7d, 0x87, 0x38, 0x2d, 0xef, 0xaf,
+			 0xf2, 0x8c, 0x72, 0x2e, 0xeb, 0xb6, 0x55, 0x4b,
+			 0x6e, 0xf1, 0x4e, 0x8a, 0x0e, 0x9a, 0x6c, 0x4c},
+			{0x25, 0xea, 0x86, 0xc2, 0xd1, 0x4f, 0xb7, 0x3e,
+			 0xa8, 0x5c, 0x8d, 0x66, 0x81, 0x25, 0xed, 0xc5,
+			 0x4c, 0x05, 0xb9, 0xd8, 0xd6, 0x70, 0xbe, 0x73,
+			 0x82, 0xe8, 0xa1, 0xe5, 0x1e, 0x71, 0xd5, 0x26}
+		},
+		{
+			{0xf5, 0x25, 0x9d, 0xc5, 0x42, 0x51, 0xed, 0x9c,
+			 0xf5, 0x97, 0x99, 0x82, 0xc8, 0x9c, 0x69, 0xf0,
+			 0x42, 0xec, 0x68, 0x01, 0x04, 0xb6, 0x7e, 0xe9,
+			 0xfd, 0xe5, 0x03, 0xa6, 0xe2, 0xb1, 0x73, 0x6a},
+			{0xcd, 0xff, 0xfa, 0xbc, 0x6e, 0x3f, 0x5c, 0x91,
+			 0x9b, 0xf1, 0x00, 0xbc, 0xbe, 0x4e, 0x81, 0xfd,
+			 0xb5, 0x5e, 0x07, 0x4b, 0x35, 0x87, 0x71, 0x05,
+			 0x11, 0x45, 0xdb, 0xef, 0xc1, 0xcc, 0xa5, 0x6e}
+		},
+		{
+			{0x4e, 0x6d, 0xc3, 0xa7, 0x4f, 0x22, 0x45, 0x26,
+			 0xa2, 0x7e, 0x16, 0xf7, 0xf7, 0x63, 0xdc, 0x86,
+			 0x01, 0x2a, 0x71, 0x38, 0x5c, 0x33, 0xc3, 0xce,
+			 0x30, 0xff, 0xf9, 0x2c, 0x91, 0x71, 0x8a, 0x72},
+			{0x8c, 0x44, 0x09, 0x28, 0xd5, 0x23, 0xc9, 0x8f,
+			 0xf3, 0x84, 0x45, 0xc6, 0x9a, 0x5e, 0xff, 0xd2,
+			 0xc7, 0x57, 0x93, 0xa3, 0xc1, 0x69, 0xdd, 0x62,
+			 0x0f, 0xda, 0x5c, 0x30, 0x59, 0x5d, 0xe9, 0x4c}
+		},
+		{
+			{0x0c, 0xf3, 0x8a, 0x21, 0xcb, 0x44, 0x45, 0x79,
+			 0xdc, 0x72, 0xb6, 0x46, 0x5a, 0x76, 0x34, 0x4d,
+			 0xdb, 0xb4, 0xc5, 0xd0, 0x2b, 0x51, 0x76, 0xb4,
+			 0x30, 0x73, 0xf1, 0x31, 0xf1, 0x76, 0xa0, 0x5c},
+			{0x23, 0xf2, 0xeb, 0xa4, 0x71, 0x49, 0x3c, 0xd3,
+			 0xd0, 0x59, 0x18, 0xbd, 0x38, 0xb6, 0x0d, 0x11,
+			 0x2d, 0xea, 0x4c, 0xe3, 0x9e, 0x7b, 0x91, 0x37,
+			 0x88, 0xd0, 0x52, 0x80, 0x1f, 0x83, 0x4d, 0x31}
+		},
+		{
+			{0x92, 0x7e, 0x50, 0x27, 0x72, 0xd7, 0x0c, 0xd6,
+			 0x69, 0x96, 0x81, 0x35, 0x84, 0x94, 0x35, 0x8b,
+			 0x6c, 0xaa, 0x62, 0x86, 0x6e, 0x1c, 0x15, 0xf3,
+			 0x6c, 0xb3, 0xff, 0x65, 0x1b, 0xa2, 0x9b, 0x59},
+			{0xe2, 0xa9, 0x65, 0x88, 0xc4, 0x50, 0xfa, 0xbb,
+			 0x3b, 0x6e, 0x5f, 0x44, 0x01, 0xca, 0x97, 0xd4,
+			 0xdd, 0xf6, 0xcd, 0x3f, 0x3f, 0xe5, 0x97, 0x67,
+			 0x2b, 0x8c, 0x66, 0x0f, 0x35, 0x9b, 0xf5, 0x07}
+		}
+	},
+#endif
+#if (52 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0xdb, 0xfa, 0x9b, 0x2c, 0xd4, 0x23, 0x67, 0x2c,
+			 0x8a, 0x63, 0x6c, 0x07, 0x26, 0x48, 0x4f, 0xc2,
+			 0x03, 0xd2, 0x53, 0x20, 0x28, 0xed, 0x65, 0x71,
+			 0x47, 0xa9, 0x16, 0x16, 0x12, 0xbc, 0x28, 0x33},
+			{0x39, 0xc0, 0xfa, 0xfa, 0xcd, 0x33, 0x43, 0xc7,
+			 0x97, 0x76, 0x9b, 0x93, 0x91, 0x72, 0xeb, 0xc5,
+			 0x18, 0x67, 0x4c, 0x11, 0xf0, 0xf4, 0xe5, 0x73,
+			 0xb2, 0x5c, 0x1b, 0xc2, 0x26, 0x3f, 0xbf, 0x2b}
+		},
+		{
+			{0x33, 0xa7, 0x90, 0x7c, 0xc3, 0x6f, 0x17, 0xa5,
+			 0xa0, 0x67, 0x72, 0x17, 0xea, 0x7e, 0x63, 0x14,
+			 0x83, 0xde, 0xc1, 0x71, 0x2d, 0x41, 0x32, 0x7a,
+			 0xf3, 0xd1, 0x2b, 0xd8, 0x2a, 0xa6, 0x46, 0x36},
+			{0xac, 0xcc, 0x6b, 0x7c, 0xf9, 0xb8, 0x8b, 0x08,
+			 0x5c, 0xd0, 0x7d, 0x8f, 0x73, 0xea, 0x20, 0xda,
+			 0x86, 0xca, 0x00, 0xc7, 0xad, 0x73, 0x4d, 0xe9,
+			 0xe8, 0xa9, 0xda, 0x1f, 0x03, 0x06, 0xdd, 0x24}
+		},
+		{
+			{0x46, 0x26, 0x37, 0x12, 0x37, 0x14, 0xf3, 0x72,
+			 0x41, 0x22, 0x79, 0x33, 0xa8, 0x8f, 0xe7, 0xe6,
+			 0x43, 0x72, 0xc5, 0x43, 0xf4, 0x2a, 0xb0, 0xb0,
+			 0x76, 0xcb, 0x67, 0xa0, 0xf6, 0x0f, 0xa1, 0x65},
+			{0x1b, 0x4d, 0x68, 0x7c, 0x77, 0x69, 0xa6, 0x5e,
+			 0xd5, 0xe5, 0x41, 0x9c, 0x50, 0x13, 0x4b, 0xb9,
+			 0xc6, 0xec, 0x7e, 0x29, 0x1e, 0x8f, 0xbc, 0x1c,
+			 0xbe, 0xec, 0x64, 0x6a, 0x4f, 0x01, 0x07, 0x36}
+		},
+		{
+			{0x9c, 0xb2, 0x61, 0x0a, 0x98, 0x2a, 0xa5, 0xd7,
+			 0xee, 0xa9, 0xac, 0x65, 0xcb, 0x0a, 0x1e, 0xe2,
+			 0xbe, 0xdc, 0x85, 0x59, 0x0f, 0x9c, 0xa6, 0x57,
+			 0x34, 0xa5, 0x87, 0xeb, 0x7b, 0x1e, 0x0c, 0x3c},
+			{0x2f, 0xbd, 0x84, 0x63, 0x0d, 0xb5, 0xa0, 0xf0,
+			 0x4b, 0x9e, 0x93, 0xc6, 0x34, 0x9a, 0x34, 0xff,
+			 0x73, 0x19, 0x2f, 0x6e, 0x54, 0x45, 0x2c, 0x92,
+			 0x31, 0x76, 0x34, 0xf1, 0xb2, 0x26, 0xe8, 0x74}
+		},
+		{
+			{0x77, 0x5c, 0x82, 0x1a, 0xfe, 0x48, 0x27, 0x64,
+			 0x31, 0x3c, 0xa5, 0xa8, 0xd0, 0x54, 0xe6, 0x25,
+			 0x37, 0x10, 0xd3, 0xf4, 0x94, 0x7a, 0x39, 0x33,
+			 0xa5, 0x80, 0x84, 0x21, 0xb5, 0xc4, 0x9a, 0x57},
+			{0x1d, 0x28, 0x8a, 0xd2, 0x13, 0xb4, 0xe2, 0x5a,
+			 0x09, 0x2d, 0xfa, 0x64, 0xb0, 0x1c, 0x0a, 0x3e,
+			 0x42, 0x77, 0xfc, 0x62, 0x98, 0x11, 0x57, 0xee,
+			 0xfc, 0xca, 0x71, 0x69, 0x3d, 0xb9, 0xbf, 0x62}
+		},
+		{
+			{0x54, 0x21, 0x1c, 0x80, 0xaf, 0x9e, 0x11, 0x72,
+			 0x3a, 0x16, 0x19, 0xf0, 0x4d, 0x2a, 0x3e, 0xd2,
+			 0x72, 0x80, 0x4c, 0x43, 0x47, 0xa0, 0x95, 0x9e,
+			 0x5c, 0x88, 0xdc, 0xf0, 0x76, 0xe3, 0xee, 0x61},
+			{0x31, 0x89, 0xb3, 0xf8, 0xfb, 0x7e, 0xa9, 0x33,
+			 0xb8, 0x5c, 0xf2, 0x28, 0x19, 0x78, 0xaf, 0x8a,
+			 0x1b, 0xe0, 0x45, 0xc7, 0xc9, 0x28, 0x74, 0xf4,
+			 0x53, 0xec, 0xd6, 0x3e, 0x8d, 0xbf, 0x2a, 0x1f}
+		},
+		{
+			{0x6c, 0x90, 0x25, 0x8a, 0x4d, 0x11, 0x57, 0x92,
+			 0xe1, 0xac, 0xb6, 0x57, 0xe6, 0x30, 0x8c, 0xe8,
+			 0xb3, 0x34, 0xe4, 0x32, 0xc6, 0x1a, 0x86, 0xd0,
+			 0x03, 0x3c, 0x24, 0x75, 0x1c, 0x19, 0x12, 0x3d},
+			{0x83, 0xfe, 0xcd, 0x9a, 0x5e, 0x4e, 0xc4, 0xc5,
+			 0xdb, 0x5f, 0x2c, 0x63, 0x18, 0xb9, 0x7f, 0xc0,
+			 0x3c, 0x5e, 0xeb, 0x57, 0x3c, 0x4e, 0x9b, 0xc9,
+			 0x8b, 0xc7, 0x34, 0x0e, 0x88, 0x65, 0x79, 0x46}
+		},
+		{
+			{0x0a, 0x67, 0x90, 0x6d, 0x0c, 0x4c, 0xcc, 0xc0,
+			 0xe6, 0xbd, 0xa7, 0x5e, 0x55, 0x8c, 0xcd, 0x58,
+			 0x9b, 0x11, 0xa2, 0xbb, 0x4b, 0xb1, 0x43, 0x04,
+			 0x3c, 0x55, 0xed, 0x23, 0xfe, 0xcd, 0xb1, 0x53},
+			{0x05, 0xfb, 0x75, 0xf5, 0x01, 0xaf, 0x38, 0x72,
+			 0x58, 0xfc, 0x04, 0x29, 0x34, 0x7a, 0x67, 0xa2,
+			 0x08, 0x50, 0x6e, 0xd0, 0x2b, 0x73, 0xd5, 0xb8,
+			 0xe4, 0x30, 0x96, 0xad, 0x45, 0xdf, 0xa6, 0x5c}
+		}
+	},
+#endif
+#if (54 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x4c, 0xb6, 0x69, 0xc8, 0x81, 0x95, 0x94, 0x33,
+			 0x92, 0x34, 0xe9, 0x3c, 0x84, 0x0d, 0x3d, 0x5a,
+			 0x37, 0x9c, 0x22, 0xa0, 0xaa, 0x65, 0xce, 0xb4,
+			 0xc2, 0x2d, 0x66, 0x67, 0x02, 0xff, 0x74, 0x10},
+			{0x22, 0xb0, 0xd5, 0xe6, 0xc7, 0xef, 0xb1, 0xa7,
+			 0x13, 0xda, 0x60, 0xb4, 0x80, 0xc1, 0x42, 0x7d,
+			 0x10, 0x70, 0x97, 0x04, 0x4d, 0xda, 0x23, 0x89,
+			 0xc2, 0x0e, 0x68, 0xcb, 0xde, 0xe0, 0x9b, 0x29}
+		},
+		{
+			{0x33, 0xfe, 0x42, 0x2a, 0x36, 0x2b, 0x2e, 0x36,
+			 0x64, 0x5c, 0x8b, 0xcc, 0x81, 0x6a, 0x15, 0x08,
+			 0xa1, 0x27, 0xe8, 0x57, 0xe5, 0x78, 0x8e, 0xf2,
+			 0x58, 0x19, 0x12, 0x42, 0xae, 0xc4, 0x63, 0x3e},
+			{0x78, 0x96, 0x9c, 0xa7, 0xca, 0x80, 0xae, 0x02,
+			 0x85, 0xb1, 0x7c, 0x04, 0x5c, 0xc1, 0x5b, 0x26,
+			 0xc1, 0xba, 0xed, 0xa5, 0x59, 0x70, 0x85, 0x8c,
+			 0x8c, 0xe8, 0x87, 0xac, 0x6a, 0x28, 0x99, 0x35}
+		},
+		{
+			{0x9f, 0x04, 0x08, 0x28, 0xbe, 0x87, 0xda, 0x80,
+			 0x28, 0x38, 0xde, 0x9f, 0xcd, 0xe4, 0xe3, 0x62,
+			 0xfb, 0x2e, 0x46, 0x8d, 0x01, 0xb3, 0x06, 0x51,
+			 0xd4, 0x19, 0x3b, 0x11, 0xfa, 0xe2, 0xad, 0x1e},
+			{0xa0, 0x20, 0x99, 0x69, 0x0a, 0xae, 0xa3, 0x70,
+			 0x4e, 0x64, 0x80, 0xb7, 0x85, 0x9c, 0x87, 0x54,
+			 0x43, 0x43, 0x55, 0x80, 0x6d, 0x8d, 0x7c, 0xa9,
+			 0x64, 0xca, 0x6c, 0x2e, 0x21, 0xd8, 0xc8, 0x6c}
+		},
+		{
+			{0x91, 0x4a, 0x07, 0xad, 0x08, 0x75, 0xc1, 0x4f,
+			 0xa4, 0xb2, 0xc3, 0x6f, 0x46, 0x3e, 0xb1, 0xce,
+			 0x52, 0xab, 0x67, 0x09, 0x54, 0x48, 0x6b, 0x6c,
+			 0xd7, 0x1d, 0x71, 0x76, 0xcb, 0xff, 0xdd, 0x31},
+			{0x36, 0x88, 0xfa, 0xfd, 0xf0, 0x36, 0x6f, 0x07,
+			 0x74, 0x88, 0x50, 0xd0, 0x95, 0x38, 0x4a, 0x48,
+			 0x2e, 0x07, 0x64, 0x97, 0x11, 0x76, 0x01, 0x1a,
+			 0x27, 0x4d, 0x8e, 0x25, 0x9a, 0x9b, 0x1c, 0x22}
+		},
+		{
+			{0x76, 0xcd, 0x82, 0xcf, 0x7c, 0xd5, 0x9d, 0x53,
+			 0xa9, 0xc0, 0x61, 0x8d, 0x0c, 0x4c, 0xcb, 0xbe,
+			 0xe0, 0xf6, 0x49, 0x69, 0xfb, 0x4c, 0xff, 0xa9,
+			 0x31, 0xf5, 0xd4, 0x11, 0x99, 0x00, 0xf6, 0x4a},
+			{0x7c, 0x16, 0x65, 0x03, 0xe4, 0xa6, 0xe9, 0x6f,
+			 0x08, 0xcb, 0x20, 0xa3, 0x93, 0x5e, 0x69, 0x7c,
+			 0x57, 0xfa, 0x54, 0x0a, 0xec, 0xd9, 0x3e, 0x7e,
+			 0x45, 0x10, 0xee, 0xf0, 0xf6, 0x9b, 0xa6, 0x1e}
+		},
+		{
+			{0x55, 0xba, 0x1b, 0xd1, 0x2b, 0xa9, 0xb7, 0xe6,
+			 0x8d, 0x1b, 0xd1, 0x11, 0xb6, 0x79, 0x92, 0x96,
+			 0xfd, 0xf3, 0xd6, 0xbe, 0xfa, 0xb2, 0x18, 0xfa,
+			 0xf7, 0x75, 0x3a, 0x33, 0xcc, 0xbf, 0xd4, 0x1e},
+			{0x5f, 0x9a, 0x90, 0x47, 0x6e, 0x50, 0xc3, 0x8c,
+			 0x81, 0x97, 0x4b, 0xb3, 0x26, 0xff, 0xa0, 0xf9,
+			 0xc9, 0x18, 0x0a, 0x8e, 0x38, 0x09, 0x71, 0x31,
+			 0xa2, 0x73, 0xbe, 0x56, 0xf5, 0x69, 0xd9, 0x73}
+		},
+		{
+			{0x31, 0x10, 0xa7, 0xcb, 0x3f, 0x68, 0x33, 0xc3,
+			 0x65, 0x36, 0x2a, 0x16, 0x50, 0x8b, 0x25, 0x5c,
+			 0xd1, 0x9e, 0x1f, 0x24, 0xe4, 0xc8, 0xa2, 0xc9,
+			 0x2b, 0xae, 0x60, 0xd7, 0x93, 0xa6, 0x4b, 0x3a},
+			{0x5d, 0xbb, 0xec, 0xf3, 0x1e, 0x96, 0x0f, 0x79,
+			 0xf9, 0x1f, 0xaa, 0x20, 0x01, 0x1d, 0xba, 0x62,
+			 0x17, 0x82, 0x22, 0x64, 0xba, 0xbc, 0x4d, 0x17,
+			 0xfd, 0x22, 0xc5, 0x2f, 0x02, 0x99, 0x8b, 0x43}
+		},
+		{
+			{0xbe, 0x57, 0xbd, 0x0e, 0x0f, 0xac, 0x5e, 0x76,
+			 0xa3, 0x71, 0xad, 0x2b, 0x10, 0x45, 0x02, 0xec,
+			 0x59, 0xd5, 0x5d, 0xa9, 0x44, 0xcc, 0x25, 0x4c,
+			 0xb3, 0x3c, 0x5b, 0x69, 0x07, 0x55, 0x26, 0x6b},
+			{0x30, 0x6b, 0xd4, 0xa7, 0x51, 0x29, 0xe3, 0xf9,
+			 0x7a, 0x75, 0x2a, 0x82, 0x2f, 0xd6, 0x1d, 0x99,
+			 0x2b, 0x80, 0xd5, 0x67, 0x1e, 0x15, 0x9d, 0xca,
+			 0xfd, 0xeb, 0xac, 0x97, 0x35, 0x09, 0x7f, 0x3f}
+		}
+	},
+#endif
+#if (56 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x3f, 0xdc, 0x05, 0xcb, 0x41, 0x3c, 0xc8, 0x23,
+			 0x04, 0x2c, 0x38, 0x99, 0xe3, 0x68, 0x55, 0xf9,
+			 0xd3, 0x32, 0xc7, 0xbf, 0xfa, 0xd4, 0x1b, 0x5d,
+			 0xde, 0xdc, 0x10, 0x42, 0xc0, 0x42, 0xd9, 0x75},
+			{0x2d, 0xab, 0x35, 0x4e, 0x87, 0xc4, 0x65, 0x97,
+			 0x67, 0x24, 0xa4, 0x47, 0xad, 0x3f, 0x8e, 0xf3,
+			 0xcb, 0x31, 0x17, 0x77, 0xc5, 0xe2, 0xd7, 0x8f,
+			 0x3c, 0xc1, 0xcd, 0x56, 0x48, 0xc1, 0x6c, 0x69}
+		},
+		{
+			{0x14, 0xae, 0x5f, 0x88, 0x7b, 0xa5, 0x90, 0xdf,
+			 0x10, 0xb2, 0x8b, 0x5e, 0x24, 0x17, 0xc3, 0xa3,
+			 0xd4, 0x0f, 0x92, 0x61, 0x1a, 0x19, 0x5a, 0xad,
+			 0x76, 0xbd, 0xd8, 0x1c, 0xdd, 0xe0, 0x12, 0x6d},
+			{0x8e, 0xbd, 0x70, 0x8f, 0x02, 0xa3, 0x24, 0x4d,
+			 0x5a, 0x67, 0xc4, 0xda, 0xf7, 0x20, 0x0f, 0x81,
+			 0x5b, 0x7a, 0x05, 0x24, 0x67, 0x83, 0x0b, 0x2a,
+			 0x80, 0xe7, 0xfd, 0x74, 0x4b, 0x9e, 0x5c, 0x0d}
+		},
+		{
+			{0x17, 0x00, 0x9b, 0x19, 0x2d, 0x9f, 0x3b, 0x82,
+			 0x1c, 0x6d, 0x6b, 0x4e, 0xb4, 0x09, 0xa9, 0x3f,
+			 0x9f, 0xb9, 0x13, 0x10, 0x85, 0x91, 0xd5, 0xc5,
+			 0x9e, 0x88, 0xe8, 0x36, 0x4e, 0x26, 0x04, 0x7d},
+			{0x66, 0xf8, 0x30, 0xe9, 0x9a, 0x31, 0xa3, 0xe1,
+			 0x8d, 0xfd, 0x93, 0xbf, 0x15, 0x8f, 0x27, 0xbc,
+			 0xfa, 0x33, 0xa3, 0xa9, 0x78, 0x79, 0x77, 0x9c,
+			 0x7f, 0x82, 0x4b, 0x42, 0x69, 0xf2, 0xc9, 0x6c}
+		},
+		{
+			{0x94, 0xd5, 0x5f, 0x1f, 0xa2, 0xfb, 0xeb, 0xe1,
+			 0x07, 0x34, 0xf8, 0x20, 0xad, 0x81, 0x30, 0x06,
+			 0x2d, 0xa1, 0x81, 0x95, 0x36, 0xcf, 0x11, 0x0b,
+			 0xaf, 0xc1, 0x2b, 0x9a, 0x6c, 0x55, 0xc1, 0x16},
+			{0x36, 0x4f, 0xf1, 0x5e, 0x74, 0x35, 0x13, 0x28,
+			 0xd7, 0x11, 0xcf, 0xb8, 0xde, 0x93, 0xb3, 0x05,
+			 0xb8, 0xb5, 0x73, 0xe9, 0xeb, 0xad, 0x19, 0x1e,
+			 0x89, 0x0f, 0x8b, 0x15, 0xd5, 0x8c, 0xe3, 0x23}
+		},
+		{
+			{0xf5, 0x18, 0x05, 0xb1, 0xf2, 0x1a, 0x21, 0xdb,
+			 0x02, 0x93, 0x11, 0xaa, 0x0d, 0xa3, 0xeb, 0x6c,
+			 0xd5, 0xd8, 0x8e, 0xe9, 0xfc, 0x6b, 0x79, 0x95,
+			 0xc6, 0x50, 0xd1, 0xe1, 0xb3, 0xbc, 0x23, 0x17},
+			{0xea, 0xb3, 0x82, 0x76, 0x80, 0x89, 0xe6, 0x56,
+			 0xf5, 0x50, 0x02, 0x48, 0xfb, 0x75, 0xf7, 0xaa,
+			 0x78, 0xbd, 0x7e, 0x0c, 0xdb, 0x80, 0x39, 0x40,
+			 0x23, 0xbb, 0x8e, 0xe0, 0x82, 0xa6, 0x4b, 0x5d}
+		},
+		{
+			{0x33, 0x79, 0xe7, 0x18, 0xe6, 0x0f, 0x57, 0x93,
+			 0x15, 0xa0, 0xa7, 0xaa, 0xc4, 0xbf, 0x4f, 0x30,
+			 0x74, 0x95, 0x5e, 0x69, 0x4a, 0x5b, 0x45, 0xe4,
+			 0x00, 0xeb, 0x23, 0x74, 0x4c, 0xdf, 0x6b, 0x45},
+			{0x97, 0x29, 0x6c, 0xc4, 0x42, 0x0b, 0xdd, 0xc0,
+			 0x29, 0x5c, 0x9b, 0x34, 0x97, 0xd0, 0xc7, 0x79,
+			 0x80, 0x63, 0x74, 0xe4, 0x8e, 0x37, 0xb0, 0x2b,
+			 0x7c, 0xe8, 0x68, 0x6c, 0xc3, 0x82, 0x97, 0x57}
+		},
+		{
+			{0x93, 0x21, 0x41, 0xf4, 0x39, 0xa3, 0x2e, 0x85,
+			 0xf5, 0x5c, 0xb7, 0x3a, 0xa8, 0x88, 0x45, 0x8d,
+			 0x45, 0x9e, 0x5d, 0x16, 0xbb, 0x6b, 0x45, 0x3b,
+			 0x11, 0xa2, 0x0a, 0xdf, 0x6c, 0xa4, 0x69, 0x22},
+			{0x4e, 0x51, 0x4c, 0x51, 0x85, 0x8f, 0xb6, 0x27,
+			 0xc0, 0xdf, 0xff, 0x41, 0x38, 0xe0, 0xa1, 0xce,
+			 0xa1, 0x1f, 0x2e, 0xd8, 0xd9, 0x11, 0x8a, 0x1b,
+			 0xf2, 0x97, 0xa9, 0x1f, 0x77, 0xf3, 0x9c, 0x48}
+		},
+		{
+			{0x22, 0xbe, 0x83, 0xb6, 0x4b, 0x80, 0x6b, 0x43,
+			 0x24, 0x5e, 0xef, 0x99, 0x9b, 0xa8, 0xfc, 0x25,
+			 0x8d, 0x3b, 0x03, 0x94, 0x2b, 0x3e, 0xe7, 0x95,
+			 0x76, 0x9b, 0xcc, 0x15, 0xdb, 0x32, 0xe6, 0x66},
+			{0x84, 0xf0, 0x4a, 0x13, 0xa6, 0xd6, 0xfa, 0x93,
+			 0x46, 0x07, 0xf6, 0x7e, 0x5c, 0x6d, 0x5e, 0xf6,
+			 0xa6, 0xe7, 0x48, 0xf0, 0x06, 0xea, 0xff, 0x90,
+			 0xc1, 0xcc, 0x4c, 0x19, 0x9c, 0x3c, 0x4e, 0x53}
+		}
+	},
+#endif
+#if (58 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x07, 0xee, 0xa7, 0xad, 0xb7, 0x09, 0x0b, 0x49,
+			 0x4e, 0xbf, 0xca, 0xe5, 0x21, 0xe6, 0xe6, 0xaf,
+			 0xd5, 0x67, 0xf3, 0xce, 0x7e, 0x7c, 0x93, 0x7b,
+			 0x5a, 0x10, 0x12, 0x0e, 0x6c, 0x06, 0x11, 0x75},
+			{0xd5, 0xfc, 0x86, 0xa3, 0x3b, 0xa3, 0x3e, 0x0a,
+			 0xfb, 0x0b, 0xf7, 0x36, 0xb1, 0x5b, 0xda, 0x70,
+			 0xb7, 0x00, 0xa7, 0xda, 0x88, 0x8f, 0x84, 0xa8,
+			 0xbc, 0x1c, 0x39, 0xb8, 0x65, 0xf3, 0x4d, 0x60}
+		},
+		{
+			{0x07, 0x98, 0x61, 0xe8, 0x6a, 0xd2, 0x81, 0x49,
+			 0x25, 0xd5, 0x5b, 0x18, 0xc7, 0x35, 0x52, 0x51,
+			 0xa4, 0x46, 0xad, 0x18, 0x0d, 0xc9, 0x5f, 0x18,
+			 0x91, 0x3b, 0xb4, 0xc0, 0x60, 0x59, 0x8d, 0x66},
+			{0x03, 0x1b, 0x79, 0x53, 0x6e, 0x24, 0xae, 0x57,
+			 0xd9, 0x58, 0x09, 0x85, 0x48, 0xa2, 0xd3, 0xb5,
+			 0xe2, 0x4d, 0x11, 0x82, 0xe6, 0x86, 0x3c, 0xe9,
+			 0xb1, 0x00, 0x19, 0xc2, 0x57, 0xf7, 0x66, 0x7a}
+		},
+		{
+			{0x64, 0x52, 0x17, 0x2e, 0x35, 0xd8, 0x62, 0xb3,
+			 0x96, 0xb4, 0x08, 0x0f, 0xf0, 0x08, 0x25, 0xe7,
+			 0xc0, 0xa9, 0x12, 0x20, 0x35, 0x8c, 0xd4, 0xe0,
+			 0x0f, 0x82, 0x82, 0x48, 0xb7, 0xf2, 0x8a, 0x15},
+			{0x46, 0x17, 0x56, 0xd1, 0x0b, 0x53, 0x72, 0x4c,
+			 0x25, 0x95, 0x37, 0xcd, 0x28, 0x02, 0x2e, 0x4d,
+			 0xd6, 0xee, 0x3a, 0x83, 0xfa, 0xcf, 0x75, 0x7d,
+			 0x1d, 0x38, 0xb0, 0x34, 0xd7, 0x7c, 0x7e, 0x62}
+		},
+		{
+			{0x0f, 0xe3, 0x89, 0x03, 0xd7, 0x22, 0x95, 0x9f,
+			 0xca, 0xb4, 0x8d, 0x9e, 0x6d, 0x97, 0xff, 0x8d,
+			 0x21, 0x59, 0x07, 0xef, 0x03, 0x2d, 0x5e, 0xf8,
+			 0x44, 0x46, 0xe7, 0x85, 0x80, 0xc5, 0x89, 0x50},
+			{0x8b, 0xd8, 0x53, 0x86, 0x24, 0x86, 0x29, 0x52,
+			 0x01, 0xfa, 0x20, 0xc3, 0x4e, 0x95, 0xcb, 0xad,
+			 0x7b, 0x34, 0x94, 0x30, 0xb7, 0x7a, 0xfa, 0x96,
+			 0x41, 0x60, 0x2b, 0xcb, 0x59, 0xb9, 0xca, 0x50}
+		},
+		{
+			{0xf6, 0x55, 0x75, 0xde, 0xab, 0x40, 0x59, 0x9b,
+			 0xff, 0x6c, 0x0f, 0x6b, 0xa5, 0xce, 0xc0, 0x6d,
+			 0x98, 0x8d, 0xe4, 0x6d, 0xec, 0x7c, 0x36, 0x3b,
+			 0x94, 0xf3, 0xc2, 0xe7, 0x73, 0x64, 0x5f, 0x7d},
+			{0x40, 0x25, 0xdf, 0x93, 0x99, 0x17, 0x61, 0x00,
+			 0xe1, 0x9b, 0xb4, 0x77, 0x55, 0xf8, 0x44, 0x85,
+			 0xf5, 0x63, 0x50, 0x59, 0x7d, 0x7d, 0xb2, 0x25,
+			 0xe6, 0x82, 0xba, 0xc2, 0x3b, 0xc7, 0x49, 0x3c}
+		},
+		{
+			{0xa1, 0x68, 0xf8, 0xe3, 0x97, 0x4e, 0x2a, 0x31,
+			 0xda, 0xb9, 0x88, 0x0f, 0xb1, 0x33, 0xe5, 0xfe,
+			 0x31, 0xec, 0x41, 0x47, 0xf8, 0xdb, 0x1d, 0x98,
+			 0x3c, 0xc5, 0x54, 0x03, 0x53, 0x3f, 0xde, 0x5d},
+			{0xc8, 0xa7, 0x27, 0x04, 0x80, 0x84, 0x2c, 0xed,
+			 0x8a, 0x2f, 0x82, 0x74, 0x93, 0x34, 0x41, 0xc6,
+			 0x48, 0x10, 0xce, 0xea, 0xcd, 0xc5, 0xc2, 0x29,
+			 0x36, 0x4f, 0x0c, 0x8e, 0x49, 0x27, 0x95, 0x75}
+		},
+		{
+			{0xb4, 0x85, 0xaa, 0xb4, 0xfb, 0xf4, 0x87, 0xda,
+			 0xff, 0xb3, 0xcb, 0x2b, 0x46, 0x81, 0x44, 0xf3,
+			 0xf7, 0x84, 0x20, 0xda, 0x90, 0x70, 0xbd, 0x03,
+			 0x05, 0x9d, 0x3d, 0x52, 0x5a, 0x99, 0x5a, 0x3d},
+			{0x20, 0x82, 0xf5, 0xed, 0x66, 0xb5, 0xec, 0x90,
+			 0xb1, 0x13, 0xa6, 0xc4, 0x6a, 0x5f, 0xcd, 0xff,
+			 0x2b, 0x5d, 0xeb, 0x25, 0xa7, 0x73, 0x4a, 0x53,
+			 0xa7, 0xd1, 0xb1, 0x30, 0xd3, 0x63, 0x66, 0x70}
+		},
+		{
+			{0xc2, 0x5b, 0x9b, 0x78, 0x23, 0x1b, 0x3a, 0x88,
+			 0x94, 0x5f, 0x0a, 0x9b, 0x98, 0x2b, 0x6e, 0x53,
+			 0x11, 0xf6, 0xff, 0xc6, 0x7d, 0x42, 0xcc, 0x02,
+			 0x80, 0x40, 0x0d, 0x1e, 0xfb, 0xaf, 0x61, 0x07},
+			{0xb0, 0xe6, 0x2f, 0x81, 0x70, 0xa1, 0x2e, 0x39,
+			 0x04, 0x7c, 0xc4, 0x2c, 0x87, 0x45, 0x4a, 0x5b,
+			 0x69, 0x97, 0xac, 0x6d, 0x2c, 0x10, 0x42, 0x7c,
+			 0x3b, 0x15, 0x70, 0x60, 0x0e, 0x11, 0x6d, 0x3a}
+		}
+	},
+#endif
+#if (60 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x87, 0x47, 0x9d, 0xe9, 0x25, 0xd5, 0xe3, 0x47,
+			 0x78, 0xdf, 0x85, 0xa7, 0x85, 0x5e, 0x7a, 0x4c,
+			 0x5f, 0x79, 0x1a, 0xf3, 0xa2, 0xb2, 0x28, 0xa0,
+			 0x9c, 0xdd, 0x30, 0x40, 0xd4, 0x38, 0xbd, 0x28},
+			{0xfc, 0xbb, 0xd5, 0x78, 0x6d, 0x1d, 0xd4, 0x99,
+			 0xb4, 0xaa, 0x44, 0x44, 0x7a, 0x1b, 0xd8, 0xfe,
+			 0xb4, 0x99, 0xb9, 0xcc, 0xe7, 0xc4, 0xd3, 0x3a,
+			 0x73, 0x83, 0x41, 0x5c, 0x40, 0xd7, 0x2d, 0x55}
+		},
+		{
+			{0x26, 0xe1, 0x7b, 0x5f, 0xe5, 0xdc, 0x3f, 0x7d,
+			 0xa1, 0xa7, 0x26, 0x44, 0x22, 0x23, 0xc0, 0x8f,
+			 0x7d, 0xf1, 0xb5, 0x11, 0x47, 0x7b, 0x19, 0xd4,
+			 0x75, 0x6f, 0x1e, 0xa5, 0x27, 0xfe, 0xc8, 0x0e},
+			{0xd3, 0x11, 0x3d, 0xab, 0xef, 0x2c, 0xed, 0xb1,
+			 0x3d, 0x7c, 0x32, 0x81, 0x6b, 0xfe, 0xf8, 0x1c,
+			 0x3c, 0x7b, 0xc0, 0x61, 0xdf, 0xb8, 0x75, 0x76,
+			 0x7f, 0xaa, 0xd8, 0x93, 0xaf, 0x3d, 0xe8, 0x3d}
+		},
+		{
+			{0xfd, 0x5b, 0x4e, 0x8d, 0xb6, 0x7e, 0x82, 0x9b,
+			 0xef, 0xce, 0x04, 0x69, 0x51, 0x52, 0xff, 0xef,
+			 0xa0, 0x52, 0xb5, 0x79, 0x17, 0x5e, 0x2f, 0xde,
+			 0xd6, 0x3c, 0x2d, 0xa0, 0x43, 0xb4, 0x0b, 0x19},
+			{0xc0, 0x61, 0x48, 0x48, 0x17, 0xf4, 0x9e, 0x18,
+			 0x51, 0x2d, 0xea, 0x2f, 0xf2, 0xf2, 0xe0, 0xa3,
+			 0x14, 0xb7, 0x8b, 0x3a, 0x30, 0xf5, 0x81, 0xc1,
+			 0x5d, 0x71, 0x39, 0x62, 0x55, 0x1f, 0x60, 0x5a}
+		},
+		{
+			{0xe5, 0x89, 0x8a, 0x76, 0x6c, 0xdb, 0x4d, 0x0a,
+			 0x5b, 0x72, 0x9d, 0x59, 0x6e, 0x63, 0x63, 0x18,
+			 0x7c, 0xe3, 0xfa, 0xe2, 0xdb, 0xa1, 0x8d, 0xf4,
+			 0xa5, 0xd7, 0x16, 0xb2, 0xd0, 0xb3, 0x3f, 0x39},
+			{0xce, 0x60, 0x09, 0x6c, 0xf5, 0x76, 0x17, 0x24,
+			 0x80, 0x3a, 0x96, 0xc7, 0x94, 0x2e, 0xf7, 0x6b,
+			 0xef, 0xb5, 0x05, 0x96, 0xef, 0xd3, 0x7b, 0x51,
+			 0xda, 0x05, 0x44, 0x67, 0xbc, 0x07, 0x21, 0x4e}
+		},
+		{
+			{0x07, 0x99, 0x7c, 0x95, 0x00, 0x9d, 0x0e, 0x8f,
+			 0x7e, 0x38, 0x70, 0x30, 0x93, 0xa8, 0x45, 0x3d,
+			 0x49, 0x4d, 0x9e, 0x45, 0xa2, 0xe5, 0x5e, 0xfb,
+			 0xee, 0x7a, 0xa5, 0x92, 0x13, 0x83, 0xd3, 0x30},
+			{0xb9, 0x59, 0xf5, 0xcf, 0x64, 0xcc, 0xed, 0x82,
+			 0xfb, 0x3a, 0x9e, 0x22, 0xb2, 0x3f, 0x84, 0x89,
+			 0xec, 0x02, 0x60, 0x8f, 0x00, 0x02, 0xdc, 0xe7,
+			 0x1c, 0x58, 0xc8, 0x9b, 0xa2, 0x44, 0xe6, 0x50}
+		},
+		{
+			{0x8c, 0x83, 0xd6, 0x00, 0x7b, 0x3d, 0x1f, 0xdd,
+			 0xeb, 0xf9, 0x79, 0x95, 0x9b, 0xcb, 0x6f, 0xd7,
+			 0x6c, 0x91, 0x7f, 0xc9, 0x6d, 0x25, 0xad, 0x47,
+			 0xf0, 0xb5, 0xcf, 0x4c, 0x32, 0x12, 0xb6, 0x18},
+			{0xbf, 0xa8, 0xf5, 0x88, 0x57, 0xd7, 0x53, 0x05,
+			 0xa2, 0x1d, 0x0d, 0x0d, 0x76, 0xf1, 0x74, 0x74,
+			 0x61, 0xd3, 0xb3, 0x30, 0x69, 0x03, 0x28, 0xd1,
+			 0x7d, 0xcc, 0x09, 0x63, 0xa3, 0xaf, 0x6d, 0x4b}
+		},
+		{
+			{0xc4, 0x00, 0xb6, 0xa0, 0xec, 0xb2, 0x87, 0xd5,
+			 0xb1, 0xc4, 0x73, 0x60, 0xfe, 0x4b, 0xb2, 0x33,
+			 0x1b, 0x09, 0x61, 0x76, 0x21, 0x02, 0xea, 0x9c,
+			 0x6a, 0x67, 0x32, 0xae, 0xf3, 0x7a, 0x84, 0x6e},
+			{0x48, 0x21, 0x18, 0xa2, 0xf7, 0x99, 0xd9, 0xe0,
+			 0x76, 0x74, 0x91, 0xeb, 0xcd, 0x51, 0x67, 0x3a,
+			 0xe8, 0xb4, 0xbb, 0x65, 0x83, 0xb2, 0x55, 0xc9,
+			 0x9b, 0x26, 0xea, 0xba, 0x53, 0xa2, 0x2e, 0x36}
+		},
+		{
+			{0xe9, 0x73, 0x6f, 0x21, 0xb9, 0xde, 0x22, 0x7d,
+			 0xeb, 0x97, 0x31, 0x10, 0xa3, 0xea, 0xe1, 0xc6,
+			 0x37, 0xeb, 0x8f, 0x43, 0x58, 0xde, 0x41, 0x64,
+			 0x0e, 0x3e, 0x07, 0x99, 0x3d, 0xf1, 0xdf, 0x1e},
+			{0xf8, 0xad, 0x43, 0xc2, 0x17, 0x06, 0xe2, 0xe4,
+			 0xa9, 0x86, 0xcd, 0x18, 0xd7, 0x78, 0xc8, 0x74,
+			 0x66, 0xd2, 0x09, 0x18, 0xa5, 0xf1, 0xca, 0xa6,
+			 0x62, 0x92, 0xc1, 0xcb, 0x00, 0xeb, 0x42, 0x2e}
+		}
+	},
+#endif
+#if (62 % ED25519_COMB_SPACING) == 0
+	{
+		{
+			{0x1f, 0x96, 0xff, 0x34, 0x2c, 0x13, 0x21, 0xcb,
+			 0x0a, 0x89, 0x85, 0xbe, 0xb3, 0x70, 0x9e, 0x1e,
+			 0xde, 0x97, 0xaf, 0x96, 0x30, 0xf7, 0x48, 0x89,
+			 0x40, 0x8d, 0x07, 0xf1, 0x25, 0xf0, 0x30, 0x58},
+			{0x1e, 0xd4, 0x93, 0x57, 0xe2, 0x17, 0xe7, 0x9d,
+			 0xab, 0x3c, 0x55, 0x03, 0x82, 0x2f, 0x2b, 0xdb,
+			 0x56, 0x1e, 0x30, 0x2e, 0x24, 0x47, 0x6e, 0xe6,
+			 0xff, 0x33, 0x24, 0x2c, 0x75, 0x51, 0xd4, 0x67}
+		},
+		{
+			{0x2b, 0x06, 0xd9, 0xa1, 0x5d, 0xe1, 0xf4, 0xd1,
+			 0x1e, 0x3c, 0x9a, 0xc6, 0x29, 0x2b, 0x13, 0x13,
+			 0x78, 0xc0, 0xd8, 0x16, 0x17, 0x2d, 0x9e, 0xa9,
+			 0xc9, 0x79, 0x57, 0xab, 0x24, 0x91, 0x92, 0x19},
+			{0x69, 0xfb, 0xa1, 0x9c, 0xa6, 0x75, 0x49, 0x7d,
+			 0x60, 0x73, 0x40, 0x42, 0xc4, 0x13, 0x0a, 0x95,
+			 0x79, 0x1e, 0x04, 0x83, 0x94, 0x99, 0x9b, 0x1e,
+			 0x0c, 0xe8, 0x1f, 0x54, 0xef, 0xcb, 0xc0, 0x52}
+		},
+		{
+			{0x8f, 0x15, 0x76, 0x2c, 0x0f, 0x72, 0x9b, 0x43,
+			 0x27, 0xbc, 0xc5, 0x2c, 0xea, 0x0a, 0x5e, 0xd1,
+			 0xbd, 0x62, 0x59, 0x0c, 0x97, 0xab, 0x99, 0x3d,
+			 0x25, 0xeb, 0x64, 0xaf, 0xa5, 0x98, 0x31, 0x63},
+			{0x18, 0x0c, 0x7b, 0x4a, 0xe6, 0x0d, 0xc4, 0x4d,
+			 0xbc, 0xcb, 0x07, 0x03, 0x3d, 0x27, 0xec, 0xf1,
+			 0x68, 0x82, 0xc2, 0x40, 0x47, 0x84, 0x20, 0x8f,
+			 0x76, 0x9e, 0x04, 0xda, 0xe9, 0xe9, 0x88, 0x08}
+		},
+		{
+			{0x14, 0x89, 0x73, 0xa1, 0x37, 0x87, 0x6a, 0x7a,
+			 0xcf, 0x1d, 0xd9, 0x2e, 0x1a, 0x67, 0xed, 0x74,
+			 0xc0, 0xf0, 0x9c, 0x33, 0xdd, 0xdf, 0x08, 0xbf,
+			 0x7b, 0xd1, 0x66, 0xda, 0xe6, 0xc9, 0x49, 0x08},
+			{0xe9, 0xdd, 0x5e, 0x55, 0xb0, 0x0a, 0xde, 0x21,
+			 0x4c, 0x5a, 0x2e, 0xd4, 0x80, 0x3a, 0x57, 0x92,
+			 0x7a, 0xf1, 0xc4, 0x2c, 0x40, 0xaf, 0x2f, 0xc9,
+			 0x92, 0x03, 0xe5, 0x5a, 0xbc, 0xdc, 0xf4, 0x09}
+		},
+		{
+			{0xbf, 0x41, 0x1e, 0xfd, 0x31, 0xcd, 0xa5, 0xc8,
+			 0x85, 0x86, 0xfe, 0xda, 0xec, 0x96, 0x65, 0x39,
+			 0x07, 0x39, 0xd0, 0x88, 0x5b, 0xb2, 0x11, 0xed,
+			 0xdd, 0x2c, 0x5b, 0xd0, 0xe4, 0x18, 0xeb, 0x1d},
+			{0x5f, 0xfd, 0x04, 0xf6, 0x12, 0x09, 0x82, 0x3a,
+			 0x90, 0x69, 0xfe, 0x59, 0x21, 0x8f, 0x34, 0x10,
+			 0x72, 0x80, 0x0a, 0x6a, 0xbb, 0xf4, 0xa3, 0x96,
+			 0x41, 0xe4, 0x78, 0xcb, 0xc8, 0xd5, 0xc1, 0x4a}
+		},
+		{
+			{0xf3, 0xe1, 0x2b, 0x7c, 0x05, 0x86, 0x80, 0x93,
+			 0x4a, 0xad, 0xb4, 0x8f, 0x7e, 0x99, 0x0c, 0xfd,
+			 0xcd, 0xef, 0xd1, 0xff, 0x2c, 0x69, 0x34, 0x13,
+			 0x41, 0x64, 0xcf, 0x3b, 0xd0, 0x90, 0x09, 0x1e},
+			{0x9d, 0x45, 0xd6, 0x80, 0xe6, 0x45, 0xaa, 0xf4,
+			 0x15, 0xaa, 0x5c, 0x34, 0x87, 0x99, 0xa2, 0x8c,
+			 0x26, 0x84, 0x62, 0x7d, 0xb6, 0x29, 0xc0, 0x52,
+			 0xea, 0xf5, 0x81, 0x18, 0x0f, 0x35, 0xa9, 0x0e}
+		},
+		{
+			{0x43, 0xb9, 0x91, 0x97, 0xfb, 0xd3, 0x2b, 0xf2,
+			 0x60, 0x4c, 0x57, 0xa5, 0x1e, 0x3a, 0x76, 0x65,
+			 0x5c, 0xe9, 0x6d, 0x48, 0xd2, 0x58, 0xfd, 0x56,
+			 0xc4, 0x48, 0x8d, 0x1d, 0x0c, 0xa4, 0xb7, 0x1c},
+			{0x76, 0xf7, 0x7e, 0xc6, 0xae, 0xdb, 0x3e, 0x38,
+			 0x48, 0xce, 0xac, 0x49, 0x52, 0x69, 0x7a, 0x13,
+			 0xc3, 0xec, 0xcc, 0x61, 0xa5, 0xa2, 0x41, 0x20,
+			 0x1d, 0x91, 0xbe, 0x89, 0x96, 0x01, 0x35, 0x28}
+		},
+		{
+			{0xe7, 0x20, 0x72, 0x7c, 0x6d, 0x94, 0x5f, 0x52,
+			 0x44, 0x54, 0xe3, 0xf1, 0xb2, 0xb0, 0x36, 0x46,
+			 0x0f, 0xae, 0x92, 0xe8, 0x70, 0x9d, 0x6e, 0x79,
+			 0xb1, 0xad, 0x37, 0xa9, 0x5f, 0xc0, 0xde, 0x03},
+			{0x15, 0x55, 0x37, 0xc6, 0x1c, 0x27, 0x1c, 0x6d,
+			 0x14, 0x4f, 0xca, 0xa4, 0xc4, 0x88, 0x25, 0x46,
+			 0x39, 0xfc, 0x5a, 0xe5, 0xfe, 0x29, 0x11, 0x69,
+			 0xf5, 0x72, 0x84, 0x4d, 0x78, 0x9f, 0x94, 0x15}
+		}
+	}
+#endif
+};
+
+#endif
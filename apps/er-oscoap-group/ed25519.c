@@ -5,6 +5,16 @@
  */
 
 #include "ed25519.h"
+#include "ed25519-tables.h"
+
+#if ED25519_COMB_SPACING < 2 || ED25519_COMB_SPACING > 64 || \
+    (ED25519_COMB_SPACING & (ED25519_COMB_SPACING - 1))
+#error "ED25519_COMB_SPACING must be a power of two from 2 to 64"
+#endif
+
+#if ED25519_WNAF_WIDTH < 2 || ED25519_WNAF_WIDTH > 5
+#error "ED25519_WNAF_WIDTH must be 2 to 5"
+#endif
 
 /* Base point is (numbers wrapped):
  *
@@ -318,3 +328,288 @@ void ed25519_smult(struct ed25519_pt *r_out, const struct ed25519_pt *p,
 
 	ed25519_copy(r_out, &r);
 }
+
+/* Load an affine point from a table, negated if neg is set */
+static void load_affine(struct ed25519_pt *r, const uint8_t (*xy)[F25519_SIZE],
+			uint8_t neg)
+{
+	uint8_t x[F25519_SIZE];
+
+	f25519_neg(x, xy[0]);
+	f25519_select(x, xy[0], x, neg);
+	ed25519_project(r, x, xy[1]);
+}
+
+/* Recode a 255-bit exponent into 64 signed radix-16 digits in the
+ * range -8..8, without branching on its value.
+ */
+static void recode16(int8_t *d, const uint8_t *e)
+{
+	int8_t carry = 0;
+	int i;
+
+	for (i = 0; i < 32; i++) {
+		d[2 * i] = e[i] & 15;
+		d[2 * i + 1] = e[i] >> 4;
+	}
+
+	for (i = 0; i < 63; i++) {
+		d[i] += carry;
+		carry = (d[i] + 8) >> 4;
+		d[i] -= carry << 4;
+	}
+
+	d[63] += carry;
+}
+
+/* Constant-time table lookup of d times the group's base, for d in -8..8 */
+static void comb_select(struct ed25519_pt *r, int group, int8_t d)
+{
+	const uint8_t neg = ((uint8_t)d) >> 7;
+	const uint8_t mag = (d ^ -neg) + neg;
+	uint8_t xy[2][F25519_SIZE];
+	int j;
+
+	f25519_load(xy[0], 0);
+	f25519_load(xy[1], 1);
+
+	for (j = 0; j < 8; j++) {
+		const uint32_t diff = mag ^ (j + 1);
+		const uint8_t eq = ((diff - 1) >> 31) & 1;
+
+		f25519_select(xy[0], xy[0], ed25519_comb[group][j][0], eq);
+		f25519_select(xy[1], xy[1], ed25519_comb[group][j][1], eq);
+	}
+
+	load_affine(r, (const uint8_t (*)[F25519_SIZE])xy, neg);
+}
+
+void ed25519_smult_base(struct ed25519_pt *r_out, const uint8_t *e)
+{
+	struct ed25519_pt r;
+	struct ed25519_pt s;
+	int8_t d[64];
+	int pass;
+	int i;
+
+	/* Digit k is worth 16^k B. Group i covers the digits at
+	 * i * spacing + pass, which are added in after the digits at
+	 * higher passes have been shifted up by 4 doublings per pass.
+	 */
+	recode16(d, e);
+	ed25519_copy(&r, &ed25519_neutral);
+
+	for (pass = ED25519_COMB_SPACING - 1; pass >= 0; pass--) {
+		for (i = 0; i < 64 / ED25519_COMB_SPACING; i++) {
+			comb_select(&s, i, d[i * ED25519_COMB_SPACING + pass]);
+			ed25519_add(&r, &r, &s);
+		}
+
+		if (pass) {
+			ed25519_double(&r, &r);
+			ed25519_double(&r, &r);
+			ed25519_double(&r, &r);
+			ed25519_double(&r, &r);
+		}
+	}
+
+	ed25519_copy(r_out, &r);
+}
+
+/* Sliding window NAF of a 255-bit exponent: every digit is zero or odd,
+ * with magnitude below 2^(w-1), and non-zero digits are at least w
+ * places apart.
+ */
+static void slide(int8_t *r, const uint8_t *a, int w)
+{
+	const int max = (1 << (w - 1)) - 1;
+	int i;
+
+	for (i = 0; i < 256; i++)
+		r[i] = (a[i >> 3] >> (i & 7)) & 1;
+
+	for (i = 0; i < 256; i++) {
+		int b;
+
+		if (!r[i])
+			continue;
+
+		for (b = 1; b < w && i + b < 256; b++) {
+			if (!r[i + b])
+				continue;
+
+			if (r[i] + (r[i + b] << b) <= max) {
+				r[i] += r[i + b] << b;
+				r[i + b] = 0;
+			} else if (r[i] - (r[i + b] << b) >= -max) {
+				int k;
+
+				r[i] -= r[i + b] << b;
+				for (k = i + b; k < 256; k++) {
+					if (!r[k]) {
+						r[k] = 1;
+						break;
+					}
+
+					r[k] = 0;
+				}
+			} else {
+				break;
+			}
+		}
+	}
+}
+
+static void neg_pt(struct ed25519_pt *r, const struct ed25519_pt *p)
+{
+	f25519_neg(r->x, p->x);
+	f25519_copy(r->y, p->y);
+	f25519_neg(r->t, p->t);
+	f25519_copy(r->z, p->z);
+}
+
+/* A point with its NAF exponent and odd multiples P, 3P, 5P, ... */
+static void wnaf_init(struct ed25519_wnaf *t, const struct ed25519_pt *p,
+		      const uint8_t *e)
+{
+	struct ed25519_pt p2;
+	int i;
+
+	slide(t->naf, e, ED25519_WNAF_WIDTH);
+
+	ed25519_copy(&t->pm[0], p);
+	ed25519_double(&p2, p);
+	for (i = 1; i < (int)(sizeof(t->pm) / sizeof(t->pm[0])); i++)
+		ed25519_add(&t->pm[i], &t->pm[i - 1], &p2);
+}
+
+/* Straus: r = aB + sum of the terms, with shared doublings. The base
+ * point uses the width 5 table in flash, so na is slide(a, 5).
+ */
+static int straus_top(const int8_t *na, const struct ed25519_wnaf *terms,
+		      int n)
+{
+	int i;
+	int j;
+
+	for (i = 255; i >= 0; i--) {
+		if (na[i])
+			break;
+
+		for (j = 0; j < n && !terms[j].naf[i]; j++)
+			;
+
+		if (j < n)
+			break;
+	}
+
+	return i;
+}
+
+static void straus_bit(struct ed25519_pt *r, const int8_t *na,
+		       const struct ed25519_wnaf *terms, int n, int i)
+{
+	struct ed25519_pt s;
+	int j;
+
+	ed25519_double(r, r);
+
+	if (na[i]) {
+		load_affine(&s, ed25519_base_odd[(na[i] < 0 ?
+			-na[i] : na[i]) >> 1], na[i] < 0);
+		ed25519_add(r, r, &s);
+	}
+
+	for (j = 0; j < n; j++) {
+		const int8_t d = terms[j].naf[i];
+
+		if (d > 0) {
+			ed25519_add(r, r, &terms[j].pm[d >> 1]);
+		} else if (d < 0) {
+			neg_pt(&s, &terms[j].pm[-d >> 1]);
+			ed25519_add(r, r, &s);
+		}
+	}
+}
+
+static void straus(struct ed25519_pt *r, const uint8_t *a,
+		   const struct ed25519_wnaf *terms, int n)
+{
+	int8_t na[256];
+	int i;
+
+	slide(na, a, 5);
+	ed25519_copy(r, &ed25519_neutral);
+
+	for (i = straus_top(na, terms, n); i >= 0; i--)
+		straus_bit(r, na, terms, n, i);
+}
+
+void ed25519_smult_vartime(struct ed25519_pt *r, const uint8_t *a,
+			   const struct ed25519_pt *p, const uint8_t *b)
+{
+	struct ed25519_wnaf t;
+
+	wnaf_init(&t, p, b);
+	straus(r, a, &t, 1);
+}
+
+void ed25519_smult_vartime_start(struct ed25519_vartime *v,
+				 const uint8_t *a,
+				 const struct ed25519_pt *p,
+				 const uint8_t *b)
+{
+	wnaf_init(&v->term, p, b);
+	slide(v->na, a, 5);
+	ed25519_copy(&v->r, &ed25519_neutral);
+	v->i = straus_top(v->na, &v->term, 1);
+}
+
+uint8_t ed25519_smult_vartime_step(struct ed25519_vartime *v, int steps)
+{
+	for (; steps > 0 && v->i >= 0; steps--, v->i--)
+		straus_bit(&v->r, v->na, &v->term, 1, v->i);
+
+	return v->i < 0;
+}
+
+/* Too large for the stack of a small device */
+static struct ed25519_wnaf msmult_terms[ED25519_MSMULT_MAX];
+
+void ed25519_msmult_vartime_start(struct ed25519_msmult *v,
+				  const uint8_t *a,
+				  const struct ed25519_pt *p,
+				  const uint8_t (*b)[ED25519_EXPONENT_SIZE],
+				  int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		wnaf_init(&msmult_terms[i], &p[i], b[i]);
+
+	slide(v->na, a, 5);
+	ed25519_copy(&v->r, &ed25519_neutral);
+	v->n = n;
+	v->i = straus_top(v->na, msmult_terms, n);
+}
+
+uint8_t ed25519_msmult_vartime_step(struct ed25519_msmult *v, int steps)
+{
+	for (; steps > 0 && v->i >= 0; steps--, v->i--)
+		straus_bit(&v->r, v->na, msmult_terms, v->n, v->i);
+
+	return v->i < 0;
+}
+
+void ed25519_msmult_vartime(struct ed25519_pt *r, const uint8_t *a,
+			    const struct ed25519_pt *p,
+			    const uint8_t (*b)[ED25519_EXPONENT_SIZE], int n)
+{
+	struct ed25519_msmult v;
+
+	ed25519_msmult_vartime_start(&v, a, p, b, n);
+	while (!ed25519_msmult_vartime_step(&v, 256))
+		;
+
+	ed25519_copy(r, &v.r);
+}
@@ -0,0 +1,176 @@
+/* Edwards curve operations
+ * Daniel Beer <dlbeer@gmail.com>, 9 Jan 2014
+ *
+ * This file is in the public domain.
+ */
+
+#ifndef ED25519_H_
+#define ED25519_H_
+
+#include "f25519.h"
+
+/* This is not the Ed25519 signature system. Rather, we're implementing
+ * basic operations on the twisted Edwards curve over (Z mod 2^255-19):
+ *
+ *     -x^2 + y^2 = 1 - (121665/121666)x^2y^2
+ *
+ * With the positive-x base point y = 4/5.
+ *
+ * These functions will not leak secret data through timing.
+ *
+ * For more information, see:
+ *
+ *     Bernstein, D.J. & Lange, T. (2007) "Faster addition and doubling on
+ *     elliptic curves". Document ID: 95616567a6ba20f575c5f25e7cebaf83.
+ *
+ *     Hisil, H. & Wong, K K. & Carter, G. & Dawson, E. (2008) "Twisted
+ *     Edwards curves revisited". Advances in Cryptology, ASIACRYPT 2008,
+ *     Vol. 5350, pp. 326-343.
+ */
+
+/* Projective coordinates */
+struct ed25519_pt {
+	uint8_t		x[F25519_SIZE];
+	uint8_t		y[F25519_SIZE];
+	uint8_t		t[F25519_SIZE];
+	uint8_t		z[F25519_SIZE];
+};
+
+extern const struct ed25519_pt ed25519_base;
+extern const struct ed25519_pt ed25519_neutral;
+
+/* Convert between projective and affine coordinates (x/y in F25519) */
+void ed25519_project(struct ed25519_pt *p,
+		     const uint8_t *x, const uint8_t *y);
+
+void ed25519_unproject(uint8_t *x, uint8_t *y,
+		       const struct ed25519_pt *p);
+
+/* Compress/uncompress points. try_unpack() will check that the
+ * compressed point is on the curve, returning 1 if the unpacked point
+ * is valid, and 0 otherwise.
+ */
+#define ED25519_PACK_SIZE	F25519_SIZE
+
+void ed25519_pack(uint8_t *c, const uint8_t *x, const uint8_t *y);
+uint8_t ed25519_try_unpack(uint8_t *x, uint8_t *y, const uint8_t *c);
+
+/* Add, double and scalar multiply */
+#define ED25519_EXPONENT_SIZE	32
+
+/* Prepare an exponent by clamping appropriate bits */
+static inline void ed25519_prepare(uint8_t *e)
+{
+	e[0] &= 0xf8;
+	e[31] &= 0x7f;
+	e[31] |= 0x40;
+}
+
+/* Order of the group generated by the base point */
+static inline void ed25519_copy(struct ed25519_pt *dst,
+				const struct ed25519_pt *src)
+{
+	memcpy(dst, src, sizeof(*dst));
+}
+
+void ed25519_add(struct ed25519_pt *r,
+		 const struct ed25519_pt *a, const struct ed25519_pt *b);
+void ed25519_double(struct ed25519_pt *r, const struct ed25519_pt *a);
+void ed25519_smult(struct ed25519_pt *r, const struct ed25519_pt *a,
+		   const uint8_t *e);
+
+/* Multiply the base point by e, using a precomputed comb table. This
+ * is constant-time, like ed25519_smult(), and e must be less than
+ * 2^255 (which holds for prepared exponents).
+ *
+ * The table has 64 / ED25519_COMB_SPACING groups of 8 points, 512
+ * bytes each, and the multiplication takes 4 * (spacing - 1) doublings
+ * and 64 additions. The spacing must be a power of two from 2 to 64.
+ */
+#ifdef ED25519_CONF_COMB_SPACING
+#define ED25519_COMB_SPACING	ED25519_CONF_COMB_SPACING
+#else
+#define ED25519_COMB_SPACING	8
+#endif
+
+void ed25519_smult_base(struct ed25519_pt *r, const uint8_t *e);
+
+/* Compute r = aB + bP, for a and b less than 2^255, with sliding window
+ * NAF and interleaved (Straus-Shamir) doublings.
+ *
+ * This is NOT constant-time, and is only suitable for public values,
+ * as in signature verification. Odd multiples of P up to
+ * (2^(ED25519_WNAF_WIDTH - 1) - 1)P are kept on the stack; the width is
+ * 2 to 5.
+ */
+#ifdef ED25519_CONF_WNAF_WIDTH
+#define ED25519_WNAF_WIDTH	ED25519_CONF_WNAF_WIDTH
+#else
+#define ED25519_WNAF_WIDTH	5
+#endif
+
+void ed25519_smult_vartime(struct ed25519_pt *r, const uint8_t *a,
+			   const struct ed25519_pt *p, const uint8_t *b);
+
+/* The same multiplication split into steps, so that it can be spread
+ * over several calls with other work in between. Each step handles one
+ * bit position: a doubling and at most two additions.
+ *
+ * ed25519_smult_vartime_step() returns non-zero, with the result in
+ * r, once all steps are done. The exponents are recoded by _start()
+ * and need not be kept.
+ */
+struct ed25519_wnaf {
+	int8_t			naf[256];
+	struct ed25519_pt	pm[1 << (ED25519_WNAF_WIDTH - 2)];
+};
+
+struct ed25519_vartime {
+	struct ed25519_pt	r;
+	struct ed25519_wnaf	term;
+	int8_t			na[256];
+	int			i;
+};
+
+void ed25519_smult_vartime_start(struct ed25519_vartime *v,
+				 const uint8_t *a,
+				 const struct ed25519_pt *p,
+				 const uint8_t *b);
+
+uint8_t ed25519_smult_vartime_step(struct ed25519_vartime *v, int steps);
+
+/* Compute r = aB + b[0]P[0] + ... + b[n-1]P[n-1] in the same way, for
+ * n up to ED25519_MSMULT_MAX. Each point takes as much memory as the
+ * one point of ed25519_smult_vartime(), about 1.3 kB, which is static
+ * rather than on the stack. The function is not reentrant.
+ */
+#ifdef ED25519_CONF_MSMULT_MAX
+#define ED25519_MSMULT_MAX	ED25519_CONF_MSMULT_MAX
+#else
+#define ED25519_MSMULT_MAX	8
+#endif
+
+void ed25519_msmult_vartime(struct ed25519_pt *r, const uint8_t *a,
+			    const struct ed25519_pt *p,
+			    const uint8_t (*b)[ED25519_EXPONENT_SIZE], int n);
+
+/* The same in steps, as for ed25519_smult_vartime_start(). The points
+ * are recoded into the same static memory, so only one multiplication,
+ * stepped or not, may be in progress at a time.
+ */
+struct ed25519_msmult {
+	struct ed25519_pt	r;
+	int8_t			na[256];
+	int			n;
+	int			i;
+};
+
+void ed25519_msmult_vartime_start(struct ed25519_msmult *v,
+				  const uint8_t *a,
+				  const struct ed25519_pt *p,
+				  const uint8_t (*b)[ED25519_EXPONENT_SIZE],
+				  int n);
+
+uint8_t ed25519_msmult_vartime_step(struct ed25519_msmult *v, int steps);
+
+#endif
@@ -0,0 +1,442 @@
+/* Edwards curve signature system
+ * Daniel Beer <dlbeer@gmail.com>, 22 Apr 2014
+ *
+ * This file is in the public domain.
+ */
+
+#include "ed25519.h"
+#include "sha512.h"
+#include "fprime.h"
+#include "edsign.h"
+
+#define EXPANDED_SIZE		64
+
+static const uint8_t ed25519_order[FPRIME_SIZE] = {
+	0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+	0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static void expand_key(uint8_t *expanded, const uint8_t *secret)
+{
+	struct sha512_state s;
+
+	sha512_init(&s);
+	sha512_final(&s, secret, EDSIGN_SECRET_KEY_SIZE);
+	sha512_get(&s, expanded, 0, EXPANDED_SIZE);
+	ed25519_prepare(expanded);
+}
+
+static uint8_t upp(struct ed25519_pt *p, const uint8_t *packed)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+	uint8_t ok = ed25519_try_unpack(x, y, packed);
+
+	ed25519_project(p, x, y);
+	return ok;
+}
+
+/* Unpack R of a signature, which must also be the one encoding of its
+ * point: y below p, and no sign bit for x = 0. Otherwise a second
+ * encoding of R would verify as well.
+ */
+static uint8_t upp_canonical(struct ed25519_pt *p, const uint8_t *packed)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+	uint8_t check[F25519_SIZE];
+	uint8_t ok = ed25519_try_unpack(x, y, packed);
+
+	ed25519_pack(check, x, y);
+	ed25519_project(p, x, y);
+	return ok & !memcmp(check, packed, F25519_SIZE);
+}
+
+/* Is s of a signature below the group order? s + L would pass the check
+ * as well, so it is rejected rather than reduced.
+ */
+static uint8_t scalar_canonical(const uint8_t *s)
+{
+	int i;
+
+	for (i = FPRIME_SIZE - 1; i >= 0; i--)
+		if (s[i] != ed25519_order[i])
+			return s[i] < ed25519_order[i];
+
+	return 0;
+}
+
+static void pp(uint8_t *packed, const struct ed25519_pt *p)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+
+	ed25519_unproject(x, y, p);
+	ed25519_pack(packed, x, y);
+}
+
+static void sm_pack(uint8_t *r, const uint8_t *k)
+{
+	struct ed25519_pt p;
+
+	ed25519_smult_base(&p, k);
+	pp(r, &p);
+}
+
+void edsign_sec_to_pub(uint8_t *pub, const uint8_t *secret)
+{
+	uint8_t expanded[EXPANDED_SIZE];
+
+	expand_key(expanded, secret);
+	sm_pack(pub, expanded);
+}
+
+/* The prefixes are fed straight from where they are and the message
+ * is compressed in place, a block at a time. No prefix fills a whole
+ * block, so there is no midstate worth keeping between calls.
+ */
+static void hash_to_scalar(uint8_t *out_fp, struct sha512_ctx *s)
+{
+	uint8_t hash[SHA512_HASH_SIZE];
+
+	sha512_finish(s, hash);
+	fprime_from_bytes(out_fp, hash, SHA512_HASH_SIZE, ed25519_order);
+}
+
+static void generate_k(uint8_t *k, const uint8_t *kgen_key,
+		       const uint8_t *message, size_t len)
+{
+	struct sha512_ctx s;
+
+	sha512_start(&s);
+	sha512_update(&s, kgen_key, 32);
+	sha512_update(&s, message, len);
+	hash_to_scalar(k, &s);
+}
+
+static void hash_message(uint8_t *z, const uint8_t *r, const uint8_t *a,
+			 const uint8_t *m, size_t len)
+{
+	struct sha512_ctx s;
+
+	sha512_start(&s);
+	sha512_update(&s, r, 32);
+	sha512_update(&s, a, 32);
+	sha512_update(&s, m, len);
+	hash_to_scalar(z, &s);
+}
+
+void edsign_prepare_secret(struct edsign_secret_key *key,
+			   const uint8_t *secret)
+{
+	expand_key(key->expanded, secret);
+	sm_pack(key->pub, key->expanded);
+}
+
+void edsign_sign_prepared(uint8_t *signature,
+			  const struct edsign_secret_key *key,
+			  const uint8_t *message, size_t len)
+{
+	uint8_t e[FPRIME_SIZE];
+	uint8_t s[FPRIME_SIZE];
+	uint8_t k[FPRIME_SIZE];
+	uint8_t z[FPRIME_SIZE];
+
+	/* Generate k and R = kB */
+	generate_k(k, key->expanded + 32, message, len);
+	sm_pack(signature, k);
+
+	/* Compute z = H(R, A, M) */
+	hash_message(z, signature, key->pub, message, len);
+
+	/* Obtain e */
+	fprime_from_bytes(e, key->expanded, 32, ed25519_order);
+
+	/* Compute s = ze + k */
+	fprime_mul(s, z, e, ed25519_order);
+	fprime_add(s, k, ed25519_order);
+	memcpy(signature + 32, s, 32);
+}
+
+void edsign_sign(uint8_t *signature, const uint8_t *pub,
+		 const uint8_t *secret,
+		 const uint8_t *message, size_t len)
+{
+	struct edsign_secret_key key;
+
+	expand_key(key.expanded, secret);
+	memcpy(key.pub, pub, EDSIGN_PUBLIC_KEY_SIZE);
+	edsign_sign_prepared(signature, &key, message, len);
+}
+
+uint8_t edsign_prepare_public(struct edsign_public_key *key,
+			      const uint8_t *pub)
+{
+	memcpy(key->packed, pub, EDSIGN_PUBLIC_KEY_SIZE);
+	key->ok = upp(&key->point, pub);
+	return key->ok;
+}
+
+void edsign_verify_start(struct edsign_verify *ctx,
+			 const uint8_t *signature,
+			 const struct edsign_public_key *key,
+			 const uint8_t *message, size_t len)
+{
+	struct ed25519_pt p;
+	uint8_t s[FPRIME_SIZE];
+	uint8_t z[FPRIME_SIZE];
+
+	/* Compute z = H(R, A, M) */
+	hash_message(z, signature, key->packed, message, len);
+
+	/* sB = (ze + k)B = zA + R, so R = sB - zA. Only public values are
+	 * involved, so this can be done in variable time. A signature is
+	 * only accepted with s below the order, so reducing it changes
+	 * nothing then.
+	 */
+	fprime_from_bytes(s, signature + 32, 32, ed25519_order);
+	ed25519_copy(&p, &key->point);
+	f25519_neg(p.x, p.x);
+	f25519_neg(p.t, p.t);
+	ed25519_smult_vartime_start(&ctx->v, s, &p, z);
+
+	memcpy(ctx->r, signature, 32);
+	ctx->ok = key->ok & scalar_canonical(signature + 32);
+}
+
+uint8_t edsign_verify_step(struct edsign_verify *ctx, int steps)
+{
+	return ed25519_smult_vartime_step(&ctx->v, steps);
+}
+
+/* Is 8r the neutral point? */
+static uint8_t cofactor_neutral(struct ed25519_pt *r)
+{
+	uint8_t t[F25519_SIZE];
+
+	ed25519_double(r, r);
+	ed25519_double(r, r);
+	ed25519_double(r, r);
+
+	/* Neutral: X = 0 and Y = Z */
+	f25519_normalize(r->x);
+	f25519_sub(t, r->y, r->z);
+	f25519_normalize(t);
+
+	return f25519_eq(r->x, f25519_zero) & f25519_eq(t, f25519_zero);
+}
+
+uint8_t edsign_verify_result(struct edsign_verify *ctx)
+{
+	struct ed25519_pt r;
+	uint8_t ok;
+
+	/* 8(sB - zA - R) = 0, the equation of the batch check */
+	ok = upp_canonical(&r, ctx->r);
+	f25519_neg(r.x, r.x);
+	f25519_neg(r.t, r.t);
+	ed25519_add(&r, &ctx->v.r, &r);
+
+	return ctx->ok & ok & cofactor_neutral(&r);
+}
+
+uint8_t edsign_verify_prepared(const uint8_t *signature,
+			       const struct edsign_public_key *key,
+			       const uint8_t *message, size_t len)
+{
+	struct edsign_verify ctx;
+
+	edsign_verify_start(&ctx, signature, key, message, len);
+	while (!edsign_verify_step(&ctx, 256))
+		;
+
+	return edsign_verify_result(&ctx);
+}
+
+uint8_t edsign_verify(const uint8_t *signature, const uint8_t *pub,
+		      const uint8_t *message, size_t len)
+{
+	struct edsign_public_key key;
+
+	edsign_prepare_public(&key, pub);
+	return edsign_verify_prepared(signature, &key, message, len);
+}
+
+/* Start the check of one group of at most EDSIGN_BATCH_SIZE signatures:
+ *
+ *     8 * sum z_i (R_i + h_i A_i - s_i B) = 0
+ *
+ * with 128-bit z_i taken from a hash of all the inputs. Returns zero,
+ * without starting, if a point does not decode.
+ */
+static uint8_t group_start(struct ed25519_msmult *m,
+			   const struct edsign_batch *batch, int n)
+{
+	/* static: about 1.5 kB with the default ED25519_MSMULT_MAX */
+	static struct ed25519_pt p[ED25519_MSMULT_MAX];
+	static uint8_t e[ED25519_MSMULT_MAX][FPRIME_SIZE];
+	uint8_t block[SHA512_BLOCK_SIZE];
+	uint8_t seed[SHA512_HASH_SIZE + 1];
+	uint8_t a[FPRIME_SIZE];
+	uint8_t t[FPRIME_SIZE];
+	struct sha512_state st;
+	uint8_t ok = 1;
+	int i;
+
+	/* e[2i] = h_i for now, and the transcript is (R, A, s, h) */
+	sha512_init(&st);
+
+	for (i = 0; i < n; i++) {
+		const struct edsign_batch *b = &batch[i];
+		const uint8_t *pub = b->key ? b->key->packed : b->pub;
+
+		hash_message(e[2 * i], b->signature, pub,
+			     b->message, b->len);
+		ok &= upp_canonical(&p[2 * i], b->signature);
+		ok &= scalar_canonical(b->signature + 32);
+		if (b->key) {
+			ed25519_copy(&p[2 * i + 1], &b->key->point);
+			ok &= b->key->ok;
+		} else {
+			ok &= upp(&p[2 * i + 1], pub);
+		}
+
+		memcpy(block, b->signature, 64);
+		memcpy(block + 64, pub, 32);
+		memcpy(block + 96, e[2 * i], 32);
+		sha512_block(&st, block);
+	}
+
+	if (!ok)
+		return 0;
+
+	/* whole blocks only, so there is no partial one to pass */
+	sha512_final(&st, NULL, n * SHA512_BLOCK_SIZE);
+	sha512_get(&st, seed, 0, SHA512_HASH_SIZE);
+
+	fprime_load(a, 0);
+
+	for (i = 0; i < n; i++) {
+		uint8_t z[FPRIME_SIZE];
+		uint8_t s[FPRIME_SIZE];
+
+		seed[SHA512_HASH_SIZE] = i;
+		sha512_init(&st);
+		sha512_final(&st, seed, sizeof(seed));
+		fprime_load(z, 0);
+		sha512_get(&st, z, 0, 16);
+
+		/* R_i: z_i, A_i: z_i h_i */
+		fprime_mul(e[2 * i + 1], z, e[2 * i], ed25519_order);
+		fprime_copy(e[2 * i], z);
+
+		/* B: -sum z_i s_i */
+		fprime_from_bytes(s, batch[i].signature + 32, 32,
+				  ed25519_order);
+		fprime_mul(t, z, s, ed25519_order);
+		fprime_sub(a, t, ed25519_order);
+	}
+
+	ed25519_msmult_vartime_start(m, a, p,
+				     (const uint8_t (*)[FPRIME_SIZE])e, 2 * n);
+	return 1;
+}
+
+/* Start verifying the signature s->j of the current group alone */
+static void batch_single(struct edsign_batch_verify *s)
+{
+	const struct edsign_batch *b = &s->batch[s->j];
+	struct edsign_public_key key;
+
+	if (b->key) {
+		edsign_verify_start(&s->one, b->signature, b->key,
+				    b->message, b->len);
+	} else {
+		edsign_prepare_public(&key, b->pub);
+		edsign_verify_start(&s->one, b->signature, &key,
+				    b->message, b->len);
+	}
+}
+
+/* Start the group at s->batch: as a whole if it has more than one
+ * signature and its points decode, otherwise one by one.
+ */
+static void batch_group(struct edsign_batch_verify *s)
+{
+	s->g = s->n < EDSIGN_BATCH_SIZE ? s->n : EDSIGN_BATCH_SIZE;
+	s->j = -1;
+
+	if (s->g > 1 && group_start(&s->m, s->batch, s->g))
+		return;
+
+	s->j = 0;
+	batch_single(s);
+}
+
+void edsign_verify_batch_start(struct edsign_batch_verify *s,
+			       struct edsign_batch *batch, int n)
+{
+	s->batch = batch;
+	s->n = n;
+	s->all = 1;
+
+	if (n > 0)
+		batch_group(s);
+}
+
+uint8_t edsign_verify_batch_step(struct edsign_batch_verify *s, int steps)
+{
+	int i;
+
+	if (s->n <= 0)
+		return 1;
+
+	if (s->j < 0) {
+		if (!ed25519_msmult_vartime_step(&s->m, steps))
+			return 0;
+
+		if (cofactor_neutral(&s->m.r)) {
+			for (i = 0; i < s->g; i++)
+				s->batch[i].ok = 1;
+		} else {
+			/* Find the bad ones */
+			s->j = 0;
+			batch_single(s);
+			return 0;
+		}
+	} else {
+		struct edsign_batch *b = &s->batch[s->j];
+
+		if (!edsign_verify_step(&s->one, steps))
+			return 0;
+
+		b->ok = edsign_verify_result(&s->one);
+		s->all &= b->ok;
+
+		if (++s->j < s->g) {
+			batch_single(s);
+			return 0;
+		}
+	}
+
+	s->batch += s->g;
+	s->n -= s->g;
+	if (s->n <= 0)
+		return 1;
+
+	batch_group(s);
+	return 0;
+}
+
+uint8_t edsign_verify_batch(struct edsign_batch *batch, int n)
+{
+	struct edsign_batch_verify s;
+
+	edsign_verify_batch_start(&s, batch, n);
+	while (!edsign_verify_batch_step(&s, 256))
+		;
+
+	return s.all;
+}
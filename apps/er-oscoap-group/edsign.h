@@ -0,0 +1,168 @@
+/* Edwards curve signature system
+ * Daniel Beer <dlbeer@gmail.com>, 22 Apr 2014
+ *
+ * This file is in the public domain.
+ */
+
+#ifndef EDSIGN_H_
+#define EDSIGN_H_
+
+#include <stdint.h>
+#include "ed25519.h"
+
+/* This is the Ed25519 signature system, as described in:
+ *
+ *     Daniel J. Bernstein, Niels Duif, Tanja Lange, Peter Schwabe, Bo-Yin
+ *     Yang. High-speed high-security signatures. Journal of Cryptographic
+ *     Engineering 2 (2012), 77–89. Document ID:
+ *     a1a62a2f76d23f65d622484ddd09caf8. URL:
+ *     http://cr.yp.to/papers.html#ed25519. Date: 2011.09.26. 
+ *
+ * The format and calculation of signatures is compatible with the
+ * Ed25519 implementation in SUPERCOP. Note, however, that our secret
+ * keys are half the size: we don't store a copy of the public key in
+ * the secret key (we generate it on demand).
+ */
+
+/* Any string of 32 random bytes is a valid secret key. There is no
+ * clamping of bits, because we don't use the key directly as an
+ * exponent (the exponent is derived from part of a key expansion).
+ */
+#define EDSIGN_SECRET_KEY_SIZE		32
+
+/* Given a secret key, produce the public key (a packed Edwards-curve
+ * point).
+ */
+#define EDSIGN_PUBLIC_KEY_SIZE		32
+
+void edsign_sec_to_pub(uint8_t *pub, const uint8_t *secret);
+
+/* Produce a signature for a message. */
+#define EDSIGN_SIGNATURE_SIZE		64
+
+void edsign_sign(uint8_t *signature, const uint8_t *pub,
+		 const uint8_t *secret,
+		 const uint8_t *message, size_t len);
+
+/* Verify a message signature. Returns non-zero if ok.
+ *
+ * The check is multiplied by the cofactor, 8(sB - zA - R) = 0, as the
+ * batch check below must be. A signature is then accepted or rejected
+ * the same way whichever path verifies it, also when R or A has a
+ * small order component.
+ *
+ * R must be canonically encoded and s below the group order, so that
+ * no second valid signature can be made from a given one.
+ */
+uint8_t edsign_verify(const uint8_t *signature, const uint8_t *pub,
+		      const uint8_t *message, size_t len);
+
+/* Keys with their expensive parts computed in advance. A secret key
+ * holds the key expansion and the public key, so that signing with it
+ * costs one scalar multiplication. A public key holds the decoded
+ * point, so that verifying with it skips the square root of point
+ * decompression. Both may be stored and reloaded as plain bytes.
+ */
+struct edsign_secret_key {
+	uint8_t			expanded[64];
+	uint8_t			pub[EDSIGN_PUBLIC_KEY_SIZE];
+};
+
+struct edsign_public_key {
+	uint8_t			packed[EDSIGN_PUBLIC_KEY_SIZE];
+	struct ed25519_pt	point;
+	uint8_t			ok;
+};
+
+void edsign_prepare_secret(struct edsign_secret_key *key,
+			   const uint8_t *secret);
+
+void edsign_sign_prepared(uint8_t *signature,
+			  const struct edsign_secret_key *key,
+			  const uint8_t *message, size_t len);
+
+/* Returns non-zero if pub is a valid point. Signatures never verify
+ * against an invalid one.
+ */
+uint8_t edsign_prepare_public(struct edsign_public_key *key,
+			      const uint8_t *pub);
+
+uint8_t edsign_verify_prepared(const uint8_t *signature,
+			       const struct edsign_public_key *key,
+			       const uint8_t *message, size_t len);
+
+/* Verification in steps, for callers that cannot block for a whole
+ * verification. _start() hashes the message and sets up the point
+ * multiplication; the signature, key and message need not be kept
+ * after it returns. _step() does up to the given number of bit
+ * positions of the multiplication (about 256 in all) and returns
+ * non-zero when they are done, after which _result() gives the same
+ * answer as edsign_verify_prepared().
+ */
+struct edsign_verify {
+	struct ed25519_vartime	v;
+	uint8_t			r[32];
+	uint8_t			ok;
+};
+
+void edsign_verify_start(struct edsign_verify *ctx,
+			 const uint8_t *signature,
+			 const struct edsign_public_key *key,
+			 const uint8_t *message, size_t len);
+
+uint8_t edsign_verify_step(struct edsign_verify *ctx, int steps);
+
+uint8_t edsign_verify_result(struct edsign_verify *ctx);
+
+/* Verify several signatures at once. The result for each signature is
+ * left in its ok field, and the return value is non-zero if all are
+ * ok.
+ *
+ * Signatures are checked in groups of EDSIGN_BATCH_SIZE with a single
+ * multi-scalar multiplication over a random linear combination of the
+ * verification equations. The coefficients are derived by hashing the
+ * whole group, so no random number source is needed. When a group
+ * fails, its signatures are verified one by one to find the bad ones.
+ *
+ * The group check uses the same cofactored equation as edsign_verify(),
+ * so both accept the same signatures. Its points and exponents are kept
+ * in static memory rather than on the stack, so it must not be called
+ * again before it returns.
+ */
+struct edsign_batch {
+	const uint8_t	*signature;
+	const uint8_t	*pub;
+	const uint8_t	*message;
+	size_t		len;
+	uint8_t		ok;
+
+	/* If set, used instead of pub */
+	const struct edsign_public_key *key;
+};
+
+#define EDSIGN_BATCH_SIZE	(ED25519_MSMULT_MAX / 2)
+
+uint8_t edsign_verify_batch(struct edsign_batch *batch, int n);
+
+/* The same in steps, as for edsign_verify_start(). The signatures,
+ * keys and messages must be kept until _step() returns non-zero, and
+ * the results are then in the ok fields. The group check still runs
+ * in static memory, so only one batch may be in progress at a time.
+ */
+struct edsign_batch_verify {
+	struct edsign_batch	*batch;
+	int			n;
+	int			g;
+	int			j;
+	uint8_t			all;
+
+	struct ed25519_msmult	m;
+	struct edsign_verify	one;
+};
+
+void edsign_verify_batch_start(struct edsign_batch_verify *s,
+			       struct edsign_batch *batch, int n);
+
+uint8_t edsign_verify_batch_step(struct edsign_batch_verify *s, int steps);
+
+#endif
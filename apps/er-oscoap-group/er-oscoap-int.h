@@ -32,7 +32,48 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef _OSCOAP_INT_H
 #define _OSCOAP_INT_H
 
-#include "er-coap.h"
+#include "contiki-conf.h"
+
+/*
+ * The part this node plays. A unicast endpoint shares a context with a
+ * single peer, with keys given by the application. In a group, the
+ * group sender multicasts requests and collects the responses; a group
+ * receiver joins the multicast group and answers within the leisure.
+ * The two group roles use each other's sender IDs and key derivation
+ * labels. Defined ahead of the signature mode, whose default depends
+ * on the role.
+ */
+#define OSCOAP_ROLE_GROUP_SENDER   1
+#define OSCOAP_ROLE_GROUP_RECEIVER 2
+#define OSCOAP_ROLE_UNICAST        3
+
+#ifdef OSCOAP_CONF_ROLE
+#define OSCOAP_ROLE OSCOAP_CONF_ROLE
+#else
+#define OSCOAP_ROLE OSCOAP_ROLE_GROUP_SENDER
+#endif
+
+/*
+ * Countersignatures on protected messages: none, a fixed test value that
+ * is sent but not checked, or Ed25519 over the ciphertext, made with the
+ * sender key and verified with the key of the recipient context. The
+ * default is Ed25519 in a group and none for unicast, where the
+ * authenticated encryption already identifies the peer. er-coap.h
+ * includes this file to make room for the signature in its buffers.
+ */
+#define OSCOAP_SIGN_NONE    0
+#define OSCOAP_SIGN_FIXED   1
+#define OSCOAP_SIGN_ED25519 2
+
+#ifdef OSCOAP_CONF_SIGN
+#define OSCOAP_SIGN OSCOAP_CONF_SIGN
+#elif OSCOAP_ROLE == OSCOAP_ROLE_UNICAST
+#define OSCOAP_SIGN OSCOAP_SIGN_NONE
+#else
+#define OSCOAP_SIGN OSCOAP_SIGN_ED25519
+#endif
+
+#include "edsign.h"
 #include <sys/types.h>
 
 
@@ -54,24 +95,29 @@ struct OSCOAP_SENDER_CONTEXT
   uint8_t   SENDER_IV[CONTEXT_INIT_VECT_LEN];
   uint8_t   SENDER_ID[ID_LEN]; 
   uint32_t  SENDER_SEQ;
+  struct edsign_secret_key SENDER_SIGN_KEY; //expanded once when the keys are derived
 };
 
 struct OSCOAP_RECIPIENT_CONTEXT
 {
   OSCOAP_RECIPIENT_CONTEXT* RECIPIENT_CONTEXT; //This field facilitates easy integration of OSCOAP multicast
+  OSCOAP_RECIPIENT_CONTEXT* NEXT_HASH; //next recipient in the same hash bucket
+  OSCOAP_COMMON_CONTEXT* COMMON_CONTEXT;
   uint8_t   RECIPIENT_KEY[CONTEXT_KEY_LEN];
   uint8_t   RECIPIENT_IV[CONTEXT_INIT_VECT_LEN];
   uint8_t   RECIPIENT_ID[ID_LEN];
-  uint32_t  RECIPIENT_SEQ;
-  uint8_t   REPLAY_WINDOW;
+  uint32_t  RECIPIENT_SEQ; //highest sequence number received
+  uint64_t  REPLAY_WINDOW; //bit n is set if RECIPIENT_SEQ - n was received
+  struct edsign_public_key RECIPIENT_SIGN_KEY; //decompressed public key of the sender
 };
 
 struct OSCOAP_COMMON_CONTEXT{
   uint8_t CONTEXT_ID[CONTEXT_ID_LEN];
   uint8_t BASE_KEY[BASE_KEY_LEN]; 
   OSCOAP_SENDER_CONTEXT* SENDER_CONTEXT;
-  OSCOAP_RECIPIENT_CONTEXT* RECIPIENT_CONTEXT;
+  OSCOAP_RECIPIENT_CONTEXT* RECIPIENT_CONTEXT; //first of the recipients, one per sender in the group
   OSCOAP_COMMON_CONTEXT* NEXT_CONTEXT;
+  OSCOAP_COMMON_CONTEXT* NEXT_HASH;
   uint8_t ALG;
 };
 
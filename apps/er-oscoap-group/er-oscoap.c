@@ -0,0 +1,1621 @@
+/*
+	 Copyright (c) 2016, SICS
+	 All rights reserved.
+
+	 Redistribution and use in source and binary forms, with or without modification, are permitted provided that the 
+	 following conditions are met:
+
+	 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the 
+	 following disclaimer.
+
+	 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the 
+	 following disclaimer in the documentation and/or other materials provided with the distribution.
+
+	 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote 
+	 products derived from this software without specific prior written permission.
+
+	 THIS SOFTWARE IS PROVInED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+	 INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+	 DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+	 SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	 SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+	 WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	 USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *      A trial implementation of OSCOAP. Based on er-coap by Matthias Kovatsch <kovatsch@inf.ethz.ch>
+ * \author
+ *      Martin Gunnarsson martin.gunnarsson@sics.se and Joakim Brorsson b.joakim@gmail.com
+ */
+#include "er-oscoap.h"
+#include "er-oscoap-int.h"
+
+#include "er-coap.h"
+#include "dev/watchdog.h"
+#include <stdbool.h>
+
+#include "opt-cose.h"
+#include "opt-cbor.h"
+#include "lib/memb.h"
+#include <inttypes.h>
+#include "sha.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "edsign.h"
+#if OSCOAP_CTX_CFS
+#include "cfs/cfs.h"
+#endif
+#include "er-coap-engine.h"
+#include "sys/ctimer.h"
+#if OSCOAP_ROLE == OSCOAP_ROLE_GROUP_RECEIVER
+#include "net/ipv6/multicast/uip-mcast6.h"
+#endif
+
+#ifdef OSCOAP_CONF_DEBUG
+#define DEBUG OSCOAP_CONF_DEBUG
+#else
+#define DEBUG 1
+#endif
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#define PRINTF_HEX(data, len)  oscoap_printf_hex(data, len)
+#define PRINTF_CHAR(data, len)   oscoap_printf(data, len)
+#define PRINTF_BIN(data, len)  oscoap_printf_bin(data, len)
+
+#else /* DEBUG */
+#define PRINTF(...)
+#define PRINTF_HEX(data, len)
+#define PRINTF_CHAR(data, len)
+#define PRINTF_BIN(data, len)
+#endif /* OSCOAP_DEBUG */
+#define PRINT6ADDR(addr) PRINTF("[%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x]", ((uint8_t *)addr)[0], ((uint8_t *)addr)[1], ((uint8_t *)addr)[2], ((uint8_t *)addr)[3], ((uint8_t *)addr)[4], ((uint8_t *)addr)[5], ((uint8_t *)addr)[6], ((uint8_t *)addr)[7], ((uint8_t *)addr)[8], ((uint8_t *)addr)[9], ((uint8_t *)addr)[10], ((uint8_t *)addr)[11], ((uint8_t *)addr)[12], ((uint8_t *)addr)[13], ((uint8_t *)addr)[14], ((uint8_t *)addr)[15])
+
+#define MESSAGE (const unsigned char *) "test"
+#define MESSAGE_LEN 4
+
+OSCOAP_COMMON_CONTEXT *common_context_store = NULL;
+
+/* Lookup tables for the contexts, by context ID, and for the recipient
+ * contexts, by context ID and sender ID. The entries are chained through
+ * their NEXT_HASH fields. */
+static OSCOAP_COMMON_CONTEXT *common_index[OSCOAP_CTX_HASH_SIZE];
+static OSCOAP_RECIPIENT_CONTEXT *recipient_index[OSCOAP_CTX_HASH_SIZE];
+
+MEMB(common_contexts, OSCOAP_COMMON_CONTEXT, CONTEXT_NUM);
+MEMB(sender_contexts, OSCOAP_SENDER_CONTEXT, CONTEXT_NUM);
+MEMB(recipient_contexts, OSCOAP_RECIPIENT_CONTEXT, RECIPIENT_NUM);
+
+#if OSCOAP_ROLE != OSCOAP_ROLE_UNICAST
+/* The own sender ID. The keys of every sender in the group, this one
+ * and those heard from, are derived from the group master secret and
+ * the ID of the sender.
+ */
+#if OSCOAP_ROLE == OSCOAP_ROLE_GROUP_SENDER
+#define OWN_ID        0xAA
+#else
+#define OWN_ID        0xAB
+#endif
+
+static const uint8_t master_secret[CONTEXT_KEY_LEN] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03};
+#endif /* OSCOAP_ROLE != OSCOAP_ROLE_UNICAST */
+
+/* ED25519 signature algorithm, one test key pair for the whole group */
+uint8_t private_key[32];  
+uint8_t public_key[32] = {
+	0x3b, 0x6a, 0x27, 0xbc, 0xce, 0xb6, 0xa4, 0x2d, 0x62, 0xa3,
+	0xa8, 0xd0, 0x2a, 0x6f, 0x0d, 0x73, 0x65, 0x32, 0x15, 0x77,
+	0x1d, 0xe2, 0x43, 0xa6, 0x3c, 0xa0, 0x48, 0xa1, 0x8b, 0x59, 0xda, 0x29};
+
+#if OSCOAP_SIGN == OSCOAP_SIGN_FIXED
+/* sent as is and never verified, for measuring the cost of the bytes alone */
+static uint8_t signature_fix[64] = {
+	0x08, 0xc4, 0x3b, 0x27, 0xf8, 0x4f, 0xd0, 0xc1, 0x37, 0x04, 
+	0x17, 0xa3, 0x16, 0xbe, 0xfa, 0x16, 0xbd, 0xc5, 0xc1, 0x1a, 
+	0x92, 0x60, 0x99, 0xaf, 0x26, 0xcf, 0x05, 0x72, 0x67, 0x54, 
+	0x2b, 0xa7, 0xf2, 0x63, 0x58, 0xe1, 0x20, 0x95, 0x8c, 0x20, 
+	0x19, 0x8c, 0x60, 0x54, 0x9d, 0x68, 0x6f, 0xc7, 0x60, 0xf7, 
+	0x8b, 0xda, 0xe3, 0x0c, 0xaa, 0x25, 0x17, 0xc0, 0x75, 0x48, 
+	0xf6, 0xd0, 0x3e, 0x0d,
+};
+#endif
+
+#if OSCOAP_ROLE == OSCOAP_ROLE_GROUP_RECEIVER
+static uip_ds6_maddr_t *
+join_mcast_group(void)
+{
+  uip_ipaddr_t addr;
+  uip_ds6_maddr_t *rv;
+
+  /* First, set our v6 global */
+  uip_ip6addr(&addr, UIP_DS6_DEFAULT_PREFIX, 0, 0, 0, 0, 0, 0, 0);
+  uip_ds6_set_addr_iid(&addr, &uip_lladdr);
+  uip_ds6_addr_add(&addr, 0, ADDR_AUTOCONF);
+
+  /*
+   * IPHC will use stateless multicast compression for this destination
+   * (M=1, DAC=0), with 32 inline bits (1E 89 AB CD)
+   */
+  uip_ip6addr(&addr, 0xFF1E,0,0,0,0,0,0x89,0xABCD);
+  rv = uip_ds6_maddr_add(&addr);
+
+  if(rv) {
+    PRINTF("Joined multicast group ");
+    PRINT6ADDR(&uip_ds6_maddr_lookup(&addr)->ipaddr);
+    PRINTF("\n");
+  }
+  return rv;
+}
+#endif /* OSCOAP_ROLE == OSCOAP_ROLE_GROUP_RECEIVER */
+
+void oscoap_ctx_store_init(){
+
+	memb_init(&common_contexts);
+	memb_init(&sender_contexts);
+	memb_init(&recipient_contexts);
+	memset(common_index, 0, sizeof(common_index));
+	memset(recipient_index, 0, sizeof(recipient_index));
+	common_context_store = NULL;
+
+#if OSCOAP_ROLE == OSCOAP_ROLE_GROUP_RECEIVER
+	if(join_mcast_group() == NULL){
+		PRINTF("Failed to join multicast group\n");
+	}
+#endif
+}
+
+/* Multicaster */
+#if OSCOAP_CTX_CFS
+/* Derived keys are stored as fixed size records, one file for the
+ * senders and one for the recipients, and found by context ID, sender
+ * or recipient ID and a digest of the master secret, salt and signature
+ * key they were derived from. Records of an earlier secret are skipped,
+ * so a re-key derives and appends new ones.
+ */
+#define CTX_FILE_SENDER    "oscoap.snd"
+#define CTX_FILE_RECIPIENT "oscoap.rcp"
+#define CTX_DIGEST_LEN     8
+
+struct ctx_record {
+  uint8_t context_id[CONTEXT_ID_LEN];
+  uint8_t id[ID_LEN];
+  uint8_t digest[CTX_DIGEST_LEN];
+  uint8_t key[CONTEXT_KEY_LEN];
+  uint8_t iv[CONTEXT_INIT_VECT_LEN];
+  union {
+    struct edsign_secret_key secret;
+    struct edsign_public_key pub;
+  } sign;
+};
+
+static void ctx_digest(uint8_t *digest, const uint8_t *secret,
+                       const uint8_t *salt, size_t salt_len,
+                       const uint8_t *sign_key){
+  SHA256Context sha;
+  uint8_t hash[SHA256HashSize];
+
+  SHA256Reset(&sha);
+  SHA256Input(&sha, secret, CONTEXT_KEY_LEN);
+  SHA256Input(&sha, salt, salt_len);
+  SHA256Input(&sha, sign_key, 32);
+  SHA256Result(&sha, hash);
+  memcpy(digest, hash, CTX_DIGEST_LEN);
+}
+
+static int ctx_load(const char *file, const uint8_t *cid, const uint8_t *id,
+                    const uint8_t *digest, struct ctx_record *record){
+  int fd, found = 0;
+
+  fd = cfs_open(file, CFS_READ);
+  if(fd < 0){
+    return 0;
+  }
+  while(cfs_read(fd, record, sizeof(*record)) == sizeof(*record)){
+    if(memcmp(record->context_id, cid, CONTEXT_ID_LEN) == 0 &&
+       memcmp(record->id, id, ID_LEN) == 0 &&
+       memcmp(record->digest, digest, CTX_DIGEST_LEN) == 0){
+      found = 1;
+      break;
+    }
+  }
+  cfs_close(fd);
+  return found;
+}
+
+static void ctx_save(const char *file, const struct ctx_record *record){
+  int fd;
+
+  fd = cfs_open(file, CFS_WRITE | CFS_APPEND);
+  if(fd < 0){
+    PRINTF("Could not open %s\n", file);
+    return;
+  }
+  if(cfs_write(fd, record, sizeof(*record)) != sizeof(*record)){
+    PRINTF("Could not store context in %s\n", file);
+  }
+  cfs_close(fd);
+}
+
+static int ctx_load_sender(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t *digest){
+  OSCOAP_SENDER_CONTEXT *sender_ctx = ctx->SENDER_CONTEXT;
+  struct ctx_record record;
+
+  if(!ctx_load(CTX_FILE_SENDER, ctx->CONTEXT_ID, sender_ctx->SENDER_ID, digest, &record)){
+    return 0;
+  }
+  memcpy(sender_ctx->SENDER_KEY, record.key, CONTEXT_KEY_LEN);
+  memcpy(sender_ctx->SENDER_IV, record.iv, CONTEXT_INIT_VECT_LEN);
+  memcpy(&sender_ctx->SENDER_SIGN_KEY, &record.sign.secret, sizeof(record.sign.secret));
+  return 1;
+}
+
+static void ctx_save_sender(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t *digest){
+  OSCOAP_SENDER_CONTEXT *sender_ctx = ctx->SENDER_CONTEXT;
+  struct ctx_record record;
+
+  memcpy(record.context_id, ctx->CONTEXT_ID, CONTEXT_ID_LEN);
+  memcpy(record.id, sender_ctx->SENDER_ID, ID_LEN);
+  memcpy(record.digest, digest, CTX_DIGEST_LEN);
+  memcpy(record.key, sender_ctx->SENDER_KEY, CONTEXT_KEY_LEN);
+  memcpy(record.iv, sender_ctx->SENDER_IV, CONTEXT_INIT_VECT_LEN);
+  memcpy(&record.sign.secret, &sender_ctx->SENDER_SIGN_KEY, sizeof(record.sign.secret));
+  ctx_save(CTX_FILE_SENDER, &record);
+}
+
+static int ctx_load_recipient(OSCOAP_RECIPIENT_CONTEXT *recipient_ctx, const uint8_t *digest){
+  struct ctx_record record;
+
+  if(!ctx_load(CTX_FILE_RECIPIENT, recipient_ctx->COMMON_CONTEXT->CONTEXT_ID,
+               recipient_ctx->RECIPIENT_ID, digest, &record)){
+    return 0;
+  }
+  memcpy(recipient_ctx->RECIPIENT_KEY, record.key, CONTEXT_KEY_LEN);
+  memcpy(recipient_ctx->RECIPIENT_IV, record.iv, CONTEXT_INIT_VECT_LEN);
+  memcpy(&recipient_ctx->RECIPIENT_SIGN_KEY, &record.sign.pub, sizeof(record.sign.pub));
+  return 1;
+}
+
+static void ctx_save_recipient(OSCOAP_RECIPIENT_CONTEXT *recipient_ctx, const uint8_t *digest){
+  struct ctx_record record;
+
+  memcpy(record.context_id, recipient_ctx->COMMON_CONTEXT->CONTEXT_ID, CONTEXT_ID_LEN);
+  memcpy(record.id, recipient_ctx->RECIPIENT_ID, ID_LEN);
+  memcpy(record.digest, digest, CTX_DIGEST_LEN);
+  memcpy(record.key, recipient_ctx->RECIPIENT_KEY, CONTEXT_KEY_LEN);
+  memcpy(record.iv, recipient_ctx->RECIPIENT_IV, CONTEXT_INIT_VECT_LEN);
+  memcpy(&record.sign.pub, &recipient_ctx->RECIPIENT_SIGN_KEY, sizeof(record.sign.pub));
+  ctx_save(CTX_FILE_RECIPIENT, &record);
+}
+#endif /* OSCOAP_CTX_CFS */
+
+#if OSCOAP_ROLE != OSCOAP_ROLE_UNICAST
+/* Derive the key or IV of the sender id in the context cid, with the
+ * sender ID, context ID and "Key" or "IV" as the HKDF info. There is no
+ * salt.
+ */
+static void derive(const uint8_t *cid, const uint8_t *id, const char *type,
+                   uint8_t *out, size_t out_len){
+  unsigned char info[ID_LEN + CONTEXT_ID_LEN + 3];
+  size_t type_len = strlen(type);
+
+  memcpy(info, id, ID_LEN);
+  memcpy(info + ID_LEN, cid, CONTEXT_ID_LEN);
+  memcpy(info + ID_LEN + CONTEXT_ID_LEN, type, type_len);
+  hkdf(SHA256, NULL, 0, master_secret, CONTEXT_KEY_LEN,
+       info, ID_LEN + CONTEXT_ID_LEN + type_len, out, out_len);
+}
+
+void oscoap_set_ctx(void) {
+  OSCOAP_SENDER_CONTEXT *sender_ctx = common_context_store->SENDER_CONTEXT;
+#if OSCOAP_CTX_CFS
+  uint8_t digest[CTX_DIGEST_LEN];
+#endif
+
+  sender_ctx->SENDER_SEQ = 0;
+  memset(sender_ctx->SENDER_ID, OWN_ID, ID_LEN);
+#if OSCOAP_CTX_CFS
+  ctx_digest(digest, master_secret, NULL, 0, private_key);
+  if(ctx_load_sender(common_context_store, digest)){
+    return;
+  }
+#endif
+
+  derive(common_context_store->CONTEXT_ID, sender_ctx->SENDER_ID, "Key", sender_ctx->SENDER_KEY, CONTEXT_KEY_LEN);
+  derive(common_context_store->CONTEXT_ID, sender_ctx->SENDER_ID, "IV", sender_ctx->SENDER_IV, CONTEXT_INIT_VECT_LEN);
+  PRINTF(">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n");
+  PRINTF_HEX(sender_ctx->SENDER_KEY, CONTEXT_KEY_LEN);
+  PRINTF_HEX(sender_ctx->SENDER_IV, CONTEXT_INIT_VECT_LEN);
+
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+  /* the secret scalar and public key are expanded once, not per signature */
+  edsign_prepare_secret(&sender_ctx->SENDER_SIGN_KEY, private_key);
+#endif
+#if OSCOAP_CTX_CFS
+  ctx_save_sender(common_context_store, digest);
+#endif
+}
+
+OSCOAP_RECIPIENT_CONTEXT* oscoap_derive_recipient_ctx(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t* rid){
+  OSCOAP_RECIPIENT_CONTEXT* recipient_ctx;
+#if OSCOAP_CTX_CFS
+  uint8_t digest[CTX_DIGEST_LEN];
+#endif
+
+  /* the keys of a known recipient are derived already, and it keeps
+   * its replay window */
+  recipient_ctx = oscoap_find_recipient_ctx(ctx->CONTEXT_ID, rid);
+  if(recipient_ctx != NULL){
+    return recipient_ctx;
+  }
+  recipient_ctx = oscoap_new_recipient_ctx(ctx, rid);
+  if(recipient_ctx == NULL){
+    PRINTF("No free recipient context\n");
+    return NULL;
+  }
+#if OSCOAP_CTX_CFS
+  ctx_digest(digest, master_secret, NULL, 0, public_key);
+  if(ctx_load_recipient(recipient_ctx, digest)){
+    return recipient_ctx;
+  }
+#endif
+  derive(ctx->CONTEXT_ID, rid, "Key", recipient_ctx->RECIPIENT_KEY, CONTEXT_KEY_LEN);
+  derive(ctx->CONTEXT_ID, rid, "IV", recipient_ctx->RECIPIENT_IV, CONTEXT_INIT_VECT_LEN);
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+  edsign_prepare_public(&recipient_ctx->RECIPIENT_SIGN_KEY, public_key);
+#endif
+#if OSCOAP_CTX_CFS
+  ctx_save_recipient(recipient_ctx, digest);
+#endif
+
+  PRINTF("set context<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n");
+  PRINTF_HEX(recipient_ctx->RECIPIENT_KEY, CONTEXT_KEY_LEN);
+  PRINTF_HEX(recipient_ctx->RECIPIENT_IV, CONTEXT_INIT_VECT_LEN);
+  return recipient_ctx;
+}
+#endif /* OSCOAP_ROLE != OSCOAP_ROLE_UNICAST */
+
+static uint8_t ctx_hash(const uint8_t* cid, const uint8_t* rid){
+	uint8_t hash = 0;
+	int i;
+
+	for(i = 0; i < CONTEXT_ID_LEN; i++){
+		hash = hash * 31 + cid[i];
+	}
+	if(rid != NULL){
+		for(i = 0; i < ID_LEN; i++){
+			hash = hash * 31 + rid[i];
+		}
+	}
+	return hash & (OSCOAP_CTX_HASH_SIZE - 1);
+}
+
+static OSCOAP_COMMON_CONTEXT* new_ctx(const uint8_t* cid){
+
+	uint8_t hash;
+	OSCOAP_COMMON_CONTEXT* common_ctx = memb_alloc(&common_contexts);
+	if(common_ctx == NULL) return 0;
+
+	OSCOAP_SENDER_CONTEXT* sender_ctx = memb_alloc(&sender_contexts);
+	if(sender_ctx == NULL){
+		memb_free(&common_contexts, common_ctx);
+		return 0;
+	}
+
+	common_ctx->ALG = COSE_Algorithm_AES_CCM_64_64_128;
+	memcpy(common_ctx->CONTEXT_ID, cid, CONTEXT_ID_LEN);
+	common_ctx->RECIPIENT_CONTEXT = NULL;
+	common_ctx->SENDER_CONTEXT = sender_ctx;
+
+	common_ctx->NEXT_CONTEXT = common_context_store;
+	common_context_store = common_ctx;
+
+	hash = ctx_hash(cid, NULL);
+	common_ctx->NEXT_HASH = common_index[hash];
+	common_index[hash] = common_ctx;
+
+	return common_ctx;
+}
+
+/* The group context, the sender and recipient keys are derived by
+ * oscoap_set_ctx() */
+OSCOAP_COMMON_CONTEXT* oscoap_new_ctx(void){
+	static const uint8_t cid[CONTEXT_ID_LEN] = { 0, 0, 0, 0, 0, 0, 0, 0x02};
+
+	return new_ctx(cid);
+}
+
+/* A context shared with one peer, which sends with the ID rid, using the
+ * keys and IVs given */
+OSCOAP_COMMON_CONTEXT* oscoap_new_unicast_ctx(const uint8_t* cid, const uint8_t* sid, const uint8_t* rid,
+                                              const uint8_t* sender_key, const uint8_t* sender_iv,
+                                              const uint8_t* recipient_key, const uint8_t* recipient_iv){
+	OSCOAP_COMMON_CONTEXT* common_ctx;
+	OSCOAP_RECIPIENT_CONTEXT* recipient_ctx;
+
+	common_ctx = new_ctx(cid);
+	if(common_ctx == NULL){
+		return NULL;
+	}
+	recipient_ctx = oscoap_new_recipient_ctx(common_ctx, rid);
+	if(recipient_ctx == NULL){
+		oscoap_free_ctx(common_ctx);
+		return NULL;
+	}
+
+	common_ctx->SENDER_CONTEXT->SENDER_SEQ = 0;
+	memcpy(common_ctx->SENDER_CONTEXT->SENDER_ID, sid, ID_LEN);
+	memcpy(common_ctx->SENDER_CONTEXT->SENDER_KEY, sender_key, CONTEXT_KEY_LEN);
+	memcpy(common_ctx->SENDER_CONTEXT->SENDER_IV, sender_iv, CONTEXT_INIT_VECT_LEN);
+	memcpy(recipient_ctx->RECIPIENT_KEY, recipient_key, CONTEXT_KEY_LEN);
+	memcpy(recipient_ctx->RECIPIENT_IV, recipient_iv, CONTEXT_INIT_VECT_LEN);
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+	edsign_prepare_secret(&common_ctx->SENDER_CONTEXT->SENDER_SIGN_KEY, private_key);
+	edsign_prepare_public(&recipient_ctx->RECIPIENT_SIGN_KEY, public_key);
+#endif
+
+	return common_ctx;
+}
+
+OSCOAP_COMMON_CONTEXT* oscoap_find_ctx_by_cid(uint8_t* cid){
+	OSCOAP_COMMON_CONTEXT *ctx_ptr = common_index[ctx_hash(cid, NULL)];
+
+	while(ctx_ptr != NULL && memcmp(ctx_ptr->CONTEXT_ID, cid, CONTEXT_ID_LEN) != 0){
+		ctx_ptr = ctx_ptr->NEXT_HASH;
+	}
+	return ctx_ptr;
+}
+
+/* Add a recipient context for the sender rid to the group context ctx.
+ * The caller sets the key and IV. */
+OSCOAP_RECIPIENT_CONTEXT* oscoap_new_recipient_ctx(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t* rid){
+	uint8_t hash;
+	OSCOAP_RECIPIENT_CONTEXT* recipient_ctx = memb_alloc(&recipient_contexts);
+	if(recipient_ctx == NULL) return NULL;
+
+	memcpy(recipient_ctx->RECIPIENT_ID, rid, ID_LEN);
+	recipient_ctx->RECIPIENT_SEQ = 0;
+	recipient_ctx->REPLAY_WINDOW = 0;
+	recipient_ctx->COMMON_CONTEXT = ctx;
+
+	recipient_ctx->RECIPIENT_CONTEXT = ctx->RECIPIENT_CONTEXT;
+	ctx->RECIPIENT_CONTEXT = recipient_ctx;
+
+	hash = ctx_hash(ctx->CONTEXT_ID, rid);
+	recipient_ctx->NEXT_HASH = recipient_index[hash];
+	recipient_index[hash] = recipient_ctx;
+
+	return recipient_ctx;
+}
+
+OSCOAP_RECIPIENT_CONTEXT* oscoap_find_recipient_ctx(const uint8_t* cid, const uint8_t* rid){
+	OSCOAP_RECIPIENT_CONTEXT *ptr = recipient_index[ctx_hash(cid, rid)];
+
+	while(ptr != NULL){
+		if(memcmp(ptr->RECIPIENT_ID, rid, ID_LEN) == 0 &&
+       memcmp(ptr->COMMON_CONTEXT->CONTEXT_ID, cid, CONTEXT_ID_LEN) == 0){
+			return ptr;
+		}
+		ptr = ptr->NEXT_HASH;
+	}
+	return NULL;
+}
+
+int oscoap_free_ctx(OSCOAP_COMMON_CONTEXT *ctx){
+	OSCOAP_COMMON_CONTEXT **common_ptr;
+	OSCOAP_RECIPIENT_CONTEXT **recipient_ptr;
+	OSCOAP_RECIPIENT_CONTEXT *recipient_ctx;
+
+	if(common_context_store == ctx){
+		common_context_store = ctx->NEXT_CONTEXT;
+
+	}else{
+
+		OSCOAP_COMMON_CONTEXT *ctx_ptr = common_context_store;
+
+		while(ctx_ptr->NEXT_CONTEXT != ctx){
+			ctx_ptr = ctx_ptr->NEXT_CONTEXT;
+		}
+
+		if(ctx_ptr->NEXT_CONTEXT->NEXT_CONTEXT != NULL){
+			ctx_ptr->NEXT_CONTEXT = ctx_ptr->NEXT_CONTEXT->NEXT_CONTEXT;
+		}else{
+			ctx_ptr->NEXT_CONTEXT = NULL;
+		}
+	}
+
+	common_ptr = &common_index[ctx_hash(ctx->CONTEXT_ID, NULL)];
+	while(*common_ptr != ctx){
+		common_ptr = &(*common_ptr)->NEXT_HASH;
+	}
+  *common_ptr = ctx->NEXT_HASH;
+
+	memset(ctx->BASE_KEY, 0x00, BASE_KEY_LEN);
+	memset(ctx->SENDER_CONTEXT->SENDER_KEY, 0x00, CONTEXT_KEY_LEN);
+	memset(ctx->SENDER_CONTEXT->SENDER_IV, 0x00, CONTEXT_INIT_VECT_LEN);
+
+	int ret = 0;
+	while(ctx->RECIPIENT_CONTEXT != NULL){
+		recipient_ctx = ctx->RECIPIENT_CONTEXT;
+		ctx->RECIPIENT_CONTEXT = recipient_ctx->RECIPIENT_CONTEXT;
+
+		recipient_ptr = &recipient_index[ctx_hash(ctx->CONTEXT_ID, recipient_ctx->RECIPIENT_ID)];
+		while(*recipient_ptr != recipient_ctx){
+			recipient_ptr = &(*recipient_ptr)->NEXT_HASH;
+		}
+    *recipient_ptr = recipient_ctx->NEXT_HASH;
+
+		memset(recipient_ctx->RECIPIENT_KEY, 0x00, CONTEXT_KEY_LEN);
+		memset(recipient_ctx->RECIPIENT_IV, 0x00, CONTEXT_INIT_VECT_LEN);
+		ret += memb_free(&recipient_contexts, recipient_ctx);
+	}
+	ret += memb_free(&sender_contexts, ctx->SENDER_CONTEXT);
+	ret += memb_free(&common_contexts, ctx);
+
+	return ret;
+}
+
+
+
+void parse_int(uint32_t in, uint8_t* bytes, int out_len){ 
+	int x = out_len - 1;
+	while(x >= 0){
+		bytes[x] = in & 0xFF;
+		in >>= 8;
+		x--;
+	}
+}
+
+/* Big endian, in as few bytes as possible */
+uint8_t to_bytes(uint32_t in, uint8_t* buffer){
+	uint8_t outlen = 1;
+	while(outlen < CONTEXT_SEQ_LEN && (in >> (outlen * 8)) != 0){
+		outlen++;
+	}
+	parse_int(in, buffer, outlen);
+	return outlen;
+}
+
+uint8_t coap_is_request(coap_packet_t* coap_pkt){
+	if(coap_pkt->code >= COAP_GET && coap_pkt->code <= COAP_DELETE){ 
+		return 1;
+	} else {
+		return 0;
+	}
+}
+
+/* Array, version, code and algorithm, and the head of the Tid or URI */
+#define OSCOAP_EXTERNAL_AAD_HEAD_LEN 8
+
+/*
+   Note that the Tid is the 3-tuple (Cid, Sender ID,
+   Sender Sequence Number) for the endpoint sending the request
+   and verifying the response; which means that for the endpoint
+   sending the response, the Tid has value (Cid, Recipient ID, seq),
+   where seq is the value of the "Partial IV" in the COSE
+   object of the request (see Section 5);
+
+   The external AAD is handed to COSE in pieces. Its CBOR heads are put
+   in head, OSCOAP_EXTERNAL_AAD_HEAD_LEN bytes, and the Tid and the URI
+   are referenced where they are instead of being copied together.
+ */
+static uint8_t oscoap_external_aad_head(coap_packet_t* coap_pkt, uint8_t* head){
+	uint8_t *buffer = head;
+	OPT_CBOR_put_array(&buffer, 4); //TODO make check for mac-previous-block
+	OPT_CBOR_put_unsigned(&buffer, 1); //version is always 1
+	OPT_CBOR_put_bytes(&buffer, 1, &(coap_pkt->code)); //COAP code is one byte
+	OPT_CBOR_put_bytes(&buffer, 1, &(coap_pkt->context->ALG));
+	return buffer - head;
+}
+
+void oscoap_set_response_external_aad(coap_packet_t* coap_pkt, opt_cose_encrypt_t *cose, uint8_t* head){
+	/* the sender ID and partial IV of the COSE object are those of the
+     endpoint that sent the message, in both directions */
+	uint8_t tid_len = CONTEXT_ID_LEN + ID_LEN + cose->partial_iv_len;
+	uint8_t len = oscoap_external_aad_head(coap_pkt, head);
+
+	if(tid_len > 15){
+		head[len++] = 0x58;
+		head[len++] = tid_len;
+	} else {
+		head[len++] = 0x40 | tid_len;
+	}
+	OPT_COSE_SetExternalAAD(cose, head, len);
+	OPT_COSE_AddExternalAAD(cose, coap_pkt->context->CONTEXT_ID, CONTEXT_ID_LEN); //context ID
+	OPT_COSE_AddExternalAAD(cose, cose->sid, ID_LEN); //Sender ID
+	OPT_COSE_AddExternalAAD(cose, cose->partial_iv, cose->partial_iv_len);
+}
+
+
+
+
+size_t oscoap_prepare_unencrypted_uri(coap_packet_t* coap_pkt, uint8_t* buffer, uint8_t sender){
+	size_t ret = strlen("coap://");
+	sprintf((char*)buffer, "coap://");
+
+	if(IS_OPTION(coap_pkt, COAP_OPTION_URI_HOST)){
+		//coap_get_header_uri_host
+		//build string and concatinate7
+		printf("THIS IS UNECSPECTED\n");
+	}else{
+		char ip[42];
+		if(sender){
+			uint8_t* addr = coap_pkt->ipaddr;
+			sprintf(ip, "[%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x]", ((uint8_t *)addr)[0], ((uint8_t *)addr)[1], ((uint8_t *)addr)[2], ((uint8_t *)addr)[3], ((uint8_t *)addr)[4], ((uint8_t *)addr)[5], ((uint8_t *)addr)[6], ((uint8_t *)addr)[7], ((uint8_t *)addr)[8], ((uint8_t *)addr)[9], ((uint8_t *)addr)[10], ((uint8_t *)addr)[11], ((uint8_t *)addr)[12], ((uint8_t *)addr)[13], ((uint8_t *)addr)[14], ((uint8_t *)addr)[15]);
+			strcat((char*)buffer, ip);
+			ret += strlen(ip);
+		} else {
+			uint8_t* addr;
+#if OSCOAP_ROLE == OSCOAP_ROLE_GROUP_RECEIVER
+			/* requests to the group are addressed to the group */
+			uip_ipaddr_t ipaddr;
+			uip_ds6_maddr_t *maddr;
+			uip_ip6addr(&ipaddr, 0xFF1E,0,0,0,0,0,0x89,0xABCD);
+			maddr = uip_ds6_maddr_lookup(&ipaddr);
+			addr = maddr != NULL ? (uint8_t*)&maddr->ipaddr : (uint8_t*)&ipaddr;
+#else
+			uip_ds6_addr_t *lladdr;
+			lladdr = uip_ds6_get_link_local(-1);
+			addr = (uint8_t*)&(lladdr->ipaddr);
+#endif
+
+			sprintf(ip, "[%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x:%02x%02x]", ((uint8_t *)addr)[0], ((uint8_t *)addr)[1], ((uint8_t *)addr)[2], ((uint8_t *)addr)[3], ((uint8_t *)addr)[4], ((uint8_t *)addr)[5], ((uint8_t *)addr)[6], ((uint8_t *)addr)[7], ((uint8_t *)addr)[8], ((uint8_t *)addr)[9], ((uint8_t *)addr)[10], ((uint8_t *)addr)[11], ((uint8_t *)addr)[12], ((uint8_t *)addr)[13], ((uint8_t *)addr)[14], ((uint8_t *)addr)[15]);
+			strcat((char*)buffer, ip);
+			ret += strlen(ip);
+		}
+	}
+
+	if(IS_OPTION(coap_pkt, COAP_OPTION_URI_PORT)){
+		if(coap_pkt->uri_port != UIP_HTONS(COAP_DEFAULT_PORT)){
+			//printf port
+		}
+	}
+	strcat((char*)buffer,"/");
+	ret += 1 ;
+	return ret;
+
+}
+
+void oscoap_set_request_external_aad(coap_packet_t* coap_pkt, opt_cose_encrypt_t *cose, uint8_t* head, uint8_t* uri, uint8_t sender){
+	uint8_t uri_len = oscoap_prepare_unencrypted_uri(coap_pkt, uri, sender);
+	uint8_t len = oscoap_external_aad_head(coap_pkt, head);
+
+	//unencrypted uri
+	if(uri_len > 15){
+		head[len++] = 0x78;
+		head[len++] = uri_len;
+	} else {
+		head[len++] = 0x60 | uri_len;
+	}
+	OPT_COSE_SetExternalAAD(cose, head, len);
+	OPT_COSE_AddExternalAAD(cose, uri, uri_len);
+}
+
+void oscoap_increment_sender_seq(OSCOAP_COMMON_CONTEXT* ctx){
+	ctx->SENDER_CONTEXT->SENDER_SEQ++; 
+	PRINTF("NEW SENDER SEQ %d\n", ctx->SENDER_CONTEXT->SENDER_SEQ);
+	//TODO CHECKS FOR LIMITS
+}
+
+/* The partial IV is the sequence number of the sender, big endian in as
+   few bytes as possible. */
+static uint8_t partial_iv_to_seq(opt_cose_encrypt_t *cose, uint32_t *seq){
+	size_t i;
+
+	if(cose->partial_iv_len == 0 || cose->partial_iv_len > CONTEXT_SEQ_LEN) {
+		return false;
+	}
+  *seq = 0;
+	for(i = 0; i < cose->partial_iv_len; i++){
+    *seq = (*seq << 8) | cose->partial_iv[i];
+	}
+	return true;
+}
+
+/* Check the sequence number against the replay window of the sender. The
+   window is moved by oscoap_update_receiver_seq() once the message has
+   been decrypted, so that forged messages cannot move it. */
+uint8_t oscoap_validate_receiver_seq(OSCOAP_RECIPIENT_CONTEXT* recipient_ctx, opt_cose_encrypt_t *cose){
+	uint32_t seq;
+	uint32_t diff;
+
+	if(!partial_iv_to_seq(cose, &seq)) {
+		PRINTF("NO SEQ FOUND IN COSE\n");
+		return false;
+	}
+
+	PRINTF("ctx->RECEIVER_WRITE_SEQ %" PRIu32 ", cose->seq %" PRIu32 "\n", recipient_ctx->RECIPIENT_SEQ, seq);
+	if(recipient_ctx->REPLAY_WINDOW == 0 || seq > recipient_ctx->RECIPIENT_SEQ){
+		return true;
+	}
+	diff = recipient_ctx->RECIPIENT_SEQ - seq;
+	if(diff >= OSCOAP_REPLAY_WINDOW_SIZE){
+		return false;
+	}
+	return (recipient_ctx->REPLAY_WINDOW & ((uint64_t)1 << diff)) == 0;
+}
+
+void oscoap_update_receiver_seq(OSCOAP_RECIPIENT_CONTEXT* recipient_ctx, opt_cose_encrypt_t *cose){
+	uint32_t seq;
+	uint32_t diff;
+
+	partial_iv_to_seq(cose, &seq);
+	if(recipient_ctx->REPLAY_WINDOW == 0){
+		recipient_ctx->RECIPIENT_SEQ = seq;
+		recipient_ctx->REPLAY_WINDOW = 1;
+	} else if(seq > recipient_ctx->RECIPIENT_SEQ){
+		diff = seq - recipient_ctx->RECIPIENT_SEQ;
+		if(diff >= OSCOAP_REPLAY_WINDOW_SIZE){
+			recipient_ctx->REPLAY_WINDOW = 1;
+		} else {
+			recipient_ctx->REPLAY_WINDOW = (recipient_ctx->REPLAY_WINDOW << diff) | 1;
+		}
+		recipient_ctx->RECIPIENT_SEQ = seq;
+	} else {
+		diff = recipient_ctx->RECIPIENT_SEQ - seq;
+		recipient_ctx->REPLAY_WINDOW |= (uint64_t)1 << diff;
+	}
+}
+
+/* Compose the nonce by XORing the static IV (Client Write IV) with
+	 the Partial IV parameter, received in the COSE Object.   */
+void create_iv(uint8_t* iv, uint8_t* out, uint8_t* seq, int seq_len ){
+	//TODO fix usage of magic numbers and add support for longer seq
+	out[0] = iv[0];
+	out[1] = iv[1];
+	out[2] = iv[2];	
+	out[3] = iv[3];
+	out[4] = iv[4];
+	out[5] = iv[5];
+	out[6] = iv[6];
+	int i = 6;
+	int j = seq_len - 1;
+	while(i > (6-seq_len)){
+		out[i] = out[i] ^ seq[j];
+		j--;
+		i--;
+	}
+
+}
+
+/* Bytes of an outgoing COSE object besides the plaintext: array head,
+   protected header, unprotected map, ciphertext head, tag and signature */
+#define COSE_OVERHEAD (1 + (3 + 2 + CONTEXT_ID_LEN + 2 + ID_LEN + 2 + CONTEXT_SEQ_LEN) + 1 + 2 + 8 + 2 + 64)
+
+/* The outgoing COSE object is laid out here, the plaintext is serialized
+   straight into its ciphertext and encrypted in place */
+static uint8_t cose_buffer[COSE_OVERHEAD + COAP_MAX_PACKET_SIZE];
+
+size_t oscoap_prepare_message(void* packet, uint8_t *buffer){
+
+	PRINTF("PREPARE MESAGE\n");
+
+	static coap_packet_t * coap_pkt;
+	coap_pkt = (coap_packet_t *)packet;
+
+	opt_cose_encrypt_t cose;
+	OPT_COSE_Init(&cose);
+
+	if(coap_pkt->context == NULL){
+		PRINTF("ERROR: NO CONTEXT IN PREPARE MESSAGE!\n");
+		return 0;
+	}
+
+	OPT_COSE_SetAlg(&cose, COSE_Algorithm_AES_CCM_64_64_128);
+
+	oscoap_increment_sender_seq(coap_pkt->context);
+
+	uint8_t seq_buffer[CONTEXT_SEQ_LEN];
+	uint8_t nonce_buffer[CONTEXT_INIT_VECT_LEN];
+
+	uint8_t seq_bytes_len = to_bytes((uint32_t)(coap_pkt->context->SENDER_CONTEXT->SENDER_SEQ), seq_buffer);
+
+	create_iv((uint8_t*)coap_pkt->context->SENDER_CONTEXT->SENDER_IV, nonce_buffer, seq_buffer, seq_bytes_len);
+
+	OPT_COSE_SetPartialIV(&cose, seq_buffer, seq_bytes_len);
+	OPT_COSE_SetNonce(&cose, nonce_buffer, CONTEXT_INIT_VECT_LEN);
+	OPT_COSE_SetKeyID(&cose, coap_pkt->context->CONTEXT_ID, CONTEXT_ID_LEN);
+
+	// Multicasting 
+	OPT_COSE_SetSenderID(&cose, coap_pkt->context->SENDER_CONTEXT->SENDER_ID, ID_LEN);
+
+	if(COSE_OVERHEAD + COAP_MAX_HEADER_SIZE + coap_pkt->payload_len > sizeof(cose_buffer)){
+		PRINTF("ERROR: PAYLOAD TOO LARGE FOR OSCOAP\n");
+		return 0;
+	}
+
+	//Serialize options and payload straight into the ciphertext
+	uint8_t *plaintext = OPT_COSE_Encode_Header(&cose, cose_buffer);
+	size_t plaintext_size = oscoap_prepare_plaintext(packet, plaintext);
+	if(plaintext_size == 0){
+		return 0;
+	}
+	OPT_COSE_SetContent(&cose, plaintext, plaintext_size);
+	OPT_COSE_SetCiphertextBuffer(&cose, plaintext, plaintext_size + 8);
+
+	uint8_t external_aad_head[OSCOAP_EXTERNAL_AAD_HEAD_LEN];
+	uint8_t uri[60];
+	if(coap_is_request(coap_pkt)){
+		PRINTF("we have a request!\n");
+		oscoap_set_request_external_aad(coap_pkt, &cose, external_aad_head, uri, 1);
+	} else {
+		PRINTF("we have a response!\n");
+		oscoap_set_response_external_aad(coap_pkt, &cose, external_aad_head);
+	}
+
+  /* only print encrypted date */ 
+	OPT_COSE_Encrypt(&cose, coap_pkt->context->SENDER_CONTEXT->SENDER_KEY, CONTEXT_KEY_LEN);
+
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+  /* the ciphertext with its tag is signed, so receivers can check the
+   * sender before they decrypt */
+  uint8_t signature[EDSIGN_SIGNATURE_SIZE];
+  edsign_sign_prepared(signature, &coap_pkt->context->SENDER_CONTEXT->SENDER_SIGN_KEY, cose.ciphertext, cose.ciphertext_len);
+  OPT_COSE_SetSign(&cose, signature, EDSIGN_SIGNATURE_SIZE);
+#elif OSCOAP_SIGN == OSCOAP_SIGN_FIXED
+  OPT_COSE_SetSign(&cose, signature_fix, sizeof(signature_fix));
+#endif
+
+	size_t serialized_len = OPT_COSE_Encode_Trailer(&cose, cose_buffer);
+  PRINTF("opt_buffer\n");
+  PRINTF_HEX(cose_buffer, serialized_len);
+
+	uint8_t in_payload = coap_pkt->payload_len > 0;
+	coap_set_header_max_age(packet, 0);
+
+	clear_options(coap_pkt);
+
+	/* buffer holds COAP_MAX_PACKET_SIZE bytes and the serializer does not
+	   bound what it writes: size the outer header alone first, the COSE
+	   object then adds at most an option head or a payload marker */
+	coap_pkt->payload_len = 0;
+	coap_set_header_object_security_content(packet, NULL, 0);
+	size_t header_size = coap_serialize_message_coap(packet, buffer);
+	if(header_size == 0 || header_size + 5 + serialized_len > COAP_MAX_PACKET_SIZE){
+		PRINTF("ERROR: OSCOAP MESSAGE TOO LARGE FOR COAP_MAX_PACKET_SIZE\n");
+		return 0;
+	}
+
+	if(in_payload){
+		coap_set_object_security_payload(coap_pkt, cose_buffer, serialized_len);	
+	}else{
+		coap_set_header_object_security_content(packet, cose_buffer, serialized_len);     
+	}
+
+	size_t serialized_size =  coap_serialize_message_coap(packet, buffer);
+
+	PRINTF("Serialized size = %d\n", serialized_size);
+	PRINTF_HEX(buffer, serialized_size);
+	return serialized_size;
+}
+
+
+/*---------------------------------------------------------------------------*/
+struct oscoap_crypto_stats oscoap_crypto_stats;
+
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+#if OSCOAP_VERIFY_QUEUE
+/* A signed datagram waiting for verification, with the signature and
+ * the signed ciphertext given as offsets into it.
+ */
+struct verify_entry {
+  uip_ipaddr_t addr;
+  uip_ipaddr_t dst;
+  uint16_t port;
+  uint16_t len;
+  uint16_t signature;
+  uint16_t message;
+  uint16_t message_len;
+  clock_time_t queued;
+  struct edsign_public_key key;
+  uint8_t data[COAP_MAX_PACKET_SIZE + 1];
+};
+
+/* A ring, verify_len entries from verify_head */
+static struct verify_entry verify_queue[OSCOAP_VERIFY_QUEUE];
+static uint8_t verify_head;
+static uint8_t verify_len;
+static uint8_t verify_replay;
+
+/* Hand a message with a good signature back to the CoAP engine */
+static void
+verify_done(struct verify_entry *e, uint8_t ok)
+{
+  if(ok) {
+    oscoap_crypto_stats.verified++;
+    verify_replay = 1;
+    coap_receive_datagram(e->data, e->len, &e->addr, e->port, &e->dst);
+    verify_replay = 0;
+  } else {
+    oscoap_crypto_stats.rejected++;
+    PRINTF("Dropping message with bad signature\n");
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* The good and bad signatures of a batch, in queue order */
+static struct edsign_batch verify_batch[OSCOAP_VERIFY_QUEUE];
+
+/* Point the batch at the first n queued messages, and count the time
+ * they waited.
+ */
+static void
+verify_batch_init(int n)
+{
+  struct verify_entry *e;
+  clock_time_t now, t;
+  int i;
+
+  now = clock_time();
+  for(i = 0; i < n; i++) {
+    e = &verify_queue[(verify_head + i) % OSCOAP_VERIFY_QUEUE];
+    t = now - e->queued;
+    oscoap_crypto_stats.wait_total += t;
+    if(t > oscoap_crypto_stats.wait_max) {
+      oscoap_crypto_stats.wait_max = t;
+    }
+    verify_batch[i].signature = e->data + e->signature;
+    verify_batch[i].pub = NULL;
+    verify_batch[i].key = &e->key;
+    verify_batch[i].message = e->data + e->message;
+    verify_batch[i].len = e->message_len;
+  }
+}
+
+/* Hand the first n queued messages on and take them off the queue */
+static void
+verify_batch_done(int n, clock_time_t start)
+{
+  clock_time_t t;
+  int i;
+
+  t = clock_time() - start;
+  oscoap_crypto_stats.busy_total += t;
+  if(t > oscoap_crypto_stats.busy_max) {
+    oscoap_crypto_stats.busy_max = t;
+  }
+  PRINTF("%d signatures verified in %lu ticks\n", n, (unsigned long)t);
+
+  for(i = 0; i < n; i++) {
+    verify_done(&verify_queue[(verify_head + i) % OSCOAP_VERIFY_QUEUE],
+                verify_batch[i].ok);
+  }
+  verify_head = (verify_head + n) % OSCOAP_VERIFY_QUEUE;
+  verify_len -= n;
+}
+/*---------------------------------------------------------------------------*/
+#if OSCOAP_CRYPTO_ASYNC
+PROCESS(oscoap_crypto_process, "OSCOAP crypto");
+
+/* Collect signed messages for up to OSCOAP_VERIFY_WINDOW, then verify
+ * them as one batch, yielding between chunks of the batch. Messages
+ * that come in meanwhile wait for the next batch.
+ */
+PROCESS_THREAD(oscoap_crypto_process, ev, data)
+{
+  static struct edsign_batch_verify bv;
+  static struct etimer window;
+  static clock_time_t start;
+  static int n;
+  clock_time_t t;
+
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_UNTIL(verify_len > 0);
+
+    /* The oldest message opens the window, a full queue closes it */
+    t = clock_time() - verify_queue[verify_head].queued;
+    etimer_set(&window, t < OSCOAP_VERIFY_WINDOW ? OSCOAP_VERIFY_WINDOW - t : 0);
+    PROCESS_WAIT_UNTIL(verify_len == OSCOAP_VERIFY_QUEUE ||
+                       etimer_expired(&window));
+    etimer_stop(&window);
+
+    n = verify_len;
+    verify_batch_init(n);
+    start = clock_time();
+    edsign_verify_batch_start(&bv, verify_batch, n);
+    while(!edsign_verify_batch_step(&bv, OSCOAP_CRYPTO_STEPS)) {
+      PROCESS_PAUSE();
+    }
+    verify_batch_done(n, start);
+  }
+
+  PROCESS_END();
+}
+#else /* OSCOAP_CRYPTO_ASYNC */
+static struct ctimer verify_timer;
+
+/* Verify the queued signatures together, in one go */
+static void
+verify_flush(void *ptr)
+{
+  clock_time_t start;
+  int n;
+
+  n = verify_len;
+  verify_batch_init(n);
+  start = clock_time();
+  edsign_verify_batch(verify_batch, n);
+  verify_batch_done(n, start);
+}
+#endif /* OSCOAP_CRYPTO_ASYNC */
+#endif /* OSCOAP_VERIFY_QUEUE */
+/*---------------------------------------------------------------------------*/
+static coap_status_t
+oscoap_verify_signature(coap_packet_t* coap_pkt, opt_cose_encrypt_t *cose,
+                        const OSCOAP_RECIPIENT_CONTEXT* recipient_ctx)
+{
+  if(cose->signature == NULL || cose->signature_len != EDSIGN_SIGNATURE_SIZE){
+    return OSCOAP_CRYPTO_ERROR;
+  }
+
+#if OSCOAP_VERIFY_QUEUE
+  if(verify_replay){
+    /* already verified */
+    return NO_ERROR;
+  }
+
+#if OSCOAP_CRYPTO_ASYNC
+  if(verify_len == OSCOAP_VERIFY_QUEUE){
+    /* the worker is behind, let the sender retransmit */
+    oscoap_crypto_stats.dropped++;
+    PRINTF("Signed message dropped, queue full\n");
+    return OSCOAP_VERIFY_PENDING;
+  }
+#endif /* OSCOAP_CRYPTO_ASYNC */
+
+  if(verify_len < OSCOAP_VERIFY_QUEUE && coap_pkt->buffer == uip_appdata &&
+     uip_datalen() <= sizeof(verify_queue[0].data)){
+    struct verify_entry *e;
+
+    e = &verify_queue[(verify_head + verify_len++) % OSCOAP_VERIFY_QUEUE];
+    memcpy(e->data, coap_pkt->buffer, uip_datalen());
+    e->len = uip_datalen();
+    uip_ipaddr_copy(&e->addr, &UIP_IP_BUF->srcipaddr);
+    uip_ipaddr_copy(&e->dst, &UIP_IP_BUF->destipaddr);
+    e->port = UIP_UDP_BUF->srcport;
+    e->signature = cose->signature - coap_pkt->buffer;
+    e->message = cose->ciphertext - coap_pkt->buffer;
+    e->message_len = cose->ciphertext_len;
+    e->queued = clock_time();
+    /* copied, the recipient may be gone when the queue is flushed */
+    memcpy(&e->key, &recipient_ctx->RECIPIENT_SIGN_KEY, sizeof(e->key));
+
+#if OSCOAP_CRYPTO_ASYNC
+    if(!process_is_running(&oscoap_crypto_process)){
+      process_start(&oscoap_crypto_process, NULL);
+    }
+    process_poll(&oscoap_crypto_process);
+#else /* OSCOAP_CRYPTO_ASYNC */
+    /* The first message opens the window, a full queue closes it */
+    if(verify_len == 1){
+      ctimer_set(&verify_timer, OSCOAP_VERIFY_WINDOW, verify_flush, NULL);
+    } else if(verify_len == OSCOAP_VERIFY_QUEUE){
+      ctimer_set(&verify_timer, 0, verify_flush, NULL);
+    }
+#endif /* OSCOAP_CRYPTO_ASYNC */
+    PRINTF("Signed message queued (%u)\n", verify_len);
+    return OSCOAP_VERIFY_PENDING;
+  }
+#endif /* OSCOAP_VERIFY_QUEUE */
+
+  if(!edsign_verify_prepared(cose->signature, &recipient_ctx->RECIPIENT_SIGN_KEY, cose->ciphertext, cose->ciphertext_len)){
+    PRINTF("Bad signature\n");
+    return OSCOAP_CRYPTO_ERROR;
+  }
+  return NO_ERROR;
+}
+#endif /* OSCOAP_SIGN == OSCOAP_SIGN_ED25519 */
+/*---------------------------------------------------------------------------*/
+coap_status_t oscoap_decode_packet(coap_packet_t* coap_pkt){
+
+	opt_cose_encrypt_t cose;
+	OPT_COSE_Init(&cose);
+
+	if(coap_pkt->object_security_len == 0){
+
+		PRINTF("DECODE COSE IN PAYLOAD\n");
+
+		PRINTF("serialized incomming COSE\n");
+		PRINTF_HEX(coap_pkt->payload, coap_pkt->payload_len);
+
+    OPT_COSE_Decode(&cose, coap_pkt->payload, coap_pkt->payload_len);
+  }else{
+
+		PRINTF("DECODE COSE IN OPTION\n");
+
+		PRINTF("serialized incomming COSE\n");
+		PRINTF_HEX(coap_pkt->object_security, coap_pkt->object_security_len);
+
+		OPT_COSE_Decode(&cose, coap_pkt->object_security, coap_pkt->object_security_len);
+
+	}
+
+	uint8_t nonce[CONTEXT_INIT_VECT_LEN];
+
+	OSCOAP_COMMON_CONTEXT* ctx;
+	OSCOAP_RECIPIENT_CONTEXT* recipient_ctx = NULL;
+	ctx = oscoap_find_ctx_by_cid(cose.kid);
+	if(ctx == NULL){
+		PRINTF("context is not fetched form DB cid: ");
+		PRINTF_HEX(cose.kid, cose.kid_len);
+		return OSCOAP_CONTEXT_NOT_FOUND;
+	}
+
+	/* Sender ID check, every sender in the group has its own recipient context */
+	size_t sid_len;
+	uint8_t *sid = OPT_COSE_GetSenderID(&cose, &sid_len);
+	if(sid != NULL && sid_len == ID_LEN){
+#if OSCOAP_ROLE != OSCOAP_ROLE_UNICAST
+		/* the first message of a sender brings its context into being */
+		recipient_ctx = oscoap_derive_recipient_ctx(ctx, sid);
+#else
+		recipient_ctx = oscoap_find_recipient_ctx(ctx->CONTEXT_ID, sid);
+#endif
+	}
+	if(recipient_ctx == NULL){
+		PRINTF("Sender is not identified\n");
+		return OSCOAP_CONTEXT_NOT_FOUND;
+	}
+
+	if(cose.ciphertext == NULL || cose.ciphertext_len < 8){
+		return OSCOAP_MALFORMED_PACKET;
+	}
+
+	/* Replays are rejected before the expensive signature check. The
+	 * check does not touch the window, which is only advanced once the
+	 * message has been verified and decrypted, and it is repeated when
+	 * a queued message is decoded again.
+	 */
+	if(!oscoap_validate_receiver_seq(recipient_ctx, &cose)){
+		return OSCOAP_SEQ_ERROR; 
+	}
+
+	/* Verify the signature with the key of the sender before any context
+	 * state is touched, since the message may be queued and decoded
+	 * again later.
+	 */
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+	coap_status_t status = oscoap_verify_signature(coap_pkt, &cose, recipient_ctx);
+	if(status != NO_ERROR){
+		return status;
+	}
+#endif
+
+	size_t seq_len;
+	uint8_t *seq = OPT_COSE_GetPartialIV(&cose, &seq_len);
+
+	create_iv((uint8_t*)recipient_ctx->RECIPIENT_IV, nonce, seq, seq_len);
+	coap_pkt->context = ctx;
+	OPT_COSE_SetNonce(&cose, nonce, CONTEXT_INIT_VECT_LEN); 
+
+	OPT_COSE_SetAlg(&cose, COSE_Algorithm_AES_CCM_64_64_128);
+
+	uint8_t external_aad_head[OSCOAP_EXTERNAL_AAD_HEAD_LEN];
+	uint8_t uri[60];
+	if(coap_is_request(coap_pkt)){//this should match reqests
+		  PRINTF("we have a incomming request!\n");
+		oscoap_set_request_external_aad(coap_pkt, &cose, external_aad_head, uri, 0);
+	} else {
+		  PRINTF("we have a incomming response!\n");
+		oscoap_set_response_external_aad(coap_pkt, &cose, external_aad_head);
+	}
+
+	//Verify and decrypt the message in place in the receive buffer. If
+	//the verification fails, the server MUST stop processing the request.
+	OPT_COSE_SetContent(&cose, cose.ciphertext, cose.ciphertext_len - 8);
+
+	if(OPT_COSE_Decrypt(&cose, recipient_ctx->RECIPIENT_KEY, CONTEXT_KEY_LEN)){
+		return OSCOAP_CRYPTO_ERROR;
+	}
+	oscoap_update_receiver_seq(recipient_ctx, &cose);
+
+	PRINTF("PLAINTEXT DECRYPTED len %d\n", cose.plaintext_len);
+	PRINTF_HEX(cose.plaintext, cose.plaintext_len);
+
+	coap_pkt->object_security = cose.plaintext;
+	coap_pkt->object_security_len = cose.plaintext_len;
+
+
+	//TODO, rädda PROXY URI; MAX AGE osv. från memset i restore_packet
+	PRINTF("buffer before restore pkt\n");
+	PRINTF_HEX(coap_pkt->buffer, 50);
+	oscoap_restore_packet(coap_pkt);
+	PRINTF("buffer after restore pkt\n");
+	PRINTF_HEX(coap_pkt->buffer, 50);
+
+	return NO_ERROR;
+
+}
+
+void clear_options(coap_packet_t* coap_pkt){
+	coap_pkt->options[COAP_OPTION_IF_MATCH / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_IF_MATCH % OPTION_MAP_SIZE));
+	/* URI-Host should be unprotected */
+	coap_pkt->options[COAP_OPTION_ETAG / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_ETAG % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_IF_NONE_MATCH / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_IF_NONE_MATCH % OPTION_MAP_SIZE));
+	/* Observe should be duplicated */
+	coap_pkt->options[COAP_OPTION_LOCATION_PATH / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_LOCATION_PATH % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_URI_PATH / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_URI_PATH % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_CONTENT_FORMAT / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_CONTENT_FORMAT % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_URI_QUERY / OPTION_MAP_SIZE] &=  ~(1 << (COAP_OPTION_URI_QUERY % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_ACCEPT / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_ACCEPT % OPTION_MAP_SIZE));
+	coap_pkt->options[COAP_OPTION_LOCATION_QUERY / OPTION_MAP_SIZE] &= ~(1 << (COAP_OPTION_LOCATION_QUERY % OPTION_MAP_SIZE));
+	/* Block2 should be duplicated */
+	/* Block1 should be duplicated */
+	/* Size2 should be duplicated */
+	/* Proxy-URI should be unprotected */
+	/* Proxy-Scheme should be unprotected */
+	/* Size1 should be duplicated */
+}
+
+	int
+coap_set_header_object_security_content(void *packet, const uint8_t* os, size_t os_len)
+{
+	coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+	if(IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)){
+		coap_pkt->object_security_len = os_len;
+		coap_pkt->object_security = os;
+    PRINTF("!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n");
+    PRINTF_HEX(coap_pkt->object_security, coap_pkt->object_security_len);
+		return coap_pkt->object_security_len;
+	}
+	return 0;
+}
+
+int coap_get_header_object_security(void* packet, const uint8_t** os_opt){
+	coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+
+	if(IS_OPTION(coap_pkt, COAP_OPTION_OBJECT_SECURITY)){
+		*os_opt = coap_pkt->object_security;
+		return coap_pkt->object_security_len;
+	}
+	return 0;
+}
+
+size_t oscoap_prepare_plaintext(void* packet, uint8_t* plaintext_buffer){
+	PRINTF("prepare plaintext\n");  
+	coap_packet_t *const coap_pkt = (coap_packet_t *)packet;
+	uint8_t *option;
+	unsigned int current_number = 0;
+
+	/* Initialize */
+	uint8_t* original_buffer = coap_pkt->buffer;
+	coap_pkt->buffer = plaintext_buffer;
+
+	PRINTF("-Serializing MID %u to %p, ", coap_pkt->mid, coap_pkt->buffer);
+
+	//TODO is this correct?
+	/* empty packet, dont need to do more stuff */
+	if(!coap_pkt->code) {
+		PRINTF("-Done serializing empty message at %p-\n", coap_pkt->buffer);
+		coap_pkt->buffer = original_buffer;
+		return 4;
+	}
+	//TODO fix this so we dont make uneccesary wirites
+	//Set Token
+	PRINTF("Token (len %u)", coap_pkt->token_len);
+	option = coap_pkt->buffer; // + COAP_HEADER_LEN-2; //TODO, fixa OSCOAP_HEADER_LEN
+	for(current_number = 0; current_number < coap_pkt->token_len;
+			++current_number) {
+		PRINTF(" %02X", coap_pkt->token[current_number]);
+		*option = coap_pkt->token[current_number];
+		++option;
+	}
+	PRINTF("-\n");
+
+	current_number = 0;
+	option = coap_pkt->buffer;
+	/* Serialize options */
+
+	PRINTF("-Serializing options at %p-\n", option);
+
+	/* The options must be serialized in the order of their number */
+	COAP_SERIALIZE_BYTE_OPTION(COAP_OPTION_IF_MATCH, if_match, "If-Match");
+	//COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_URI_HOST, uri_host, '\0', 
+	//                             "Uri-Host"); //Should be omitted
+	COAP_SERIALIZE_BYTE_OPTION(COAP_OPTION_ETAG, etag, "ETag");
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_IF_NONE_MATCH,
+			content_format -
+			coap_pkt->
+			content_format /* hack to get a zero field */,
+			"If-None-Match");
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_OBSERVE, observe, "Observe");
+	// COAP_SERIALIZE_INT_OPTION(COAP_OPTION_URI_PORT, uri_port, "Uri-Port");
+	COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_LOCATION_PATH, location_path, '/',
+			"Location-Path");
+	COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_URI_PATH, uri_path, '/',
+			"Uri-Path");
+	PRINTF("Serialize content format: %d\n", coap_pkt->content_format);
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_CONTENT_FORMAT, content_format,
+			"Content-Format");
+	//COAP_OPTION_MAX_AGE Should be omitted
+	COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_URI_QUERY, uri_query, '&',
+			"Uri-Query");
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_ACCEPT, accept, "Accept");
+	COAP_SERIALIZE_STRING_OPTION(COAP_OPTION_LOCATION_QUERY, location_query,
+			'&', "Location-Query");
+	//COAP_OPTION_OBJECT_SECURITY (21) SHOULD BE OMITTED
+	COAP_SERIALIZE_BLOCK_OPTION(COAP_OPTION_BLOCK2, block2, "Block2");
+	COAP_SERIALIZE_BLOCK_OPTION(COAP_OPTION_BLOCK1, block1, "Block1");
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_SIZE2, size2, "Size2");
+	//COAP_OPTION_PROXY_URI Should be omitted
+	//COAP_OPTION_PROXY_SCHEME Should be omitted
+	COAP_SERIALIZE_INT_OPTION(COAP_OPTION_SIZE1, size1, "Size1");
+
+	PRINTF("-Done serializing at %p----\n", option);
+
+	/* Pack payload */
+	if((option - coap_pkt->buffer) <= COAP_MAX_HEADER_SIZE) {
+		/* Payload marker */
+		if(coap_pkt->payload_len) {
+			*option = 0xFF;
+			++option;
+		}
+		memmove(option, coap_pkt->payload, coap_pkt->payload_len);
+	} else {
+		/* an error occurred: caller must check for !=0 */
+		coap_pkt->buffer = NULL;
+		coap_error_message = "Serialized header exceeds COAP_MAX_HEADER_SIZE";
+		return 0;
+	}
+
+	coap_pkt->buffer = original_buffer;
+	return (option - plaintext_buffer) + coap_pkt->payload_len; /* packet length */
+}
+
+void oscoap_restore_packet(void* packet){
+
+	coap_packet_t* coap_pkt = (coap_packet_t*) packet;
+	uint8_t *data =  coap_pkt->object_security;
+	uint8_t *current_option = data;
+	/* parse options */
+	memset(coap_pkt->options, 0, sizeof(coap_pkt->options));
+
+	size_t data_len = coap_pkt->object_security_len;
+	unsigned int option_number = 0;
+	unsigned int option_delta = 0;
+	size_t option_length = 0;
+
+	while(current_option < data + data_len) {
+		/* payload marker 0xFF, currently only checking for 0xF* because rest is reserved */
+		if((current_option[0] & 0xF0) == 0xF0) {
+			coap_pkt->payload = ++current_option;
+			coap_pkt->payload_len = data_len - (coap_pkt->payload - data);
+
+			/* also for receiving, the Erbium upper bound is REST_MAX_CHUNK_SIZE */
+			if(coap_pkt->payload_len > REST_MAX_CHUNK_SIZE) {
+				coap_pkt->payload_len = REST_MAX_CHUNK_SIZE;
+				/* null-terminate payload */
+			}
+			coap_pkt->payload[coap_pkt->payload_len] = '\0';
+
+			break;
+		}
+
+		option_delta = current_option[0] >> 4;
+		option_length = current_option[0] & 0x0F;
+		++current_option;
+
+		if(option_delta == 13) {
+			option_delta += current_option[0];
+			++current_option;
+		} else if(option_delta == 14) {
+			option_delta += 255;
+			option_delta += current_option[0] << 8;
+			++current_option;
+			option_delta += current_option[0];
+			++current_option;
+		}
+
+		if(option_length == 13) {
+			option_length += current_option[0];
+			++current_option;
+		} else if(option_length == 14) {
+			option_length += 255;
+			option_length += current_option[0] << 8;
+			++current_option;
+			option_length += current_option[0];
+			++current_option;
+		}
+		option_number += option_delta;
+		PRINTF("OPTION %u (delta %u, len %zu): \n", option_number, option_delta,
+				option_length);
+
+		SET_OPTION(coap_pkt, option_number);
+
+		switch(option_number) {
+			case COAP_OPTION_CONTENT_FORMAT:
+				coap_pkt->content_format = coap_parse_int_option(current_option,
+						option_length);
+				PRINTF("Content-Format [%u]\n", coap_pkt->content_format);
+				break;
+			case COAP_OPTION_MAX_AGE:
+				coap_pkt->max_age = coap_parse_int_option(current_option,
+						option_length);
+				PRINTF("Max-Age [%lu]\n", (unsigned long)coap_pkt->max_age);
+				break;
+			case COAP_OPTION_ETAG:
+				coap_pkt->etag_len = MIN(COAP_ETAG_LEN, option_length);
+				memcpy(coap_pkt->etag, current_option, coap_pkt->etag_len);
+				PRINTF("ETag %u [0x%02X%02X%02X%02X%02X%02X%02X%02X]\n",
+						coap_pkt->etag_len, coap_pkt->etag[0], coap_pkt->etag[1],
+						coap_pkt->etag[2], coap_pkt->etag[3], coap_pkt->etag[4],
+						coap_pkt->etag[5], coap_pkt->etag[6], coap_pkt->etag[7]
+						);                 /*FIXME always prints 8 bytes */
+				break;
+			case COAP_OPTION_ACCEPT:
+				coap_pkt->accept = coap_parse_int_option(current_option, option_length);
+				PRINTF("Accept [%u]\n", coap_pkt->accept);
+				break;
+			case COAP_OPTION_IF_MATCH:
+				/* TODO support multiple ETags */
+				coap_pkt->if_match_len = MIN(COAP_ETAG_LEN, option_length);
+				memcpy(coap_pkt->if_match, current_option, coap_pkt->if_match_len);
+				PRINTF("If-Match %u [0x%02X%02X%02X%02X%02X%02X%02X%02X]\n",
+						coap_pkt->if_match_len, coap_pkt->if_match[0],
+						coap_pkt->if_match[1], coap_pkt->if_match[2],
+						coap_pkt->if_match[3], coap_pkt->if_match[4],
+						coap_pkt->if_match[5], coap_pkt->if_match[6],
+						coap_pkt->if_match[7]
+						); /* FIXME always prints 8 bytes */
+				break;
+			case COAP_OPTION_IF_NONE_MATCH:
+				coap_pkt->if_none_match = 1;
+				PRINTF("If-None-Match\n");
+				break;
+
+			case COAP_OPTION_PROXY_URI:
+#if COAP_PROXY_OPTION_PROCESSING
+				coap_pkt->proxy_uri = (char *)current_option;
+				coap_pkt->proxy_uri_len = option_length;
+#endif
+				PRINTF("Proxy-Uri NOT IMPLEMENTED [%.*s]\n", (int)coap_pkt->proxy_uri_len,
+						coap_pkt->proxy_uri);
+				coap_error_message = "This is a constrained server (Contiki)";
+				//return PROXYING_NOT_SUPPORTED_5_05;
+				break;
+			case COAP_OPTION_PROXY_SCHEME:
+#if COAP_PROXY_OPTION_PROCESSING
+				coap_pkt->proxy_scheme = (char *)current_option;
+				coap_pkt->proxy_scheme_len = option_length;
+#endif
+				PRINTF("Proxy-Scheme NOT IMPLEMENTED [%.*s]\n",
+						(int)coap_pkt->proxy_scheme_len, coap_pkt->proxy_scheme);
+				coap_error_message = "This is a constrained server (Contiki)";
+				//return PROXYING_NOT_SUPPORTED_5_05;
+				break;
+
+			case COAP_OPTION_URI_HOST:
+				coap_pkt->uri_host = (char *)current_option;
+				coap_pkt->uri_host_len = option_length;
+				PRINTF("Uri-Host [%.*s]\n", (int)coap_pkt->uri_host_len,
+						coap_pkt->uri_host);
+				break;
+			case COAP_OPTION_URI_PORT:
+				coap_pkt->uri_port = coap_parse_int_option(current_option,
+						option_length);
+				PRINTF("Uri-Port [%u]\n", coap_pkt->uri_port);
+				break;
+			case COAP_OPTION_URI_PATH:
+				/* coap_merge_multi_option() operates in-place on the IPBUF, but final packet field should be const string -> cast to string */
+				coap_merge_multi_option((char **)&(coap_pkt->uri_path),
+						&(coap_pkt->uri_path_len), current_option,
+						option_length, '/');
+				PRINTF("Uri-Path [%.*s]\n", (int)coap_pkt->uri_path_len, coap_pkt->uri_path);
+				break;
+			case COAP_OPTION_URI_QUERY:
+				/* coap_merge_multi_option() operates in-place on the IPBUF, but final packet field should be const string -> cast to string */
+				coap_merge_multi_option((char **)&(coap_pkt->uri_query),
+						&(coap_pkt->uri_query_len), current_option,
+						option_length, '&');
+				PRINTF("Uri-Query [%.*s]\n", (int)coap_pkt->uri_query_len,
+						coap_pkt->uri_query);
+				break;
+
+			case COAP_OPTION_LOCATION_PATH:
+				/* coap_merge_multi_option() operates in-place on the IPBUF, but final packet field should be const string -> cast to string */
+				coap_merge_multi_option((char **)&(coap_pkt->location_path),
+						&(coap_pkt->location_path_len), current_option,
+						option_length, '/');
+				PRINTF("Location-Path [%.*s]\n", (int)coap_pkt->location_path_len,
+						coap_pkt->location_path);
+				break;
+			case COAP_OPTION_LOCATION_QUERY:
+				/* coap_merge_multi_option() operates in-place on the IPBUF, but final packet field should be const string -> cast to string */
+				coap_merge_multi_option((char **)&(coap_pkt->location_query),
+						&(coap_pkt->location_query_len), current_option,
+						option_length, '&');
+				PRINTF("Location-Query [%.*s]\n", (int)coap_pkt->location_query_len,
+						coap_pkt->location_query);
+				break;
+
+			case COAP_OPTION_OBSERVE:
+				coap_pkt->observe = coap_parse_int_option(current_option,
+						option_length);
+				PRINTF("Observe [%lu]\n", (unsigned long)coap_pkt->observe);
+				break;
+			case COAP_OPTION_BLOCK2:
+				coap_pkt->block2_num = coap_parse_int_option(current_option,
+						option_length);
+				coap_pkt->block2_more = (coap_pkt->block2_num & 0x08) >> 3;
+				coap_pkt->block2_size = 16 << (coap_pkt->block2_num & 0x07);
+				coap_pkt->block2_offset = (coap_pkt->block2_num & ~0x0000000F)
+					<< (coap_pkt->block2_num & 0x07);
+				coap_pkt->block2_num >>= 4;
+				PRINTF("Block2 [%lu%s (%u B/blk)]\n",
+						(unsigned long)coap_pkt->block2_num,
+						coap_pkt->block2_more ? "+" : "", coap_pkt->block2_size);
+				break;
+			case COAP_OPTION_BLOCK1:
+				coap_pkt->block1_num = coap_parse_int_option(current_option,
+						option_length);
+				coap_pkt->block1_more = (coap_pkt->block1_num & 0x08) >> 3;
+				coap_pkt->block1_size = 16 << (coap_pkt->block1_num & 0x07);
+				coap_pkt->block1_offset = (coap_pkt->block1_num & ~0x0000000F)
+					<< (coap_pkt->block1_num & 0x07);
+				coap_pkt->block1_num >>= 4;
+				PRINTF("Block1 [%lu%s (%u B/blk)]\n",
+						(unsigned long)coap_pkt->block1_num,
+						coap_pkt->block1_more ? "+" : "", coap_pkt->block1_size);
+				break;
+			case COAP_OPTION_SIZE2:
+				coap_pkt->size2 = coap_parse_int_option(current_option, option_length);
+				PRINTF("Size2 [%lu]\n", (unsigned long)coap_pkt->size2);
+				break;
+			case COAP_OPTION_SIZE1:
+				coap_pkt->size1 = coap_parse_int_option(current_option, option_length);
+				PRINTF("Size1 [%lu]\n", (unsigned long)coap_pkt->size1);
+				break;
+			default:
+				PRINTF("unknown (%u)\n", option_number);
+				/* check if critical (odd) */
+
+				if(option_number & 1) {
+					coap_error_message = "Unsupported critical option";
+					//return BAD_OPTION_4_02;
+				}
+		}
+		current_option += option_length;  
+	}
+}
+
+void oscoap_printf_hex(unsigned char *data, unsigned int len){
+	int i=0;
+	for(i=0; i<len; i++)
+	{
+		printf(" %02x ",data[i]);
+	}
+	printf("\n");
+}
+
+void oscoap_printf_char(unsigned char *data, unsigned int len){
+	int i=0;
+	for(i=0; i<len; i++)
+	{
+		PRINTF(" %c ",data[i]);
+	}
+	PRINTF("\n");
+}
+
+#define BYTETOBINARYPATTERN "%d%d%d%d%d%d%d%d"
+#define BYTETOBINARY(byte)  \
+	(byte & 0x80 ? 1 : 0), \
+(byte & 0x40 ? 1 : 0), \
+(byte & 0x20 ? 1 : 0), \
+(byte & 0x10 ? 1 : 0), \
+(byte & 0x08 ? 1 : 0), \
+(byte & 0x04 ? 1 : 0), \
+(byte & 0x02 ? 1 : 0), \
+(byte & 0x01 ? 1 : 0) 
+
+void oscoap_printf_bin(unsigned char *data, unsigned int len){
+	int i=0;
+	for(i=0; i<len; i++)
+	{
+		PRINTF(" "BYTETOBINARYPATTERN" ",BYTETOBINARY(data[i]));
+	}
+	PRINTF("\n");
+}
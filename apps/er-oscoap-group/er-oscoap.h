@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2016, SICS
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the 
+following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this list of conditions and the 
+following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the 
+following disclaimer in the documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote 
+products derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * \file
+ *      A trial implementation of OSCOAP. Based on er-coap by Matthias Kovatsch <kovatsch@inf.ethz.ch>
+ * \author
+ *      Martin Gunnarsson martin.gunnarsson@sics.se and Joakim Brorsson b.joakim@gmail.com
+ */
+
+#ifndef _OSCOAP_H
+#define _OSCOAP_H
+
+#include "er-oscoap.h"
+#include "er-coap.h"
+#include <sys/types.h>
+
+#define CLEAR_OPTION(packet, opt) ((packet)->options[opt / OPTION_MAP_SIZE] &= ~(1 << (opt % OPTION_MAP_SIZE))) //clear one bit
+
+
+//debug methods
+void oscoap_printf_hex(unsigned char *data, unsigned int len);
+void oscoap_printf_char(unsigned char *data, unsigned int len);
+void oscoap_printf_bin(unsigned char *data, unsigned int len);
+
+/* The number of Security Contexts available on this device */
+#define CONTEXT_NUM 1
+
+/* The number of senders that can be tracked, over all contexts */
+#ifdef OSCOAP_CONF_RECIPIENT_NUM
+#define RECIPIENT_NUM OSCOAP_CONF_RECIPIENT_NUM
+#else
+#define RECIPIENT_NUM 8
+#endif
+
+/* Buckets in the context and recipient lookup tables, a power of two */
+#ifdef OSCOAP_CONF_CTX_HASH_SIZE
+#define OSCOAP_CTX_HASH_SIZE OSCOAP_CONF_CTX_HASH_SIZE
+#else
+#define OSCOAP_CTX_HASH_SIZE 8
+#endif
+
+/* Keep the derived keys and the prepared signature keys of the contexts
+ * in the file system, so that a reboot does not derive them again. Each
+ * record carries a digest of the master secret, salt and signature key,
+ * and is not loaded after any of them changes. Sequence numbers are not
+ * stored. Unicast contexts get their keys from the application, so there
+ * is nothing to keep.
+ */
+#if defined(OSCOAP_CONF_CTX_CFS) && OSCOAP_ROLE != OSCOAP_ROLE_UNICAST
+#define OSCOAP_CTX_CFS OSCOAP_CONF_CTX_CFS
+#else
+#define OSCOAP_CTX_CFS 0
+#endif
+
+/* Sequence numbers this far behind the highest one received are replays */
+#define OSCOAP_REPLAY_WINDOW_SIZE 64
+
+/* Functions for handling the security contexts */
+void oscoap_ctx_store_init();
+void oscoap_set_ctx(void);
+OSCOAP_COMMON_CONTEXT* oscoap_new_ctx();
+OSCOAP_COMMON_CONTEXT* oscoap_new_unicast_ctx(const uint8_t* cid, const uint8_t* sid, const uint8_t* rid,
+                                              const uint8_t* sender_key, const uint8_t* sender_iv,
+                                              const uint8_t* recipient_key, const uint8_t* recipient_iv);
+OSCOAP_COMMON_CONTEXT* oscoap_find_ctx_by_cid(uint8_t* cid);
+int oscoap_free_ctx(OSCOAP_COMMON_CONTEXT *ctx);
+OSCOAP_RECIPIENT_CONTEXT* oscoap_new_recipient_ctx(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t* rid);
+OSCOAP_RECIPIENT_CONTEXT* oscoap_find_recipient_ctx(const uint8_t* cid, const uint8_t* rid);
+OSCOAP_RECIPIENT_CONTEXT* oscoap_derive_recipient_ctx(OSCOAP_COMMON_CONTEXT *ctx, const uint8_t* rid);
+
+
+
+/*
+ * With OSCOAP_SIGN_ED25519, signed messages are queued for up to
+ * OSCOAP_VERIFY_WINDOW, or until OSCOAP_VERIFY_QUEUE of them have
+ * arrived, and their signatures are then verified together with
+ * edsign_verify_batch(). Messages with a good signature are passed to
+ * the CoAP engine again; the others are dropped. With a queue of 0 each
+ * signature is verified on arrival.
+ */
+#ifdef OSCOAP_CONF_VERIFY_QUEUE
+#define OSCOAP_VERIFY_QUEUE OSCOAP_CONF_VERIFY_QUEUE
+#else
+#define OSCOAP_VERIFY_QUEUE 4
+#endif
+
+#ifdef OSCOAP_CONF_VERIFY_WINDOW
+#define OSCOAP_VERIFY_WINDOW OSCOAP_CONF_VERIFY_WINDOW
+#else
+#define OSCOAP_VERIFY_WINDOW (CLOCK_SECOND / 16)
+#endif
+
+/*
+ * By default the batch is verified by the oscoap_crypto process,
+ * OSCOAP_CRYPTO_STEPS bit positions of the point multiplication per
+ * scheduling round, so that other processes run between the chunks of
+ * a batch. Messages that arrive meanwhile wait for the next batch. With
+ * OSCOAP_CONF_CRYPTO_ASYNC 0 the whole batch is verified in the ctimer
+ * callback that closes the window, which blocks the system for as long.
+ */
+#ifdef OSCOAP_CONF_CRYPTO_ASYNC
+#define OSCOAP_CRYPTO_ASYNC OSCOAP_CONF_CRYPTO_ASYNC
+#else
+#define OSCOAP_CRYPTO_ASYNC 1
+#endif
+
+#ifdef OSCOAP_CONF_CRYPTO_STEPS
+#define OSCOAP_CRYPTO_STEPS OSCOAP_CONF_CRYPTO_STEPS
+#else
+#define OSCOAP_CRYPTO_STEPS 16
+#endif
+
+/* Time signed messages spent in the queue and in verification */
+struct oscoap_crypto_stats {
+  uint32_t verified;
+  uint32_t rejected;
+  uint32_t dropped;
+  clock_time_t wait_total;
+  clock_time_t wait_max;
+  clock_time_t busy_total;
+  clock_time_t busy_max;
+};
+
+extern struct oscoap_crypto_stats oscoap_crypto_stats;
+
+void clear_options(coap_packet_t* coap_pkt);
+size_t oscoap_prepare_message(void* packet, uint8_t* buffer);
+coap_status_t oscoap_decode_packet(coap_packet_t* coap_pkt);
+void oscoap_restore_packet(void* packet);
+size_t oscoap_prepare_plaintext(void* packet, uint8_t* plaintext_buffer);
+
+
+#endif /* _OSCOAP_H */
@@ -0,0 +1,605 @@
+/* Arithmetic mod p = 2^255-19
+ * Daniel Beer <dlbeer@gmail.com>, 5 Jan 2014
+ *
+ * This file is in the public domain.
+ */
+
+#include "f25519.h"
+
+/* Field multiplication backend, selected at build time:
+ *
+ *     8:  32 x 8-bit limbs (the reference code, for 8/16-bit MCUs)
+ *     25: 10 limbs of alternately 26 and 25 bits in 32-bit words, with
+ *         64-bit products (radix 2^25.5, for 32-bit MCUs)
+ *     51: 5 x 51-bit limbs in 64-bit words, with 128-bit products
+ *
+ * Whatever the backend, elements are passed around as byte strings
+ * as described in f25519.h. The wide backends unpack operands into
+ * limbs for multiplication and pack the result back, and run the long
+ * exponentiation chains in inversion and square roots entirely on
+ * limbs.
+ *
+ * With the radix 2^25.5 backend, F25519_CONF_FE_MUL may name a hand
+ * written replacement for the limb multiplication, for example using
+ * the UMAAL instruction on Cortex-M4:
+ *
+ *     void fn(uint32_t r[10], const uint32_t a[10], const uint32_t b[10]);
+ *
+ * Limbs of a and b are below 2^27; limbs of r must be carried as done
+ * by fe_carry() below.
+ */
+#ifdef F25519_CONF_RADIX
+#define F25519_RADIX F25519_CONF_RADIX
+#elif defined(__SIZEOF_INT128__)
+#define F25519_RADIX 51
+#elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 4
+#define F25519_RADIX 25
+#else
+#define F25519_RADIX 8
+#endif
+
+const uint8_t f25519_zero[F25519_SIZE] = {0};
+const uint8_t f25519_one[F25519_SIZE] = {1};
+
+void f25519_load(uint8_t *x, uint32_t c)
+{
+	int i;
+
+	for (i = 0; i < sizeof(c); i++) {
+		x[i] = c;
+		c >>= 8;
+	}
+
+	for (; i < F25519_SIZE; i++)
+		x[i] = 0;
+}
+
+void f25519_normalize(uint8_t *x)
+{
+	uint8_t minusp[F25519_SIZE];
+	uint16_t c;
+	int i;
+
+	/* Reduce using 2^255 = 19 mod p */
+	c = (x[31] >> 7) * 19;
+	x[31] &= 127;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += x[i];
+		x[i] = c;
+		c >>= 8;
+	}
+
+	/* The number is now less than 2^255 + 18, and therefore less than
+	 * 2p. Try subtracting p, and conditionally load the subtracted
+	 * value if underflow did not occur.
+	 */
+	c = 19;
+
+	for (i = 0; i + 1 < F25519_SIZE; i++) {
+		c += x[i];
+		minusp[i] = c;
+		c >>= 8;
+	}
+
+	c += ((uint16_t)x[i]) - 128;
+	minusp[31] = c;
+
+	/* Load x-p if no underflow */
+	f25519_select(x, minusp, x, (c >> 15) & 1);
+}
+
+uint8_t f25519_eq(const uint8_t *x, const uint8_t *y)
+{
+	uint8_t sum = 0;
+	int i;
+
+	for (i = 0; i < F25519_SIZE; i++)
+		sum |= x[i] ^ y[i];
+
+	sum |= (sum >> 4);
+	sum |= (sum >> 2);
+	sum |= (sum >> 1);
+
+	return (sum ^ 1) & 1;
+}
+
+void f25519_select(uint8_t *dst,
+		   const uint8_t *zero, const uint8_t *one,
+		   uint8_t condition)
+{
+	const uint8_t mask = -condition;
+	int i;
+
+	for (i = 0; i < F25519_SIZE; i++)
+		dst[i] = zero[i] ^ (mask & (one[i] ^ zero[i]));
+}
+
+void f25519_add(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	uint16_t c = 0;
+	int i;
+
+	/* Add */
+	for (i = 0; i < F25519_SIZE; i++) {
+		c >>= 8;
+		c += ((uint16_t)a[i]) + ((uint16_t)b[i]);
+		r[i] = c;
+	}
+
+	/* Reduce with 2^255 = 19 mod p */
+	r[31] &= 127;
+	c = (c >> 7) * 19;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += r[i];
+		r[i] = c;
+		c >>= 8;
+	}
+}
+
+void f25519_sub(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	uint32_t c = 0;
+	int i;
+
+	/* Calculate a + 2p - b, to avoid underflow */
+	c = 218;
+	for (i = 0; i + 1 < F25519_SIZE; i++) {
+		c += 65280 + ((uint32_t)a[i]) - ((uint32_t)b[i]);
+		r[i] = c;
+		c >>= 8;
+	}
+
+	c += ((uint32_t)a[31]) - ((uint32_t)b[31]);
+	r[31] = c & 127;
+	c = (c >> 7) * 19;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += r[i];
+		r[i] = c;
+		c >>= 8;
+	}
+}
+
+void f25519_neg(uint8_t *r, const uint8_t *a)
+{
+	uint32_t c = 0;
+	int i;
+
+	/* Calculate 2p - a, to avoid underflow */
+	c = 218;
+	for (i = 0; i + 1 < F25519_SIZE; i++) {
+		c += 65280 - ((uint32_t)a[i]);
+		r[i] = c;
+		c >>= 8;
+	}
+
+	c -= ((uint32_t)a[31]);
+	r[31] = c & 127;
+	c = (c >> 7) * 19;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += r[i];
+		r[i] = c;
+		c >>= 8;
+	}
+}
+
+#if F25519_RADIX == 51
+typedef uint64_t limb_t;
+typedef unsigned __int128 dlimb_t;
+#define FE_LIMBS	5
+#define FE_WIDTH(i)	51
+#elif F25519_RADIX == 25
+typedef uint32_t limb_t;
+typedef uint64_t dlimb_t;
+#define FE_LIMBS	10
+#define FE_WIDTH(i)	(26 - ((i) & 1))
+#elif F25519_RADIX != 8
+#error "F25519_RADIX must be 8, 25 or 51"
+#endif
+
+#if F25519_RADIX == 8
+void f25519_mul__distinct(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	uint32_t c = 0;
+	int i;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		int j;
+
+		c >>= 8;
+		for (j = 0; j <= i; j++)
+			c += ((uint32_t)a[j]) * ((uint32_t)b[i - j]);
+
+		for (; j < F25519_SIZE; j++)
+			c += ((uint32_t)a[j]) *
+			     ((uint32_t)b[i + F25519_SIZE - j]) * 38;
+
+		r[i] = c;
+	}
+
+	r[31] &= 127;
+	c = (c >> 7) * 19;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += r[i];
+		r[i] = c;
+		c >>= 8;
+	}
+}
+
+#else /* F25519_RADIX == 8 */
+#define FE_MASK(i)	((((limb_t)1) << FE_WIDTH(i)) - 1)
+
+typedef limb_t fe[FE_LIMBS];
+
+/* Convert from a byte string. Bit 255 is folded in as 19. */
+static void fe_unpack(fe r, const uint8_t *x)
+{
+	uint64_t acc = 0;
+	int bits = 0;
+	int n = 0;
+	int i;
+
+	for (i = 0; i < FE_LIMBS; i++) {
+		while (bits < FE_WIDTH(i)) {
+			acc |= ((uint64_t)x[n++]) << bits;
+			bits += 8;
+		}
+
+		r[i] = acc & FE_MASK(i);
+		acc >>= FE_WIDTH(i);
+		bits -= FE_WIDTH(i);
+	}
+
+	r[0] += (x[31] >> 7) * 19;
+}
+
+/* Convert to a byte string. The input is carried first, with the top
+ * limb left unmasked: the value fits in 256 bits and is less than 2p.
+ */
+static void fe_pack(uint8_t *x, const fe a)
+{
+	limb_t t[FE_LIMBS];
+	limb_t c = 0;
+	uint64_t acc = 0;
+	int bits = 0;
+	int n = 0;
+	int i;
+
+	for (i = 0; i + 1 < FE_LIMBS; i++) {
+		t[i] = a[i] + c;
+		c = t[i] >> FE_WIDTH(i);
+		t[i] &= FE_MASK(i);
+	}
+
+	t[i] = a[i] + c;
+
+	for (i = 0; i < FE_LIMBS; i++) {
+		acc |= ((uint64_t)t[i]) << bits;
+		bits += FE_WIDTH(i);
+
+		while (bits >= 8 && n < F25519_SIZE) {
+			x[n++] = acc;
+			acc >>= 8;
+			bits -= 8;
+		}
+	}
+
+	while (n < F25519_SIZE) {
+		x[n++] = acc;
+		acc >>= 8;
+	}
+}
+
+/* Reduce double width column sums to limbs, using 2^255 = 19 mod p.
+ * Every limb but the second ends up within its width; the second
+ * exceeds it by a small carry.
+ */
+static void fe_carry(fe r, dlimb_t *t)
+{
+	dlimb_t c = 0;
+	int i;
+
+	for (i = 0; i < FE_LIMBS; i++) {
+		t[i] += c;
+		c = t[i] >> FE_WIDTH(i);
+		t[i] &= FE_MASK(i);
+	}
+
+	t[0] += c * 19;
+	t[1] += t[0] >> FE_WIDTH(0);
+	t[0] &= FE_MASK(0);
+
+	for (i = 0; i < FE_LIMBS; i++)
+		r[i] = t[i];
+}
+
+#if F25519_RADIX == 51
+static void fe_mul(fe r, const fe a, const fe b)
+{
+	const dlimb_t b1 = b[1] * 19;
+	const dlimb_t b2 = b[2] * 19;
+	const dlimb_t b3 = b[3] * 19;
+	const dlimb_t b4 = b[4] * 19;
+	dlimb_t t[FE_LIMBS];
+
+	t[0] = a[0] * (dlimb_t)b[0] + a[1] * b4 + a[2] * b3 +
+	       a[3] * b2 + a[4] * b1;
+	t[1] = a[0] * (dlimb_t)b[1] + a[1] * (dlimb_t)b[0] + a[2] * b4 +
+	       a[3] * b3 + a[4] * b2;
+	t[2] = a[0] * (dlimb_t)b[2] + a[1] * (dlimb_t)b[1] +
+	       a[2] * (dlimb_t)b[0] + a[3] * b4 + a[4] * b3;
+	t[3] = a[0] * (dlimb_t)b[3] + a[1] * (dlimb_t)b[2] +
+	       a[2] * (dlimb_t)b[1] + a[3] * (dlimb_t)b[0] + a[4] * b4;
+	t[4] = a[0] * (dlimb_t)b[4] + a[1] * (dlimb_t)b[3] +
+	       a[2] * (dlimb_t)b[2] + a[3] * (dlimb_t)b[1] +
+	       a[4] * (dlimb_t)b[0];
+
+	fe_carry(r, t);
+}
+#elif defined(F25519_CONF_FE_MUL)
+void F25519_CONF_FE_MUL(uint32_t *r, const uint32_t *a, const uint32_t *b);
+#define fe_mul F25519_CONF_FE_MUL
+#else
+static void fe_mul(fe r, const fe a, const fe b)
+{
+	limb_t b19[FE_LIMBS];
+	dlimb_t t[FE_LIMBS] = {0};
+	int i;
+
+	for (i = 0; i < FE_LIMBS; i++)
+		b19[i] = b[i] * 19;
+
+	/* Limb i has weight 2^ceil(25.5i). Two odd limbs multiply to
+	 * twice the weight of their column, and columns of 10 and up
+	 * wrap around with a factor of 19.
+	 */
+	for (i = 0; i < FE_LIMBS; i++) {
+		const limb_t ai = a[i];
+		const limb_t ai2 = a[i] << (i & 1);
+		int j;
+
+		for (j = 0; j < FE_LIMBS - i; j++)
+			t[i + j] += ((dlimb_t)((j & 1) ? ai2 : ai)) * b[j];
+
+		for (; j < FE_LIMBS; j++)
+			t[i + j - FE_LIMBS] +=
+				((dlimb_t)((j & 1) ? ai2 : ai)) * b19[j];
+	}
+
+	fe_carry(r, t);
+}
+#endif
+
+void f25519_mul__distinct(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	fe x;
+	fe y;
+
+	fe_unpack(x, a);
+	fe_unpack(y, b);
+	fe_mul(x, x, y);
+	fe_pack(r, x);
+}
+#endif /* F25519_RADIX == 8 */
+
+void f25519_mul(uint8_t *r, const uint8_t *a, const uint8_t *b)
+{
+	uint8_t tmp[F25519_SIZE];
+
+	f25519_mul__distinct(tmp, a, b);
+	f25519_copy(r, tmp);
+}
+
+void f25519_mul_c(uint8_t *r, const uint8_t *a, uint32_t b)
+{
+	uint32_t c = 0;
+	int i;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c >>= 8;
+		c += b * ((uint32_t)a[i]);
+		r[i] = c;
+	}
+
+	r[31] &= 127;
+	c >>= 7;
+	c *= 19;
+
+	for (i = 0; i < F25519_SIZE; i++) {
+		c += r[i];
+		r[i] = c;
+		c >>= 8;
+	}
+}
+
+#if F25519_RADIX == 8
+void f25519_inv__distinct(uint8_t *r, const uint8_t *x)
+{
+	uint8_t s[F25519_SIZE];
+	int i;
+
+	/* This is a prime field, so by Fermat's little theorem:
+	 *
+	 *     x^(p-1) = 1 mod p
+	 *
+	 * Therefore, raise to (p-2) = 2^255-21 to get a multiplicative
+	 * inverse.
+	 *
+	 * This is a 255-bit binary number with the digits:
+	 *
+	 *     11111111... 01011
+	 *
+	 * We compute the result by the usual binary chain, but
+	 * alternate between keeping the accumulator in r and s, so as
+	 * to avoid copying temporaries.
+	 */
+
+	/* 1 1 */
+	f25519_mul__distinct(s, x, x);
+	f25519_mul__distinct(r, s, x);
+
+	/* 1 x 248 */
+	for (i = 0; i < 248; i++) {
+		f25519_mul__distinct(s, r, r);
+		f25519_mul__distinct(r, s, x);
+	}
+
+	/* 0 */
+	f25519_mul__distinct(s, r, r);
+
+	/* 1 */
+	f25519_mul__distinct(r, s, s);
+	f25519_mul__distinct(s, r, x);
+
+	/* 0 */
+	f25519_mul__distinct(r, s, s);
+
+	/* 1 */
+	f25519_mul__distinct(s, r, r);
+	f25519_mul__distinct(r, s, x);
+
+	/* 1 */
+	f25519_mul__distinct(s, r, r);
+	f25519_mul__distinct(r, s, x);
+}
+#else /* F25519_RADIX == 8 */
+void f25519_inv__distinct(uint8_t *r, const uint8_t *x)
+{
+	fe a;
+	fe s;
+	fe t;
+	int i;
+
+	/* The same chain as for 8-bit limbs: x^(p-2) = x^(2^255-21) */
+	fe_unpack(a, x);
+
+	/* 1 1 */
+	fe_mul(s, a, a);
+	fe_mul(t, s, a);
+
+	/* 1 x 248 */
+	for (i = 0; i < 248; i++) {
+		fe_mul(s, t, t);
+		fe_mul(t, s, a);
+	}
+
+	/* 0 */
+	fe_mul(s, t, t);
+
+	/* 1 */
+	fe_mul(t, s, s);
+	fe_mul(s, t, a);
+
+	/* 0 */
+	fe_mul(t, s, s);
+
+	/* 1 */
+	fe_mul(s, t, t);
+	fe_mul(t, s, a);
+
+	/* 1 */
+	fe_mul(s, t, t);
+	fe_mul(t, s, a);
+
+	fe_pack(r, t);
+}
+#endif /* F25519_RADIX == 8 */
+
+void f25519_inv(uint8_t *r, const uint8_t *x)
+{
+	uint8_t tmp[F25519_SIZE];
+
+	f25519_inv__distinct(tmp, x);
+	f25519_copy(r, tmp);
+}
+
+#if F25519_RADIX == 8
+/* Raise x to the power of (p-5)/8 = 2^252-3, using s for temporary
+ * storage.
+ */
+static void exp2523(uint8_t *r, const uint8_t *x, uint8_t *s)
+{
+	int i;
+
+	/* This number is a 252-bit number with the binary expansion:
+	 *
+	 *     111111... 01
+	 */
+
+	/* 1 1 */
+	f25519_mul__distinct(r, x, x);
+	f25519_mul__distinct(s, r, x);
+
+	/* 1 x 248 */
+	for (i = 0; i < 248; i++) {
+		f25519_mul__distinct(r, s, s);
+		f25519_mul__distinct(s, r, x);
+	}
+
+	/* 0 */
+	f25519_mul__distinct(r, s, s);
+
+	/* 1 */
+	f25519_mul__distinct(s, r, r);
+	f25519_mul__distinct(r, s, x);
+}
+#else /* F25519_RADIX == 8 */
+/* Raise x to the power of (p-5)/8 = 2^252-3. s is unused, and kept
+ * for the sake of a common signature with the 8-bit version.
+ */
+static void exp2523(uint8_t *r, const uint8_t *x, uint8_t *s)
+{
+	fe a;
+	fe u;
+	fe v;
+	int i;
+
+	(void)s;
+	fe_unpack(a, x);
+
+	/* 1 1 */
+	fe_mul(u, a, a);
+	fe_mul(v, u, a);
+
+	/* 1 x 248 */
+	for (i = 0; i < 248; i++) {
+		fe_mul(u, v, v);
+		fe_mul(v, u, a);
+	}
+
+	/* 0 */
+	fe_mul(u, v, v);
+
+	/* 1 */
+	fe_mul(v, u, u);
+	fe_mul(u, v, a);
+
+	fe_pack(r, u);
+}
+#endif /* F25519_RADIX == 8 */
+
+void f25519_sqrt(uint8_t *r, const uint8_t *a)
+{
+	uint8_t v[F25519_SIZE];
+	uint8_t i[F25519_SIZE];
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+
+	/* v = (2a)^((p-5)/8) [x = 2a] */
+	f25519_mul_c(x, a, 2);
+	exp2523(v, x, y);
+
+	/* i = 2av^2 - 1 */
+	f25519_mul__distinct(y, v, v);
+	f25519_mul__distinct(i, x, y);
+	f25519_load(y, 1);
+	f25519_sub(i, i, y);
+
+	/* r = avi */
+	f25519_mul__distinct(x, v, a);
+	f25519_mul__distinct(r, x, i);
+}
@@ -34,7 +34,11 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string.h>
 #include "er-oscoap.h"
 
+#ifdef OSCOAP_CONF_DEBUG
+#define DEBUG OSCOAP_CONF_DEBUG
+#else
 #define DEBUG 1
+#endif
 #if DEBUG
 #include <stdio.h>
 #define PRINTF(...) printf(__VA_ARGS__)
@@ -144,8 +148,23 @@ uint8_t* OPT_COSE_SetSign(opt_cose_encrypt_t *cose, uint8_t *sign_buffer, size_t
 }
 
 uint8_t OPT_COSE_SetExternalAAD(opt_cose_encrypt_t *cose, uint8_t *external_aad_buffer, size_t external_aad_len){
-	cose->external_aad = external_aad_buffer;
-	cose->external_aad_len = external_aad_len;
+	cose->external_aad_frags = 0;
+	cose->external_aad_len = 0;
+	return OPT_COSE_AddExternalAAD(cose, external_aad_buffer, external_aad_len);
+}
+
+uint8_t OPT_COSE_AddExternalAAD(opt_cose_encrypt_t *cose, uint8_t *external_aad_buffer, size_t external_aad_len){
+	if(cose->external_aad_frags == OPT_COSE_EXTERNAL_AAD_FRAGS){
+		PRINTF("Too many external AAD pieces\n");
+		return 0;
+	}
+	if(cose->external_aad_frags == 0){
+		cose->external_aad = external_aad_buffer;
+	}
+	cose->external_aad_frag[cose->external_aad_frags] = external_aad_buffer;
+	cose->external_aad_frag_len[cose->external_aad_frags] = external_aad_len;
+	cose->external_aad_frags++;
+	cose->external_aad_len += external_aad_len;
 	return 1;
 }
 
@@ -219,33 +238,28 @@ uint8_t OPT_COSE_Encode_Protected(opt_cose_encrypt_t *cose, uint8_t **buffer){
 	return 1;
 }
 
-uint8_t OPT_COSE_Build_AAD(opt_cose_encrypt_t *cose, uint8_t *buffer){
-	OPT_CBOR_put_array(&buffer, 3);
-	char* encrypted = "Encrypted";
-	OPT_CBOR_put_text(&buffer, encrypted , strlen(encrypted));
+uint8_t* OPT_COSE_Encode_Header(opt_cose_encrypt_t *cose, uint8_t *buffer){
+	OPT_CBOR_put_array(&buffer, 4);
+	cose->protected = buffer;
 	OPT_COSE_Encode_Protected(cose, &buffer);
-	OPT_CBOR_put_bytes(&buffer, cose->external_aad_len, cose->external_aad);
-	return 1;
+	cose->protected_len = buffer - cose->protected;
+	OPT_CBOR_put_map(&buffer, 0);
+	/* the ciphertext length is not known yet, the long form of the
+	   head leaves room for any length */
+	buffer += 2;
+	cose->ciphertext = buffer;
+	cose->plaintext = buffer;
+	return buffer;
 }
 
-size_t OPT_COSE_AAD_length(opt_cose_encrypt_t *cose, int is_request){
-	//TODO this only works for responses
-	PRINTF("cose->partial_iv_len %d\n", cose->partial_iv_len);
-	PRINTF("cose->external_aad_len %d\n", cose->external_aad_len);
-	PRINTF("cose->kid_len %d\n", cose->kid_len);
-	size_t ret;
-
-  if ( is_request ) {
-    ret = 12 + 12 + 3 + cose->partial_iv_len + 1 + cose->external_aad_len;
-  } else {
-    ret = 12 + 3 + cose->partial_iv_len + 1 + cose->external_aad_len;
-  }
-	//array + text(Encrypted) + bytes + seq_len + bytes + external_aad_len
-	if(cose->kid_len > 0){
-		ret += cose->kid_len;
-		ret += 2; // one byte key one byte byte-tag
-	}
-	return ret;
+size_t OPT_COSE_Encode_Trailer(opt_cose_encrypt_t *cose, uint8_t *buffer){
+	uint8_t *end = cose->ciphertext + cose->ciphertext_len;
+
+	cose->ciphertext[-2] = 0x58;
+	cose->ciphertext[-1] = cose->ciphertext_len;
+	/* Signature */
+	OPT_CBOR_put_bytes(&end, cose->signature_len, cose->signature);
+	return end - buffer;
 }
 
 uint8_t OPT_COSE_SetNonce(opt_cose_encrypt_t *cose, uint8_t *nonce_buffer, size_t nonce_len){
@@ -329,6 +343,7 @@ size_t OPT_COSE_Decode(opt_cose_encrypt_t *cose, uint8_t *buffer, size_t buffer_
 	uint8_t *end_ptr = (uint8_t*)(buffer + buffer_len);
 
 	while(buffer < end_ptr){
+		uint8_t *head = buffer;
 		uint8_t len;
 		
 		switch(*buffer & 0xF0){
@@ -344,6 +359,10 @@ size_t OPT_COSE_Decode(opt_cose_encrypt_t *cose, uint8_t *buffer, size_t buffer_
 			//	PRINTF("bytes\n");
 				len = (*buffer & 0x0F);
 				buffer++; //step by tag
+				if(bytefield == 0){
+					cose->protected = head;
+					cose->protected_len = buffer + len - head;
+				}
 				_OPT_COSE_cbor_bytes(cose, buffer, len, bytefield);
 				bytefield++;
 				buffer += len; //step by bytes
@@ -361,6 +380,10 @@ size_t OPT_COSE_Decode(opt_cose_encrypt_t *cose, uint8_t *buffer, size_t buffer_
 					buffer++; //step by length
 				}
 
+				if(bytefield == 0){
+					cose->protected = head;
+					cose->protected_len = buffer + len - head;
+				}
 				_OPT_COSE_cbor_bytes(cose, buffer, len, bytefield);
 				bytefield++;
 				buffer += len; //step by bytes
@@ -379,6 +402,90 @@ size_t OPT_COSE_Decode(opt_cose_encrypt_t *cose, uint8_t *buffer, size_t buffer_
 }
 
 
+/* The Enc_structure ["Encrypted", protected, external_aad] is fed to the
+ * CBC-MAC piece by piece, from where the pieces are, so that it is never
+ * assembled in a buffer. The received protected header is used as it
+ * is, otherwise it is fed field by field. */
+static const uint8_t enc_structure_prefix[] = {
+	0x83, 0x69, 'E', 'n', 'c', 'r', 'y', 'p', 't', 'e', 'd'
+};
+
+static uint8_t cbor_bytes_head(uint8_t *head, size_t len){
+	/* same encoding as OPT_CBOR_put_bytes() */
+	if(len > 15){
+		head[0] = 0x58;
+		head[1] = len;
+		return 2;
+	}
+	head[0] = 0x40 | len;
+	return 1;
+}
+
+static void mic_bytes(struct cose_aes_ccm_mic *mic, uint8_t key, uint8_t *bytes, size_t len){
+	uint8_t head[2];
+
+	COSE_AES_CCM.mic_update(mic, &key, 1);
+	COSE_AES_CCM.mic_update(mic, head, cbor_bytes_head(head, len));
+	COSE_AES_CCM.mic_update(mic, bytes, len);
+}
+
+static size_t protected_map_len(opt_cose_encrypt_t *cose, uint8_t *elements){
+	size_t len = 1 + 2 + cose->partial_iv_len;
+
+	*elements = 1;
+	if(cose->kid_len != 0){
+		(*elements)++;
+		len += cose->kid_len + 2;
+	}
+	if(cose->sid_len != 0){
+		(*elements)++;
+		len += cose->sid_len + 2;
+	}
+	return len;
+}
+
+static void mic_start_aad(opt_cose_encrypt_t *cose, struct cose_aes_ccm_mic *mic, uint8_t m_len, uint8_t tag_len){
+	uint8_t protected_head[3];
+	uint8_t protected_head_len = 0;
+	uint8_t external_head[2];
+	uint8_t external_head_len;
+	size_t protected_len = cose->protected_len;
+	uint8_t elements;
+	uint8_t i;
+
+	if(cose->protected == NULL){
+		size_t map_len = protected_map_len(cose, &elements);
+		protected_head_len = cbor_bytes_head(protected_head, map_len);
+		protected_head[protected_head_len++] = 0xa0 | elements;
+		protected_len = protected_head_len - 1 + map_len;
+	}
+	external_head_len = cbor_bytes_head(external_head, cose->external_aad_len);
+
+	COSE_AES_CCM.mic_start(mic, cose->nonce, m_len,
+		sizeof(enc_structure_prefix) + protected_len + external_head_len + cose->external_aad_len,
+		tag_len);
+	COSE_AES_CCM.mic_update(mic, enc_structure_prefix, sizeof(enc_structure_prefix));
+
+	if(cose->protected != NULL){
+		COSE_AES_CCM.mic_update(mic, cose->protected, cose->protected_len);
+	}else{
+		/* same order as OPT_COSE_Encode_Protected() */
+		COSE_AES_CCM.mic_update(mic, protected_head, protected_head_len);
+		if(cose->kid_len != 0){
+			mic_bytes(mic, COSE_Header_KID, cose->kid, cose->kid_len);
+		}
+		if(cose->sid_len != 0){
+			mic_bytes(mic, COSE_Header_Sender_ID, cose->sid, cose->sid_len);
+		}
+		mic_bytes(mic, COSE_Header_Partial_IV, cose->partial_iv, cose->partial_iv_len);
+	}
+
+	COSE_AES_CCM.mic_update(mic, external_head, external_head_len);
+	for(i = 0; i < cose->external_aad_frags; i++){
+		COSE_AES_CCM.mic_update(mic, cose->external_aad_frag[i], cose->external_aad_frag_len[i]);
+	}
+}
+
 uint8_t OPT_COSE_Encrypt(opt_cose_encrypt_t *cose, uint8_t *key, size_t key_len){
 
   PRINTF("encrypt OPT_COSE\n");
@@ -416,7 +523,13 @@ uint8_t OPT_COSE_Encrypt(opt_cose_encrypt_t *cose, uint8_t *key, size_t key_len)
 
 
   COSE_AES_CCM.set_key(key);
-  COSE_AES_CCM.aead(cose->nonce, cose->ciphertext, cose->plaintext_len, cose->aad, cose->aad_len, &cose->ciphertext[cose->plaintext_len], TSize, 1);
+  if(cose->aad != NULL){
+    COSE_AES_CCM.aead(cose->nonce, cose->ciphertext, cose->plaintext_len, cose->aad, cose->aad_len, &cose->ciphertext[cose->plaintext_len], TSize, 1);
+  }else{
+    struct cose_aes_ccm_mic mic;
+    mic_start_aad(cose, &mic, cose->plaintext_len, TSize);
+    COSE_AES_CCM.aead_finish(&mic, cose->nonce, cose->ciphertext, cose->plaintext_len, &cose->ciphertext[cose->plaintext_len], TSize, 1);
+  }
   PRINTF("CCM STAR ciphertext:\n");
   PRINTF_HEX(cose->ciphertext, cose->ciphertext_len);
 
@@ -461,14 +574,24 @@ uint8_t OPT_COSE_Decrypt(opt_cose_encrypt_t *cose, uint8_t *key, size_t key_len)
   uint8_t tag[TagSize];
 
   COSE_AES_CCM.set_key(key);
-  COSE_AES_CCM.aead(cose->nonce, cose->ciphertext, cose->plaintext_len, cose->aad, cose->aad_len, tag, TagSize, 0);
+  if(cose->aad != NULL){
+    COSE_AES_CCM.aead(cose->nonce, cose->ciphertext, cose->plaintext_len, cose->aad, cose->aad_len, tag, TagSize, 0);
+  }else{
+    struct cose_aes_ccm_mic mic;
+    mic_start_aad(cose, &mic, cose->plaintext_len, TagSize);
+    COSE_AES_CCM.aead_finish(&mic, cose->nonce, cose->ciphertext, cose->plaintext_len, tag, TagSize, 0);
+  }
 
   if(memcmp(tag, &cose->ciphertext[cose->plaintext_len], TagSize) != 0){
   	PRINTF("ERROR vadidating AES-CCM tag\n");
   	return 1;
   }
-  //Move the decrypted plaintext to the plaintext fielf
-  memcpy(cose->plaintext, cose->ciphertext, cose->plaintext_len);
+  //The plaintext is decrypted in place unless a plaintext buffer is set
+  if(cose->plaintext == NULL){
+    cose->plaintext = cose->ciphertext;
+  }else if(cose->plaintext != cose->ciphertext){
+    memcpy(cose->plaintext, cose->ciphertext, cose->plaintext_len);
+  }
 
 
 	if(ret == 0){
@@ -35,6 +35,8 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "er-oscoap.h"
 #include <inttypes.h>
 
+#define OPT_COSE_EXTERNAL_AAD_FRAGS 4
+
 typedef struct opt_cose_encrypt_t{
 
 	uint8_t alg;
@@ -60,8 +62,18 @@ typedef struct opt_cose_encrypt_t{
 	uint8_t *aad;
 	size_t aad_len;
 	
+	/* The external AAD may be given in pieces, external_aad is the
+	 * first of them and external_aad_len the total length */
 	uint8_t *external_aad;
 	size_t external_aad_len;
+	uint8_t *external_aad_frag[OPT_COSE_EXTERNAL_AAD_FRAGS];
+	uint8_t external_aad_frag_len[OPT_COSE_EXTERNAL_AAD_FRAGS];
+	uint8_t external_aad_frags;
+
+	/* Serialized protected header, when the object is decoded or laid
+	 * out by OPT_COSE_Encode_Header() */
+	uint8_t *protected;
+	size_t protected_len;
 
 	uint8_t *plaintext;
 	size_t plaintext_len;
@@ -105,8 +117,14 @@ size_t OPT_COSE_Encoded_length(opt_cose_encrypt_t *cose);
 size_t OPT_COSE_Decode(opt_cose_encrypt_t *cose, uint8_t *buffer, size_t buffer_len);
 
 size_t OPT_COSE_Encode(opt_cose_encrypt_t *cose, uint8_t *buffer);
-uint8_t OPT_COSE_Build_AAD(opt_cose_encrypt_t *cose, uint8_t *buffer);
-size_t  OPT_COSE_AAD_length(opt_cose_encrypt_t *cose, int is_request);
+uint8_t OPT_COSE_AddExternalAAD(opt_cose_encrypt_t *cose, uint8_t *external_aad_buffer, size_t external_aad_len);
+
+/* In place encoding: OPT_COSE_Encode_Header() writes the object up to the
+ * ciphertext and returns where the plaintext is to be put, the plaintext
+ * is encrypted there and OPT_COSE_Encode_Trailer() completes the object
+ * with the signature and returns its length. */
+uint8_t* OPT_COSE_Encode_Header(opt_cose_encrypt_t *cose, uint8_t *buffer);
+size_t OPT_COSE_Encode_Trailer(opt_cose_encrypt_t *cose, uint8_t *buffer);
 
 uint8_t OPT_COSE_Encode_Protected(opt_cose_encrypt_t *cose, uint8_t **buffer);
 
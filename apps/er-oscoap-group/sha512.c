@@ -0,0 +1,375 @@
+/* SHA512
+ * Daniel Beer <dlbeer@gmail.com>, 22 Apr 2014
+ *
+ * This file is in the public domain.
+ */
+
+#include "sha512.h"
+
+const struct sha512_state sha512_initial_state = { {
+	0x6a09e667f3bcc908LL, 0xbb67ae8584caa73bLL,
+	0x3c6ef372fe94f82bLL, 0xa54ff53a5f1d36f1LL,
+	0x510e527fade682d1LL, 0x9b05688c2b3e6c1fLL,
+	0x1f83d9abfb41bd6bLL, 0x5be0cd19137e2179LL,
+} };
+
+static const uint64_t round_k[80] = {
+	0x428a2f98d728ae22LL, 0x7137449123ef65cdLL,
+	0xb5c0fbcfec4d3b2fLL, 0xe9b5dba58189dbbcLL,
+	0x3956c25bf348b538LL, 0x59f111f1b605d019LL,
+	0x923f82a4af194f9bLL, 0xab1c5ed5da6d8118LL,
+	0xd807aa98a3030242LL, 0x12835b0145706fbeLL,
+	0x243185be4ee4b28cLL, 0x550c7dc3d5ffb4e2LL,
+	0x72be5d74f27b896fLL, 0x80deb1fe3b1696b1LL,
+	0x9bdc06a725c71235LL, 0xc19bf174cf692694LL,
+	0xe49b69c19ef14ad2LL, 0xefbe4786384f25e3LL,
+	0x0fc19dc68b8cd5b5LL, 0x240ca1cc77ac9c65LL,
+	0x2de92c6f592b0275LL, 0x4a7484aa6ea6e483LL,
+	0x5cb0a9dcbd41fbd4LL, 0x76f988da831153b5LL,
+	0x983e5152ee66dfabLL, 0xa831c66d2db43210LL,
+	0xb00327c898fb213fLL, 0xbf597fc7beef0ee4LL,
+	0xc6e00bf33da88fc2LL, 0xd5a79147930aa725LL,
+	0x06ca6351e003826fLL, 0x142929670a0e6e70LL,
+	0x27b70a8546d22ffcLL, 0x2e1b21385c26c926LL,
+	0x4d2c6dfc5ac42aedLL, 0x53380d139d95b3dfLL,
+	0x650a73548baf63deLL, 0x766a0abb3c77b2a8LL,
+	0x81c2c92e47edaee6LL, 0x92722c851482353bLL,
+	0xa2bfe8a14cf10364LL, 0xa81a664bbc423001LL,
+	0xc24b8b70d0f89791LL, 0xc76c51a30654be30LL,
+	0xd192e819d6ef5218LL, 0xd69906245565a910LL,
+	0xf40e35855771202aLL, 0x106aa07032bbd1b8LL,
+	0x19a4c116b8d2d0c8LL, 0x1e376c085141ab53LL,
+	0x2748774cdf8eeb99LL, 0x34b0bcb5e19b48a8LL,
+	0x391c0cb3c5c95a63LL, 0x4ed8aa4ae3418acbLL,
+	0x5b9cca4f7763e373LL, 0x682e6ff3d6b2b8a3LL,
+	0x748f82ee5defb2fcLL, 0x78a5636f43172f60LL,
+	0x84c87814a1f0ab72LL, 0x8cc702081a6439ecLL,
+	0x90befffa23631e28LL, 0xa4506cebde82bde9LL,
+	0xbef9a3f7b2c67915LL, 0xc67178f2e372532bLL,
+	0xca273eceea26619cLL, 0xd186b8c721c0c207LL,
+	0xeada7dd6cde0eb1eLL, 0xf57d4f7fee6ed178LL,
+	0x06f067aa72176fbaLL, 0x0a637dc5a2c898a6LL,
+	0x113f9804bef90daeLL, 0x1b710b35131c471bLL,
+	0x28db77f523047d84LL, 0x32caab7b40c72493LL,
+	0x3c9ebe0a15c9bebcLL, 0x431d67c49c100d4cLL,
+	0x4cc5d4becb3e42b6LL, 0x597f299cfc657e2aLL,
+	0x5fcb6fab3ad6faecLL, 0x6c44198c4a475817LL,
+};
+
+static inline uint64_t load64(const uint8_t *x)
+{
+	uint64_t r;
+
+	r = *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+	r = (r << 8) | *(x++);
+
+	return r;
+}
+
+static inline void store64(uint8_t *x, uint64_t v)
+{
+	x += 7;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+	v >>= 8;
+	*(x--) = v;
+}
+
+static inline uint64_t rot64(uint64_t x, int bits)
+{
+	return (x >> bits) | (x << (64 - bits));
+}
+
+/* Compression backend, selected at build time:
+ *
+ *     64: rounds on 64-bit words, unrolled eight at a time so that the
+ *         a..h rotation is done by renaming instead of moves
+ *     32: each word held as a pair of 32-bit halves, with rotations and
+ *         carries spelled out, for MCUs without 64-bit registers where
+ *         the compiler's 64-bit emulation is slow
+ */
+#ifdef SHA512_CONF_WORD_SIZE
+#define SHA512_WORD_SIZE SHA512_CONF_WORD_SIZE
+#elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 8
+#define SHA512_WORD_SIZE 64
+#else
+#define SHA512_WORD_SIZE 32
+#endif
+
+#if SHA512_WORD_SIZE == 64
+
+#define S0(x)	(rot64(x, 28) ^ rot64(x, 34) ^ rot64(x, 39))
+#define S1(x)	(rot64(x, 14) ^ rot64(x, 18) ^ rot64(x, 41))
+#define s0(x)	(rot64(x, 1) ^ rot64(x, 8) ^ ((x) >> 7))
+#define s1(x)	(rot64(x, 19) ^ rot64(x, 61) ^ ((x) >> 6))
+
+/* Round i, with w[i & 15] replaced by w[i + 16] for the later rounds */
+#define ROUND(a, b, c, d, e, f, g, h, i) do {				\
+	const uint64_t t = h + S1(e) + ((e & f) ^ (~e & g)) +		\
+		round_k[i] + w[(i) & 15];				\
+									\
+	d += t;								\
+	h = t + S0(a) + ((a & b) ^ (a & c) ^ (b & c));			\
+	w[(i) & 15] += s0(w[((i) + 1) & 15]) + w[((i) + 9) & 15] +	\
+		s1(w[((i) + 14) & 15]);					\
+} while (0)
+
+void sha512_block(struct sha512_state *s, const uint8_t *blk)
+{
+	uint64_t w[16];
+	uint64_t a, b, c, d, e, f, g, h;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = load64(blk);
+		blk += 8;
+	}
+
+	a = s->h[0];
+	b = s->h[1];
+	c = s->h[2];
+	d = s->h[3];
+	e = s->h[4];
+	f = s->h[5];
+	g = s->h[6];
+	h = s->h[7];
+
+	for (i = 0; i < 80; i += 8) {
+		ROUND(a, b, c, d, e, f, g, h, i);
+		ROUND(h, a, b, c, d, e, f, g, i + 1);
+		ROUND(g, h, a, b, c, d, e, f, i + 2);
+		ROUND(f, g, h, a, b, c, d, e, i + 3);
+		ROUND(e, f, g, h, a, b, c, d, i + 4);
+		ROUND(d, e, f, g, h, a, b, c, i + 5);
+		ROUND(c, d, e, f, g, h, a, b, i + 6);
+		ROUND(b, c, d, e, f, g, h, a, i + 7);
+	}
+
+	s->h[0] += a;
+	s->h[1] += b;
+	s->h[2] += c;
+	s->h[3] += d;
+	s->h[4] += e;
+	s->h[5] += f;
+	s->h[6] += g;
+	s->h[7] += h;
+}
+
+#else /* SHA512_WORD_SIZE == 64 */
+
+static inline uint32_t load32(const uint8_t *x)
+{
+	return ((uint32_t)x[0] << 24) | ((uint32_t)x[1] << 16) |
+		((uint32_t)x[2] << 8) | x[3];
+}
+
+/* High and low halves of a 64-bit rotation right by n, 0 < n < 32.
+ * Rotations by 32 + n swap the halves first.
+ */
+#define ROTH(h, l, n)	(((h) >> (n)) | ((l) << (32 - (n))))
+#define ROTL(h, l, n)	(((l) >> (n)) | ((h) << (32 - (n))))
+
+/* (rh, rl) += (xh, xl) */
+#define ADD(rh, rl, xh, xl) do {					\
+	const uint32_t add_l = (xl);					\
+									\
+	rl += add_l;							\
+	rh += (xh) + (rl < add_l);					\
+} while (0)
+
+void sha512_block(struct sha512_state *s, const uint8_t *blk)
+{
+	uint32_t wh[16], wl[16];
+	uint32_t vh[8], vl[8];
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		wh[i] = load32(blk);
+		wl[i] = load32(blk + 4);
+		blk += 8;
+	}
+
+	for (i = 0; i < 8; i++) {
+		vh[i] = s->h[i] >> 32;
+		vl[i] = s->h[i];
+	}
+
+	for (i = 0; i < 80; i++) {
+		const uint32_t ah = vh[0], al = vl[0];
+		const uint32_t eh = vh[4], el = vl[4];
+		uint32_t th = vh[7], tl = vl[7];
+		uint32_t uh, ul;
+		int j;
+
+		/* t = h + S1(e) + ch(e, f, g) + k[i] + w[i] */
+		ADD(th, tl, ROTH(eh, el, 14) ^ ROTH(eh, el, 18) ^
+			    ROTH(el, eh, 9),
+			    ROTL(eh, el, 14) ^ ROTL(eh, el, 18) ^
+			    ROTL(el, eh, 9));
+		ADD(th, tl, (eh & vh[5]) ^ (~eh & vh[6]),
+			    (el & vl[5]) ^ (~el & vl[6]));
+		ADD(th, tl, round_k[i] >> 32, round_k[i]);
+		ADD(th, tl, wh[i & 15], wl[i & 15]);
+
+		/* u = t + S0(a) + maj(a, b, c) */
+		uh = th;
+		ul = tl;
+		ADD(uh, ul, ROTH(ah, al, 28) ^ ROTH(al, ah, 2) ^
+			    ROTH(al, ah, 7),
+			    ROTL(ah, al, 28) ^ ROTL(al, ah, 2) ^
+			    ROTL(al, ah, 7));
+		ADD(uh, ul, (ah & vh[1]) ^ (ah & vh[2]) ^ (vh[1] & vh[2]),
+			    (al & vl[1]) ^ (al & vl[2]) ^ (vl[1] & vl[2]));
+
+		/* (a, ..., h) = (u, a, b, c, d + t, e, f, g) */
+		for (j = 7; j > 0; j--) {
+			vh[j] = vh[j - 1];
+			vl[j] = vl[j - 1];
+		}
+		vh[0] = uh;
+		vl[0] = ul;
+		ADD(vh[4], vl[4], th, tl);
+
+		/* w[i & 15] becomes w[i + 16] */
+		if (i < 64) {
+			const uint32_t xh = wh[(i + 1) & 15];
+			const uint32_t xl = wl[(i + 1) & 15];
+			const uint32_t yh = wh[(i + 14) & 15];
+			const uint32_t yl = wl[(i + 14) & 15];
+
+			ADD(wh[i & 15], wl[i & 15],
+			    ROTH(xh, xl, 1) ^ ROTH(xh, xl, 8) ^ (xh >> 7),
+			    ROTL(xh, xl, 1) ^ ROTL(xh, xl, 8) ^
+			    ((xl >> 7) | (xh << 25)));
+			ADD(wh[i & 15], wl[i & 15],
+			    wh[(i + 9) & 15], wl[(i + 9) & 15]);
+			ADD(wh[i & 15], wl[i & 15],
+			    ROTH(yh, yl, 19) ^ ROTH(yl, yh, 29) ^ (yh >> 6),
+			    ROTL(yh, yl, 19) ^ ROTL(yl, yh, 29) ^
+			    ((yl >> 6) | (yh << 26)));
+		}
+	}
+
+	for (i = 0; i < 8; i++)
+		s->h[i] += ((uint64_t)vh[i] << 32) | vl[i];
+}
+
+#endif /* SHA512_WORD_SIZE == 64 */
+
+void sha512_final(struct sha512_state *s, const uint8_t *blk,
+		  size_t total_size)
+{
+	uint8_t temp[SHA512_BLOCK_SIZE] = {0};
+	const size_t last_size = total_size & (SHA512_BLOCK_SIZE - 1);
+
+	if (last_size)
+		memcpy(temp, blk, last_size);
+	temp[last_size] = 0x80;
+
+	if (last_size > 111) {
+		sha512_block(s, temp);
+		memset(temp, 0, sizeof(temp));
+	}
+
+	/* Note: we assume total_size fits in 61 bits */
+	store64(temp + SHA512_BLOCK_SIZE - 8, total_size << 3);
+	sha512_block(s, temp);
+}
+
+void sha512_get(const struct sha512_state *s, uint8_t *hash,
+		unsigned int offset, unsigned int len)
+{
+	int i;
+
+	if (offset > SHA512_BLOCK_SIZE)
+		return;
+
+	if (len > SHA512_BLOCK_SIZE - offset)
+		len = SHA512_BLOCK_SIZE - offset;
+
+	/* Skip whole words */
+	i = offset >> 3;
+	offset &= 7;
+
+	/* Skip/read out bytes */
+	if (offset) {
+		uint8_t tmp[8];
+		unsigned int c = 8 - offset;
+
+		if (c > len)
+			c = len;
+
+		store64(tmp, s->h[i++]);
+		memcpy(hash, tmp + offset, c);
+		len -= c;
+		hash += c;
+	}
+
+	/* Read out whole words */
+	while (len >= 8) {
+		store64(hash, s->h[i++]);
+		hash += 8;
+		len -= 8;
+	}
+
+	/* Read out bytes */
+	if (len) {
+		uint8_t tmp[8];
+
+		store64(tmp, s->h[i]);
+		memcpy(hash, tmp, len);
+	}
+}
+
+void sha512_update(struct sha512_ctx *c, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	const size_t used = c->len & (SHA512_BLOCK_SIZE - 1);
+
+	c->len += len;
+
+	if (used) {
+		const size_t n = SHA512_BLOCK_SIZE - used;
+
+		if (len < n) {
+			memcpy(c->buf + used, p, len);
+			return;
+		}
+
+		memcpy(c->buf + used, p, n);
+		sha512_block(&c->s, c->buf);
+		p += n;
+		len -= n;
+	}
+
+	while (len >= SHA512_BLOCK_SIZE) {
+		sha512_block(&c->s, p);
+		p += SHA512_BLOCK_SIZE;
+		len -= SHA512_BLOCK_SIZE;
+	}
+
+	memcpy(c->buf, p, len);
+}
+
+void sha512_finish(struct sha512_ctx *c, uint8_t *hash)
+{
+	sha512_final(&c->s, c->buf, c->len);
+	sha512_get(&c->s, hash, 0, SHA512_HASH_SIZE);
+}
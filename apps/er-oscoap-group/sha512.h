@@ -49,4 +49,31 @@ void sha512_final(struct sha512_state *s, const uint8_t *blk,
 void sha512_get(const struct sha512_state *s, uint8_t *hash,
 		unsigned int offset, unsigned int len);
 
+/* Streaming interface. Data may be fed in pieces of any size; only the
+ * tail of an incomplete block is copied, full blocks are compressed
+ * from where they are.
+ *
+ * A context holds no pointers, so it can be copied by assignment. A
+ * copy taken after feeding a common prefix can be finished several
+ * times with different suffixes, saving the blocks of the prefix.
+ */
+struct sha512_ctx {
+	struct sha512_state	s;
+	uint8_t			buf[SHA512_BLOCK_SIZE];
+	size_t			len;
+};
+
+static inline void sha512_start(struct sha512_ctx *c)
+{
+	sha512_init(&c->s);
+	c->len = 0;
+}
+
+void sha512_update(struct sha512_ctx *c, const void *data, size_t len);
+
+/* Write out the SHA512_HASH_SIZE byte hash. The context must be started
+ * again before reuse.
+ */
+void sha512_finish(struct sha512_ctx *c, uint8_t *hash);
+
 #endif
@@ -1,731 +0,0 @@
-/* Curve25519 (Montgomery form)
- * Daniel Beer <dlbeer@gmail.com>, 18 Apr 2014
- *
- * This file is in the public domain.
- */
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <assert.h>
-#include "c25519.h"
-
-struct test_vector {
-	const uint8_t p[F25519_SIZE];
-	const uint8_t e[C25519_EXPONENT_SIZE];
-	const uint8_t r[F25519_SIZE];
-};
-
-static const struct test_vector vectors[] = {
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x67, 0xc6, 0x69, 0x73, 0x51, 0xff, 0x4a, 0xec,
-			0x29, 0xcd, 0xba, 0xab, 0xf2, 0xfb, 0xe3, 0x46,
-			0x7c, 0xc2, 0x54, 0xf8, 0x1b, 0xe8, 0xe7, 0x8d,
-			0x76, 0x5a, 0x2e, 0x63, 0x33, 0x9f, 0xc9, 0x9a,
-		},
-		.r = {
-			0x63, 0xa8, 0xfd, 0x14, 0xa5, 0x7b, 0x6e, 0xcc,
-			0xea, 0x4e, 0xcd, 0x7a, 0xaf, 0xd3, 0x1d, 0xe6,
-			0x1d, 0x79, 0x6a, 0x69, 0x6e, 0x8f, 0x16, 0x27,
-			0x8a, 0xbe, 0x1c, 0x9f, 0xea, 0x23, 0x7e, 0x05,
-		},
-	},
-	{
-		.p = {
-			0x63, 0xa8, 0xfd, 0x14, 0xa5, 0x7b, 0x6e, 0xcc,
-			0xea, 0x4e, 0xcd, 0x7a, 0xaf, 0xd3, 0x1d, 0xe6,
-			0x1d, 0x79, 0x6a, 0x69, 0x6e, 0x8f, 0x16, 0x27,
-			0x8a, 0xbe, 0x1c, 0x9f, 0xea, 0x23, 0x7e, 0x05,
-		},
-		.e = {
-			0x66, 0x32, 0x0d, 0xb7, 0x31, 0x58, 0xa3, 0x5a,
-			0x25, 0x5d, 0x05, 0x17, 0x58, 0xe9, 0x5e, 0xd4,
-			0xab, 0xb2, 0xcd, 0xc6, 0x9b, 0xb4, 0x54, 0x11,
-			0x0e, 0x82, 0x74, 0x41, 0x21, 0x3d, 0xdc, 0x87,
-		},
-		.r = {
-			0xab, 0x94, 0x34, 0xd5, 0x84, 0x11, 0x51, 0xb8,
-			0xd6, 0xb8, 0x68, 0x94, 0xf0, 0x99, 0x8b, 0x73,
-			0xef, 0x0a, 0x9f, 0x7a, 0x89, 0x6a, 0x77, 0x58,
-			0x6b, 0x01, 0x36, 0x8e, 0xd9, 0x0c, 0x45, 0x61,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x70, 0xe9, 0x3e, 0xa1, 0x41, 0xe1, 0xfc, 0x67,
-			0x3e, 0x01, 0x7e, 0x97, 0xea, 0xdc, 0x6b, 0x96,
-			0x8f, 0x38, 0x5c, 0x2a, 0xec, 0xb0, 0x3b, 0xfb,
-			0x32, 0xaf, 0x3c, 0x54, 0xec, 0x18, 0xdb, 0x5c,
-		},
-		.r = {
-			0x38, 0x2b, 0x3a, 0x36, 0x60, 0x4b, 0xdf, 0xf5,
-			0x42, 0x87, 0xcc, 0xa6, 0x6f, 0x5e, 0xe4, 0x52,
-			0x1a, 0x6e, 0x20, 0x4d, 0x93, 0xf1, 0x43, 0x23,
-			0x6b, 0xab, 0x9b, 0x66, 0xbf, 0x4f, 0x7e, 0x6f,
-		},
-	},
-	{
-		.p = {
-			0x38, 0x2b, 0x3a, 0x36, 0x60, 0x4b, 0xdf, 0xf5,
-			0x42, 0x87, 0xcc, 0xa6, 0x6f, 0x5e, 0xe4, 0x52,
-			0x1a, 0x6e, 0x20, 0x4d, 0x93, 0xf1, 0x43, 0x23,
-			0x6b, 0xab, 0x9b, 0x66, 0xbf, 0x4f, 0x7e, 0x6f,
-		},
-		.e = {
-			0x02, 0x1a, 0xfe, 0x43, 0xfb, 0xfa, 0xaa, 0x3a,
-			0xfb, 0x29, 0xd1, 0xe6, 0x05, 0x3c, 0x7c, 0x94,
-			0x75, 0xd8, 0xbe, 0x61, 0x89, 0xf9, 0x5c, 0xbb,
-			0xa8, 0x99, 0x0f, 0x95, 0xb1, 0xeb, 0xf1, 0xb3,
-		},
-		.r = {
-			0xc4, 0xe3, 0x70, 0x02, 0xfd, 0x17, 0x26, 0x7b,
-			0xc1, 0x8a, 0x51, 0xaf, 0xec, 0xd9, 0x92, 0xde,
-			0xec, 0x1e, 0x78, 0x28, 0xd0, 0x24, 0x5a, 0xb2,
-			0x80, 0x5b, 0x6a, 0x27, 0x8f, 0x98, 0xd1, 0x63,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x05, 0xef, 0xf7, 0x00, 0xe9, 0xa1, 0x3a, 0xe5,
-			0xca, 0x0b, 0xcb, 0xd0, 0x48, 0x47, 0x64, 0xbd,
-			0x1f, 0x23, 0x1e, 0xa8, 0x1c, 0x7b, 0x64, 0xc5,
-			0x14, 0x73, 0x5a, 0xc5, 0x5e, 0x4b, 0x79, 0x63,
-		},
-		.r = {
-			0xd8, 0x0f, 0x52, 0xa0, 0xda, 0xe5, 0xdd, 0xf2,
-			0x4d, 0xa0, 0x7b, 0xb2, 0xc6, 0xec, 0x55, 0xa8,
-			0x90, 0x03, 0xe9, 0x09, 0x37, 0xca, 0xaa, 0xec,
-			0xa3, 0xf6, 0xd6, 0x82, 0x57, 0x29, 0x63, 0x26,
-		},
-	},
-	{
-		.p = {
-			0xd8, 0x0f, 0x52, 0xa0, 0xda, 0xe5, 0xdd, 0xf2,
-			0x4d, 0xa0, 0x7b, 0xb2, 0xc6, 0xec, 0x55, 0xa8,
-			0x90, 0x03, 0xe9, 0x09, 0x37, 0xca, 0xaa, 0xec,
-			0xa3, 0xf6, 0xd6, 0x82, 0x57, 0x29, 0x63, 0x26,
-		},
-		.e = {
-			0x3b, 0x70, 0x64, 0x24, 0x11, 0x9e, 0x09, 0xdc,
-			0xaa, 0xd4, 0xac, 0xf2, 0x1b, 0x10, 0xaf, 0x3b,
-			0x33, 0xcd, 0xe3, 0x50, 0x48, 0x47, 0x15, 0x5c,
-			0xbb, 0x6f, 0x22, 0x19, 0xba, 0x9b, 0x7d, 0xf5,
-		},
-		.r = {
-			0xd8, 0xb4, 0x63, 0xb2, 0x1e, 0x6a, 0xa3, 0xb9,
-			0x63, 0xb9, 0x42, 0xc0, 0x72, 0x2b, 0xe2, 0x17,
-			0xef, 0xcc, 0x2e, 0x6f, 0x6b, 0x8b, 0x84, 0x17,
-			0x27, 0x6a, 0x11, 0x1c, 0xb7, 0xb6, 0xfa, 0x4a,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x0b, 0xe1, 0x1a, 0x1c, 0x7f, 0x23, 0xf8, 0x29,
-			0xf8, 0xa4, 0x1b, 0x13, 0xb5, 0xca, 0x4e, 0xe8,
-			0x98, 0x32, 0x38, 0xe0, 0x79, 0x4d, 0x3d, 0x34,
-			0xbc, 0x5f, 0x4e, 0x77, 0xfa, 0xcb, 0x6c, 0x05,
-		},
-		.r = {
-			0xa4, 0xad, 0x8e, 0x97, 0x85, 0xa3, 0x1d, 0xc6,
-			0x10, 0xb1, 0x03, 0xe3, 0xb8, 0xf3, 0x46, 0x71,
-			0xbd, 0xe2, 0xb9, 0x9f, 0x35, 0x97, 0x14, 0xe0,
-			0x28, 0x3f, 0x95, 0xe3, 0x8a, 0x5a, 0x2b, 0x7c,
-		},
-	},
-	{
-		.p = {
-			0xa4, 0xad, 0x8e, 0x97, 0x85, 0xa3, 0x1d, 0xc6,
-			0x10, 0xb1, 0x03, 0xe3, 0xb8, 0xf3, 0x46, 0x71,
-			0xbd, 0xe2, 0xb9, 0x9f, 0x35, 0x97, 0x14, 0xe0,
-			0x28, 0x3f, 0x95, 0xe3, 0x8a, 0x5a, 0x2b, 0x7c,
-		},
-		.e = {
-			0xac, 0x86, 0x21, 0x2b, 0xaa, 0x1a, 0x55, 0xa2,
-			0xbe, 0x70, 0xb5, 0x73, 0x3b, 0x04, 0x5c, 0xd3,
-			0x36, 0x94, 0xb3, 0xaf, 0xe2, 0xf0, 0xe4, 0x9e,
-			0x4f, 0x32, 0x15, 0x49, 0xfd, 0x82, 0x4e, 0xa9,
-		},
-		.r = {
-			0x2d, 0xbd, 0x67, 0x11, 0xb6, 0x37, 0x40, 0xf4,
-			0x19, 0x9c, 0xd3, 0x91, 0x85, 0x8a, 0xe7, 0xeb,
-			0x0b, 0xdb, 0xb1, 0x44, 0x4d, 0x56, 0x1c, 0x8e,
-			0xf2, 0x5c, 0x8a, 0x3c, 0x63, 0x31, 0x3c, 0x3b,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x08, 0x70, 0xd4, 0xb2, 0x8a, 0x29, 0x54, 0x48,
-			0x9a, 0x0a, 0xbc, 0xd5, 0x0e, 0x18, 0xa8, 0x44,
-			0xac, 0x5b, 0xf3, 0x8e, 0x4c, 0xd7, 0x2d, 0x9b,
-			0x09, 0x42, 0xe5, 0x06, 0xc4, 0x33, 0xaf, 0xcd,
-		},
-		.r = {
-			0x47, 0x86, 0x22, 0x44, 0x48, 0x37, 0x2a, 0x68,
-			0xe7, 0x03, 0xf2, 0x6b, 0xb7, 0xc9, 0xb5, 0xbd,
-			0xb0, 0x73, 0x61, 0xea, 0x66, 0x4f, 0x6a, 0x88,
-			0xd9, 0x2f, 0x7e, 0x5d, 0xbc, 0xc3, 0xdd, 0x4a,
-		},
-	},
-	{
-		.p = {
-			0x47, 0x86, 0x22, 0x44, 0x48, 0x37, 0x2a, 0x68,
-			0xe7, 0x03, 0xf2, 0x6b, 0xb7, 0xc9, 0xb5, 0xbd,
-			0xb0, 0x73, 0x61, 0xea, 0x66, 0x4f, 0x6a, 0x88,
-			0xd9, 0x2f, 0x7e, 0x5d, 0xbc, 0xc3, 0xdd, 0x4a,
-		},
-		.e = {
-			0xa3, 0x84, 0x7f, 0x2d, 0xad, 0xd4, 0x76, 0x47,
-			0xde, 0x32, 0x1c, 0xec, 0x4a, 0xc4, 0x30, 0xf6,
-			0x20, 0x23, 0x85, 0x6c, 0xfb, 0xb2, 0x07, 0x04,
-			0xf4, 0xec, 0x0b, 0xb9, 0x20, 0xba, 0x86, 0xc3,
-		},
-		.r = {
-			0xdc, 0x0f, 0xe0, 0xb3, 0x4c, 0x1e, 0x70, 0x57,
-			0xd8, 0x68, 0x9a, 0x5d, 0x4f, 0x85, 0x65, 0x1e,
-			0xbe, 0xc9, 0x4d, 0x25, 0x9c, 0xed, 0xf9, 0x77,
-			0x8f, 0x40, 0xbf, 0xd7, 0x00, 0x7b, 0x20, 0x4b,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x3e, 0x05, 0xf1, 0xec, 0xd9, 0x67, 0x33, 0xb7,
-			0x99, 0x50, 0xa3, 0xe3, 0x14, 0xd3, 0xd9, 0x34,
-			0xf7, 0x5e, 0xa0, 0xf2, 0x10, 0xa8, 0xf6, 0x05,
-			0x94, 0x01, 0xbe, 0xb4, 0xbc, 0x44, 0x78, 0xfa,
-		},
-		.r = {
-			0x36, 0x6d, 0x94, 0x20, 0x1c, 0x71, 0xc3, 0x63,
-			0xb8, 0xf5, 0x31, 0x56, 0x29, 0x77, 0xb4, 0xbd,
-			0x02, 0xcf, 0xb9, 0xb5, 0x7e, 0xc5, 0x0a, 0xdc,
-			0x3d, 0xb0, 0x6a, 0xf5, 0x23, 0x30, 0x50, 0x0d,
-		},
-	},
-	{
-		.p = {
-			0x36, 0x6d, 0x94, 0x20, 0x1c, 0x71, 0xc3, 0x63,
-			0xb8, 0xf5, 0x31, 0x56, 0x29, 0x77, 0xb4, 0xbd,
-			0x02, 0xcf, 0xb9, 0xb5, 0x7e, 0xc5, 0x0a, 0xdc,
-			0x3d, 0xb0, 0x6a, 0xf5, 0x23, 0x30, 0x50, 0x0d,
-		},
-		.e = {
-			0x49, 0x69, 0xe6, 0x23, 0xd0, 0x1a, 0xda, 0x69,
-			0x6a, 0x7e, 0x4c, 0x7e, 0x51, 0x25, 0xb3, 0x48,
-			0x84, 0x53, 0x3a, 0x94, 0xfb, 0x31, 0x99, 0x90,
-			0x32, 0x57, 0x44, 0xee, 0x9b, 0xbc, 0xe9, 0xe5,
-		},
-		.r = {
-			0xb1, 0x9c, 0xa9, 0x64, 0xf1, 0x8e, 0x57, 0x6e,
-			0x2e, 0x9b, 0xec, 0x3c, 0xeb, 0xfe, 0xac, 0xfd,
-			0xa9, 0xd3, 0x66, 0x47, 0xdb, 0x80, 0xff, 0xfd,
-			0xb7, 0x27, 0x10, 0x35, 0x86, 0xc1, 0xbc, 0x5e,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x25, 0xcf, 0x08, 0xf5, 0xe9, 0xe2, 0x5e, 0x53,
-			0x60, 0xaa, 0xd2, 0xb2, 0xd0, 0x85, 0xfa, 0x54,
-			0xd8, 0x35, 0xe8, 0xd4, 0x66, 0x82, 0x64, 0x98,
-			0xd9, 0xa8, 0x87, 0x75, 0x65, 0x70, 0x5a, 0x8a,
-		},
-		.r = {
-			0x73, 0x49, 0x38, 0x9e, 0xae, 0x58, 0x97, 0x88,
-			0xd0, 0x9f, 0x65, 0xc7, 0x49, 0x95, 0x78, 0x16,
-			0xeb, 0x73, 0x52, 0x0b, 0x10, 0x23, 0x3a, 0xd3,
-			0x50, 0x41, 0xbe, 0x99, 0xe0, 0x8c, 0x1c, 0x4b,
-		},
-	},
-	{
-		.p = {
-			0x73, 0x49, 0x38, 0x9e, 0xae, 0x58, 0x97, 0x88,
-			0xd0, 0x9f, 0x65, 0xc7, 0x49, 0x95, 0x78, 0x16,
-			0xeb, 0x73, 0x52, 0x0b, 0x10, 0x23, 0x3a, 0xd3,
-			0x50, 0x41, 0xbe, 0x99, 0xe0, 0x8c, 0x1c, 0x4b,
-		},
-		.e = {
-			0x3f, 0x62, 0x80, 0x29, 0x44, 0xde, 0x7c, 0xa5,
-			0x89, 0x4e, 0x57, 0x59, 0xd3, 0x51, 0xad, 0xac,
-			0x86, 0x95, 0x80, 0xec, 0x17, 0xe4, 0x85, 0xf1,
-			0x8c, 0x0c, 0x66, 0xf1, 0x7c, 0xc0, 0x7c, 0xbb,
-		},
-		.r = {
-			0x18, 0x7c, 0x0a, 0xd6, 0x0e, 0x8e, 0x3d, 0xdb,
-			0xd7, 0x09, 0xff, 0xc8, 0x40, 0x12, 0x05, 0x5e,
-			0x0a, 0x63, 0xf1, 0xc1, 0xf0, 0x81, 0x08, 0xa7,
-			0x52, 0xe3, 0xaa, 0x2d, 0xac, 0xd7, 0xf2, 0x43,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x22, 0xfc, 0xe4, 0x66, 0xda, 0x61, 0x0b, 0x63,
-			0xaf, 0x62, 0xbc, 0x83, 0xb4, 0x69, 0x2f, 0x3a,
-			0xff, 0xaf, 0x27, 0x16, 0x93, 0xac, 0x07, 0x1f,
-			0xb8, 0x6d, 0x11, 0x34, 0x2d, 0x8d, 0xef, 0x4f,
-		},
-		.r = {
-			0xd9, 0x66, 0x13, 0x7f, 0xa8, 0x31, 0x90, 0x9b,
-			0x8f, 0x1f, 0xe7, 0x2e, 0x17, 0xef, 0x07, 0x83,
-			0x75, 0x71, 0x0e, 0x80, 0x73, 0xde, 0x51, 0x5e,
-			0x0c, 0x56, 0x86, 0x93, 0x31, 0x0f, 0x11, 0x36,
-		},
-	},
-	{
-		.p = {
-			0xd9, 0x66, 0x13, 0x7f, 0xa8, 0x31, 0x90, 0x9b,
-			0x8f, 0x1f, 0xe7, 0x2e, 0x17, 0xef, 0x07, 0x83,
-			0x75, 0x71, 0x0e, 0x80, 0x73, 0xde, 0x51, 0x5e,
-			0x0c, 0x56, 0x86, 0x93, 0x31, 0x0f, 0x11, 0x36,
-		},
-		.e = {
-			0x89, 0xd4, 0xb6, 0x63, 0x35, 0xc1, 0xc7, 0xe4,
-			0x24, 0x83, 0x67, 0xd8, 0xed, 0x96, 0x12, 0xec,
-			0x45, 0x39, 0x02, 0xd8, 0xe5, 0x0a, 0xf8, 0x9d,
-			0x77, 0x09, 0xd1, 0xa5, 0x96, 0xc1, 0xf4, 0x1f,
-		},
-		.r = {
-			0x5e, 0x84, 0x29, 0x54, 0x7b, 0x2d, 0xb4, 0xe8,
-			0x16, 0xa3, 0x75, 0x52, 0x99, 0x47, 0x08, 0xfb,
-			0x74, 0x0c, 0xd7, 0x6b, 0x7c, 0x98, 0x51, 0x1e,
-			0x05, 0xd1, 0x26, 0x5d, 0x67, 0x14, 0xb3, 0x02,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x95, 0xaa, 0x82, 0xca, 0x6c, 0x49, 0xae, 0x90,
-			0xcd, 0x16, 0x68, 0xba, 0xac, 0x7a, 0xa6, 0xf2,
-			0xb4, 0xa8, 0xca, 0x99, 0xb2, 0xc2, 0x37, 0x2a,
-			0xcb, 0x08, 0xcf, 0x61, 0xc9, 0xc3, 0x80, 0x5e,
-		},
-		.r = {
-			0x59, 0x3e, 0xf6, 0xd2, 0x4b, 0x68, 0x8b, 0xd9,
-			0x7f, 0x88, 0x04, 0x7b, 0xff, 0xec, 0xab, 0x3d,
-			0xb2, 0xdb, 0xdc, 0x1f, 0x09, 0x85, 0x4e, 0xd4,
-			0xd2, 0xe0, 0x05, 0x99, 0x2b, 0x7b, 0x7b, 0x1b,
-		},
-	},
-	{
-		.p = {
-			0x59, 0x3e, 0xf6, 0xd2, 0x4b, 0x68, 0x8b, 0xd9,
-			0x7f, 0x88, 0x04, 0x7b, 0xff, 0xec, 0xab, 0x3d,
-			0xb2, 0xdb, 0xdc, 0x1f, 0x09, 0x85, 0x4e, 0xd4,
-			0xd2, 0xe0, 0x05, 0x99, 0x2b, 0x7b, 0x7b, 0x1b,
-		},
-		.e = {
-			0x6e, 0x03, 0x28, 0xda, 0x4c, 0xd7, 0x6a, 0x19,
-			0xed, 0xd2, 0xd3, 0x99, 0x4c, 0x79, 0x8b, 0x00,
-			0x22, 0x56, 0x9a, 0xd4, 0x18, 0xd1, 0xfe, 0xe4,
-			0xd9, 0xcd, 0x45, 0xa3, 0x91, 0xc6, 0x01, 0xff,
-		},
-		.r = {
-			0x04, 0x90, 0x82, 0x15, 0xa4, 0xef, 0x09, 0xa8,
-			0x71, 0xd6, 0x52, 0x3d, 0x18, 0x30, 0x15, 0x5e,
-			0x7e, 0x64, 0xe4, 0x01, 0x0f, 0xa8, 0xf2, 0xcf,
-			0x3e, 0x5d, 0x48, 0x0e, 0x40, 0xa2, 0x33, 0x33,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0xc9, 0x2a, 0xd9, 0x15, 0x01, 0x43, 0x2f, 0xee,
-			0x15, 0x02, 0x87, 0x61, 0x7c, 0x13, 0x62, 0x9e,
-			0x69, 0xfc, 0x72, 0x81, 0xcd, 0x71, 0x65, 0xa6,
-			0x3e, 0xab, 0x49, 0xcf, 0x71, 0x4b, 0xce, 0x3a,
-		},
-		.r = {
-			0xe8, 0x7c, 0x05, 0x67, 0x77, 0xd2, 0xd5, 0xdd,
-			0x7f, 0xe7, 0xff, 0x0a, 0x8e, 0xa3, 0x9b, 0x53,
-			0x6d, 0x53, 0x42, 0x87, 0x9f, 0xbc, 0xde, 0xc0,
-			0xf4, 0x09, 0x3a, 0xd2, 0x71, 0x7f, 0x21, 0x22,
-		},
-	},
-	{
-		.p = {
-			0xe8, 0x7c, 0x05, 0x67, 0x77, 0xd2, 0xd5, 0xdd,
-			0x7f, 0xe7, 0xff, 0x0a, 0x8e, 0xa3, 0x9b, 0x53,
-			0x6d, 0x53, 0x42, 0x87, 0x9f, 0xbc, 0xde, 0xc0,
-			0xf4, 0x09, 0x3a, 0xd2, 0x71, 0x7f, 0x21, 0x22,
-		},
-		.e = {
-			0x75, 0xa7, 0x4f, 0x76, 0xea, 0x7e, 0x64, 0xff,
-			0x81, 0xeb, 0x61, 0xfd, 0xfe, 0xc3, 0x9b, 0x67,
-			0xbf, 0x0d, 0xe9, 0x8c, 0x7e, 0x4e, 0x32, 0xbd,
-			0xf9, 0x7c, 0x8c, 0x6a, 0xc7, 0x5b, 0xa4, 0x3c,
-		},
-		.r = {
-			0x88, 0xd1, 0x56, 0x14, 0x30, 0xa3, 0xfb, 0xbe,
-			0xf6, 0x6c, 0x1e, 0x55, 0xd7, 0xb3, 0xac, 0xea,
-			0x6d, 0x8e, 0xb4, 0xb4, 0x05, 0x8e, 0xaf, 0x82,
-			0x4a, 0x07, 0xdc, 0xa4, 0xb7, 0x2e, 0xed, 0x11,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x02, 0xf4, 0xb2, 0xed, 0x72, 0x16, 0xec, 0xf3,
-			0x01, 0x4d, 0xf0, 0x00, 0x10, 0x8b, 0x67, 0xcf,
-			0x99, 0x50, 0x5b, 0x17, 0x9f, 0x8e, 0xd4, 0x98,
-			0x0a, 0x61, 0x03, 0xd1, 0xbc, 0xa7, 0x0d, 0xbe,
-		},
-		.r = {
-			0x4e, 0xdb, 0x9d, 0x4d, 0xa2, 0xd9, 0x11, 0x7f,
-			0xad, 0x01, 0xf4, 0x36, 0x7b, 0x03, 0xd9, 0xa3,
-			0x87, 0xe7, 0x58, 0x8e, 0x96, 0x21, 0xac, 0xf6,
-			0x84, 0xc1, 0x46, 0xbc, 0xd2, 0x28, 0x24, 0x1b,
-		},
-	},
-	{
-		.p = {
-			0x4e, 0xdb, 0x9d, 0x4d, 0xa2, 0xd9, 0x11, 0x7f,
-			0xad, 0x01, 0xf4, 0x36, 0x7b, 0x03, 0xd9, 0xa3,
-			0x87, 0xe7, 0x58, 0x8e, 0x96, 0x21, 0xac, 0xf6,
-			0x84, 0xc1, 0x46, 0xbc, 0xd2, 0x28, 0x24, 0x1b,
-		},
-		.e = {
-			0x9b, 0xbf, 0xab, 0x0e, 0xd5, 0x98, 0x01, 0xd6,
-			0xe5, 0xf2, 0xd6, 0xf6, 0x7d, 0x3e, 0xc5, 0x16,
-			0x8e, 0x21, 0x2e, 0x2d, 0xaf, 0x02, 0xc6, 0xb9,
-			0x63, 0xc9, 0x8a, 0x1f, 0x70, 0x97, 0xde, 0x0c,
-		},
-		.r = {
-			0xdb, 0x70, 0x2a, 0x4f, 0x1e, 0x15, 0xb7, 0x6b,
-			0x67, 0x2f, 0x83, 0xa2, 0x58, 0x65, 0x43, 0x0b,
-			0xec, 0xbc, 0xfb, 0xa2, 0xaa, 0x13, 0x3c, 0x68,
-			0xc3, 0x2b, 0x8e, 0x37, 0x84, 0x32, 0xf2, 0x43,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x56, 0x89, 0x1a, 0x2b, 0x21, 0x1b, 0x01, 0x07,
-			0x0d, 0xd8, 0xfd, 0x8b, 0x16, 0xc2, 0xa1, 0xa4,
-			0xe3, 0xcf, 0xd2, 0x92, 0xd2, 0x98, 0x4b, 0x35,
-			0x61, 0xd5, 0x55, 0xd1, 0x6c, 0x33, 0xdd, 0xc2,
-		},
-		.r = {
-			0xa9, 0x8e, 0xc9, 0x3e, 0x6d, 0xc9, 0xe2, 0xe7,
-			0xf1, 0xa8, 0x59, 0xf6, 0xac, 0x6b, 0xd6, 0x7b,
-			0x4b, 0xcd, 0xa0, 0xef, 0x45, 0xd1, 0xf6, 0x2e,
-			0x35, 0x35, 0x7e, 0x62, 0x4c, 0xcc, 0xcd, 0x1d,
-		},
-	},
-	{
-		.p = {
-			0xa9, 0x8e, 0xc9, 0x3e, 0x6d, 0xc9, 0xe2, 0xe7,
-			0xf1, 0xa8, 0x59, 0xf6, 0xac, 0x6b, 0xd6, 0x7b,
-			0x4b, 0xcd, 0xa0, 0xef, 0x45, 0xd1, 0xf6, 0x2e,
-			0x35, 0x35, 0x7e, 0x62, 0x4c, 0xcc, 0xcd, 0x1d,
-		},
-		.e = {
-			0xbc, 0xf7, 0xed, 0xde, 0x13, 0xef, 0xe5, 0x20,
-			0xc7, 0xe2, 0xab, 0xdd, 0xa4, 0x4d, 0x81, 0x88,
-			0x1c, 0x53, 0x1a, 0xee, 0xeb, 0x66, 0x24, 0x4c,
-			0x3b, 0x79, 0x1e, 0xa8, 0xac, 0xfb, 0x6a, 0x68,
-		},
-		.r = {
-			0xd6, 0x18, 0x84, 0xc0, 0x0d, 0xa1, 0xb5, 0xf2,
-			0xdf, 0x6c, 0x92, 0x3d, 0x8a, 0xa0, 0x95, 0xc7,
-			0x57, 0x67, 0xbf, 0x71, 0x0b, 0xf7, 0xb7, 0x4f,
-			0xd9, 0x4a, 0x4e, 0x01, 0xf0, 0x01, 0xab, 0x2a,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0xf3, 0x58, 0x46, 0x06, 0x47, 0x2b, 0x26, 0x0e,
-			0x0d, 0xd2, 0xeb, 0xb2, 0x1f, 0x6c, 0x3a, 0x3b,
-			0xc0, 0x54, 0x2a, 0xab, 0xba, 0x4e, 0xf8, 0xf6,
-			0xc7, 0x16, 0x9e, 0x73, 0x11, 0x08, 0xdb, 0x04,
-		},
-		.r = {
-			0xd5, 0x62, 0x64, 0x0b, 0xa0, 0xb5, 0x33, 0x29,
-			0x25, 0x05, 0xa0, 0x77, 0xb9, 0x53, 0xa8, 0xb3,
-			0x0c, 0xc6, 0x7a, 0x79, 0x8e, 0x02, 0x59, 0xd3,
-			0x33, 0x7b, 0x97, 0xbc, 0x2f, 0xc3, 0x7f, 0x28,
-		},
-	},
-	{
-		.p = {
-			0xd5, 0x62, 0x64, 0x0b, 0xa0, 0xb5, 0x33, 0x29,
-			0x25, 0x05, 0xa0, 0x77, 0xb9, 0x53, 0xa8, 0xb3,
-			0x0c, 0xc6, 0x7a, 0x79, 0x8e, 0x02, 0x59, 0xd3,
-			0x33, 0x7b, 0x97, 0xbc, 0x2f, 0xc3, 0x7f, 0x28,
-		},
-		.e = {
-			0x60, 0x22, 0x0a, 0xa7, 0x4d, 0x31, 0xb5, 0x5b,
-			0x03, 0xa0, 0x0d, 0x22, 0x0d, 0x47, 0x5d, 0xcd,
-			0x9b, 0x87, 0x78, 0x56, 0xd5, 0x70, 0x4c, 0x9c,
-			0x86, 0xea, 0x0f, 0x98, 0xf2, 0xeb, 0x9c, 0x53,
-		},
-		.r = {
-			0xcd, 0x7b, 0x6c, 0x18, 0x90, 0x3a, 0x49, 0xc6,
-			0x09, 0x85, 0xe7, 0x29, 0x40, 0x03, 0xd3, 0xf6,
-			0x88, 0xa8, 0x95, 0x6f, 0xe3, 0x40, 0x68, 0x65,
-			0xb0, 0x4e, 0x6e, 0xa8, 0xf0, 0x67, 0x5b, 0x0f,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x0d, 0xa7, 0xfa, 0x5a, 0xd8, 0xb0, 0xb5, 0xdb,
-			0x50, 0xc2, 0xfd, 0x5d, 0x09, 0x5a, 0x2a, 0xa5,
-			0xe2, 0xa3, 0xfb, 0xb7, 0x13, 0x47, 0x54, 0x9a,
-			0x31, 0x63, 0x32, 0x23, 0x4e, 0xce, 0x76, 0x5b,
-		},
-		.r = {
-			0x74, 0x0b, 0x06, 0xd7, 0x5c, 0x32, 0xa1, 0x94,
-			0x53, 0x88, 0x7f, 0xaa, 0xfa, 0xe2, 0x48, 0xa5,
-			0xb0, 0xac, 0x99, 0x96, 0x26, 0x2f, 0x6c, 0x82,
-			0x50, 0xf7, 0xf0, 0xa8, 0xc5, 0xf3, 0xc3, 0x44,
-		},
-	},
-	{
-		.p = {
-			0x74, 0x0b, 0x06, 0xd7, 0x5c, 0x32, 0xa1, 0x94,
-			0x53, 0x88, 0x7f, 0xaa, 0xfa, 0xe2, 0x48, 0xa5,
-			0xb0, 0xac, 0x99, 0x96, 0x26, 0x2f, 0x6c, 0x82,
-			0x50, 0xf7, 0xf0, 0xa8, 0xc5, 0xf3, 0xc3, 0x44,
-		},
-		.e = {
-			0x75, 0x71, 0xb6, 0x4d, 0x21, 0x6b, 0x28, 0x71,
-			0x2e, 0x25, 0xcf, 0x37, 0x80, 0xf9, 0xdc, 0x62,
-			0x9c, 0xd7, 0x19, 0xb0, 0x1e, 0x6d, 0x4a, 0x4f,
-			0xd1, 0x7c, 0x73, 0x1f, 0x4a, 0xe9, 0x7b, 0xc0,
-		},
-		.r = {
-			0x03, 0x0c, 0xa5, 0xd6, 0x3c, 0x52, 0xf1, 0x01,
-			0xb4, 0x29, 0xd8, 0x34, 0x14, 0xd2, 0x22, 0x0b,
-			0x22, 0xad, 0xfe, 0x27, 0x89, 0x0b, 0xde, 0xef,
-			0x2e, 0x23, 0x7b, 0xcf, 0x49, 0x75, 0xcf, 0x63,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0x5a, 0x31, 0x0d, 0x7b, 0x9c, 0x36, 0xed, 0xca,
-			0x5b, 0xbc, 0x02, 0xdb, 0xb5, 0xde, 0x3d, 0x52,
-			0xb6, 0x57, 0x02, 0xd4, 0xc4, 0x4c, 0x24, 0x95,
-			0xc8, 0x97, 0xb5, 0x12, 0x80, 0x30, 0xd2, 0xdb,
-		},
-		.r = {
-			0xe1, 0x20, 0x3f, 0xf6, 0xaa, 0xb6, 0x1a, 0x99,
-			0xaf, 0x90, 0xb8, 0x19, 0xb9, 0xd5, 0x48, 0x6f,
-			0x76, 0x71, 0x21, 0x84, 0x13, 0x66, 0x91, 0x63,
-			0xfe, 0xc2, 0xc4, 0x28, 0xd9, 0xe8, 0x1e, 0x0e,
-		},
-	},
-	{
-		.p = {
-			0xe1, 0x20, 0x3f, 0xf6, 0xaa, 0xb6, 0x1a, 0x99,
-			0xaf, 0x90, 0xb8, 0x19, 0xb9, 0xd5, 0x48, 0x6f,
-			0x76, 0x71, 0x21, 0x84, 0x13, 0x66, 0x91, 0x63,
-			0xfe, 0xc2, 0xc4, 0x28, 0xd9, 0xe8, 0x1e, 0x0e,
-		},
-		.e = {
-			0x61, 0xe0, 0x56, 0xfd, 0x16, 0x43, 0xc8, 0x71,
-			0xff, 0xca, 0x4d, 0xb5, 0xa8, 0x8a, 0x07, 0x5e,
-			0xe1, 0x09, 0x33, 0xa6, 0x55, 0x57, 0x3b, 0x1d,
-			0xee, 0xf0, 0x2f, 0x6e, 0x20, 0x02, 0x49, 0x81,
-		},
-		.r = {
-			0xb2, 0x0d, 0x5d, 0xe6, 0x6e, 0x0a, 0x8c, 0x74,
-			0xaa, 0xfb, 0x7b, 0x02, 0x4b, 0x25, 0x46, 0x2a,
-			0xa2, 0x17, 0x9a, 0xc1, 0x9c, 0xad, 0xa0, 0x49,
-			0x94, 0xd6, 0x9e, 0x7e, 0x8c, 0x6d, 0x47, 0x3e,
-		},
-	},
-	{
-		.p = {
-			0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		},
-		.e = {
-			0xe2, 0xa0, 0x7f, 0xf8, 0xe3, 0x47, 0x69, 0xe3,
-			0x11, 0xb6, 0x98, 0xb9, 0x41, 0x9f, 0x18, 0x22,
-			0xa8, 0x4b, 0xc8, 0xfd, 0xa2, 0x04, 0x1a, 0x90,
-			0xf4, 0x49, 0xfe, 0x15, 0x4b, 0x48, 0x96, 0x2d,
-		},
-		.r = {
-			0xfd, 0x15, 0xd9, 0xf5, 0x34, 0xac, 0xe7, 0x91,
-			0x01, 0xac, 0x9f, 0xef, 0x3d, 0x20, 0x49, 0xef,
-			0xa3, 0x2d, 0xb8, 0xda, 0x16, 0x89, 0xbf, 0xd7,
-			0x68, 0xd3, 0x37, 0xd4, 0x51, 0x30, 0x9c, 0x6a,
-		},
-	},
-	{
-		.p = {
-			0xfd, 0x15, 0xd9, 0xf5, 0x34, 0xac, 0xe7, 0x91,
-			0x01, 0xac, 0x9f, 0xef, 0x3d, 0x20, 0x49, 0xef,
-			0xa3, 0x2d, 0xb8, 0xda, 0x16, 0x89, 0xbf, 0xd7,
-			0x68, 0xd3, 0x37, 0xd4, 0x51, 0x30, 0x9c, 0x6a,
-		},
-		.e = {
-			0xe8, 0x15, 0x25, 0xcb, 0x5c, 0x8f, 0xae, 0x6d,
-			0x45, 0x46, 0x27, 0x86, 0xe5, 0x3f, 0xa9, 0x8d,
-			0x8a, 0x71, 0x8a, 0x2c, 0x75, 0xa4, 0xbc, 0x6a,
-			0xee, 0xba, 0x7f, 0x39, 0x02, 0x15, 0x67, 0xea,
-		},
-		.r = {
-			0xe5, 0xcb, 0x46, 0x91, 0x2c, 0x5f, 0x9c, 0xc4,
-			0x0d, 0xe1, 0xa7, 0xd0, 0xba, 0x6d, 0xd9, 0xa2,
-			0x57, 0x0f, 0xee, 0x27, 0xcd, 0x1c, 0x44, 0x24,
-			0x3e, 0xef, 0xd4, 0xba, 0x34, 0xb4, 0x1f, 0x3a,
-		},
-	},
-};
-
-#define NUM_VECTORS (sizeof(vectors) / sizeof(vectors[0]))
-
-static void test_dh(void)
-{
-	uint8_t e1[C25519_EXPONENT_SIZE];
-	uint8_t e2[C25519_EXPONENT_SIZE];
-	uint8_t q1[F25519_SIZE];
-	uint8_t q2[F25519_SIZE];
-	uint8_t r1[F25519_SIZE];
-	uint8_t r2[F25519_SIZE];
-	int i;
-
-	for (i = 0; i < sizeof(e1); i++)
-		e1[i] = random();
-	for (i = 0; i < sizeof(e2); i++)
-		e2[i] = random();
-
-	/* Create private keys */
-	c25519_prepare(e1);
-	c25519_prepare(e2);
-
-	/* Create public keys */
-	c25519_smult(q1, c25519_base_x, e1);
-	c25519_smult(q2, c25519_base_x, e2);
-
-	/* Diffie-Hellman exchange */
-	c25519_smult(r1, q2, e1);
-	c25519_smult(r2, q1, e2);
-
-	assert(f25519_eq(r1, r2));
-
-	printf("  ");
-	for (i = 0; i < F25519_SIZE; i++)
-		printf("%02x", q1[i]);
-	printf("\n");
-}
-
-static void test_vector(const struct test_vector *v)
-{
-	uint8_t r[F25519_SIZE];
-	uint8_t e[F25519_SIZE];
-	int i;
-
-	f25519_copy(e, v->e);
-	c25519_prepare(e);
-	c25519_smult(r, v->p, e);
-
-	assert(f25519_eq(r, v->r));
-
-	printf("  ");
-	for (i = 0; i < F25519_SIZE; i++)
-		printf("%02x", r[i]);
-	printf("\n");
-}
-
-int main(void)
-{
-	int i;
-
-	srandom(0);
-
-	printf("test_vectors\n");
-	for (i = 0; i < 32; i++)
-		test_vector(&vectors[i]);
-
-	printf("test_dh\n");
-	for (i = 0; i < 32; i++)
-		test_dh();
-
-	return 0;
-}
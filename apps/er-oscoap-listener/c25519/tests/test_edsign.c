@@ -1,114 +0,0 @@
-/* Edwards curve signature system
- * Daniel Beer <dlbeer@gmail.com>, 22 Apr 2014
- *
- * This file is in the public domain.
- */
-
-#include <stdio.h>
-#include <stdint.h>
-#include <string.h>
-#include <assert.h>
-#include "edsign.h"
-
-#define MAX_MSG_SIZE	128
-
-struct test_vector {
-	const uint8_t	secret[EDSIGN_SECRET_KEY_SIZE];
-	const uint8_t	public[EDSIGN_PUBLIC_KEY_SIZE];
-	size_t		mlen;
-	const uint8_t	message[MAX_MSG_SIZE];
-	const uint8_t	signature[EDSIGN_SIGNATURE_SIZE];
-};
-
-static const struct test_vector test_vectors[] = {
-  {
-    .secret = {
-      0xc6, 0x69, 0x73, 0x51, 0xff, 0x4a, 0xec, 0x29,
-      0xcd, 0xba, 0xab, 0xf2, 0xfb, 0xe3, 0x46, 0x7c,
-      0xc2, 0x54, 0xf8, 0x1b, 0xe8, 0xe7, 0x8d, 0x76,
-      0x5a, 0x2e, 0x63, 0x33, 0x9f, 0xc9, 0x9a, 0x66,
-    },
-    .public = {
-      0xea, 0x97, 0xf5, 0xbd, 0x16, 0x70, 0xc2, 0xd5,
-      0xdc, 0xb6, 0xa9, 0x4b, 0x42, 0x02, 0xdd, 0xfb,
-      0xe5, 0x78, 0xba, 0xfa, 0x60, 0x55, 0x28, 0xb6,
-      0xe3, 0x33, 0xdf, 0xdc, 0x7f, 0x39, 0xce, 0xca,
-    },
-    .mlen = 103,
-    .message = {
-      0xe9, 0x3e, 0xa1, 0x41, 0xe1, 0xfc, 0x67, 0x3e,
-      0x01, 0x7e, 0x97, 0xea, 0xdc, 0x6b, 0x96, 0x8f,
-      0x38, 0x5c, 0x2a, 0xec, 0xb0, 0x3b, 0xfb, 0x32,
-      0xaf, 0x3c, 0x54, 0xec, 0x18, 0xdb, 0x5c, 0x02,
-      0x1a, 0xfe, 0x43, 0xfb, 0xfa, 0xaa, 0x3a, 0xfb,
-      0x29, 0xd1, 0xe6, 0x05, 0x3c, 0x7c, 0x94, 0x75,
-      0xd8, 0xbe, 0x61, 0x89, 0xf9, 0x5c, 0xbb, 0xa8,
-      0x99, 0x0f, 0x95, 0xb1, 0xeb, 0xf1, 0xb3, 0x05,
-      0xef, 0xf7, 0x00, 0xe9, 0xa1, 0x3a, 0xe5, 0xca,
-      0x0b, 0xcb, 0xd0, 0x48, 0x47, 0x64, 0xbd, 0x1f,
-      0x23, 0x1e, 0xa8, 0x1c, 0x7b, 0x64, 0xc5, 0x14,
-      0x73, 0x5a, 0xc5, 0x5e, 0x4b, 0x79, 0x63, 0x3b,
-      0x70, 0x64, 0x24, 0x11, 0x9e, 0x09, 0xdc,
-    },
-    .signature = {0},
-   }
-};
-
-#define NUM_VECTORS (sizeof(test_vectors) / sizeof(test_vectors[0]))
-
-static void print_hex(const char *label, const uint8_t *data, int len)
-{
-	int i;
-
-	printf("%s: ", label);
-	for (i = 0; i < len; i++)
-		printf("%02x", data[i]);
-	printf("\n");
-}
-
-static void test(const struct test_vector *t)
-{
-	uint8_t pub[EDSIGN_PUBLIC_KEY_SIZE];
-	uint8_t msg[MAX_MSG_SIZE];
-	uint8_t signature[EDSIGN_SIGNATURE_SIZE];
-  uint8_t secret[EDSIGN_SECRET_KEY_SIZE];
-
-	//edsign_sec_to_pub(pub, t->secret);
-	edsign_sec_to_pub(pub, secret);
-
-//	print_hex("Secret", t->secret, sizeof(t->secret));
-	print_hex("Secret", secret, sizeof(secret));
-	print_hex("Public", pub, sizeof(pub));
-	//assert(!memcmp(t->public, pub, sizeof(t->public)));
-
-	memcpy(msg, t->message, t->mlen);
-//	edsign_sign(signature, pub, t->secret, msg, t->mlen);
-	edsign_sign(signature, pub, secret, msg, t->mlen);
-
-	print_hex("Message", msg, t->mlen);
-	print_hex("Signature", signature, sizeof(signature));
-	//assert(!memcmp(t->signature, signature, sizeof(t->signature)));
-
-	//assert(edsign_verify(signature, pub, msg, t->mlen));
-
-	msg[0] ^= 1;
-	assert(!edsign_verify(signature, pub, msg, t->mlen));
-	msg[0] ^= 1;
-
-	signature[0] ^= 1;
-	assert(!edsign_verify(signature, pub, msg, t->mlen));
-	signature[0] ^= 1;
-
-	signature[32] ^= 1;
-	assert(!edsign_verify(signature, pub, msg, t->mlen));
-	signature[32] ^= 1;
-}
-
-int main(void)
-{
-
-		test(&test_vectors[0]);
-		printf("\n");
-
-	return 0;
-}
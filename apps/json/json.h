@@ -49,6 +49,7 @@
 #define JSON_TYPE_INT 'I'
 #define JSON_TYPE_NUMBER '0'
 #define JSON_TYPE_ERROR 0
+#define JSON_TYPE_MORE 'M' /* the parser needs the next chunk of input */
 
 /* how should we handle null vs false - both can be 0? */
 #define JSON_TYPE_NULL 'n'
@@ -72,7 +73,8 @@ enum {
   JSON_ERROR_UNEXPECTED_END_OF_ARRAY,
   JSON_ERROR_UNEXPECTED_OBJECT,
   JSON_ERROR_UNEXPECTED_END_OF_OBJECT,
-  JSON_ERROR_UNEXPECTED_STRING
+  JSON_ERROR_UNEXPECTED_STRING,
+  JSON_ERROR_TOO_LONG
 };
 
 #define JSON_CONTENT_TYPE "application/json"
@@ -62,6 +62,30 @@ pop(struct jsonparse_state *state)
   return state->stack[state->depth];
 }
 /*--------------------------------------------------------------------*/
+/* the value being scanned runs into the end of a chunk that is not the
+   last one */
+static int
+chunk_end(struct jsonparse_state *state)
+{
+  return state->pos >= state->len &&
+    (state->more || (state->json == state->carry &&
+                     state->len - state->carry_len < state->next_len));
+}
+/*--------------------------------------------------------------------*/
+static char
+incomplete(struct jsonparse_state *state, int start)
+{
+  if(state->json == state->carry &&
+     state->len - state->carry_len < state->next_len) {
+    /* the carry buffer is full and the value still goes on */
+    state->error = JSON_ERROR_TOO_LONG;
+    return JSON_TYPE_ERROR;
+  }
+  /* back up to the start of the value and wait for the next chunk */
+  state->pos = start;
+  return JSON_TYPE_MORE;
+}
+/*--------------------------------------------------------------------*/
 /* will pass by the value and store the start and length of the value for
    atomic types */
 /*--------------------------------------------------------------------*/
@@ -74,27 +98,30 @@ atomic(struct jsonparse_state *state, char type)
 
   state->vstart = state->pos;
   if(type == JSON_TYPE_STRING || type == JSON_TYPE_PAIR_NAME) {
-    while((c = state->json[state->pos++]) && c != '"') {
+    c = 0;
+    while(state->pos < state->len && (c = state->json[state->pos++]) != '"') {
       if(c == '\\') {
         state->pos++;           /* skip current char */
       }
     }
     if (c != '"') {
+      if(chunk_end(state)) {
+        return incomplete(state, state->vstart - 1);
+      }
       state->error = JSON_ERROR_SYNTAX;
       return JSON_TYPE_ERROR;
     }
     state->vlen = state->pos - state->vstart - 1;
   } else if(type == JSON_TYPE_NUMBER) {
-    do {
-      c = state->json[state->pos];
-      if((c < '0' || c > '9') && c != '.') {
-        c = 0;
-      } else {
-        state->pos++;
-      }
-    } while(c);
+    while(state->pos < state->len &&
+          (((c = state->json[state->pos]) >= '0' && c <= '9') || c == '.')) {
+      state->pos++;
+    }
     /* need to back one step since first char is already gone */
     state->vstart--;
+    if(chunk_end(state)) {
+      return incomplete(state, state->vstart);
+    }
     state->vlen = state->pos - state->vstart;
   } else if(type == JSON_TYPE_NULL || type == JSON_TYPE_TRUE || type == JSON_TYPE_FALSE) {
     state->vstart--;
@@ -105,9 +132,13 @@ atomic(struct jsonparse_state *state, char type)
     default:              str = "";      break;
     }
 
-    while ((c = state->json[state->pos]) && c != ' ' && c != ',' && c != ']' && c != '}') {
+    while (state->pos < state->len && (c = state->json[state->pos]) &&
+           c != ' ' && c != ',' && c != ']' && c != '}') {
       state->pos++;
     }
+    if(chunk_end(state)) {
+      return incomplete(state, state->vstart);
+    }
 
     state->vlen = state->pos - state->vstart;
     len = strlen(str);
@@ -155,6 +186,44 @@ jsonparse_setup(struct jsonparse_state *state, const char *json, int len)
   state->error = 0;
   state->vtype = 0;
   state->stack[0] = 0;
+  state->more = 0;
+  state->carry_len = 0;
+  state->next = NULL;
+  state->next_len = 0;
+}
+/*--------------------------------------------------------------------*/
+void
+jsonparse_feed(struct jsonparse_state *state, const char *json, int len,
+               int more)
+{
+  int tail;
+  int n;
+
+  /* what is left of the previous chunk is the start of a cut value */
+  tail = state->more ? state->len - state->pos : 0;
+  if(tail <= 0) {
+    state->json = json;
+    state->len = len;
+    state->pos = 0;
+  } else if(tail >= JSONPARSE_CARRY_SIZE) {
+    state->error = JSON_ERROR_TOO_LONG;
+  } else {
+    /* complete the value in the carry buffer; parsing moves on to the
+       chunk itself once the value has been passed */
+    memmove(state->carry, &state->json[state->pos], tail);
+    n = JSONPARSE_CARRY_SIZE - tail;
+    if(n > len) {
+      n = len;
+    }
+    memcpy(&state->carry[tail], json, n);
+    state->json = state->carry;
+    state->len = tail + n;
+    state->pos = 0;
+    state->carry_len = tail;
+    state->next = json;
+    state->next_len = len;
+  }
+  state->more = more;
 }
 /*--------------------------------------------------------------------*/
 int
@@ -164,8 +233,23 @@ jsonparse_next(struct jsonparse_state *state)
   char s;
   char v;
 
+  if(state->error != JSON_ERROR_OK) {
+    return JSON_TYPE_ERROR;
+  }
+  if(state->json == state->carry && state->pos >= state->carry_len) {
+    /* past the carried value, continue in the chunk it came from */
+    state->pos -= state->carry_len;
+    state->json = state->next;
+    state->len = state->next_len;
+  }
   skip_ws(state);
-  c = state->json[state->pos];
+  if(state->pos < state->len) {
+    c = state->json[state->pos];
+  } else if(state->more) {
+    return JSON_TYPE_MORE;
+  } else {
+    c = 0;
+  }
   s = jsonparse_get_type(state);
   v = state->vtype;
   state->pos++;
@@ -298,21 +382,41 @@ jsonparse_copy_value(struct jsonparse_state *state, char *str, int size)
 }
 /*--------------------------------------------------------------------*/
 int
-jsonparse_get_value_as_int(struct jsonparse_state *state)
+jsonparse_get_value(struct jsonparse_state *state, const char **value)
 {
-  if(state->vtype != JSON_TYPE_NUMBER) {
+  if(!is_atomic(state)) {
+    *value = NULL;
     return 0;
   }
-  return atoi(&state->json[state->vstart]);
+  *value = &state->json[state->vstart];
+  return state->vlen;
+}
+/*--------------------------------------------------------------------*/
+int
+jsonparse_get_value_as_int(struct jsonparse_state *state)
+{
+  return (int)jsonparse_get_value_as_long(state);
 }
 /*--------------------------------------------------------------------*/
+/* the value need not be followed by a delimiter in the buffer, so it is
+   converted within its own length instead of with atol() */
+/*--------------------------------------------------------------------*/
 long
 jsonparse_get_value_as_long(struct jsonparse_state *state)
 {
+  const char *p;
+  long value;
+  int i;
+
   if(state->vtype != JSON_TYPE_NUMBER) {
     return 0;
   }
-  return atol(&state->json[state->vstart]);
+  p = &state->json[state->vstart];
+  value = 0;
+  for(i = (*p == '-'); i < state->vlen && p[i] >= '0' && p[i] <= '9'; i++) {
+    value = value * 10 + (p[i] - '0');
+  }
+  return *p == '-' ? -value : value;
 }
 /*--------------------------------------------------------------------*/
 /* strcmp - assume no strange chars that needs to be stuffed in string... */
@@ -41,6 +41,13 @@
 #define JSONPARSE_MAX_DEPTH 10
 #endif
 
+/* room for a value that is cut at the end of a chunk, see jsonparse_feed() */
+#ifdef JSONPARSE_CONF_CARRY_SIZE
+#define JSONPARSE_CARRY_SIZE JSONPARSE_CONF_CARRY_SIZE
+#else
+#define JSONPARSE_CARRY_SIZE 32
+#endif
+
 struct jsonparse_state {
   const char *json;
   int pos;
@@ -52,6 +59,12 @@ struct jsonparse_state {
   char vtype;
   char error;
   char stack[JSONPARSE_MAX_DEPTH];
+  /* for parsing a document fed in chunks */
+  char more;
+  int carry_len;
+  const char *next;
+  int next_len;
+  char carry[JSONPARSE_CARRY_SIZE];
 };
 
 /**
@@ -66,9 +79,32 @@ struct jsonparse_state {
 void jsonparse_setup(struct jsonparse_state *state, const char *json,
                      int len);
 
-/* move to next JSON element */
+/**
+ * \brief      Hand the next chunk of a document to a JSON parser.
+ * \param state A pointer to a JSON parser state
+ * \param json The next chunk of the document
+ * \param len  The length of the chunk
+ * \param more Non-zero if more chunks follow this one
+ *
+ *             This function lets a document that arrives in pieces,
+ *             such as the blocks of a CoAP block-wise transfer, be
+ *             parsed without first collecting it in one buffer. Set
+ *             the parser up with an empty string and feed it each
+ *             chunk after jsonparse_next() has returned
+ *             JSON_TYPE_MORE. A value cut at the end of a chunk is
+ *             completed in a carry buffer of JSONPARSE_CARRY_SIZE
+ *             bytes; a longer one fails with JSON_ERROR_TOO_LONG.
+ */
+void jsonparse_feed(struct jsonparse_state *state, const char *json,
+                    int len, int more);
+
+/* move to next JSON element, JSON_TYPE_MORE at the end of a fed chunk */
 int jsonparse_next(struct jsonparse_state *state);
 
+/* point at the current JSON value in the input, without copying or
+   unescaping it, and return its length */
+int jsonparse_get_value(struct jsonparse_state *state, const char **value);
+
 /* copy the current JSON value into the specified buffer */
 int jsonparse_copy_value(struct jsonparse_state *state, char *buf,
                          int buf_size);
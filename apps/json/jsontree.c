@@ -50,36 +50,90 @@
 #define PRINTF(...)
 #endif
 
+/* jsontree_context flags */
+#define JSONTREE_OVERFLOW 0x01
+#define JSONTREE_DONE     0x02
+
+/*---------------------------------------------------------------------------*/
+static void
+write_bytes(struct jsontree_context *js_ctx, const char *text, int len)
+{
+  int n;
+
+  if(js_ctx->buf == NULL) {
+    while(len-- > 0) {
+      js_ctx->putchar(*text++);
+    }
+    return;
+  }
+
+  if(js_ctx->flags & JSONTREE_OVERFLOW) {
+    return;
+  }
+
+  /* leave out what an earlier, interrupted pass has already delivered */
+  if(js_ctx->skip > 0) {
+    n = len < js_ctx->skip ? len : js_ctx->skip;
+    js_ctx->skip -= n;
+    text += n;
+    len -= n;
+  }
+  n = js_ctx->buf_size - js_ctx->buf_pos;
+  if(n > len) {
+    n = len;
+  }
+  memcpy(&js_ctx->buf[js_ctx->buf_pos], text, n);
+  js_ctx->buf_pos += n;
+  text += n;
+  len -= n;
+
+  /* the rest of the value goes out first in the next chunk */
+  if(len > JSONTREE_CARRY_SIZE - js_ctx->carry_len) {
+    js_ctx->flags |= JSONTREE_OVERFLOW;
+    return;
+  }
+  memcpy(&js_ctx->carry[js_ctx->carry_len], text, len);
+  js_ctx->carry_len += len;
+}
+/*---------------------------------------------------------------------------*/
+static void
+write_char(struct jsontree_context *js_ctx, char c)
+{
+  write_bytes(js_ctx, &c, 1);
+}
 /*---------------------------------------------------------------------------*/
 void
-jsontree_write_atom(const struct jsontree_context *js_ctx, const char *text)
+jsontree_write_atom(struct jsontree_context *js_ctx, const char *text)
 {
   if(text == NULL) {
-    js_ctx->putchar('0');
+    write_char(js_ctx, '0');
   } else {
-    while(*text != '\0') {
-      js_ctx->putchar(*text++);
-    }
+    write_bytes(js_ctx, text, strlen(text));
   }
 }
 /*---------------------------------------------------------------------------*/
 void
-jsontree_write_string(const struct jsontree_context *js_ctx, const char *text)
+jsontree_write_string(struct jsontree_context *js_ctx, const char *text)
 {
-  js_ctx->putchar('"');
+  const char *run;
+
+  write_char(js_ctx, '"');
   if(text != NULL) {
     while(*text != '\0') {
-      if(*text == '"') {
-        js_ctx->putchar('\\');
+      /* write everything up to the next character to escape at once */
+      for(run = text; *text != '\0' && *text != '"' && *text != '\\'; text++);
+      write_bytes(js_ctx, run, text - run);
+      if(*text != '\0') {
+        write_char(js_ctx, '\\');
+        write_char(js_ctx, *text++);
       }
-      js_ctx->putchar(*text++);
     }
   }
-  js_ctx->putchar('"');
+  write_char(js_ctx, '"');
 }
 /*---------------------------------------------------------------------------*/
 void
-jsontree_write_uint(const struct jsontree_context *js_ctx, unsigned int value)
+jsontree_write_uint(struct jsontree_context *js_ctx, unsigned int value)
 {
   char buf[10];
   int l;
@@ -90,16 +144,14 @@ jsontree_write_uint(const struct jsontree_context *js_ctx, unsigned int value)
     value /= 10;
   } while(value > 0 && l >= 0);
 
-  while(++l < sizeof(buf)) {
-    js_ctx->putchar(buf[l]);
-  }
+  write_bytes(js_ctx, &buf[l + 1], sizeof(buf) - l - 1);
 }
 /*---------------------------------------------------------------------------*/
 void
-jsontree_write_int(const struct jsontree_context *js_ctx, int value)
+jsontree_write_int(struct jsontree_context *js_ctx, int value)
 {
   if(value < 0) {
-    js_ctx->putchar('-');
+    write_char(js_ctx, '-');
     value = -value;
   }
 
@@ -121,6 +173,10 @@ jsontree_reset(struct jsontree_context *js_ctx)
 {
   js_ctx->depth = 0;
   js_ctx->index[0] = 0;
+  js_ctx->buf = NULL;
+  js_ctx->skip = 0;
+  js_ctx->flags = 0;
+  js_ctx->carry_len = 0;
 }
 /*---------------------------------------------------------------------------*/
 const char *
@@ -153,46 +209,46 @@ jsontree_print_next(struct jsontree_context *js_ctx)
 
     index = js_ctx->index[js_ctx->depth];
     if(index == 0) {
-      js_ctx->putchar(v->type);
+      write_char(js_ctx, v->type);
 #if JSONTREE_PRETTY
-      js_ctx->putchar('\n');
+      write_char(js_ctx, '\n');
 #endif
     }
     if(index >= o->count) {
 #if JSONTREE_PRETTY
-      js_ctx->putchar('\n');
+      write_char(js_ctx, '\n');
       indent = js_ctx->depth;
       while (indent--) {
-        js_ctx->putchar(' ');
-        js_ctx->putchar(' ');
+        write_char(js_ctx, ' ');
+        write_char(js_ctx, ' ');
       }
 #endif
-      js_ctx->putchar(v->type + 2);
+      write_char(js_ctx, v->type + 2);
       /* Default operation: back up one level! */
       break;
     }
 
     if(index > 0) {
-      js_ctx->putchar(',');
+      write_char(js_ctx, ',');
 #if JSONTREE_PRETTY
-      js_ctx->putchar('\n');
+      write_char(js_ctx, '\n');
 #endif
     }
 
 #if JSONTREE_PRETTY
     indent = js_ctx->depth + 1;
     while (indent--) {
-      js_ctx->putchar(' ');
-      js_ctx->putchar(' ');
+      write_char(js_ctx, ' ');
+      write_char(js_ctx, ' ');
     }
 #endif
 
     if(v->type == JSON_TYPE_OBJECT) {
       jsontree_write_string(js_ctx,
                             ((struct jsontree_object *)o)->pairs[index].name);
-      js_ctx->putchar(':');
+      write_char(js_ctx, ':');
 #if JSONTREE_PRETTY
-      js_ctx->putchar(' ');
+      write_char(js_ctx, ' ');
 #endif
       ov = ((struct jsontree_object *)o)->pairs[index].value;
     } else {
@@ -272,6 +328,77 @@ jsontree_print_next(struct jsontree_context *js_ctx)
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+int
+jsontree_print_chunk(struct jsontree_context *js_ctx, char *buf, int size)
+{
+  uint8_t depth;
+  uint16_t index;
+  uint16_t parent_index;
+  int callback_state;
+  uint32_t skip;
+  uint16_t pos;
+  int more;
+
+  js_ctx->buf = buf;
+  js_ctx->buf_size = size;
+  js_ctx->buf_pos = 0;
+
+  /* the part of the last value that did not fit before */
+  if(js_ctx->carry_len > 0) {
+    js_ctx->buf_pos = js_ctx->carry_len < size ? js_ctx->carry_len : size;
+    memcpy(buf, js_ctx->carry, js_ctx->buf_pos);
+    js_ctx->carry_len -= js_ctx->buf_pos;
+    memmove(js_ctx->carry, &js_ctx->carry[js_ctx->buf_pos],
+            js_ctx->carry_len);
+  }
+
+  while(!(js_ctx->flags & JSONTREE_DONE) &&
+        js_ctx->buf_pos < js_ctx->buf_size) {
+    /* remember where this value starts, in case it does not fit */
+    depth = js_ctx->depth;
+    index = js_ctx->index[depth];
+    parent_index = depth > 0 ? js_ctx->index[depth - 1] : 0;
+    callback_state = js_ctx->callback_state;
+    skip = js_ctx->skip;
+    pos = js_ctx->buf_pos;
+
+    more = jsontree_print_next(js_ctx) && js_ctx->path <= js_ctx->depth;
+
+    if(js_ctx->flags & JSONTREE_OVERFLOW) {
+      /* print the value again next time, leaving out the part that fit */
+      js_ctx->flags &= ~JSONTREE_OVERFLOW;
+      js_ctx->depth = depth;
+      js_ctx->index[depth] = index;
+      if(depth > 0) {
+        js_ctx->index[depth - 1] = parent_index;
+      }
+      js_ctx->callback_state = callback_state;
+      js_ctx->skip = skip + (js_ctx->buf_pos - pos);
+      js_ctx->carry_len = 0;
+      break;
+    }
+    if(!more) {
+      js_ctx->flags |= JSONTREE_DONE;
+    }
+  }
+
+  /* back to putchar() for jsontree_print_next() */
+  js_ctx->buf = NULL;
+  return js_ctx->buf_pos;
+}
+/*---------------------------------------------------------------------------*/
+int
+jsontree_print_done(const struct jsontree_context *js_ctx)
+{
+  return (js_ctx->flags & JSONTREE_DONE) != 0 && js_ctx->carry_len == 0;
+}
+/*---------------------------------------------------------------------------*/
+void
+jsontree_skip(struct jsontree_context *js_ctx, uint32_t count)
+{
+  js_ctx->skip += count;
+}
+/*---------------------------------------------------------------------------*/
 static struct jsontree_value *
 find_next(struct jsontree_context *js_ctx)
 {
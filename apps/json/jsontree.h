@@ -55,6 +55,14 @@
 #define JSONTREE_PRETTY 0
 #endif /* JSONTREE_CONF_PRETTY */
 
+/* room for the rest of a value cut at the end of a chunk, see
+   jsontree_print_chunk() */
+#ifdef JSONTREE_CONF_CARRY_SIZE
+#define JSONTREE_CARRY_SIZE JSONTREE_CONF_CARRY_SIZE
+#else
+#define JSONTREE_CARRY_SIZE 32
+#endif /* JSONTREE_CONF_CARRY_SIZE */
+
 struct jsontree_context {
   struct jsontree_value *values[JSONTREE_MAX_DEPTH];
   uint16_t index[JSONTREE_MAX_DEPTH];
@@ -62,6 +70,14 @@ struct jsontree_context {
   uint8_t depth;
   uint8_t path;
   int callback_state;
+  /* output buffer when printed through jsontree_print_chunk() */
+  char *buf;
+  uint16_t buf_size;
+  uint16_t buf_pos;
+  uint32_t skip;
+  uint8_t flags;
+  uint8_t carry_len;
+  char carry[JSONTREE_CARRY_SIZE];
 };
 
 struct jsontree_value {
@@ -146,14 +162,43 @@ void jsontree_reset(struct jsontree_context *js_ctx);
 const char *jsontree_path_name(const struct jsontree_context *js_ctx,
                                int depth);
 
-void jsontree_write_uint(const struct jsontree_context *js_ctx,
+void jsontree_write_uint(struct jsontree_context *js_ctx,
                          unsigned int value);
-void jsontree_write_int(const struct jsontree_context *js_ctx, int value);
-void jsontree_write_atom(const struct jsontree_context *js_ctx,
+void jsontree_write_int(struct jsontree_context *js_ctx, int value);
+void jsontree_write_atom(struct jsontree_context *js_ctx,
                          const char *text);
-void jsontree_write_string(const struct jsontree_context *js_ctx,
+void jsontree_write_string(struct jsontree_context *js_ctx,
                            const char *text);
 int jsontree_print_next(struct jsontree_context *js_ctx);
+
+/**
+ * \brief      Print the next part of a JSON tree into a buffer.
+ * \param js_ctx A pointer to a JSON tree context
+ * \param buf  The buffer to print into
+ * \param size The size of the buffer, greater than zero
+ * \return     The number of bytes printed, 0 once the tree is done
+ *
+ *             This function prints values until the buffer is full
+ *             and picks up again where it stopped on the next call,
+ *             so that a document larger than any one buffer can be
+ *             sent in TCP segments or CoAP blocks. The rest of a
+ *             value that did not fit is kept and comes first on the
+ *             next call, so each value is read once. Only a value
+ *             with more than JSONTREE_CARRY_SIZE bytes left over is
+ *             printed again from its start, with the bytes already
+ *             delivered left out, so a callback printing that much
+ *             at a time must print the same text when called again
+ *             with the same callback_state.
+ */
+int jsontree_print_chunk(struct jsontree_context *js_ctx, char *buf,
+                         int size);
+
+/* non-zero when jsontree_print_chunk() has printed the whole tree */
+int jsontree_print_done(const struct jsontree_context *js_ctx);
+
+/* leave out the next count bytes of output, such as the blocks of a
+   block-wise transfer already sent. The values in them are still read. */
+void jsontree_skip(struct jsontree_context *js_ctx, uint32_t count);
 struct jsontree_value *jsontree_find_next(struct jsontree_context *js_ctx,
                                           int type);
 
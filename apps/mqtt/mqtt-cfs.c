@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/*---------------------------------------------------------------------------*/
+/**
+ * \addtogroup mqtt-engine
+ * @{
+ */
+/**
+ * \file
+ *    Streaming MQTT publish payloads from CFS files. Kept apart from mqtt.c
+ *    so that only applications using it need a file system.
+ */
+/*---------------------------------------------------------------------------*/
+#include "mqtt.h"
+#include "cfs/cfs.h"
+/*---------------------------------------------------------------------------*/
+int
+mqtt_cfs_producer(void *ptr, uint32_t offset, uint8_t *buf, uint16_t len)
+{
+  int fd = *(int *)ptr;
+
+  if(cfs_seek(fd, offset, CFS_SEEK_SET) != (cfs_offset_t)offset) {
+    return -1;
+  }
+  return cfs_read(fd, buf, len);
+}
+/*---------------------------------------------------------------------------*/
+mqtt_status_t
+mqtt_publish_file(struct mqtt_connection *conn, uint16_t *mid, char *topic,
+                  int *fd, uint32_t payload_size, mqtt_qos_level_t qos_level,
+                  mqtt_retain_t retain)
+{
+  if(fd == NULL || *fd < 0) {
+    return MQTT_STATUS_INVALID_ARGS_ERROR;
+  }
+  return mqtt_publish_stream(conn, mid, topic, mqtt_cfs_producer, fd,
+                             payload_size, qos_level, retain);
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
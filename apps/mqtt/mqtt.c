@@ -161,9 +161,7 @@ typedef enum {
 static process_event_t mqtt_do_connect_tcp_event;
 static process_event_t mqtt_do_connect_mqtt_event;
 static process_event_t mqtt_do_disconnect_mqtt_event;
-static process_event_t mqtt_do_subscribe_event;
-static process_event_t mqtt_do_unsubscribe_event;
-static process_event_t mqtt_do_publish_event;
+static process_event_t mqtt_do_send_event;
 static process_event_t mqtt_do_pingreq_event;
 static process_event_t mqtt_continue_send_event;
 static process_event_t mqtt_abort_now_event;
@@ -215,10 +213,12 @@ static void
 abort_connection(struct mqtt_connection *conn)
 {
   conn->out_buffer_ptr = conn->out_buffer;
-  conn->out_queue_full = 0;
 
-  /* Reset outgoing packet */
+  /* Reset outgoing packets, the session is not kept */
   memset(&conn->out_packet, 0, sizeof(conn->out_packet));
+  conn->out_queue_count = 0;
+  memset(conn->inflight, 0, sizeof(conn->inflight));
+  ctimer_stop(&conn->inflight_timer);
 
   tcp_socket_close(&conn->socket);
   tcp_socket_unregister(&conn->socket);
@@ -351,6 +351,191 @@ encode_remaining_length(uint8_t *remaining_length,
   DBG("MQTT - remaining_length_bytes %u\n", *remaining_length_bytes);
 }
 /*---------------------------------------------------------------------------*/
+static struct mqtt_inflight *
+inflight_find(struct mqtt_connection *conn, uint16_t mid)
+{
+  uint8_t i;
+
+  for(i = 0; i < MQTT_MAX_INFLIGHT; i++) {
+    if(conn->inflight[i].mid != 0 && conn->inflight[i].mid == mid) {
+      return &conn->inflight[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static struct mqtt_inflight *
+inflight_free_slot(struct mqtt_connection *conn)
+{
+  uint8_t i;
+
+  for(i = 0; i < MQTT_MAX_INFLIGHT; i++) {
+    if(conn->inflight[i].mid == 0) {
+      return &conn->inflight[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Acknowledgements are not waited for longer than RESPONSE_WAIT_TIMEOUT.
+ * Packet IDs given up are reported to the application.
+ */
+static void
+inflight_timeout(void *ptr)
+{
+  struct mqtt_connection *conn = ptr;
+  clock_time_t age;
+  clock_time_t next = RESPONSE_WAIT_TIMEOUT;
+  uint16_t mid;
+  uint8_t i;
+  uint8_t waiting = 0;
+
+  for(i = 0; i < MQTT_MAX_INFLIGHT; i++) {
+    if(conn->inflight[i].mid == 0) {
+      continue;
+    }
+    age = clock_time() - conn->inflight[i].stamp;
+    if(age >= RESPONSE_WAIT_TIMEOUT) {
+      PRINTF("MQTT - Timeout waiting for ack of MID %u\n",
+             conn->inflight[i].mid);
+      mid = conn->inflight[i].mid;
+      conn->inflight[i].mid = 0;
+      call_event(conn, MQTT_EVENT_ACK_TIMEOUT, &mid);
+    } else {
+      waiting = 1;
+      if(RESPONSE_WAIT_TIMEOUT - age < next) {
+        next = RESPONSE_WAIT_TIMEOUT - age;
+      }
+    }
+  }
+
+  /* An ID taken from the callback above has set the timer if needed */
+  if(waiting) {
+    ctimer_set(&conn->inflight_timer, next, inflight_timeout, conn);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+send_pending(struct mqtt_connection *conn)
+{
+  uint8_t i;
+
+  if(conn->out_queue_count > 0) {
+    return 1;
+  }
+  for(i = 0; i < MQTT_MAX_INFLIGHT; i++) {
+    if(conn->inflight[i].mid != 0 &&
+       conn->inflight[i].state == MQTT_QOS_STATE_GOT_PUBREC) {
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Takes a packet for the API, reserving a packet ID if it will be
+ * acknowledged. The caller fills in the rest.
+ */
+static struct mqtt_out_packet *
+queue_packet(struct mqtt_connection *conn, uint8_t fhdr, uint8_t acked,
+             uint16_t *mid)
+{
+  struct mqtt_out_packet *packet;
+  struct mqtt_inflight *slot = NULL;
+
+  if(conn->out_queue_count == MQTT_OUT_QUEUE_SIZE) {
+    return NULL;
+  }
+  if(acked) {
+    slot = inflight_free_slot(conn);
+    if(slot == NULL) {
+      return NULL;
+    }
+    /* Skip IDs still in use once the counter has wrapped */
+    do {
+      INCREMENT_MID(conn);
+    } while(inflight_find(conn, conn->mid_counter) != NULL);
+    slot->mid = conn->mid_counter;
+    slot->state = MQTT_QOS_STATE_NO_ACK;
+    slot->stamp = clock_time();
+    if(ctimer_expired(&conn->inflight_timer)) {
+      ctimer_set(&conn->inflight_timer, RESPONSE_WAIT_TIMEOUT,
+                 inflight_timeout, conn);
+    }
+  }
+
+  packet = &conn->out_queue[(conn->out_queue_head + conn->out_queue_count) %
+                            MQTT_OUT_QUEUE_SIZE];
+  memset(packet, 0, sizeof(*packet));
+  packet->fhdr = fhdr;
+  packet->mid = slot != NULL ? slot->mid : 0;
+  packet->qos_state = MQTT_QOS_STATE_NO_ACK;
+  if(mid != NULL) {
+    *mid = packet->mid;
+  }
+
+  /* Everything queued before the engine runs goes out together */
+  if(conn->out_queue_count++ == 0) {
+    process_post(&mqtt_process, mqtt_do_send_event, conn);
+  }
+  return packet;
+}
+/*---------------------------------------------------------------------------*/
+static struct mqtt_out_packet *
+queue_publish(struct mqtt_connection *conn, uint16_t *mid, char *topic,
+              uint32_t payload_size, mqtt_qos_level_t qos_level,
+              mqtt_retain_t retain)
+{
+  struct mqtt_out_packet *packet;
+
+  packet = queue_packet(conn, MQTT_FHDR_MSG_TYPE_PUBLISH,
+                        qos_level > MQTT_QOS_LEVEL_0, mid);
+  if(packet == NULL) {
+    DBG("MQTT - Not accepted!\n");
+    return NULL;
+  }
+  DBG("MQTT - Accepted!\n");
+
+  packet->retain = retain;
+  packet->topic = topic;
+  packet->topic_length = strlen(topic);
+  packet->payload_size = payload_size;
+  packet->qos = qos_level;
+  return packet;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Makes the next packet to write out the current one, PUBRELs first since
+ * they complete exchanges already under way.
+ */
+static int
+next_packet(struct mqtt_connection *conn)
+{
+  uint8_t i;
+
+  for(i = 0; i < MQTT_MAX_INFLIGHT; i++) {
+    if(conn->inflight[i].mid != 0 &&
+       conn->inflight[i].state == MQTT_QOS_STATE_GOT_PUBREC) {
+      conn->inflight[i].state = MQTT_QOS_STATE_PUBREL_SENT;
+      conn->inflight[i].stamp = clock_time();
+      memset(&conn->out_packet, 0, sizeof(conn->out_packet));
+      conn->out_packet.fhdr = MQTT_FHDR_MSG_TYPE_PUBREL;
+      conn->out_packet.mid = conn->inflight[i].mid;
+      return 1;
+    }
+  }
+
+  if(conn->out_queue_count == 0) {
+    return 0;
+  }
+  memcpy(&conn->out_packet, &conn->out_queue[conn->out_queue_head],
+         sizeof(conn->out_packet));
+  conn->out_queue_head = (conn->out_queue_head + 1) % MQTT_OUT_QUEUE_SIZE;
+  conn->out_queue_count--;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
 static void
 keep_alive_callback(void *ptr)
 {
@@ -510,7 +695,7 @@ PT_THREAD(subscribe_pt(struct pt *pt, struct mqtt_connection *conn))
       &conn->out_buffer[MQTT_TCP_OUTPUT_BUFF_SIZE] - conn->out_buffer_ptr);
 
   /* Set up FHDR */
-  conn->out_packet.fhdr = MQTT_FHDR_MSG_TYPE_SUBSCRIBE | MQTT_FHDR_QOS_LEVEL_1;
+  conn->out_packet.fhdr |= MQTT_FHDR_QOS_LEVEL_1;
   conn->out_packet.remaining_length = MQTT_MID_SIZE +
     MQTT_STRING_LEN_SIZE +
     conn->out_packet.topic_length +
@@ -530,7 +715,7 @@ PT_THREAD(subscribe_pt(struct pt *pt, struct mqtt_connection *conn))
                       conn->out_packet.remaining_length_enc,
                       conn->out_packet.remaining_length_enc_bytes);
   /* Write Variable Header */
-  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid << 8));
+  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid >> 8));
   PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid & 0x00FF));
   /* Write Payload */
   PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.topic_length >> 8));
@@ -539,24 +724,7 @@ PT_THREAD(subscribe_pt(struct pt *pt, struct mqtt_connection *conn))
                       conn->out_packet.topic_length);
   PT_MQTT_WRITE_BYTE(conn, conn->out_packet.qos);
 
-  /* Send out buffer */
-  send_out_buffer(conn);
-  timer_set(&conn->t, RESPONSE_WAIT_TIMEOUT);
-
-  /* Wait for SUBACK. */
-  reset_packet(&conn->in_packet);
-  PT_WAIT_UNTIL(pt, conn->out_packet.qos_state == MQTT_QOS_STATE_GOT_ACK ||
-                timer_expired(&conn->t));
-
-  if(timer_expired(&conn->t)) {
-    DBG("Timeout waiting for SUBACK\n");
-  }
-  reset_packet(&conn->in_packet);
-
-  /* This is clear after the entire transaction is complete */
-  conn->out_queue_full = 0;
-
-  DBG("MQTT - Done in send_subscribe!\n");
+  DBG("MQTT - Done writing subscribe message to out buffer!\n");
 
   PT_END(pt);
 }
@@ -573,8 +741,7 @@ PT_THREAD(unsubscribe_pt(struct pt *pt, struct mqtt_connection *conn))
       &conn->out_buffer[MQTT_TCP_OUTPUT_BUFF_SIZE] - conn->out_buffer_ptr);
 
   /* Set up FHDR */
-  conn->out_packet.fhdr = MQTT_FHDR_MSG_TYPE_UNSUBSCRIBE |
-    MQTT_FHDR_QOS_LEVEL_1;
+  conn->out_packet.fhdr |= MQTT_FHDR_QOS_LEVEL_1;
   conn->out_packet.remaining_length = MQTT_MID_SIZE +
     MQTT_STRING_LEN_SIZE +
     conn->out_packet.topic_length;
@@ -592,7 +759,7 @@ PT_THREAD(unsubscribe_pt(struct pt *pt, struct mqtt_connection *conn))
   PT_MQTT_WRITE_BYTES(conn, (uint8_t *)conn->out_packet.remaining_length_enc,
                       conn->out_packet.remaining_length_enc_bytes);
   /* Write Variable Header */
-  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid << 8));
+  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid >> 8));
   PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid & 0x00FF));
   /* Write Payload */
   PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.topic_length >> 8));
@@ -600,25 +767,7 @@ PT_THREAD(unsubscribe_pt(struct pt *pt, struct mqtt_connection *conn))
   PT_MQTT_WRITE_BYTES(conn, (uint8_t *)conn->out_packet.topic,
                       conn->out_packet.topic_length);
 
-  /* Send out buffer */
-  send_out_buffer(conn);
-  timer_set(&conn->t, RESPONSE_WAIT_TIMEOUT);
-
-  /* Wait for UNSUBACK */
-  reset_packet(&conn->in_packet);
-  PT_WAIT_UNTIL(pt, conn->out_packet.qos_state == MQTT_QOS_STATE_GOT_ACK ||
-                timer_expired(&conn->t));
-
-  if(timer_expired(&conn->t)) {
-    DBG("Timeout waiting for UNSUBACK\n");
-  }
-
-  reset_packet(&conn->in_packet);
-
-  /* This is clear after the entire transaction is complete */
-  conn->out_queue_full = 0;
-
-  DBG("MQTT - Done writing subscribe message to out buffer!\n");
+  DBG("MQTT - Done writing unsubscribe message to out buffer!\n");
 
   PT_END(pt);
 }
@@ -626,6 +775,8 @@ PT_THREAD(unsubscribe_pt(struct pt *pt, struct mqtt_connection *conn))
 static
 PT_THREAD(publish_pt(struct pt *pt, struct mqtt_connection *conn))
 {
+  int produced;
+
   PT_BEGIN(pt);
 
   DBG("MQTT - Sending publish message! topic %s topic_length %i\n",
@@ -635,8 +786,7 @@ PT_THREAD(publish_pt(struct pt *pt, struct mqtt_connection *conn))
       &conn->out_buffer[MQTT_TCP_OUTPUT_BUFF_SIZE] - conn->out_buffer_ptr);
 
   /* Set up FHDR */
-  conn->out_packet.fhdr = MQTT_FHDR_MSG_TYPE_PUBLISH |
-    conn->out_packet.qos << 1;
+  conn->out_packet.fhdr |= conn->out_packet.qos << 1;
   if(conn->out_packet.retain == MQTT_RETAIN_ON) {
     conn->out_packet.fhdr |= MQTT_FHDR_RETAIN_FLAG;
   }
@@ -665,52 +815,80 @@ PT_THREAD(publish_pt(struct pt *pt, struct mqtt_connection *conn))
   PT_MQTT_WRITE_BYTES(conn, (uint8_t *)conn->out_packet.topic,
                       conn->out_packet.topic_length);
   if(conn->out_packet.qos > MQTT_QOS_LEVEL_0) {
-    PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid << 8));
+    PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid >> 8));
     PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid & 0x00FF));
   }
   /* Write Payload */
-  PT_MQTT_WRITE_BYTES(conn,
-                      conn->out_packet.payload,
-                      conn->out_packet.payload_size);
-
-  send_out_buffer(conn);
-  timer_set(&conn->t, RESPONSE_WAIT_TIMEOUT);
-
-  /*
-   * If QoS is zero then wait until the message has been sent, since there is
-   * no ACK to wait for.
-   *
-   * Also notify the app will not be notified via PUBACK or PUBCOMP
-   */
-  if(conn->out_packet.qos == 0) {
-    process_post(conn->app_process, mqtt_update_event, NULL);
-  } else if(conn->out_packet.qos == 1) {
-    /* Wait for PUBACK */
-    reset_packet(&conn->in_packet);
-    PT_WAIT_UNTIL(pt, conn->out_packet.qos_state == MQTT_QOS_STATE_GOT_ACK ||
-                  timer_expired(&conn->t));
-    if(timer_expired(&conn->t)) {
-      DBG("Timeout waiting for PUBACK\n");
-    }
-    if(conn->in_packet.mid != conn->out_packet.mid) {
-      DBG("MQTT - Warning, got PUBACK with none matching MID. Currently there "
-          "is no support for several concurrent PUBLISH messages.\n");
+  if(conn->out_packet.producer == NULL) {
+    PT_MQTT_WRITE_BYTES(conn,
+                        conn->out_packet.payload,
+                        conn->out_packet.payload_size);
+  } else {
+    /* Produced straight into the out buffer, a buffer full at a time */
+    while(conn->out_write_pos < conn->out_packet.payload_size) {
+      if(conn->out_buffer_ptr == &conn->out_buffer[MQTT_TCP_OUTPUT_BUFF_SIZE]) {
+        send_out_buffer(conn);
+        PT_WAIT_UNTIL(pt, conn->out_buffer_sent);
+      }
+      produced = MIN(&conn->out_buffer[MQTT_TCP_OUTPUT_BUFF_SIZE] -
+                     conn->out_buffer_ptr,
+                     conn->out_packet.payload_size - conn->out_write_pos);
+      produced = conn->out_packet.producer(conn->out_packet.producer_ptr,
+                                           conn->out_write_pos,
+                                           conn->out_buffer_ptr, produced);
+      if(produced <= 0) {
+        /* The length has been written already, so the packet cannot end */
+        PRINTF("MQTT - Error, payload producer failed at %lu\n",
+               (unsigned long)conn->out_write_pos);
+        conn->out_write_pos = 0;
+        call_event(conn, MQTT_EVENT_ERROR, NULL);
+        disconnect_tcp(conn);
+        PT_EXIT(pt);
+      }
+      conn->out_buffer_ptr += produced;
+      conn->out_write_pos += produced;
     }
-  } else if(conn->out_packet.qos == 2) {
-    DBG("MQTT - QoS not implemented yet.\n");
-    /* Should wait for PUBREC, send PUBREL and then wait for PUBCOMP */
+    conn->out_write_pos = 0;
   }
 
-  reset_packet(&conn->in_packet);
+  DBG("MQTT - Publish written to out buffer\n");
+
+  PT_END(pt);
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(pubrel_pt(struct pt *pt, struct mqtt_connection *conn))
+{
+  PT_BEGIN(pt);
 
-  /* This is clear after the entire transaction is complete */
-  conn->out_queue_full = 0;
+  DBG("MQTT - Sending PUBREL for MID %u\n", conn->out_packet.mid);
 
-  DBG("MQTT - Publish Enqueued\n");
+  PT_MQTT_WRITE_BYTE(conn, MQTT_FHDR_MSG_TYPE_PUBREL | MQTT_FHDR_QOS_LEVEL_1);
+  PT_MQTT_WRITE_BYTE(conn, MQTT_MID_SIZE);
+  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid >> 8));
+  PT_MQTT_WRITE_BYTE(conn, (conn->out_packet.mid & 0x00FF));
 
   PT_END(pt);
 }
 /*---------------------------------------------------------------------------*/
+/* Runs the protothread writing the current packet into the out buffer */
+static char
+write_packet(struct mqtt_connection *conn)
+{
+  switch(conn->out_packet.fhdr & 0xF0) {
+  case MQTT_FHDR_MSG_TYPE_PUBLISH:
+    return publish_pt(&conn->out_proto_thread, conn);
+  case MQTT_FHDR_MSG_TYPE_PUBREL:
+    return pubrel_pt(&conn->out_proto_thread, conn);
+  case MQTT_FHDR_MSG_TYPE_SUBSCRIBE:
+    return subscribe_pt(&conn->out_proto_thread, conn);
+  case MQTT_FHDR_MSG_TYPE_UNSUBSCRIBE:
+    return unsubscribe_pt(&conn->out_proto_thread, conn);
+  default:
+    return PT_ENDED;
+  }
+}
+/*---------------------------------------------------------------------------*/
 static
 PT_THREAD(pingreq_pt(struct pt *pt, struct mqtt_connection *conn))
 {
@@ -724,19 +902,12 @@ PT_THREAD(pingreq_pt(struct pt *pt, struct mqtt_connection *conn))
 
   send_out_buffer(conn);
 
-  /* Start timeout for reply. */
+  /*
+   * Cleared by handle_pingresp. Should it still be set when the keep alive
+   * timer fires next, the broker is taken to be gone.
+   */
   conn->waiting_for_pingresp = 1;
 
-  /* Wait for PINGRESP or timeout */
-  reset_packet(&conn->in_packet);
-  timer_set(&conn->t, RESPONSE_WAIT_TIMEOUT);
-
-  PT_WAIT_UNTIL(pt, conn->in_packet.packet_received || timer_expired(&conn->t));
-
-  reset_packet(&conn->in_packet);
-
-  conn->waiting_for_pingresp = 0;
-
   PT_END(pt);
 }
 /*---------------------------------------------------------------------------*/
@@ -767,6 +938,23 @@ static void
 handle_pingresp(struct mqtt_connection *conn)
 {
   DBG("MQTT - Got RINGRESP\n");
+
+  conn->waiting_for_pingresp = 0;
+}
+/*---------------------------------------------------------------------------*/
+/* Releases the packet ID of the acknowledgement in in_packet.mid */
+static void
+inflight_ack(struct mqtt_connection *conn)
+{
+  struct mqtt_inflight *slot;
+
+  slot = inflight_find(conn, conn->in_packet.mid);
+  if(slot == NULL) {
+    DBG("MQTT - Ack for unknown MID %u\n", conn->in_packet.mid);
+    return;
+  }
+  slot->state = MQTT_QOS_STATE_GOT_ACK;
+  slot->mid = 0;
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -782,17 +970,12 @@ handle_suback(struct mqtt_connection *conn)
     DBG("MQTT - Error, SUBACK with > 1 topic, not supported.\n");
   }
 
-  conn->out_packet.qos_state = MQTT_QOS_STATE_GOT_ACK;
-
   suback_event.mid = (conn->in_packet.payload[0] << 8) |
     (conn->in_packet.payload[1]);
   suback_event.qos_level = conn->in_packet.payload[2];
   conn->in_packet.mid = suback_event.mid;
 
-  if(conn->in_packet.mid != conn->out_packet.mid) {
-    DBG("MQTT - Warning, got SUBACK with none matching MID. Currently there is"
-        "no support for several concurrent SUBSCRIBE messages.\n");
-  }
+  inflight_ack(conn);
 
   /* Always reset packet before callback since it might be used directly */
   call_event(conn, MQTT_EVENT_SUBACK, &suback_event);
@@ -803,14 +986,10 @@ handle_unsuback(struct mqtt_connection *conn)
 {
   DBG("MQTT - Got UNSUBACK\n");
 
-  conn->out_packet.qos_state = MQTT_QOS_STATE_GOT_ACK;
   conn->in_packet.mid = (conn->in_packet.payload[0] << 8) |
     (conn->in_packet.payload[1]);
 
-  if(conn->in_packet.mid != conn->out_packet.mid) {
-    DBG("MQTT - Warning, got UNSUBACK with none matching MID. Currently there is"
-        "no support for several concurrent UNSUBSCRIBE messages.\n");
-  }
+  inflight_ack(conn);
 
   call_event(conn, MQTT_EVENT_UNSUBACK, &conn->in_packet.mid);
 }
@@ -820,22 +999,58 @@ handle_puback(struct mqtt_connection *conn)
 {
   DBG("MQTT - Got PUBACK\n");
 
-  conn->out_packet.qos_state = MQTT_QOS_STATE_GOT_ACK;
   conn->in_packet.mid = (conn->in_packet.payload[0] << 8) |
     (conn->in_packet.payload[1]);
 
+  inflight_ack(conn);
+
   call_event(conn, MQTT_EVENT_PUBACK, &conn->in_packet.mid);
 }
 /*---------------------------------------------------------------------------*/
 static void
+handle_pubrec(struct mqtt_connection *conn)
+{
+  struct mqtt_inflight *slot;
+
+  DBG("MQTT - Got PUBREC\n");
+
+  conn->in_packet.mid = (conn->in_packet.payload[0] << 8) |
+    (conn->in_packet.payload[1]);
+
+  /* Also answers a repeated PUBREC, in case our PUBREL was lost */
+  slot = inflight_find(conn, conn->in_packet.mid);
+  if(slot == NULL) {
+    DBG("MQTT - PUBREC for unknown MID %u\n", conn->in_packet.mid);
+    return;
+  }
+  slot->state = MQTT_QOS_STATE_GOT_PUBREC;
+  process_post(&mqtt_process, mqtt_do_send_event, conn);
+}
+/*---------------------------------------------------------------------------*/
+static void
+handle_pubcomp(struct mqtt_connection *conn)
+{
+  DBG("MQTT - Got PUBCOMP\n");
+
+  conn->in_packet.mid = (conn->in_packet.payload[0] << 8) |
+    (conn->in_packet.payload[1]);
+
+  inflight_ack(conn);
+
+  call_event(conn, MQTT_EVENT_PUBCOMP, &conn->in_packet.mid);
+}
+/*---------------------------------------------------------------------------*/
+static void
 handle_publish(struct mqtt_connection *conn)
 {
-  DBG("MQTT - Got PUBLISH, called once per manageable chunk of message.\n");
+  DBG("MQTT - Got PUBLISH, called once per chunk of message.\n");
   DBG("MQTT - Handling publish on topic '%s'\n", conn->in_publish_msg.topic);
 
-  DBG("MQTT - This chunk is %i bytes\n", conn->in_packet.payload_pos);
+  DBG("MQTT - This chunk is %u bytes\n",
+      conn->in_publish_msg.payload_chunk_length);
 
-  if(((conn->in_packet.fhdr & 0x09) >> 1) > 0) {
+  if(conn->in_publish_msg.first_chunk == 1 &&
+     (conn->in_packet.fhdr & (MQTT_FHDR_QOS_LEVEL_1 | MQTT_FHDR_QOS_LEVEL_2))) {
     PRINTF("MQTT - Error, got incoming PUBLISH with QoS > 0, not supported atm!\n");
   }
 
@@ -844,16 +1059,6 @@ handle_publish(struct mqtt_connection *conn)
   if(conn->in_publish_msg.first_chunk == 1) {
     conn->in_publish_msg.first_chunk = 0;
   }
-
-  /* If this is the last time handle_publish will be called, reset packet. */
-  if(conn->in_publish_msg.payload_left == 0) {
-
-    /* Check for QoS and initiate the reply, do not rely on the data in the
-     * in_packet being untouched. */
-
-    DBG("MQTT - (handle_publish) resetting packet.\n");
-    reset_packet(&conn->in_packet);
-  }
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -866,10 +1071,14 @@ parse_publish_vhdr(struct mqtt_connection *conn,
 
   /* Read out topic length */
   if(conn->in_packet.topic_len_received == 0) {
-    conn->in_packet.topic_len = (input_data_ptr[(*pos)++] << 8);
-    conn->in_packet.byte_counter++;
-    if(*pos >= input_data_len) {
-      return;
+    /* The two bytes may come in different segments */
+    if(conn->in_packet.byte_counter ==
+       MQTT_FHDR_SIZE + conn->in_packet.remaining_length_bytes) {
+      conn->in_packet.topic_len = (input_data_ptr[(*pos)++] << 8);
+      conn->in_packet.byte_counter++;
+      if(*pos >= input_data_len) {
+        return;
+      }
     }
     conn->in_packet.topic_len |= input_data_ptr[(*pos)++];
     conn->in_packet.byte_counter++;
@@ -916,176 +1125,163 @@ tcp_input(struct tcp_socket *s,
   struct mqtt_connection *conn = ptr;
   uint32_t pos = 0;
   uint32_t copy_bytes = 0;
+  uint32_t packet_len;
   uint8_t byte;
 
   if(input_data_len == 0) {
     return 0;
   }
 
-  if(conn->in_packet.packet_received) {
-    reset_packet(&conn->in_packet);
-  }
-
   DBG("tcp_input with %i bytes of data:\n", input_data_len);
 
-  /* Read the fixed header field, if we do not have it */
-  if(!conn->in_packet.fhdr) {
-    conn->in_packet.fhdr = input_data_ptr[pos++];
-    conn->in_packet.byte_counter++;
-
-    DBG("MQTT - Read VHDR '%02X'\n", conn->in_packet.fhdr);
-
-    if(pos >= input_data_len) {
-      return 0;
+  /*
+   * The data may end in the middle of a packet or hold several of them, all
+   * of which is consumed here.
+   */
+  while(pos < input_data_len) {
+    if(conn->in_packet.packet_received) {
+      reset_packet(&conn->in_packet);
     }
-  }
 
-  /* Read the Remaining Length field, if we do not have it */
-  if(!conn->in_packet.has_remaining_length) {
-    do {
-      if(pos >= input_data_len) {
-        return 0;
-      }
-
-      byte = input_data_ptr[pos++];
+    /* Read the fixed header field, if we do not have it */
+    if(!conn->in_packet.fhdr) {
+      conn->in_packet.fhdr = input_data_ptr[pos++];
       conn->in_packet.byte_counter++;
-      conn->in_packet.remaining_length_bytes++;
-      DBG("MQTT - Read Remaining Length byte\n");
-
-      if(conn->in_packet.byte_counter > 5) {
-        call_event(conn, MQTT_EVENT_ERROR, NULL);
-        DBG("Received more then 4 byte 'remaining lenght'.");
-        return 0;
-      }
 
-      conn->in_packet.remaining_length +=
-        (byte & 127) * conn->in_packet.remaining_multiplier;
-      conn->in_packet.remaining_multiplier *= 128;
-    } while((byte & 128) != 0);
-
-    DBG("MQTT - Finished reading remaining length byte\n");
-    conn->in_packet.has_remaining_length = 1;
-  }
+      DBG("MQTT - Read VHDR '%02X'\n", conn->in_packet.fhdr);
+    }
 
-  /*
-   * Check for unsupported payload length. Will read all incoming data from the
-   * server in any case and then reset the packet.
-   *
-   * TODO: Decide if we, for example, want to disconnect instead.
-   */
-  if((conn->in_packet.remaining_length > MQTT_INPUT_BUFF_SIZE) &&
-     (conn->in_packet.fhdr & 0xF0) != MQTT_FHDR_MSG_TYPE_PUBLISH) {
+    /* Read the Remaining Length field, if we do not have it */
+    if(!conn->in_packet.has_remaining_length) {
+      do {
+        if(pos >= input_data_len) {
+          return 0;
+        }
 
-    PRINTF("MQTT - Error, unsupported payload size for non-PUBLISH message\n");
+        byte = input_data_ptr[pos++];
+        conn->in_packet.byte_counter++;
+        conn->in_packet.remaining_length_bytes++;
+        DBG("MQTT - Read Remaining Length byte\n");
 
-    conn->in_packet.byte_counter += input_data_len;
-    if(conn->in_packet.byte_counter >=
-       (MQTT_FHDR_SIZE + conn->in_packet.remaining_length)) {
-      conn->in_packet.packet_received = 1;
-    }
-    return 0;
-  }
+        if(conn->in_packet.byte_counter > 5) {
+          call_event(conn, MQTT_EVENT_ERROR, NULL);
+          DBG("Received more then 4 byte 'remaining lenght'.");
+          return 0;
+        }
 
-  /*
-   * Supported payload, reads out both VHDR and Payload of all packets.
-   *
-   * Note: There will always be at least one byte left to read when we enter
-   *       this loop.
-   */
-  while(conn->in_packet.byte_counter <
-        (MQTT_FHDR_SIZE + conn->in_packet.remaining_length)) {
+        conn->in_packet.remaining_length +=
+          (byte & 127) * conn->in_packet.remaining_multiplier;
+        conn->in_packet.remaining_multiplier *= 128;
+      } while((byte & 128) != 0);
 
-    if((conn->in_packet.fhdr & 0xF0) == MQTT_FHDR_MSG_TYPE_PUBLISH &&
-       conn->in_packet.topic_received == 0) {
-      parse_publish_vhdr(conn, &pos, input_data_ptr, input_data_len);
+      DBG("MQTT - Finished reading remaining length byte\n");
+      conn->in_packet.has_remaining_length = 1;
     }
 
-    /* Read in as much as we can into the packet payload */
-    copy_bytes = MIN(input_data_len - pos,
-                     MQTT_INPUT_BUFF_SIZE - conn->in_packet.payload_pos);
-    DBG("- Copied %lu payload bytes\n", copy_bytes);
-    memcpy(&conn->in_packet.payload[conn->in_packet.payload_pos],
-           &input_data_ptr[pos],
-           copy_bytes);
-    conn->in_packet.byte_counter += copy_bytes;
-    conn->in_packet.payload_pos += copy_bytes;
-    pos += copy_bytes;
-
-    uint8_t i;
-    DBG("MQTT - Copied bytes: \n");
-    for(i = 0; i < copy_bytes; i++) {
-      DBG("%02X ", conn->in_packet.payload[i]);
+    packet_len = MQTT_FHDR_SIZE + conn->in_packet.remaining_length_bytes +
+      conn->in_packet.remaining_length;
+
+    /*
+     * Check for unsupported payload length. Will read all incoming data from
+     * the server in any case and then reset the packet.
+     *
+     * TODO: Decide if we, for example, want to disconnect instead.
+     */
+    if((conn->in_packet.remaining_length > MQTT_INPUT_BUFF_SIZE) &&
+       (conn->in_packet.fhdr & 0xF0) != MQTT_FHDR_MSG_TYPE_PUBLISH) {
+
+      PRINTF("MQTT - Error, unsupported payload size for non-PUBLISH message\n");
+
+      copy_bytes = MIN(input_data_len - pos,
+                       packet_len - conn->in_packet.byte_counter);
+      conn->in_packet.byte_counter += copy_bytes;
+      pos += copy_bytes;
+      if(conn->in_packet.byte_counter >= packet_len) {
+        conn->in_packet.packet_received = 1;
+      }
+      continue;
     }
-    DBG("\n");
-
-    /* Full buffer, shall only happen to PUBLISH messages. */
-    if(MQTT_INPUT_BUFF_SIZE - conn->in_packet.payload_pos == 0) {
-      conn->in_publish_msg.payload_chunk = conn->in_packet.payload;
-      conn->in_publish_msg.payload_chunk_length = MQTT_INPUT_BUFF_SIZE;
-      conn->in_publish_msg.payload_left -= MQTT_INPUT_BUFF_SIZE;
-
-      handle_publish(conn);
 
-      conn->in_publish_msg.payload_chunk = conn->in_packet.payload;
-      conn->in_packet.payload_pos = 0;
+    /* Read the VHDR and payload, as far as we have them */
+    while(conn->in_packet.byte_counter < packet_len && pos < input_data_len) {
+      copy_bytes = MIN(input_data_len - pos,
+                       packet_len - conn->in_packet.byte_counter);
+
+      if((conn->in_packet.fhdr & 0xF0) != MQTT_FHDR_MSG_TYPE_PUBLISH) {
+        memcpy(&conn->in_packet.payload[conn->in_packet.payload_pos],
+               &input_data_ptr[pos],
+               copy_bytes);
+        conn->in_packet.payload_pos += copy_bytes;
+      } else if(conn->in_packet.topic_received == 0) {
+        parse_publish_vhdr(conn, &pos, input_data_ptr, input_data_len);
+        continue;
+      } else {
+        /* PUBLISH payload is handed over without copying it anywhere */
+        conn->in_publish_msg.payload_chunk = (uint8_t *)&input_data_ptr[pos];
+        conn->in_publish_msg.payload_chunk_length = copy_bytes;
+        conn->in_publish_msg.payload_left -= copy_bytes;
+        handle_publish(conn);
+      }
+      conn->in_packet.byte_counter += copy_bytes;
+      pos += copy_bytes;
     }
 
-    if(pos >= input_data_len &&
-       (conn->in_packet.byte_counter < (MQTT_FHDR_SIZE + conn->in_packet.remaining_length))) {
+    if(conn->in_packet.byte_counter < packet_len) {
       return 0;
     }
-  }
-
-  /* Debug information */
-  DBG("\n");
-  /* Take care of input */
-  DBG("MQTT - Finished reading packet!\n");
-  /* What to return? */
-  DBG("MQTT - total data was %i bytes of data. \n",
-      (MQTT_FHDR_SIZE + conn->in_packet.remaining_length));
-
-  /* Handle packet here. */
-  switch(conn->in_packet.fhdr & 0xF0) {
-  case MQTT_FHDR_MSG_TYPE_CONNACK:
-    handle_connack(conn);
-    break;
-  case MQTT_FHDR_MSG_TYPE_PUBLISH:
-    /* This is the only or the last chunk of publish payload */
-    conn->in_publish_msg.payload_chunk = conn->in_packet.payload;
-    conn->in_publish_msg.payload_chunk_length = conn->in_packet.payload_pos;
-    conn->in_publish_msg.payload_left = 0;
-    handle_publish(conn);
-    break;
-  case MQTT_FHDR_MSG_TYPE_PUBACK:
-    handle_puback(conn);
-    break;
-  case MQTT_FHDR_MSG_TYPE_SUBACK:
-    handle_suback(conn);
-    break;
-  case MQTT_FHDR_MSG_TYPE_UNSUBACK:
-    handle_unsuback(conn);
-    break;
-  case MQTT_FHDR_MSG_TYPE_PINGRESP:
-    handle_pingresp(conn);
-    break;
 
-  /* QoS 2 not implemented yet */
-  case MQTT_FHDR_MSG_TYPE_PUBREC:
-  case MQTT_FHDR_MSG_TYPE_PUBREL:
-  case MQTT_FHDR_MSG_TYPE_PUBCOMP:
-    call_event(conn, MQTT_EVENT_NOT_IMPLEMENTED_ERROR, NULL);
-    PRINTF("MQTT - Got unhandled MQTT Message Type '%i'",
-           (conn->in_packet.fhdr & 0xF0));
-    break;
+    DBG("MQTT - Finished reading packet!\n");
+    DBG("MQTT - total data was %lu bytes of data. \n", packet_len);
+
+    /* Handle packet here. */
+    switch(conn->in_packet.fhdr & 0xF0) {
+    case MQTT_FHDR_MSG_TYPE_CONNACK:
+      handle_connack(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_PUBLISH:
+      /* The payload went out as it came in, but an empty one is still news */
+      if(conn->in_publish_msg.payload_length == 0) {
+        conn->in_publish_msg.payload_chunk = conn->in_packet.payload;
+        conn->in_publish_msg.payload_chunk_length = 0;
+        conn->in_publish_msg.payload_left = 0;
+        handle_publish(conn);
+      }
+      break;
+    case MQTT_FHDR_MSG_TYPE_PUBACK:
+      handle_puback(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_SUBACK:
+      handle_suback(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_UNSUBACK:
+      handle_unsuback(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_PINGRESP:
+      handle_pingresp(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_PUBREC:
+      handle_pubrec(conn);
+      break;
+    case MQTT_FHDR_MSG_TYPE_PUBCOMP:
+      handle_pubcomp(conn);
+      break;
+
+    /* Incoming QoS 2 not implemented yet */
+    case MQTT_FHDR_MSG_TYPE_PUBREL:
+      call_event(conn, MQTT_EVENT_NOT_IMPLEMENTED_ERROR, NULL);
+      PRINTF("MQTT - Got unhandled MQTT Message Type '%i'",
+             (conn->in_packet.fhdr & 0xF0));
+      break;
+
+    default:
+      /* All server-only message */
+      PRINTF("MQTT - Got MQTT Message Type '%i'", (conn->in_packet.fhdr & 0xF0));
+      break;
+    }
 
-  default:
-    /* All server-only message */
-    PRINTF("MQTT - Got MQTT Message Type '%i'", (conn->in_packet.fhdr & 0xF0));
-    break;
+    conn->in_packet.packet_received = 1;
   }
 
-  conn->in_packet.packet_received = 1;
-
   return 0;
 }
 /*---------------------------------------------------------------------------*/
@@ -1131,6 +1327,11 @@ tcp_event(struct tcp_socket *s, void *ptr, tcp_socket_event_t event)
     if(conn->socket.output_data_len == 0) {
       conn->out_buffer_sent = 1;
       conn->out_buffer_ptr = conn->out_buffer;
+
+      /* Packets queued while the buffer was busy */
+      if(send_pending(conn)) {
+        process_post(&mqtt_process, mqtt_do_send_event, conn);
+      }
     }
 
     ctimer_restart(&conn->keep_alive_timer);
@@ -1147,6 +1348,7 @@ tcp_event(struct tcp_socket *s, void *ptr, tcp_socket_event_t event)
 PROCESS_THREAD(mqtt_process, ev, data)
 {
   static struct mqtt_connection *conn;
+  static uint8_t written;
 
   PROCESS_BEGIN();
 
@@ -1210,42 +1412,31 @@ PROCESS_THREAD(mqtt_process, ev, data)
         }
       }
     }
-    if(ev == mqtt_do_subscribe_event) {
+    if(ev == mqtt_do_send_event) {
       conn = data;
-      DBG("MQTT - Got mqtt_do_subscribe_mqtt_event!\n");
+      DBG("MQTT - Got mqtt_do_send_event!\n");
 
+      /*
+       * Write everything pending back to back and hand it to TCP at once.
+       * If the buffer is busy, TCP_SOCKET_DATA_SENT will bring us back.
+       */
       if(conn->out_buffer_sent == 1 &&
          conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-        PT_INIT(&conn->out_proto_thread);
-        while(subscribe_pt(&conn->out_proto_thread, conn) < PT_EXITED &&
-              conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-          PT_MQTT_WAIT_SEND();
+        written = 0;
+        while(conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER &&
+              next_packet(conn)) {
+          written = 1;
+          PT_INIT(&conn->out_proto_thread);
+          while(write_packet(conn) < PT_EXITED &&
+                conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
+            PT_MQTT_WAIT_SEND();
+          }
         }
-      }
-    }
-    if(ev == mqtt_do_unsubscribe_event) {
-      conn = data;
-      DBG("MQTT - Got mqtt_do_unsubscribe_mqtt_event!\n");
+        if(written && conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
+          send_out_buffer(conn);
 
-      if(conn->out_buffer_sent == 1 &&
-         conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-        PT_INIT(&conn->out_proto_thread);
-        while(unsubscribe_pt(&conn->out_proto_thread, conn) < PT_EXITED &&
-              conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-          PT_MQTT_WAIT_SEND();
-        }
-      }
-    }
-    if(ev == mqtt_do_publish_event) {
-      conn = data;
-      DBG("MQTT - Got mqtt_do_publish_mqtt_event!\n");
-
-      if(conn->out_buffer_sent == 1 &&
-         conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-        PT_INIT(&conn->out_proto_thread);
-        while(publish_pt(&conn->out_proto_thread, conn) < PT_EXITED &&
-              conn->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
-          PT_MQTT_WAIT_SEND();
+          /* Payloads of the packets written may be reused now */
+          process_post(conn->app_process, mqtt_update_event, NULL);
         }
       }
     }
@@ -1263,9 +1454,7 @@ mqtt_init(void)
 
     mqtt_do_connect_mqtt_event = process_alloc_event();
     mqtt_do_disconnect_mqtt_event = process_alloc_event();
-    mqtt_do_subscribe_event = process_alloc_event();
-    mqtt_do_unsubscribe_event = process_alloc_event();
-    mqtt_do_publish_event = process_alloc_event();
+    mqtt_do_send_event = process_alloc_event();
     mqtt_do_pingreq_event = process_alloc_event();
     mqtt_update_event = process_alloc_event();
     mqtt_abort_now_event = process_alloc_event();
@@ -1361,52 +1550,49 @@ mqtt_status_t
 mqtt_subscribe(struct mqtt_connection *conn, uint16_t *mid, char *topic,
                mqtt_qos_level_t qos_level)
 {
+  struct mqtt_out_packet *packet;
+
   if(conn->state != MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
     return MQTT_STATUS_NOT_CONNECTED_ERROR;
   }
 
   DBG("MQTT - Call to mqtt_subscribe...\n");
 
-  /* Currently don't have a queue, so only one item at a time */
-  if(conn->out_queue_full) {
+  packet = queue_packet(conn, MQTT_FHDR_MSG_TYPE_SUBSCRIBE, 1, mid);
+  if(packet == NULL) {
     DBG("MQTT - Not accepted!\n");
     return MQTT_STATUS_OUT_QUEUE_FULL;
   }
-  conn->out_queue_full = 1;
   DBG("MQTT - Accepted!\n");
 
-  conn->out_packet.mid = INCREMENT_MID(conn);
-  conn->out_packet.topic = topic;
-  conn->out_packet.topic_length = strlen(topic);
-  conn->out_packet.qos = qos_level;
-  conn->out_packet.qos_state = MQTT_QOS_STATE_NO_ACK;
+  packet->topic = topic;
+  packet->topic_length = strlen(topic);
+  packet->qos = qos_level;
 
-  process_post(&mqtt_process, mqtt_do_subscribe_event, conn);
   return MQTT_STATUS_OK;
 }
 /*----------------------------------------------------------------------------*/
 mqtt_status_t
 mqtt_unsubscribe(struct mqtt_connection *conn, uint16_t *mid, char *topic)
 {
+  struct mqtt_out_packet *packet;
+
   if(conn->state != MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
     return MQTT_STATUS_NOT_CONNECTED_ERROR;
   }
 
   DBG("MQTT - Call to mqtt_unsubscribe...\n");
-  /* Currently don't have a queue, so only one item at a time */
-  if(conn->out_queue_full) {
+
+  packet = queue_packet(conn, MQTT_FHDR_MSG_TYPE_UNSUBSCRIBE, 1, mid);
+  if(packet == NULL) {
     DBG("MQTT - Not accepted!\n");
     return MQTT_STATUS_OUT_QUEUE_FULL;
   }
-  conn->out_queue_full = 1;
   DBG("MQTT - Accepted!\n");
 
-  conn->out_packet.mid = INCREMENT_MID(conn);
-  conn->out_packet.topic = topic;
-  conn->out_packet.topic_length = strlen(topic);
-  conn->out_packet.qos_state = MQTT_QOS_STATE_NO_ACK;
+  packet->topic = topic;
+  packet->topic_length = strlen(topic);
 
-  process_post(&mqtt_process, mqtt_do_unsubscribe_event, conn);
   return MQTT_STATUS_OK;
 }
 /*----------------------------------------------------------------------------*/
@@ -1415,33 +1601,58 @@ mqtt_publish(struct mqtt_connection *conn, uint16_t *mid, char *topic,
              uint8_t *payload, uint32_t payload_size,
              mqtt_qos_level_t qos_level, mqtt_retain_t retain)
 {
+  struct mqtt_out_packet *packet;
+
   if(conn->state != MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
     return MQTT_STATUS_NOT_CONNECTED_ERROR;
   }
 
   DBG("MQTT - Call to mqtt_publish...\n");
 
-  /* Currently don't have a queue, so only one item at a time */
-  if(conn->out_queue_full) {
-    DBG("MQTT - Not accepted!\n");
+  packet = queue_publish(conn, mid, topic, payload_size, qos_level, retain);
+  if(packet == NULL) {
     return MQTT_STATUS_OUT_QUEUE_FULL;
   }
-  conn->out_queue_full = 1;
-  DBG("MQTT - Accepted!\n");
+  packet->payload = payload;
 
-  conn->out_packet.mid = INCREMENT_MID(conn);
-  conn->out_packet.retain = retain;
-  conn->out_packet.topic = topic;
-  conn->out_packet.topic_length = strlen(topic);
-  conn->out_packet.payload = payload;
-  conn->out_packet.payload_size = payload_size;
-  conn->out_packet.qos = qos_level;
-  conn->out_packet.qos_state = MQTT_QOS_STATE_NO_ACK;
+  return MQTT_STATUS_OK;
+}
+/*----------------------------------------------------------------------------*/
+mqtt_status_t
+mqtt_publish_stream(struct mqtt_connection *conn, uint16_t *mid, char *topic,
+                    mqtt_payload_producer_t producer, void *ptr,
+                    uint32_t payload_size, mqtt_qos_level_t qos_level,
+                    mqtt_retain_t retain)
+{
+  struct mqtt_out_packet *packet;
+
+  if(conn->state != MQTT_CONN_STATE_CONNECTED_TO_BROKER) {
+    return MQTT_STATUS_NOT_CONNECTED_ERROR;
+  }
+  if(producer == NULL) {
+    return MQTT_STATUS_INVALID_ARGS_ERROR;
+  }
+
+  DBG("MQTT - Call to mqtt_publish_stream...\n");
+
+  packet = queue_publish(conn, mid, topic, payload_size, qos_level, retain);
+  if(packet == NULL) {
+    return MQTT_STATUS_OUT_QUEUE_FULL;
+  }
+  packet->producer = producer;
+  packet->producer_ptr = ptr;
 
-  process_post(&mqtt_process, mqtt_do_publish_event, conn);
   return MQTT_STATUS_OK;
 }
 /*----------------------------------------------------------------------------*/
+int
+mqtt_ready(struct mqtt_connection *conn)
+{
+  return mqtt_connected(conn) &&
+         conn->out_queue_count < MQTT_OUT_QUEUE_SIZE &&
+         inflight_free_slot(conn) != NULL;
+}
+/*----------------------------------------------------------------------------*/
 void
 mqtt_set_username_password(struct mqtt_connection *conn, char *username,
                            char *password)
@@ -61,7 +61,7 @@
  *  -- "Exactly once" (2), where message are assured to arrive exactly once.
  *  This level could be used, for example, with billing systems where duplicate
  *  or lost messages could lead to incorrect charges being applied. This QoS
- *  level is currently not supported in this implementation.
+ *  level is supported for outgoing PUBLISH messages only.
  *
  * - A small transport overhead and protocol exchanges minimized to reduce
  *   network traffic.
@@ -108,7 +108,15 @@
 #define MQTT_TCP_INPUT_BUFF_SIZE 512
 #define MQTT_TCP_OUTPUT_BUFF_SIZE 512
 
-#define MQTT_INPUT_BUFF_SIZE 512
+/*
+ * Holds the variable header of incoming control packets. PUBLISH payloads
+ * are handed to the application straight from the TCP input buffer.
+ */
+#ifdef MQTT_CONF_INPUT_BUFF_SIZE
+#define MQTT_INPUT_BUFF_SIZE MQTT_CONF_INPUT_BUFF_SIZE
+#else
+#define MQTT_INPUT_BUFF_SIZE 16
+#endif
 #define MQTT_MAX_TOPIC_LENGTH 64
 #define MQTT_MAX_TOPICS_PER_SUBSCRIBE 1
 
@@ -117,6 +125,27 @@
 #define MQTT_PROTOCOL_VERSION 3
 #define MQTT_PROTOCOL_NAME "MQIsdp"
 #define MQTT_TOPIC_MAX_LENGTH 128
+
+/*
+ * Number of packet IDs that can await an acknowledgement from the broker at
+ * the same time, shared by QoS 1 and 2 PUBLISH, SUBSCRIBE and UNSUBSCRIBE.
+ */
+#ifdef MQTT_CONF_MAX_INFLIGHT
+#define MQTT_MAX_INFLIGHT MQTT_CONF_MAX_INFLIGHT
+#else
+#define MQTT_MAX_INFLIGHT 4
+#endif
+
+/*
+ * Number of packets accepted by the API that have not been written out yet.
+ * Packets queued by the time the engine gets to run are written back to back
+ * and leave in as few TCP segments as possible.
+ */
+#ifdef MQTT_CONF_OUT_QUEUE_SIZE
+#define MQTT_OUT_QUEUE_SIZE MQTT_CONF_OUT_QUEUE_SIZE
+#else
+#define MQTT_OUT_QUEUE_SIZE 4
+#endif
 /*---------------------------------------------------------------------------*/
 /*
  * Debug configuration, this is similar but not exactly like the Debugging
@@ -151,6 +180,8 @@ typedef enum {
   MQTT_EVENT_UNSUBACK,
   MQTT_EVENT_PUBLISH,
   MQTT_EVENT_PUBACK,
+  MQTT_EVENT_PUBCOMP,
+  MQTT_EVENT_ACK_TIMEOUT,
 
   /* Errors */
   MQTT_EVENT_ERROR = 0x80,
@@ -183,7 +214,9 @@ typedef enum {
   MQTT_QOS_STATE_NO_ACK,
   MQTT_QOS_STATE_GOT_ACK,
 
-  /* Expand for QoS 2 */
+  /* QoS 2 */
+  MQTT_QOS_STATE_GOT_PUBREC,
+  MQTT_QOS_STATE_PUBREL_SENT,
 } mqtt_qos_state_t;
 /*---------------------------------------------------------------------------*/
 /*
@@ -233,8 +266,8 @@ struct mqtt_message {
   uint16_t payload_chunk_length;
 
   uint8_t first_chunk;
-  uint16_t payload_length;
-  uint16_t payload_left;
+  uint32_t payload_length;
+  uint32_t payload_left;
 };
 
 /* This struct represents a packet received from the MQTT server. */
@@ -248,11 +281,11 @@ struct mqtt_in_packet {
   uint8_t packet_received;
 
   uint8_t fhdr;
-  uint16_t remaining_length;
+  uint32_t remaining_length;
   uint16_t mid;
 
   /* Helper variables needed to decode the remaining_length */
-  uint8_t remaining_multiplier;
+  uint32_t remaining_multiplier;
   uint8_t has_remaining_length;
   uint8_t remaining_length_bytes;
 
@@ -269,6 +302,20 @@ struct mqtt_in_packet {
   uint8_t topic_received;
 };
 
+/**
+ * \brief           Produces the payload of a streamed PUBLISH
+ * \param ptr       The pointer passed to mqtt_publish_stream()
+ * \param offset    Offset of the requested bytes within the payload
+ * \param buf       Where to put them, directly in the TCP output buffer
+ * \param len       The number of bytes requested
+ * \return          The number of bytes produced, 1 to len, or -1 on error
+ *
+ * The producer is called as the output buffer drains, with increasing
+ * offsets, until the payload size given to mqtt_publish_stream() is reached.
+ */
+typedef int (*mqtt_payload_producer_t)(void *ptr, uint32_t offset,
+                                       uint8_t *buf, uint16_t len);
+
 /* This struct represents a packet sent to the MQTT server. */
 struct mqtt_out_packet {
   uint8_t fhdr;
@@ -279,11 +326,20 @@ struct mqtt_out_packet {
   char *topic;
   uint16_t topic_length;
   uint8_t *payload;
+  mqtt_payload_producer_t producer;
+  void *producer_ptr;
   uint32_t payload_size;
   mqtt_qos_level_t qos;
   mqtt_qos_state_t qos_state;
   mqtt_retain_t retain;
 };
+
+/* A packet ID awaiting acknowledgement, free when mid is 0. */
+struct mqtt_inflight {
+  uint16_t mid;
+  mqtt_qos_state_t state;
+  clock_time_t stamp;
+};
 /*---------------------------------------------------------------------------*/
 /**
  * \brief           MQTT event callback function
@@ -337,7 +393,11 @@ struct mqtt_connection {
   uint16_t mid_counter;
 
   /* Used for communication between MQTT API and APP */
-  uint8_t out_queue_full;
+  struct mqtt_out_packet out_queue[MQTT_OUT_QUEUE_SIZE];
+  uint8_t out_queue_head;
+  uint8_t out_queue_count;
+  struct mqtt_inflight inflight[MQTT_MAX_INFLIGHT];
+  struct ctimer inflight_timer;
   struct process *app_process;
 
   /* Outgoing data related */
@@ -411,12 +471,13 @@ void mqtt_disconnect(struct mqtt_connection *conn);
 /**
  * \brief Subscribes to a MQTT topic.
  * \param conn A pointer to the MQTT connection.
- * \param mid A pointer to message ID.
+ * \param mid A pointer to message ID, set unless NULL.
  * \param topic A pointer to the topic to subscribe to.
  * \param qos_level Quality Of Service level to use. Currently supports 0, 1.
  * \return MQTT_STATUS_OK or some error status
  *
- * This function subscribes to a topic on a MQTT broker.
+ * This function subscribes to a topic on a MQTT broker. The SUBACK is reported
+ * with MQTT_EVENT_SUBACK, carrying the same message ID.
  */
 mqtt_status_t mqtt_subscribe(struct mqtt_connection *conn,
                              uint16_t *mid,
@@ -426,7 +487,7 @@ mqtt_status_t mqtt_subscribe(struct mqtt_connection *conn,
 /**
  * \brief Unsubscribes from a MQTT topic.
  * \param conn A pointer to the MQTT connection.
- * \param mid A pointer to message ID.
+ * \param mid A pointer to message ID, set unless NULL.
  * \param topic A pointer to the topic to unsubscribe from.
  * \return MQTT_STATUS_OK or some error status
  *
@@ -439,18 +500,29 @@ mqtt_status_t mqtt_unsubscribe(struct mqtt_connection *conn,
 /**
  * \brief Publish to a MQTT topic.
  * \param conn A pointer to the MQTT connection.
- * \param mid A pointer to message ID.
+ * \param mid A pointer to message ID, set unless NULL.
  * \param topic A pointer to the topic to subscribe to.
  * \param payload A pointer to the topic payload.
  * \param payload_size Payload size.
- * \param qos_level Quality Of Service level to use. Currently supports 0, 1.
+ * \param qos_level Quality Of Service level to use. Supports 0, 1 and 2.
  * \param retain If the RETAIN flag is set to 1, in a PUBLISH Packet sent by a
  *        Client to a Server, the Server MUST store the Application Message
  *        and its QoS, so that it can be delivered to future subscribers whose
  *        subscriptions match its topic name
  * \return MQTT_STATUS_OK or some error status
  *
- * This function publishes to a topic on a MQTT broker.
+ * This function publishes to a topic on a MQTT broker. The message is queued
+ * and the topic and payload are not copied: they must stay unchanged until
+ * the engine has written the message out, which it signals by posting
+ * mqtt_update_event to the application process. Delivery is reported with
+ * MQTT_EVENT_PUBACK for QoS 1 and MQTT_EVENT_PUBCOMP for QoS 2. If the
+ * acknowledgement does not come within 10 seconds, the packet ID is given up
+ * and reported with MQTT_EVENT_ACK_TIMEOUT, carrying a pointer to it. The
+ * message is not sent again.
+ *
+ * MQTT_STATUS_OUT_QUEUE_FULL is returned while MQTT_OUT_QUEUE_SIZE packets
+ * are queued or, for QoS 1 and 2, while MQTT_MAX_INFLIGHT packet IDs are
+ * awaiting acknowledgement.
  */
 mqtt_status_t mqtt_publish(struct mqtt_connection *conn,
                            uint16_t *mid,
@@ -460,6 +532,60 @@ mqtt_status_t mqtt_publish(struct mqtt_connection *conn,
                            mqtt_qos_level_t qos_level,
                            mqtt_retain_t retain);
 /*---------------------------------------------------------------------------*/
+/**
+ * \brief Publish to a MQTT topic, pulling the payload from a producer.
+ * \param conn A pointer to the MQTT connection.
+ * \param mid A pointer to message ID, set unless NULL.
+ * \param topic A pointer to the topic to publish to.
+ * \param producer The function producing the payload.
+ * \param ptr A pointer passed to the producer.
+ * \param payload_size Payload size.
+ * \param qos_level Quality Of Service level to use. Supports 0, 1 and 2.
+ * \param retain See mqtt_publish().
+ * \return MQTT_STATUS_OK or some error status
+ *
+ * Like mqtt_publish(), but the payload is written into the TCP output buffer
+ * by the producer, a piece at a time as the buffer drains, so it never has to
+ * be held in RAM as a whole. If the producer fails, the connection is closed
+ * since the packet length has already been sent.
+ */
+mqtt_status_t mqtt_publish_stream(struct mqtt_connection *conn,
+                                  uint16_t *mid,
+                                  char *topic,
+                                  mqtt_payload_producer_t producer,
+                                  void *ptr,
+                                  uint32_t payload_size,
+                                  mqtt_qos_level_t qos_level,
+                                  mqtt_retain_t retain);
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief Publish to a MQTT topic, streaming the payload from a CFS file.
+ * \param conn A pointer to the MQTT connection.
+ * \param mid A pointer to message ID, set unless NULL.
+ * \param topic A pointer to the topic to publish to.
+ * \param fd A pointer to a file descriptor open for reading.
+ * \param payload_size The number of bytes to publish from the file start.
+ * \param qos_level Quality Of Service level to use. Supports 0, 1 and 2.
+ * \param retain See mqtt_publish().
+ * \return MQTT_STATUS_OK or some error status
+ *
+ * The file must stay open until mqtt_update_event reports the message
+ * written.
+ */
+mqtt_status_t mqtt_publish_file(struct mqtt_connection *conn,
+                                uint16_t *mid,
+                                char *topic,
+                                int *fd,
+                                uint32_t payload_size,
+                                mqtt_qos_level_t qos_level,
+                                mqtt_retain_t retain);
+
+/**
+ * \brief The producer used by mqtt_publish_file(), reading from *(int *)ptr.
+ */
+int mqtt_cfs_producer(void *ptr, uint32_t offset, uint8_t *buf,
+                      uint16_t len);
+/*---------------------------------------------------------------------------*/
 /**
  * \brief Set the user name and password for a MQTT client.
  * \param conn A pointer to the MQTT connection.
@@ -495,11 +621,17 @@ void mqtt_set_last_will(struct mqtt_connection *conn,
                         char *message,
                         mqtt_qos_level_t qos);
 
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief Checks whether a MQTT client can take another packet.
+ * \param conn A pointer to the MQTT connection.
+ * \return 1 if connected, with room in the outgoing queue and a packet ID
+ *         free for a message that needs acknowledgement, otherwise 0
+ */
+int mqtt_ready(struct mqtt_connection *conn);
+
 #define mqtt_connected(conn) \
   ((conn)->state == MQTT_CONN_STATE_CONNECTED_TO_BROKER ? 1 : 0)
-
-#define mqtt_ready(conn) \
-  (!(conn)->out_queue_full && mqtt_connected((conn)))
 /*---------------------------------------------------------------------------*/
 #endif /* MQTT_H_ */
 /*---------------------------------------------------------------------------*/
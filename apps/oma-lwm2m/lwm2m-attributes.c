@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \addtogroup oma-lwm2m
+ * @{
+ *
+ */
+
+/**
+ * \file
+ *         Implementation of the Contiki OMA LWM2M notification attributes
+ *
+ *         The attributes written by a server are applied on the node:
+ *         a change is only notified when it passes the gt, lt and st
+ *         attributes of the resource, no sooner than pmin seconds
+ *         after the last notification, and a notification is sent at
+ *         least every pmax seconds. An instance or object level pmin
+ *         and pmax apply to resources without attributes of their own.
+ */
+
+#include "contiki.h"
+#include "lib/memb.h"
+#include "lib/list.h"
+#include "lwm2m-object.h"
+#include "lwm2m-engine.h"
+#include "lwm2m-attributes.h"
+#include "lwm2m-plain-text.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DEBUG 0
+#if DEBUG
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+#define ATTRIBUTE_PMIN 0x01
+#define ATTRIBUTE_PMAX 0x02
+#define ATTRIBUTE_GT   0x04
+#define ATTRIBUTE_LT   0x08
+#define ATTRIBUTE_ST   0x10
+#define ATTRIBUTE_VALUE (ATTRIBUTE_GT | ATTRIBUTE_LT | ATTRIBUTE_ST)
+
+typedef struct lwm2m_attributes {
+  struct lwm2m_attributes *next;
+  const lwm2m_object_t *object;
+  uint16_t instance_id;
+  uint16_t resource_id;
+  uint8_t depth;
+  uint8_t set;        /* ATTRIBUTE_ flags of the attributes written */
+  uint8_t pending;    /* a change waits for pmin to pass */
+  uint16_t pmin;      /* seconds */
+  uint16_t pmax;      /* seconds */
+  int32_t gt;         /* fixpoint, LWM2M_FLOAT32_BITS */
+  int32_t lt;
+  int32_t st;
+  int32_t last_value; /* the value last notified */
+  clock_time_t last_notify;
+  struct ctimer timer;
+} lwm2m_attributes_t;
+
+MEMB(attributes_memb, lwm2m_attributes_t, LWM2M_ATTRIBUTES_MAX);
+LIST(attributes_list);
+
+/* fixpoint value of a resource, caught from its writer */
+static int32_t read_value;
+/*---------------------------------------------------------------------------*/
+static size_t
+read_int(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+         int32_t value)
+{
+  read_value = value << LWM2M_FLOAT32_BITS;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+read_string(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+            const char *value, size_t stringlen)
+{
+  /* not a number */
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+read_float32fix(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+                int32_t value, int bits)
+{
+  if(bits > LWM2M_FLOAT32_BITS) {
+    read_value = value >> (bits - LWM2M_FLOAT32_BITS);
+  } else {
+    read_value = value << (LWM2M_FLOAT32_BITS - bits);
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+read_boolean(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+             int value)
+{
+  read_value = value ? LWM2M_FLOAT32_FRAC : 0;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static const lwm2m_writer_t value_writer = {
+  read_int,
+  read_string,
+  read_float32fix,
+  read_boolean
+};
+/*---------------------------------------------------------------------------*/
+/* the current value of the resource of a set of attributes */
+static int
+get_value(const lwm2m_attributes_t *a, int32_t *value)
+{
+  lwm2m_context_t context;
+  const lwm2m_instance_t *instance;
+  const lwm2m_resource_t *resource;
+  uint8_t buf[8];
+
+  memset(&context, 0, sizeof(context));
+  context.object_id = a->object->id;
+  context.object_instance_id = a->instance_id;
+  context.resource_id = a->resource_id;
+  context.writer = &value_writer;
+
+  instance = lwm2m_object_get_instance(a->object, &context);
+  if(instance == NULL) {
+    return 0;
+  }
+  resource = lwm2m_object_get_resource(instance, &context);
+  if(resource == NULL ||
+     lwm2m_object_write_resource(resource, &context, buf, sizeof(buf)) <= 0) {
+    return 0;
+  }
+  *value = read_value;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void timeout(void *ptr);
+
+static void
+send_notification(lwm2m_attributes_t *a, char *path)
+{
+  PRINTF("lwm2m: notify %s/%s\n", a->object->path, path);
+  coap_notify_observers_sub(lwm2m_object_get_coap_resource(a->object), path);
+
+  a->pending = 0;
+  a->last_notify = clock_time();
+  if(a->set & ATTRIBUTE_VALUE) {
+    get_value(a, &a->last_value);
+  }
+  if(a->set & ATTRIBUTE_PMAX) {
+    ctimer_set(&a->timer, (clock_time_t)a->pmax * CLOCK_SECOND, timeout, a);
+  } else {
+    ctimer_stop(&a->timer);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+notify(lwm2m_attributes_t *a, char *path)
+{
+  clock_time_t since;
+
+  since = clock_time() - a->last_notify;
+  if((a->set & ATTRIBUTE_PMIN) &&
+     since < (clock_time_t)a->pmin * CLOCK_SECOND) {
+    /* hold the change back until pmin has passed */
+    if(!a->pending) {
+      a->pending = 1;
+      ctimer_set(&a->timer, (clock_time_t)a->pmin * CLOCK_SECOND - since,
+                 timeout, a);
+    }
+    return;
+  }
+  send_notification(a, path);
+}
+/*---------------------------------------------------------------------------*/
+static void
+timeout(void *ptr)
+{
+  lwm2m_attributes_t *a = ptr;
+  char path[16];
+
+  /* a held back change or pmax: notify the whole path of the attributes */
+  if(a->depth == 3) {
+    snprintf(path, sizeof(path), "/%u/%u", a->instance_id, a->resource_id);
+  } else if(a->depth == 2) {
+    snprintf(path, sizeof(path), "/%u", a->instance_id);
+  } else {
+    path[0] = '\0';
+  }
+  send_notification(a, path);
+}
+/*---------------------------------------------------------------------------*/
+static lwm2m_attributes_t *
+find(const lwm2m_object_t *object, int depth,
+     uint16_t instance_id, uint16_t resource_id)
+{
+  lwm2m_attributes_t *a;
+
+  for(a = list_head(attributes_list); a != NULL; a = a->next) {
+    if(a->object == object && a->depth == depth &&
+       (depth < 2 || a->instance_id == instance_id) &&
+       (depth < 3 || a->resource_id == resource_id)) {
+      return a;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static int
+parse_id(const char **path, uint16_t *id)
+{
+  if(**path != '/' || (*path)[1] < '0' || (*path)[1] > '9') {
+    return 0;
+  }
+  (*path)++;
+  *id = 0;
+  while(**path >= '0' && **path <= '9') {
+    *id = *id * 10 + (**path - '0');
+    (*path)++;
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+void
+lwm2m_object_notify_observers(const lwm2m_object_t *object, char *path)
+{
+  lwm2m_attributes_t *a;
+  const char *p;
+  uint16_t instance_id, resource_id;
+  int32_t value;
+  int depth;
+
+  depth = 1;
+  p = path;
+  if(p != NULL && parse_id(&p, &instance_id)) {
+    depth++;
+    if(parse_id(&p, &resource_id)) {
+      depth++;
+    }
+  }
+
+  /* the attributes closest to the changed path apply */
+  a = NULL;
+  for(; depth > 0 && a == NULL; depth--) {
+    a = find(object, depth, instance_id, resource_id);
+  }
+  if(a == NULL) {
+    coap_notify_observers_sub(lwm2m_object_get_coap_resource(object), path);
+    return;
+  }
+
+  if(a->depth == 3 && (a->set & ATTRIBUTE_VALUE) && get_value(a, &value)) {
+    /* notify when the value crosses gt or lt, or moves st or more */
+    if(!(((a->set & ATTRIBUTE_GT) &&
+          (a->last_value > a->gt) != (value > a->gt)) ||
+         ((a->set & ATTRIBUTE_LT) &&
+          (a->last_value < a->lt) != (value < a->lt)) ||
+         ((a->set & ATTRIBUTE_ST) &&
+          (value - a->last_value >= a->st || a->last_value - value >= a->st)))) {
+      return;
+    }
+  }
+  notify(a, path);
+}
+/*---------------------------------------------------------------------------*/
+static int
+set_attribute(lwm2m_attributes_t *a, const char *name, int name_len,
+              const char *value, int value_len)
+{
+  int32_t v;
+  uint8_t flag;
+
+  if(name_len == 4 && strncmp(name, "pmin", 4) == 0) {
+    flag = ATTRIBUTE_PMIN;
+  } else if(name_len == 4 && strncmp(name, "pmax", 4) == 0) {
+    flag = ATTRIBUTE_PMAX;
+  } else if(name_len == 2 && strncmp(name, "gt", 2) == 0) {
+    flag = ATTRIBUTE_GT;
+  } else if(name_len == 2 && strncmp(name, "lt", 2) == 0) {
+    flag = ATTRIBUTE_LT;
+  } else if(name_len == 2 && strncmp(name, "st", 2) == 0) {
+    flag = ATTRIBUTE_ST;
+  } else {
+    return 0;
+  }
+  if((flag & ATTRIBUTE_VALUE) && a->depth != 3) {
+    /* only a resource has a value to compare */
+    return 0;
+  }
+
+  if(value == NULL) {
+    a->set &= ~flag;
+    return 1;
+  }
+  if(flag & ATTRIBUTE_VALUE) {
+    if(value_len == 0 ||
+       lwm2m_plain_text_read_float32fix((const uint8_t *)value, value_len,
+                                        &v, LWM2M_FLOAT32_BITS) != value_len) {
+      return 0;
+    }
+  } else if(value_len == 0 ||
+            lwm2m_plain_text_read_int((const uint8_t *)value, value_len,
+                                      &v) != value_len ||
+            v < 0 || v > 0xffff) {
+    return 0;
+  }
+
+  switch(flag) {
+  case ATTRIBUTE_PMIN:
+    a->pmin = v;
+    break;
+  case ATTRIBUTE_PMAX:
+    a->pmax = v;
+    break;
+  case ATTRIBUTE_GT:
+    a->gt = v;
+    break;
+  case ATTRIBUTE_LT:
+    a->lt = v;
+    break;
+  case ATTRIBUTE_ST:
+    a->st = v;
+    break;
+  }
+  a->set |= flag;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/* the attributes must also agree with each other, not only be valid alone */
+static int
+check_attributes(const lwm2m_attributes_t *a)
+{
+  int64_t st;
+
+  if((a->set & ATTRIBUTE_PMIN) && (a->set & ATTRIBUTE_PMAX) &&
+     a->pmin > a->pmax) {
+    return 0;
+  }
+  if((a->set & ATTRIBUTE_GT) && (a->set & ATTRIBUTE_LT)) {
+    st = (a->set & ATTRIBUTE_ST) ? a->st : 0;
+    if((int64_t)a->lt + 2 * st >= a->gt) {
+      return 0;
+    }
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/* only the attributes, as an entry has its own list link and timer */
+static void
+copy_attributes(lwm2m_attributes_t *to, const lwm2m_attributes_t *from)
+{
+  to->set = from->set;
+  to->pmin = from->pmin;
+  to->pmax = from->pmax;
+  to->gt = from->gt;
+  to->lt = from->lt;
+  to->st = from->st;
+}
+/*---------------------------------------------------------------------------*/
+int
+lwm2m_attributes_write(const lwm2m_object_t *object,
+                       const lwm2m_context_t *context, int depth,
+                       const char *query, int len)
+{
+  lwm2m_attributes_t update;
+  lwm2m_attributes_t *a;
+  const char *end, *name, *value;
+  int name_len;
+
+  memset(&update, 0, sizeof(update));
+  update.depth = depth;
+  a = find(object, depth, context->object_instance_id, context->resource_id);
+  if(a != NULL) {
+    copy_attributes(&update, a);
+  }
+
+  /* apply all attributes to a copy, so that a bad one changes nothing */
+  end = query + len;
+  while(query < end) {
+    name = query;
+    while(query < end && *query != '&') {
+      query++;
+    }
+    value = memchr(name, '=', query - name);
+    if(value != NULL) {
+      name_len = value - name;
+      value++;
+    } else {
+      name_len = query - name;
+    }
+    if(!set_attribute(&update, name, name_len,
+                      value, value != NULL ? query - value : 0)) {
+      PRINTF("lwm2m: bad attribute %.*s\n", (int)(query - name), name);
+      return 0;
+    }
+    query++;
+  }
+  if(!check_attributes(&update)) {
+    PRINTF("lwm2m: conflicting attributes\n");
+    return 0;
+  }
+
+  if(a == NULL) {
+    if(update.set == 0) {
+      return 1;
+    }
+    a = memb_alloc(&attributes_memb);
+    if(a == NULL) {
+      PRINTF("lwm2m: no room for more attributes\n");
+      return 0;
+    }
+    memset(a, 0, sizeof(*a));
+    a->object = object;
+    a->depth = depth;
+    a->instance_id = context->object_instance_id;
+    a->resource_id = context->resource_id;
+    list_add(attributes_list, a);
+  } else if(update.set == 0) {
+    ctimer_stop(&a->timer);
+    list_remove(attributes_list, a);
+    memb_free(&attributes_memb, a);
+    return 1;
+  } else {
+    ctimer_stop(&a->timer);
+  }
+  copy_attributes(a, &update);
+  a->pending = 0;
+
+  /* changes are measured from the value when the attributes were set */
+  if(a->set & ATTRIBUTE_VALUE) {
+    get_value(a, &a->last_value);
+  }
+  if(a->set & ATTRIBUTE_PMAX) {
+    ctimer_set(&a->timer, (clock_time_t)a->pmax * CLOCK_SECOND, timeout, a);
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
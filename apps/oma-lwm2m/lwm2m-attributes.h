@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/** \addtogroup oma-lwm2m
+ * @{ */
+
+/**
+ * \file
+ *         Header file for the Contiki OMA LWM2M notification attributes
+ */
+
+#ifndef LWM2M_ATTRIBUTES_H_
+#define LWM2M_ATTRIBUTES_H_
+
+#include "lwm2m-object.h"
+
+/* The number of objects, instances and resources that can have
+   notification attributes at the same time */
+#ifdef LWM2M_ATTRIBUTES_CONF_MAX
+#define LWM2M_ATTRIBUTES_MAX LWM2M_ATTRIBUTES_CONF_MAX
+#else /* LWM2M_ATTRIBUTES_CONF_MAX */
+#define LWM2M_ATTRIBUTES_MAX 4
+#endif /* LWM2M_ATTRIBUTES_CONF_MAX */
+
+/**
+ * \brief Set or clear the notification attributes of a path
+ * \param object  The object of the path
+ * \param context The instance and resource of the path
+ * \param depth   1 for the object, 2 for an instance, 3 for a resource
+ * \param query   The attributes, such as "pmin=10&gt=20.5", not
+ *                null-terminated. An attribute without value is cleared.
+ * \param len     The length of the query
+ * \return        1 if the attributes were set, 0 if they were not valid,
+ *                conflict with each other or there is no room for them.
+ *                Conflicts are pmin > pmax and lt + 2 * st >= gt, checked
+ *                on the attributes the path has after the write.
+ *                Nothing is changed when 0 is returned.
+ */
+int lwm2m_attributes_write(const lwm2m_object_t *object,
+                           const lwm2m_context_t *context, int depth,
+                           const char *query, int len);
+
+#endif /* LWM2M_ATTRIBUTES_H_ */
+/** @} */
@@ -47,6 +47,8 @@
 #include "lwm2m-device.h"
 #include "lwm2m-plain-text.h"
 #include "lwm2m-json.h"
+#include "lwm2m-senml-cbor.h"
+#include "lwm2m-attributes.h"
 #include "rest-engine.h"
 #include "er-coap-constants.h"
 #include "er-coap-engine.h"
@@ -82,7 +84,9 @@
 #define REMOTE_PORT        UIP_HTONS(COAP_DEFAULT_PORT)
 #define BS_REMOTE_PORT     UIP_HTONS(5685)
 
+/* registered objects, kept sorted by id */
 static const lwm2m_object_t *objects[MAX_OBJECTS];
+static uint8_t object_count;
 static char endpoint[32];
 static char rd_data[128]; /* allocate some data for the RD */
 
@@ -499,10 +503,18 @@ lwm2m_engine_parse_context(const lwm2m_object_t *object,
 const lwm2m_object_t *
 lwm2m_engine_get_object(uint16_t id)
 {
-  int i;
-  for(i = 0; i < MAX_OBJECTS; i++) {
-    if(objects[i] != NULL && objects[i]->id == id) {
-      return objects[i];
+  int low, high, mid;
+
+  low = 0;
+  high = object_count - 1;
+  while(low <= high) {
+    mid = (low + high) / 2;
+    if(objects[mid]->id == id) {
+      return objects[mid];
+    } else if(objects[mid]->id < id) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
     }
   }
   return NULL;
@@ -513,12 +525,14 @@ lwm2m_engine_register_object(const lwm2m_object_t *object)
 {
   int i;
   int found = 0;
-  for(i = 0; i < MAX_OBJECTS; i++) {
-    if(objects[i] == NULL) {
-      objects[i] = object;
-      found = 1;
-      break;
+  if(object_count < MAX_OBJECTS) {
+    /* insert in order of id */
+    for(i = object_count; i > 0 && objects[i - 1]->id > object->id; i--) {
+      objects[i] = objects[i - 1];
     }
+    objects[i] = object;
+    object_count++;
+    found = 1;
   }
   rest_activate_resource(lwm2m_object_get_coap_resource(object),
                          (char *)object->path);
@@ -554,18 +568,9 @@ get_first_instance_of_object(uint16_t id, lwm2m_context_t *context)
 static const lwm2m_instance_t *
 get_instance(const lwm2m_object_t *object, lwm2m_context_t *context, int depth)
 {
-  int i;
   if(depth > 1) {
     PRINTF("lwm2m: searching for instance %u\n", context->object_instance_id);
-    for(i = 0; i < object->count; i++) {
-      PRINTF("  Instance %d -> %u (used: %d)\n", i, object->instances[i].id,
-             (object->instances[i].flag & LWM2M_INSTANCE_FLAG_USED) != 0);
-      if(object->instances[i].id == context->object_instance_id &&
-         object->instances[i].flag & LWM2M_INSTANCE_FLAG_USED) {
-        context->object_instance_index = i;
-        return &object->instances[i];
-      }
-    }
+    return lwm2m_object_get_instance(object, context);
   }
   return NULL;
 }
@@ -573,16 +578,9 @@ get_instance(const lwm2m_object_t *object, lwm2m_context_t *context, int depth)
 static const lwm2m_resource_t *
 get_resource(const lwm2m_instance_t *instance, lwm2m_context_t *context)
 {
-  int i;
   if(instance != NULL) {
     PRINTF("lwm2m: searching for resource %u\n", context->resource_id);
-    for(i = 0; i < instance->count; i++) {
-      PRINTF("  Resource %d -> %u\n", i, instance->resources[i].id);
-      if(instance->resources[i].id == context->resource_id) {
-        context->resource_index = i;
-        return &instance->resources[i];
-      }
-    }
+    return lwm2m_object_get_resource(instance, context);
   }
   return NULL;
 }
@@ -743,6 +741,132 @@ write_rd_json_data(const lwm2m_context_t *context,
   return rdlen;
 }
 /*---------------------------------------------------------------------------*/
+/**
+ * @brief Write the readable resources of an instance one after the other
+ *        with the writer of the context, in a single pass
+ */
+static int
+write_instance_bulk(lwm2m_context_t *context,
+                    const lwm2m_instance_t *instance,
+                    uint8_t *buffer, size_t size)
+{
+  const lwm2m_resource_t *resource;
+  int len, pos, i;
+
+  pos = 0;
+  context->writer_flags = LWM2M_WRITER_BULK | LWM2M_WRITER_BASE;
+  for(i = 0; i < instance->count; i++) {
+    resource = &instance->resources[i];
+    context->resource_id = resource->id;
+    context->resource_index = i;
+    len = lwm2m_object_write_resource(resource, context,
+                                      &buffer[pos], size - pos);
+    if(len < 0) {
+      /* nothing to read, such as an executable resource */
+      continue;
+    }
+    if(len == 0 && !lwm2m_object_is_resource_callback(resource)) {
+      /* every value takes some room in TLV and CBOR - it did not fit */
+      return -1;
+    }
+    if(len > 0) {
+      context->writer_flags &= ~LWM2M_WRITER_BASE;
+    }
+    pos += len;
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+/* room for the largest TLV header: type, 16-bit id and 24-bit length */
+#define TLV_MAX_HEADER 6
+/**
+ * @brief Write the readable resources of all instances of an object
+ */
+static int
+write_object_bulk(lwm2m_context_t *context, const lwm2m_object_t *object,
+                  unsigned int format, uint8_t *buffer, size_t size)
+{
+  oma_tlv_t tlv;
+  int len, pos, hdr, i;
+
+  pos = 0;
+  for(i = 0; i < object->count; i++) {
+    if((object->instances[i].flag & LWM2M_INSTANCE_FLAG_USED) == 0) {
+      continue;
+    }
+    context->object_instance_id = object->instances[i].id;
+    context->object_instance_index = i;
+    if(format != LWM2M_TLV) {
+      len = write_instance_bulk(context, &object->instances[i],
+                                &buffer[pos], size - pos);
+      if(len < 0) {
+        return -1;
+      }
+      pos += len;
+      continue;
+    }
+
+    /* The resources are nested in an instance TLV with a header that
+       depends on their length: leave room for the largest header and
+       move them down to it once they are written. */
+    if(size - pos < TLV_MAX_HEADER) {
+      return -1;
+    }
+    len = write_instance_bulk(context, &object->instances[i],
+                              &buffer[pos + TLV_MAX_HEADER],
+                              size - pos - TLV_MAX_HEADER);
+    if(len < 0) {
+      return -1;
+    }
+    tlv.type = OMA_TLV_TYPE_OBJECT_INSTANCE;
+    tlv.id = object->instances[i].id;
+    tlv.length = len;
+    tlv.value = NULL;
+    hdr = oma_tlv_write_header(&tlv, &buffer[pos], TLV_MAX_HEADER);
+    memmove(&buffer[pos + hdr], &buffer[pos + TLV_MAX_HEADER], len);
+    pos += hdr + len;
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Write an instance, or a whole object if instance is NULL, as TLV
+ *        or SenML CBOR
+ */
+static int
+write_bulk(lwm2m_context_t *context, const lwm2m_object_t *object,
+           const lwm2m_instance_t *instance, unsigned int format,
+           uint8_t *buffer, size_t size)
+{
+  int len, pos;
+
+  pos = 0;
+  if(format == LWM2M_SENML_CBOR) {
+    pos = lwm2m_senml_cbor_write_start(buffer, size);
+    if(pos == 0) {
+      return -1;
+    }
+  }
+  if(instance != NULL) {
+    len = write_instance_bulk(context, instance, &buffer[pos], size - pos);
+  } else {
+    len = write_object_bulk(context, object, format,
+                            &buffer[pos], size - pos);
+  }
+  if(len < 0) {
+    return -1;
+  }
+  pos += len;
+  if(format == LWM2M_SENML_CBOR) {
+    len = lwm2m_senml_cbor_write_end(&buffer[pos], size - pos);
+    if(len == 0) {
+      return -1;
+    }
+    pos += len;
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
 /**
  * @brief  Set the writer pointer to the proper writer based on the Accept: header
  *
@@ -766,6 +890,9 @@ lwm2m_engine_select_writer(lwm2m_context_t *context, unsigned int accept)
     case APPLICATION_JSON:
       context->writer = &lwm2m_json_writer;
       break;
+    case LWM2M_SENML_CBOR:
+      context->writer = &lwm2m_senml_cbor_writer;
+      break;
     default:
       PRINTF("Unknown Accept type %u, using LWM2M plain text\n", accept);
       context->writer = &lwm2m_plain_text_writer;
@@ -808,6 +935,7 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
 {
   int len;
   const char *url;
+  const char *query;
   unsigned int format;
   unsigned int accept;
   unsigned int content_type;
@@ -815,6 +943,7 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
   lwm2m_context_t context;
   rest_resource_flags_t method;
   const lwm2m_instance_t *instance;
+  const uint8_t *payload;
 #if (DEBUG) & DEBUG_PRINT
   const char *method_str;
 #endif /* (DEBUG) & DEBUG_PRINT */
@@ -869,6 +998,21 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
 
   instance = get_instance(object, &context, depth);
 
+  /* Write-Attributes: a PUT with the attributes as query and no payload */
+  if(method == METHOD_PUT &&
+     REST.get_request_payload(request, &payload) == 0 &&
+     (len = REST.get_query(request, &query)) > 0) {
+    if((depth > 1 && instance == NULL) ||
+       (depth == 3 && get_resource(instance, &context) == NULL)) {
+      REST.set_response_status(response, NOT_FOUND_4_04);
+    } else if(lwm2m_attributes_write(object, &context, depth, query, len)) {
+      REST.set_response_status(response, CHANGED_2_04);
+    } else {
+      REST.set_response_status(response, BAD_REQUEST_4_00);
+    }
+    return;
+  }
+
   /* from POST */
   if(depth > 1 && instance == NULL) {
     if(method != METHOD_PUT && method != METHOD_POST) {
@@ -1000,37 +1144,15 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
       }
       /* HANDLE GET */
     } else if(method == METHOD_GET) {
-      if(lwm2m_object_is_resource_string(resource)) {
-        const uint8_t *value;
-        value = lwm2m_object_get_resource_string(resource, &context);
-        if(value != NULL) {
-          uint16_t len = lwm2m_object_get_resource_strlen(resource, &context);
-          PRINTF("Get string value: %.*s\n", (int)len, (char *)value);
-          content_len = context.writer->write_string(&context, buffer,
-            preferred_size, (const char *)value, len);
-        }
-      } else if(lwm2m_object_is_resource_int(resource)) {
-        int32_t value;
-        if(lwm2m_object_get_resource_int(resource, &context, &value)) {
-          content_len = context.writer->write_int(&context, buffer, preferred_size, value);
-        }
-      } else if(lwm2m_object_is_resource_floatfix(resource)) {
-        int32_t value;
-        if(lwm2m_object_get_resource_floatfix(resource, &context, &value)) {
-          /* export FLOATFIX */
-          PRINTF("Exporting %d-bit fix as float: %" PRId32 "\n",
-                 LWM2M_FLOAT32_BITS, value);
-          content_len = context.writer->write_float32fix(&context, buffer,
-            preferred_size, value, LWM2M_FLOAT32_BITS);
-        }
-      } else if(lwm2m_object_is_resource_callback(resource)) {
-        if(resource->value.callback.read != NULL) {
-          content_len = resource->value.callback.read(&context,
-                                                 buffer, preferred_size);
-        } else {
-          REST.set_response_status(response, METHOD_NOT_ALLOWED_4_05);
-          return;
-        }
+      if(lwm2m_object_is_resource_callback(resource) &&
+         resource->value.callback.read == NULL) {
+        REST.set_response_status(response, METHOD_NOT_ALLOWED_4_05);
+        return;
+      }
+      len = lwm2m_object_write_resource(resource, &context,
+                                        buffer, preferred_size);
+      if(len > 0) {
+        content_len = len;
       }
       if(content_len > 0) {
         REST.set_response_payload(response, buffer, content_len);
@@ -1070,6 +1192,9 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
       if(accept == APPLICATION_LINK_FORMAT) {
         rdlen = write_rd_link_data(object, instance,
                                    (char *)buffer, preferred_size);
+      } else if(accept == LWM2M_TLV || accept == LWM2M_SENML_CBOR) {
+        rdlen = write_bulk(&context, object, instance, accept,
+                           buffer, preferred_size);
       } else {
         rdlen = write_rd_json_data(&context, object, instance,
                                    (char *)buffer, preferred_size);
@@ -1082,6 +1207,8 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
       REST.set_response_payload(response, buffer, rdlen);
       if(accept == APPLICATION_LINK_FORMAT) {
         REST.set_header_content_type(response, REST.type.APPLICATION_LINK_FORMAT);
+      } else if(accept == LWM2M_TLV || accept == LWM2M_SENML_CBOR) {
+        REST.set_header_content_type(response, accept);
       } else {
         REST.set_header_content_type(response, LWM2M_JSON);
       }
@@ -1092,15 +1219,22 @@ lwm2m_engine_handler(const lwm2m_object_t *object,
       REST.set_response_status(response, METHOD_NOT_ALLOWED_4_05);
     } else {
       int rdlen;
-      PRINTF("Sending instance list for object %u\n", object->id);
-      /* TODO: if(accept == APPLICATION_LINK_FORMAT) { */
-      rdlen = write_object_instances_link(object, (char *)buffer, preferred_size);
+      if(accept == LWM2M_TLV || accept == LWM2M_SENML_CBOR) {
+        PRINTF("Sending all instances of object %u\n", object->id);
+        rdlen = write_bulk(&context, object, NULL, accept,
+                           buffer, preferred_size);
+      } else {
+        PRINTF("Sending instance list for object %u\n", object->id);
+        rdlen = write_object_instances_link(object, (char *)buffer,
+                                            preferred_size);
+        accept = APPLICATION_LINK_FORMAT;
+      }
       if(rdlen < 0) {
         PRINTF("Failed to generate object response\n");
         REST.set_response_status(response, SERVICE_UNAVAILABLE_5_03);
         return;
       }
-      REST.set_header_content_type(response, REST.type.APPLICATION_LINK_FORMAT);
+      REST.set_header_content_type(response, accept);
       REST.set_response_payload(response, buffer, rdlen);
     }
   }
@@ -54,7 +54,8 @@ typedef enum {
   LWM2M_TEXT_PLAIN = 1541,
   LWM2M_TLV        = 1542,
   LWM2M_JSON       = 1543,
-  LWM2M_OPAQUE     = 1544
+  LWM2M_OPAQUE     = 1544,
+  LWM2M_SENML_CBOR = 112   /* application/senml+cbor, RFC 8428 */
 } lwm2m_content_format_t;
 
 void lwm2m_engine_init(void);
@@ -45,6 +45,49 @@
 #include "lwm2m-object.h"
 #include <string.h>
 /*---------------------------------------------------------------------------*/
+const lwm2m_instance_t *
+lwm2m_object_get_instance(const lwm2m_object_t *object,
+                          lwm2m_context_t *context)
+{
+  uint16_t id;
+  int i;
+
+  id = context->object_instance_id;
+  /* instances are mostly numbered by their position, so look there first */
+  i = id;
+  if(i >= object->count || object->instances[i].id != id) {
+    for(i = 0; i < object->count && object->instances[i].id != id; i++);
+  }
+  for(; i < object->count; i++) {
+    if(object->instances[i].id == id &&
+       (object->instances[i].flag & LWM2M_INSTANCE_FLAG_USED)) {
+      context->object_instance_index = i;
+      return &object->instances[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+const lwm2m_resource_t *
+lwm2m_object_get_resource(const lwm2m_instance_t *instance,
+                          lwm2m_context_t *context)
+{
+  int i;
+
+  /* the index found last is the likely one when an instance is walked */
+  i = context->resource_index;
+  if(i < instance->count && instance->resources[i].id == context->resource_id) {
+    return &instance->resources[i];
+  }
+  for(i = 0; i < instance->count; i++) {
+    if(instance->resources[i].id == context->resource_id) {
+      context->resource_index = i;
+      return &instance->resources[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
 int
 lwm2m_object_is_resource_string(const lwm2m_resource_t *resource)
 {
@@ -333,4 +376,45 @@ lwm2m_object_set_resource_boolean(const lwm2m_resource_t *resource,
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+/**
+ * \brief Write the value of a resource with the writer of the context
+ * \return The length written, or -1 if the resource has no value to read
+ */
+int
+lwm2m_object_write_resource(const lwm2m_resource_t *resource,
+                            lwm2m_context_t *context,
+                            uint8_t *outbuf, size_t outlen)
+{
+  const uint8_t *string;
+  int32_t value;
+  int boolean;
+
+  if(lwm2m_object_is_resource_string(resource)) {
+    string = lwm2m_object_get_resource_string(resource, context);
+    if(string != NULL) {
+      return context->writer->write_string(context, outbuf, outlen,
+                                           (const char *)string,
+                                           lwm2m_object_get_resource_strlen(resource, context));
+    }
+  } else if(lwm2m_object_is_resource_int(resource)) {
+    if(lwm2m_object_get_resource_int(resource, context, &value)) {
+      return context->writer->write_int(context, outbuf, outlen, value);
+    }
+  } else if(lwm2m_object_is_resource_floatfix(resource)) {
+    if(lwm2m_object_get_resource_floatfix(resource, context, &value)) {
+      return context->writer->write_float32fix(context, outbuf, outlen,
+                                               value, LWM2M_FLOAT32_BITS);
+    }
+  } else if(lwm2m_object_is_resource_boolean(resource)) {
+    if(lwm2m_object_get_resource_boolean(resource, context, &boolean)) {
+      return context->writer->write_boolean(context, outbuf, outlen, boolean);
+    }
+  } else if(lwm2m_object_is_resource_callback(resource)) {
+    if(resource->value.callback.read != NULL) {
+      return resource->value.callback.read(context, outbuf, outlen);
+    }
+  }
+  return -1;
+}
+/*---------------------------------------------------------------------------*/
 /** @} */
@@ -95,12 +95,18 @@ typedef struct lwm2m_context {
   uint16_t resource_id;
   uint8_t object_instance_index;
   uint8_t resource_index;
+  uint8_t writer_flags;
   /* TODO - add uint16_t resource_instance_id */
 
   const struct lwm2m_reader *reader;
   const struct lwm2m_writer *writer;
 } lwm2m_context_t;
 
+/* the value is one of several written into the same response */
+#define LWM2M_WRITER_BULK 0x01
+/* the first value of an instance in a bulk response */
+#define LWM2M_WRITER_BASE 0x02
+
 /* LWM2M format writer for the various formats supported */
 typedef struct lwm2m_writer {
   size_t (* write_int)(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen, int32_t value);
@@ -295,6 +301,19 @@ lwm2m_object_is_resource_callback(const lwm2m_resource_t *resource)
   return resource != NULL && resource->type == LWM2M_RESOURCE_TYPE_CALLBACK;
 }
 
+const lwm2m_instance_t *
+lwm2m_object_get_instance(const lwm2m_object_t *object,
+                          lwm2m_context_t *context);
+
+const lwm2m_resource_t *
+lwm2m_object_get_resource(const lwm2m_instance_t *instance,
+                          lwm2m_context_t *context);
+
+int
+lwm2m_object_write_resource(const lwm2m_resource_t *resource,
+                            lwm2m_context_t *context,
+                            uint8_t *outbuf, size_t outlen);
+
 const uint8_t *
 lwm2m_object_get_resource_string(const lwm2m_resource_t *resource,
                                  const lwm2m_context_t *context);
@@ -344,11 +363,9 @@ lwm2m_object_get_coap_resource(const lwm2m_object_t *object)
   return (resource_t *)object->coap_resource;
 }
 
-static inline void
-lwm2m_object_notify_observers(const lwm2m_object_t *object, char *path)
-{
-  coap_notify_observers_sub(lwm2m_object_get_coap_resource(object), path);
-}
+/* notify observers of a changed resource, as the notification attributes
+   written for it allow */
+void lwm2m_object_notify_observers(const lwm2m_object_t *object, char *path);
 
 #include "lwm2m-engine.h"
 
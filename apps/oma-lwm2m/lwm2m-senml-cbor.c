@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \addtogroup oma-lwm2m
+ * @{
+ *
+ */
+
+/**
+ * \file
+ *         Implementation of the Contiki OMA LWM2M SenML CBOR writer
+ *
+ *         Each value is a SenML record (RFC 8428) holding the resource
+ *         id as name. The first record of an instance carries the base
+ *         name "/object/instance/", so that a bulk read spells out the
+ *         path prefix once rather than for every resource.
+ */
+
+#include "lwm2m-object.h"
+#include "lwm2m-senml-cbor.h"
+#include "oma-tlv.h"
+#include <stdio.h>
+#include <string.h>
+
+/* CBOR major types */
+#define CBOR_UINT   0x00
+#define CBOR_NINT   0x20
+#define CBOR_TEXT   0x60
+#define CBOR_ARRAY  0x80
+#define CBOR_MAP    0xa0
+#define CBOR_FALSE  0xf4
+#define CBOR_TRUE   0xf5
+#define CBOR_FLOAT  0xfa
+#define CBOR_INDEFINITE_ARRAY 0x9f
+#define CBOR_BREAK  0xff
+
+/* SenML labels */
+#define SENML_BASE_NAME    0x21 /* -2 */
+#define SENML_NAME         0x00
+#define SENML_VALUE        0x02
+#define SENML_STRING_VALUE 0x03
+#define SENML_BOOLEAN_VALUE 0x04
+
+/*---------------------------------------------------------------------------*/
+static size_t
+write_head(uint8_t *outbuf, size_t outlen, uint8_t major, uint32_t value)
+{
+  size_t len;
+
+  len = value < 24 ? 1 : value <= 0xff ? 2 : value <= 0xffff ? 3 : 5;
+  if(outlen < len) {
+    return 0;
+  }
+  switch(len) {
+  case 1:
+    outbuf[0] = major | value;
+    break;
+  case 2:
+    outbuf[0] = major | 24;
+    outbuf[1] = value;
+    break;
+  case 3:
+    outbuf[0] = major | 25;
+    outbuf[1] = value >> 8;
+    outbuf[2] = value;
+    break;
+  default:
+    outbuf[0] = major | 26;
+    outbuf[1] = value >> 24;
+    outbuf[2] = value >> 16;
+    outbuf[3] = value >> 8;
+    outbuf[4] = value;
+    break;
+  }
+  return len;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_text(uint8_t *outbuf, size_t outlen, const char *text, size_t textlen)
+{
+  size_t len;
+
+  len = write_head(outbuf, outlen, CBOR_TEXT, textlen);
+  if(len == 0 || outlen < len + textlen) {
+    return 0;
+  }
+  memcpy(&outbuf[len], text, textlen);
+  return len + textlen;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_int32(uint8_t *outbuf, size_t outlen, int32_t value)
+{
+  if(value < 0) {
+    return write_head(outbuf, outlen, CBOR_NINT, -(value + 1));
+  }
+  return write_head(outbuf, outlen, CBOR_UINT, value);
+}
+/*---------------------------------------------------------------------------*/
+/* everything up to the value label: the enclosing array unless the record
+   is part of a bulk response, the map, and the base name and name */
+static size_t
+write_record_start(const lwm2m_context_t *ctx, uint8_t *outbuf,
+                   size_t outlen, uint8_t label)
+{
+  char text[16];
+  size_t len, pos;
+  int base;
+
+  base = !(ctx->writer_flags & LWM2M_WRITER_BULK) ||
+    (ctx->writer_flags & LWM2M_WRITER_BASE);
+
+  pos = 0;
+  if(!(ctx->writer_flags & LWM2M_WRITER_BULK)) {
+    if(outlen < 1) {
+      return 0;
+    }
+    outbuf[pos++] = CBOR_ARRAY | 1;
+  }
+  if(outlen < pos + 1) {
+    return 0;
+  }
+  outbuf[pos++] = CBOR_MAP | (base ? 3 : 2);
+
+  if(base) {
+    if(outlen < pos + 1) {
+      return 0;
+    }
+    outbuf[pos++] = SENML_BASE_NAME;
+    len = snprintf(text, sizeof(text), "/%u/%u/",
+                   ctx->object_id, ctx->object_instance_id);
+    len = write_text(&outbuf[pos], outlen - pos, text, len);
+    if(len == 0) {
+      return 0;
+    }
+    pos += len;
+  }
+
+  if(outlen < pos + 1) {
+    return 0;
+  }
+  outbuf[pos++] = SENML_NAME;
+  len = snprintf(text, sizeof(text), "%u", ctx->resource_id);
+  len = write_text(&outbuf[pos], outlen - pos, text, len);
+  if(len == 0 || outlen < pos + len + 1) {
+    return 0;
+  }
+  pos += len;
+  outbuf[pos++] = label;
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_int(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+          int32_t value)
+{
+  size_t pos, len;
+
+  pos = write_record_start(ctx, outbuf, outlen, SENML_VALUE);
+  if(pos == 0) {
+    return 0;
+  }
+  len = write_int32(&outbuf[pos], outlen - pos, value);
+  return len == 0 ? 0 : pos + len;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_float32fix(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+                 int32_t value, int bits)
+{
+  size_t pos;
+
+  /* whole numbers are shorter as integers */
+  if((value & ((1L << bits) - 1)) == 0) {
+    return write_int(ctx, outbuf, outlen, value / (1L << bits));
+  }
+  pos = write_record_start(ctx, outbuf, outlen, SENML_VALUE);
+  if(pos == 0 || outlen < pos + 5) {
+    return 0;
+  }
+  outbuf[pos++] = CBOR_FLOAT;
+  oma_tlv_fix_to_float32(value, bits, &outbuf[pos]);
+  return pos + 4;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_boolean(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+              int value)
+{
+  size_t pos;
+
+  pos = write_record_start(ctx, outbuf, outlen, SENML_BOOLEAN_VALUE);
+  if(pos == 0 || outlen < pos + 1) {
+    return 0;
+  }
+  outbuf[pos++] = value ? CBOR_TRUE : CBOR_FALSE;
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_string(const lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+             const char *value, size_t stringlen)
+{
+  size_t pos, len;
+
+  pos = write_record_start(ctx, outbuf, outlen, SENML_STRING_VALUE);
+  if(pos == 0) {
+    return 0;
+  }
+  len = write_text(&outbuf[pos], outlen - pos, value, stringlen);
+  return len == 0 ? 0 : pos + len;
+}
+/*---------------------------------------------------------------------------*/
+size_t
+lwm2m_senml_cbor_write_start(uint8_t *outbuf, size_t outlen)
+{
+  /* the number of records is not known up front */
+  if(outlen < 1) {
+    return 0;
+  }
+  outbuf[0] = CBOR_INDEFINITE_ARRAY;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+size_t
+lwm2m_senml_cbor_write_end(uint8_t *outbuf, size_t outlen)
+{
+  if(outlen < 1) {
+    return 0;
+  }
+  outbuf[0] = CBOR_BREAK;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+const lwm2m_writer_t lwm2m_senml_cbor_writer = {
+  write_int,
+  write_string,
+  write_float32fix,
+  write_boolean
+};
+/*---------------------------------------------------------------------------*/
+/** @} */
@@ -118,17 +118,14 @@ oma_tlv_get_size(const oma_tlv_t *tlv)
 }
 /*---------------------------------------------------------------------------*/
 size_t
-oma_tlv_write(const oma_tlv_t *tlv, uint8_t *buffer, size_t len)
+oma_tlv_write_header(const oma_tlv_t *tlv, uint8_t *buffer, size_t len)
 {
   int pos;
   uint8_t len_type;
 
   /* len type is the same as number of bytes required for length */
   len_type = get_len_type(tlv);
-  pos = 1 + len_type;
-  /* ensure that we do not write too much */
-  if(len < tlv->length + pos) {
-    PRINTF("OMA-TLV: Could not write the TLV - buffer overflow.\n");
+  if(len < 1 + (tlv->id > 255 ? 2 : 1) + len_type) {
     return 0;
   }
 
@@ -154,6 +151,21 @@ oma_tlv_write(const oma_tlv_t *tlv, uint8_t *buffer, size_t len)
   if(len_type > 0) {
     buffer[pos++] = tlv->length & 0xff;
   }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+size_t
+oma_tlv_write(const oma_tlv_t *tlv, uint8_t *buffer, size_t len)
+{
+  int pos;
+
+  /* ensure that we do not write too much */
+  if(len < oma_tlv_get_size(tlv)) {
+    PRINTF("OMA-TLV: Could not write the TLV - buffer overflow.\n");
+    return 0;
+  }
+
+  pos = oma_tlv_write_header(tlv, buffer, len);
 
   /* finally add the value */
   memcpy(&buffer[pos], tlv->value, tlv->length);
@@ -209,16 +221,13 @@ oma_tlv_write_int32(int16_t id, int32_t value, uint8_t *buffer, size_t len)
 }
 /*---------------------------------------------------------------------------*/
 /* convert fixpoint 32-bit to a IEEE Float in the byte array*/
-size_t
-oma_tlv_write_float32(int16_t id, int32_t value, int bits,
-                      uint8_t *buffer, size_t len)
+void
+oma_tlv_fix_to_float32(int32_t value, int bits, uint8_t *b)
 {
   int i;
   int e = 0;
   int32_t val = 0;
   int32_t v;
-  uint8_t b[4];
-  oma_tlv_t tlv;
 
   v = value;
   if(v < 0) {
@@ -248,6 +257,16 @@ oma_tlv_write_float32(int16_t id, int32_t value, int bits,
   b[1] = ((e & 1) << 7) | ((val >> 16) & 0x7f);
   b[2] = (val >> 8) & 0xff;
   b[3] = val & 0xff;
+}
+/*---------------------------------------------------------------------------*/
+size_t
+oma_tlv_write_float32(int16_t id, int32_t value, int bits,
+                      uint8_t *buffer, size_t len)
+{
+  uint8_t b[4];
+  oma_tlv_t tlv;
+
+  oma_tlv_fix_to_float32(value, bits, b);
 
   /* construct the TLV */
   tlv.type = OMA_TLV_TYPE_RESOURCE;
@@ -74,6 +74,9 @@ size_t oma_tlv_read(oma_tlv_t *tlv, const uint8_t *buffer, size_t len);
 /* write a TLV to the buffer */
 size_t oma_tlv_write(const oma_tlv_t *tlv, uint8_t *buffer, size_t len);
 
+/* write only the type, id and length of a TLV, for a value built in place */
+size_t oma_tlv_write_header(const oma_tlv_t *tlv, uint8_t *buffer, size_t len);
+
 int32_t oma_tlv_get_int32(const oma_tlv_t *tlv);
 
 /* write a int as a TLV to the buffer */
@@ -82,6 +85,9 @@ size_t oma_tlv_write_int32(int16_t id, int32_t value, uint8_t *buffer, size_t le
 /* write a float converted from fixpoint as a TLV to the buffer */
 size_t oma_tlv_write_float32(int16_t id, int32_t value, int bits, uint8_t *buffer, size_t len);
 
+/* convert fixpoint to the four bytes of an IEEE float32, MSB first */
+void oma_tlv_fix_to_float32(int32_t value, int bits, uint8_t *b);
+
 /* convert TLV with float32 to fixpoint */
 size_t oma_tlv_float32_to_fix(const oma_tlv_t *tlv, int32_t *value, int bits);
 
@@ -59,6 +59,39 @@ PROCESS(rest_engine_process, "REST Engine");
 LIST(restful_services);
 LIST(restful_periodic_services);
 /*---------------------------------------------------------------------------*/
+/* resources hashed by URL, chained through index_next */
+static resource_t *restful_index[REST_INDEX_SIZE];
+
+/* one step of the string hash, so that the hashes of all prefixes fall out
+ * of a single pass over a path */
+#define INDEX_HASH(h, c) ((h) * 31 + (uint8_t)(c))
+/*---------------------------------------------------------------------------*/
+static uint16_t
+index_hash(const char *url, int url_len)
+{
+  uint16_t h = 0;
+
+  while(url_len-- > 0) {
+    h = INDEX_HASH(h, *url++);
+  }
+  return h;
+}
+/*---------------------------------------------------------------------------*/
+static resource_t *
+index_lookup(uint16_t hash, const char *url, int url_len)
+{
+  resource_t *resource;
+
+  for(resource = restful_index[hash & (REST_INDEX_SIZE - 1)]; resource;
+      resource = resource->index_next) {
+    if(strncmp(resource->url, url, url_len) == 0
+       && resource->url[url_len] == '\0') {
+      return resource;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
 /*- REST Engine API ---------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /**
@@ -102,9 +135,21 @@ rest_init_engine(void)
 void
 rest_activate_resource(resource_t *resource, char *path)
 {
+  resource_t **slot;
+
   resource->url = path;
   list_add(restful_services, resource);
 
+  /* append, so that the first resource activated for a path wins */
+  slot = &restful_index[index_hash(path, strlen(path)) & (REST_INDEX_SIZE - 1)];
+  while(*slot != NULL && *slot != resource) {
+    slot = &(*slot)->index_next;
+  }
+  if(*slot == NULL) {
+    resource->index_next = NULL;
+    *slot = resource;
+  }
+
   PRINTF("Activating: %s\n", resource->url);
 
   /* Only add periodic resources with a periodic_handler and a period > 0. */
@@ -124,6 +169,29 @@ rest_get_resources(void)
   return restful_services;
 }
 /*---------------------------------------------------------------------------*/
+resource_t *
+rest_find_resource(const char *url, int url_len)
+{
+  resource_t *resource;
+  resource_t *parent = NULL;
+  uint16_t hash = 0;
+  int i;
+
+  for(i = 0; i < url_len; i++) {
+    /* each segment boundary ends a candidate parent path */
+    if(url[i] == '/') {
+      resource = index_lookup(hash, url, i);
+      if(resource != NULL && (resource->flags & HAS_SUB_RESOURCES)) {
+        parent = resource;
+      }
+    }
+    hash = INDEX_HASH(hash, url[i]);
+  }
+  resource = index_lookup(hash, url, url_len);
+
+  return resource != NULL ? resource : parent;
+}
+/*---------------------------------------------------------------------------*/
 int
 rest_invoke_restful_service(void *request, void *response, uint8_t *buffer,
                             uint16_t buffer_size, int32_t *offset)
@@ -133,44 +201,35 @@ rest_invoke_restful_service(void *request, void *response, uint8_t *buffer,
 
   resource_t *resource = NULL;
   const char *url = NULL;
-  int url_len, res_url_len;
+  int url_len;
 
   url_len = REST.get_url(request, &url);
-  for(resource = (resource_t *)list_head(restful_services);
-      resource; resource = resource->next) {
-
-    /* if the web service handles that kind of requests and urls matches */
-    res_url_len = strlen(resource->url);
-    if((url_len == res_url_len
-        || (url_len > res_url_len
-            && (resource->flags & HAS_SUB_RESOURCES)
-            && url[res_url_len] == '/'))
-       && strncmp(resource->url, url, res_url_len) == 0) {
-      found = 1;
-      rest_resource_flags_t method = REST.get_method_type(request);
-
-      PRINTF("/%s, method %u, resource->flags %u\n", resource->url,
-             (uint16_t)method, resource->flags);
-
-      if((method & METHOD_GET) && resource->get_handler != NULL) {
-        /* call handler function */
-        resource->get_handler(request, response, buffer, buffer_size, offset);
-      } else if((method & METHOD_POST) && resource->post_handler != NULL) {
-        /* call handler function */
-        resource->post_handler(request, response, buffer, buffer_size,
+  resource = rest_find_resource(url, url_len);
+  /* the resource for this url, if any, and whether it handles the method */
+  if(resource != NULL) {
+    found = 1;
+    rest_resource_flags_t method = REST.get_method_type(request);
+
+    PRINTF("/%s, method %u, resource->flags %u\n", resource->url,
+           (uint16_t)method, resource->flags);
+
+    if((method & METHOD_GET) && resource->get_handler != NULL) {
+      /* call handler function */
+      resource->get_handler(request, response, buffer, buffer_size, offset);
+    } else if((method & METHOD_POST) && resource->post_handler != NULL) {
+      /* call handler function */
+      resource->post_handler(request, response, buffer, buffer_size,
+                             offset);
+    } else if((method & METHOD_PUT) && resource->put_handler != NULL) {
+      /* call handler function */
+      resource->put_handler(request, response, buffer, buffer_size, offset);
+    } else if((method & METHOD_DELETE) && resource->delete_handler != NULL) {
+      /* call handler function */
+      resource->delete_handler(request, response, buffer, buffer_size,
                                offset);
-      } else if((method & METHOD_PUT) && resource->put_handler != NULL) {
-        /* call handler function */
-        resource->put_handler(request, response, buffer, buffer_size, offset);
-      } else if((method & METHOD_DELETE) && resource->delete_handler != NULL) {
-        /* call handler function */
-        resource->delete_handler(request, response, buffer, buffer_size,
-                                 offset);
-      } else {
-        allowed = 0;
-        REST.set_response_status(response, REST.status.METHOD_NOT_ALLOWED);
-      }
-      break;
+    } else {
+      allowed = 0;
+      REST.set_response_status(response, REST.status.METHOD_NOT_ALLOWED);
     }
   }
   if(!found) {
@@ -62,6 +62,16 @@
 #define REST_MAX_CHUNK_SIZE     64
 #endif
 
+/*
+ * Number of hash buckets used to look up resources by URI path, a power of two.
+ * A lookup hashes the request path once and checks one bucket per path segment.
+ */
+#ifdef REST_CONF_INDEX_SIZE
+#define REST_INDEX_SIZE         REST_CONF_INDEX_SIZE
+#else
+#define REST_INDEX_SIZE         16
+#endif
+
 struct resource_s;
 struct periodic_resource_s;
 
@@ -95,6 +105,8 @@ struct resource_s {
     restful_trigger_handler trigger;
     restful_trigger_handler resume;
   };
+  struct resource_s *index_next;  /* next resource in the same hash bucket */
+  void *observers;                /* observers of this resource, kept by the implementation */
 };
 typedef struct resource_s resource_t;
 
@@ -254,5 +266,14 @@ void rest_activate_resource(resource_t *resource, char *path);
  */
 list_t rest_get_resources(void);
 /*---------------------------------------------------------------------------*/
+/**
+ * \brief      Finds the resource handling a URI path.
+ * \param url  The URI path, not null-terminated
+ * \param url_len The length of the URI path
+ * \return     The resource with exactly this path, or else the one with the
+ *             longest path that is a parent of it and has sub-resources, or NULL.
+ */
+resource_t *rest_find_resource(const char *url, int url_len);
+/*---------------------------------------------------------------------------*/
 
 #endif /*REST_ENGINE_H_ */
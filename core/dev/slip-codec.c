@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Buffer oriented SLIP escaping and unescaping
+ */
+
+#include "dev/slip-codec.h"
+#include <string.h>
+
+/*
+ * Scan a machine word at a time for SLIP_END and SLIP_ESC. A byte of
+ * x ^ pattern is zero where x holds the pattern byte, and
+ * (v - 0x01..01) & ~v & 0x80..80 is non-zero iff v has a zero byte.
+ */
+#ifdef SLIP_CODEC_CONF_WORD_SCAN
+#define WORD_SCAN SLIP_CODEC_CONF_WORD_SCAN
+#else
+#define WORD_SCAN 1
+#endif
+
+typedef unsigned long word_t;
+
+#define ONES    ((word_t)-1 / 0xff)
+#define HIGHS   (ONES * 0x80)
+#define HAS_ZERO(v) (((v) - ONES) & ~(v) & HIGHS)
+/*---------------------------------------------------------------------------*/
+int
+slip_codec_span(const uint8_t *buf, int len)
+{
+  int i = 0;
+
+#if WORD_SCAN
+  for(; i + (int)sizeof(word_t) <= len; i += sizeof(word_t)) {
+    word_t w;
+    memcpy(&w, buf + i, sizeof(w));
+    if(HAS_ZERO(w ^ (ONES * SLIP_CODEC_END)) |
+       HAS_ZERO(w ^ (ONES * SLIP_CODEC_ESC))) {
+      break;
+    }
+  }
+#endif /* WORD_SCAN */
+
+  for(; i < len; i++) {
+    if(buf[i] == SLIP_CODEC_END || buf[i] == SLIP_CODEC_ESC) {
+      break;
+    }
+  }
+  return i;
+}
+/*---------------------------------------------------------------------------*/
+int
+slip_codec_encode(uint8_t *dst, const uint8_t *src, int len)
+{
+  uint8_t *out = dst;
+  int n;
+
+  while(len > 0) {
+    n = slip_codec_span(src, len);
+    memcpy(out, src, n);
+    out += n;
+    src += n;
+    len -= n;
+    if(len > 0) {
+      *out++ = SLIP_CODEC_ESC;
+      *out++ = *src++ == SLIP_CODEC_END ? SLIP_CODEC_ESC_END : SLIP_CODEC_ESC_ESC;
+      len--;
+    }
+  }
+  return out - dst;
+}
+/*---------------------------------------------------------------------------*/
+void
+slip_codec_write(const uint8_t *src, int len,
+                 void (*write)(const uint8_t *buf, int len))
+{
+  static const uint8_t esc_end[2] = { SLIP_CODEC_ESC, SLIP_CODEC_ESC_END };
+  static const uint8_t esc_esc[2] = { SLIP_CODEC_ESC, SLIP_CODEC_ESC_ESC };
+  int n;
+
+  while(len > 0) {
+    n = slip_codec_span(src, len);
+    if(n > 0) {
+      write(src, n);
+      src += n;
+      len -= n;
+    }
+    if(len > 0) {
+      write(*src++ == SLIP_CODEC_END ? esc_end : esc_esc, 2);
+      len--;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+slip_codec_decode(uint8_t *dst, const uint8_t *src, int len, uint8_t *esc)
+{
+  const uint8_t *end = src + len;
+  const uint8_t *p;
+  uint8_t *out = dst;
+  int n;
+
+  while(src < end) {
+    if(*esc) {
+      /* Anything else than the two escape codes is dropped */
+      if(*src == SLIP_CODEC_ESC_END) {
+        *out++ = SLIP_CODEC_END;
+      } else if(*src == SLIP_CODEC_ESC_ESC) {
+        *out++ = SLIP_CODEC_ESC;
+      }
+      *esc = 0;
+      src++;
+      continue;
+    }
+
+    p = memchr(src, SLIP_CODEC_ESC, end - src);
+    n = (p != NULL ? p : end) - src;
+    if(out != src) {
+      memmove(out, src, n);
+    }
+    out += n;
+    src += n;
+    if(p != NULL) {
+      *esc = 1;
+      src++;
+    }
+  }
+  return out - dst;
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Buffer oriented SLIP escaping and unescaping
+ *
+ *         The functions work on whole runs of bytes instead of one
+ *         character at a time: bytes that need no escaping are found
+ *         a machine word at a time and moved with memcpy(). The
+ *         module only depends on the C library so that it can also
+ *         be built into host tools.
+ */
+
+#ifndef SLIP_CODEC_H_
+#define SLIP_CODEC_H_
+
+#include <stdint.h>
+
+#define SLIP_CODEC_END     0300
+#define SLIP_CODEC_ESC     0333
+#define SLIP_CODEC_ESC_END 0334
+#define SLIP_CODEC_ESC_ESC 0335
+
+/* Worst case size of len bytes once escaped (without SLIP_END). */
+#define SLIP_CODEC_MAX_ENCODED(len) (2 * (len))
+
+/**
+ * \brief      Find the first byte that must be escaped.
+ * \param buf  The data
+ * \param len  The length of the data
+ * \return     The number of leading bytes that can be sent as is
+ */
+int slip_codec_span(const uint8_t *buf, int len);
+
+/**
+ * \brief      Escape a buffer.
+ * \param dst  Output buffer, at least SLIP_CODEC_MAX_ENCODED(len) bytes
+ * \param src  The data to escape
+ * \param len  The length of the data
+ * \return     The number of bytes written to dst
+ *
+ *             No SLIP_END is added; the caller frames the data.
+ */
+int slip_codec_encode(uint8_t *dst, const uint8_t *src, int len);
+
+/**
+ * \brief        Escape a buffer and pass it on in bulk.
+ * \param src    The data to escape
+ * \param len    The length of the data
+ * \param write  Called with each run of output bytes
+ *
+ *               Runs without special characters are handed to write()
+ *               directly from src, so no output buffer is needed.
+ */
+void slip_codec_write(const uint8_t *src, int len,
+                      void (*write)(const uint8_t *buf, int len));
+
+/**
+ * \brief      Unescape the contents of a SLIP frame.
+ * \param dst  Output buffer; may be the same as src
+ * \param src  The escaped data, without SLIP_END
+ * \param len  The length of the escaped data
+ * \param esc  Escape state, carried between calls when a frame is
+ *             unescaped in several pieces. Set to zero at the start
+ *             of each frame.
+ * \return     The number of bytes written to dst
+ *
+ *             The output is never longer than the input, which makes
+ *             it possible to unescape a frame in place in the buffer
+ *             it was received into.
+ */
+int slip_codec_decode(uint8_t *dst, const uint8_t *src, int len,
+                      uint8_t *esc);
+
+#endif /* SLIP_CODEC_H_ */
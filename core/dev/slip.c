@@ -42,6 +42,7 @@
 #define BUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
 
 #include "dev/slip.h"
+#include "dev/slip-codec.h"
 
 #define SLIP_END     0300
 #define SLIP_ESC     0333
@@ -59,6 +60,13 @@ uint16_t slip_rubbish, slip_twopackets, slip_overflow, slip_ip_drop;
 #define SLIP_STATISTICS(statement) statement
 #endif
 
+/* Set when the platform provides slip_arch_write() */
+#ifdef SLIP_CONF_BULK_WRITE
+#define SLIP_BULK_WRITE SLIP_CONF_BULK_WRITE
+#else
+#define SLIP_BULK_WRITE 0
+#endif
+
 /* Must be at least one byte larger than UIP_BUFSIZE! */
 #define RX_BUFSIZE (UIP_BUFSIZE - UIP_LLH_LEN + 16)
 
@@ -93,32 +101,33 @@ slip_set_input_callback(void (*c)(void))
   input_callback = c;
 }
 /*---------------------------------------------------------------------------*/
+/* Hand a run of escaped bytes to the serial driver */
+static void
+arch_write(const uint8_t *buf, int len)
+{
+#if SLIP_BULK_WRITE
+  slip_arch_write(buf, len);
+#else
+  while(len-- > 0) {
+    slip_arch_writeb(*buf++);
+  }
+#endif
+}
+/*---------------------------------------------------------------------------*/
 /* slip_send: forward (IPv4) packets with {UIP_FW_NETIF(..., slip_send)}
  * was used in slip-bridge.c
  */
 uint8_t
 slip_send(void)
 {
-  uint16_t i;
-  uint8_t *ptr;
-  uint8_t c;
-
   slip_arch_writeb(SLIP_END);
 
-  ptr = &uip_buf[UIP_LLH_LEN];
-  for(i = 0; i < uip_len; ++i) {
-    if(i == UIP_TCPIP_HLEN) {
-      ptr = (uint8_t *)uip_appdata;
-    }
-    c = *ptr++;
-    if(c == SLIP_END) {
-      slip_arch_writeb(SLIP_ESC);
-      c = SLIP_ESC_END;
-    } else if(c == SLIP_ESC) {
-      slip_arch_writeb(SLIP_ESC);
-      c = SLIP_ESC_ESC;
-    }
-    slip_arch_writeb(c);
+  if(uip_len > UIP_TCPIP_HLEN) {
+    slip_codec_write(&uip_buf[UIP_LLH_LEN], UIP_TCPIP_HLEN, arch_write);
+    slip_codec_write((uint8_t *)uip_appdata, uip_len - UIP_TCPIP_HLEN,
+                     arch_write);
+  } else {
+    slip_codec_write(&uip_buf[UIP_LLH_LEN], uip_len, arch_write);
   }
   slip_arch_writeb(SLIP_END);
 
@@ -128,23 +137,8 @@ slip_send(void)
 uint8_t
 slip_write(const void *_ptr, int len)
 {
-  const uint8_t *ptr = _ptr;
-  uint16_t i;
-  uint8_t c;
-
   slip_arch_writeb(SLIP_END);
-
-  for(i = 0; i < len; ++i) {
-    c = *ptr++;
-    if(c == SLIP_END) {
-      slip_arch_writeb(SLIP_ESC);
-      c = SLIP_ESC_END;
-    } else if(c == SLIP_ESC) {
-      slip_arch_writeb(SLIP_ESC);
-      c = SLIP_ESC_ESC;
-    }
-    slip_arch_writeb(c);
-  }
+  slip_codec_write(_ptr, len, arch_write);
   slip_arch_writeb(SLIP_END);
 
   return len;
@@ -157,6 +151,29 @@ rxbuf_init(void)
   state = STATE_OK;
 }
 /*---------------------------------------------------------------------------*/
+/*
+ * Unescape n bytes of rxbuf into outbuf after the len bytes already
+ * there. Returns the new length, or -1 if outbuf overflows.
+ */
+static int
+unescape(uint8_t *outbuf, int len, uint16_t blen,
+         const uint8_t *src, uint16_t n, uint8_t *esc)
+{
+  uint16_t chunk;
+
+  while(n > 0) {
+    if(len >= blen) {
+      return -1;
+    }
+    /* Output is never longer than input, so the chunk always fits */
+    chunk = n < blen - len ? n : blen - len;
+    len += slip_codec_decode(outbuf + len, src, chunk, esc);
+    src += chunk;
+    n -= chunk;
+  }
+  return len;
+}
+/*---------------------------------------------------------------------------*/
 /* Upper half does the polling. */
 static uint16_t
 slip_poll_handler(uint8_t *outbuf, uint16_t blen)
@@ -209,81 +226,23 @@ slip_poll_handler(uint8_t *outbuf, uint16_t blen)
    * If pkt_end != begin it will not change again.
    */
   if(begin != pkt_end) {
-    uint16_t len;
+    int len;
     uint16_t cur_next_free;
     uint16_t cur_ptr;
-    int esc = 0;
+    uint8_t esc = 0;
 
     if(begin < pkt_end) {
-      uint16_t i;
-      len = 0;
-      for(i = begin; i < pkt_end; ++i) {
-        if(len > blen) {
-          len = 0;
-          break;
-        }
-        if (esc) {
-          if(rxbuf[i] == SLIP_ESC_ESC) {
-            outbuf[len] = SLIP_ESC;
-            len++;
-          } else if(rxbuf[i] == SLIP_ESC_END) {
-            outbuf[len] = SLIP_END;
-            len++;
-          }
-          esc = 0;
-        } else if(rxbuf[i] == SLIP_ESC) {
-          esc = 1;
-        } else {
-          outbuf[len] = rxbuf[i];
-          len++;
-        }
-      }
+      len = unescape(outbuf, 0, blen, &rxbuf[begin], pkt_end - begin, &esc);
     } else {
-      uint16_t i;
-      len = 0;
-      for(i = begin; i < RX_BUFSIZE; ++i) {
-        if(len > blen) {
-          len = 0;
-          break;
-        }
-        if (esc) {
-          if(rxbuf[i] == SLIP_ESC_ESC) {
-            outbuf[len] = SLIP_ESC;
-            len++;
-          } else if(rxbuf[i] == SLIP_ESC_END) {
-            outbuf[len] = SLIP_END;
-            len++;
-          }
-          esc = 0;
-        } else if(rxbuf[i] == SLIP_ESC) {
-          esc = 1;
-        } else {
-          outbuf[len] = rxbuf[i];
-          len++;
-        }
-      }
-      for(i = 0; i < pkt_end; ++i) {
-        if(len > blen) {
-          len = 0;
-          break;
-        }
-        if (esc) {
-          if(rxbuf[i] == SLIP_ESC_ESC) {
-            outbuf[len] = SLIP_ESC;
-            len++;
-          } else if(rxbuf[i] == SLIP_ESC_END) {
-            outbuf[len] = SLIP_END;
-            len++;
-          }
-          esc = 0;
-        } else if(rxbuf[i] == SLIP_ESC) {
-          esc = 1;
-        } else {
-          outbuf[len] = rxbuf[i];
-          len++;
-        }
+      len = unescape(outbuf, 0, blen, &rxbuf[begin], RX_BUFSIZE - begin, &esc);
+      if(len >= 0) {
+        len = unescape(outbuf, len, blen, rxbuf, pkt_end, &esc);
       }
     }
+    if(len < 0) {
+      /* Too large for the buffer, drop it */
+      len = 0;
+    }
 
     /* Remove data from buffer together with the copied packet. */
     pkt_end = pkt_end + 1;
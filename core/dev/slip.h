@@ -83,4 +83,10 @@ void slip_set_input_callback(void (*callback)(void));
 void slip_arch_init(unsigned long ubr);
 void slip_arch_writeb(unsigned char c);
 
+/*
+ * Optional bulk output, used instead of slip_arch_writeb() for runs
+ * of bytes when the platform defines SLIP_CONF_BULK_WRITE to 1.
+ */
+void slip_arch_write(const uint8_t *buf, int len);
+
 #endif /* SLIP_H_ */
@@ -224,6 +224,32 @@ static int we_are_receiving_burst = 0;
 #define MAX_PHASE_STROBE_TIME              RTIMER_ARCH_SECOND / 60
 #endif
 
+/* BROADCAST_TRAIN enables sending queued broadcast packets as one
+   train: only the first packet is strobed for a full cycle, and the
+   following ones are sent back-to-back with the FRAME_PENDING bit set
+   while the receivers are still awake. */
+#ifdef CONTIKIMAC_CONF_BROADCAST_TRAIN
+#define BROADCAST_TRAIN                    CONTIKIMAC_CONF_BROADCAST_TRAIN
+#else
+#define BROADCAST_TRAIN                    1
+#endif
+
+/* BROADCAST_TRAIN_MAX is the maximum number of broadcast packets sent
+   in one train. The remaining packets are sent in a later train. */
+#ifdef CONTIKIMAC_CONF_BROADCAST_TRAIN_MAX
+#define BROADCAST_TRAIN_MAX                CONTIKIMAC_CONF_BROADCAST_TRAIN_MAX
+#else
+#define BROADCAST_TRAIN_MAX                8
+#endif
+
+/* BROADCAST_TRAIN_REPEATS is the number of times each packet
+   following the first one in a broadcast train is transmitted. */
+#ifdef CONTIKIMAC_CONF_BROADCAST_TRAIN_REPEATS
+#define BROADCAST_TRAIN_REPEATS            CONTIKIMAC_CONF_BROADCAST_TRAIN_REPEATS
+#else
+#define BROADCAST_TRAIN_REPEATS            2
+#endif
+
 #ifdef CONTIKIMAC_CONF_SEND_SW_ACK
 #define CONTIKIMAC_SEND_SW_ACK CONTIKIMAC_CONF_SEND_SW_ACK
 #else
@@ -718,6 +744,16 @@ send_packet(mac_callback_t mac_callback, void *mac_callback_ptr,
       break;
     }
 
+#if BROADCAST_TRAIN
+    /* The receivers of a broadcast train were woken up by its first
+       packet and keep their radio on while FRAME_PENDING is set, so
+       the following packets need not be strobed for a full cycle. */
+    if(is_broadcast && is_receiver_awake &&
+       strobes >= BROADCAST_TRAIN_REPEATS) {
+      break;
+    }
+#endif /* BROADCAST_TRAIN */
+
 #if !RDC_CONF_HARDWARE_ACK
     len = 0;
 #endif
@@ -850,6 +886,7 @@ qsend_list(mac_callback_t sent, void *ptr, struct rdc_buf_list *buf_list)
   int ret;
   int is_receiver_awake;
   int pending;
+  int count;
 
   if(buf_list == NULL) {
     return;
@@ -865,13 +902,22 @@ qsend_list(mac_callback_t sent, void *ptr, struct rdc_buf_list *buf_list)
 
   /* Create and secure frames in advance */
   curr = buf_list;
+  count = 0;
   do {
     next = list_item_next(curr);
     queuebuf_to_packetbuf(curr->buf);
     if(!packetbuf_attr(PACKETBUF_ATTR_IS_CREATED_AND_SECURED)) {
       /* create and secure this frame */
       if(next != NULL) {
-        packetbuf_set_attr(PACKETBUF_ATTR_PENDING, 1);
+#if BROADCAST_TRAIN
+        /* Bound the length of a broadcast train so that receivers are
+           not kept awake for too long. */
+        if(!packetbuf_holds_broadcast() ||
+           count % BROADCAST_TRAIN_MAX != BROADCAST_TRAIN_MAX - 1)
+#endif /* BROADCAST_TRAIN */
+        {
+          packetbuf_set_attr(PACKETBUF_ATTR_PENDING, 1);
+        }
       }
       packetbuf_set_attr(PACKETBUF_ATTR_MAC_ACK, 1);
       if(NETSTACK_FRAMER.create() < 0) {
@@ -883,6 +929,7 @@ qsend_list(mac_callback_t sent, void *ptr, struct rdc_buf_list *buf_list)
       packetbuf_set_attr(PACKETBUF_ATTR_IS_CREATED_AND_SECURED, 1);
       queuebuf_update_from_packetbuf(curr->buf);
     }
+    count++;
     curr = next;
   } while(next != NULL);
 
@@ -65,11 +65,21 @@ static const struct packetbuf_attrlist attributes[] =
   };
 
 
-/* The recent_packets list holds the sequence number, the originator,
+/* The recent_packets table holds the sequence number, the originator,
    and the connection for packets that have been recently
-   forwarded. This list is maintained to avoid forwarding duplicate
-   packets. */
+   forwarded. This table is maintained to avoid forwarding duplicate
+   packets. It is hashed on the originator and the sequence number
+   into buckets of RECENT_PACKETS_WAYS entries, so that a lookup only
+   has to compare the entries of one bucket. The entries of a bucket
+   are replaced in FIFO order. */
+#ifdef COLLECT_CONF_NUM_RECENT_PACKETS
+#define NUM_RECENT_PACKETS COLLECT_CONF_NUM_RECENT_PACKETS
+#else /* COLLECT_CONF_NUM_RECENT_PACKETS */
 #define NUM_RECENT_PACKETS 16
+#endif /* COLLECT_CONF_NUM_RECENT_PACKETS */
+
+#define RECENT_PACKETS_WAYS 4
+#define NUM_RECENT_BUCKETS  (NUM_RECENT_PACKETS / RECENT_PACKETS_WAYS)
 
 struct recent_packet {
   struct collect_conn *conn;
@@ -77,8 +87,8 @@ struct recent_packet {
   uint8_t eseqno;
 };
 
-static struct recent_packet recent_packets[NUM_RECENT_PACKETS];
-static uint8_t recent_packet_ptr;
+static struct recent_packet recent_packets[NUM_RECENT_BUCKETS][RECENT_PACKETS_WAYS];
+static uint8_t recent_packet_ptr[NUM_RECENT_BUCKETS];
 
 
 /* This is the header of data packets. The header comtains the routing
@@ -489,22 +499,91 @@ enqueue_dummy_packet(struct collect_conn *c, int rexmits)
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+/**
+ * This function returns the number of packets that this node holds
+ * for sending: the packets on the send queue and the packets that are
+ * in flight to the parent.
+ *
+ */
+static int
+send_queue_len(struct collect_conn *c)
+{
+  return packetqueue_len(&c->send_queue) + c->sending;
+}
+/*---------------------------------------------------------------------------*/
+static struct collect_inflight *
+find_inflight(struct collect_conn *c, uint8_t seqno)
+{
+  int i;
+
+  for(i = 0; i < COLLECT_WINDOW; i++) {
+    if(c->inflight[i].buf != NULL && c->inflight[i].seqno == seqno) {
+      return &c->inflight[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+drop_inflight(struct collect_conn *c)
+{
+  int i;
+
+  for(i = 0; i < COLLECT_WINDOW; i++) {
+    if(c->inflight[i].buf != NULL) {
+      queuebuf_free(c->inflight[i].buf);
+      c->inflight[i].buf = NULL;
+    }
+    ctimer_stop(&c->inflight[i].retransmission_timer);
+  }
+  c->sending = 0;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * This function sets the packet attributes and the header of an in
+ * flight packet, which must be in the packetbuf, and sends it to the
+ * neighbor n.
+ *
+ */
 static void
-send_packet(struct collect_conn *c, struct collect_neighbor *n)
+send_packet(struct collect_conn *c, struct collect_inflight *s,
+            struct collect_neighbor *n)
 {
+  struct data_msg_hdr hdr;
   clock_time_t time;
+  int max_mac_rexmits;
+
+  PRINTF("Sending packet %d to %d.%d, %d transmissions\n",
+         s->seqno, n->addr.u8[0], n->addr.u8[1],
+         s->transmissions);
+
+  /* Set the packet attributes: this packet wants an ACK, so we
+     sent the PACKETBUF_ATTR_RELIABLE flag; the MAC should retry
+     MAX_MAC_REXMITS times; and the PACKETBUF_ATTR_PACKET_ID is
+     set to the sequence number of the in-flight packet, which the ACK
+     will carry back to us. */
+  packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, 1);
+  max_mac_rexmits = s->max_rexmits - s->transmissions > MAX_MAC_REXMITS?
+    MAX_MAC_REXMITS : s->max_rexmits - s->transmissions;
+  packetbuf_set_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS, max_mac_rexmits);
+  packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, s->seqno);
+
+  stats.datasent++;
+
+  /* Copy our rtmetric into the packet header of the outgoing
+     packet. */
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.rtmetric = c->rtmetric;
+  memcpy(packetbuf_dataptr(), &hdr, sizeof(struct data_msg_hdr));
 
-  PRINTF("Sending packet to %d.%d, %d transmissions\n",
-         n->addr.u8[0], n->addr.u8[1],
-         c->transmissions);
   /* Defensive programming: if a bug in the MAC/RDC layers will cause
      it to not call us back, we'll set up the retransmission timer
      with a high timeout, so that we can cancel the transmission and
      send a new one. */
   time = 16 * REXMIT_TIME;
-  ctimer_set(&c->retransmission_timer, time,
-             retransmit_not_sent_callback, c);
-  c->send_time = clock_time();
+  ctimer_set(&s->retransmission_timer, time,
+             retransmit_not_sent_callback, s);
+  s->send_time = clock_time();
 
   unicast_send(&c->unicast_conn, &n->addr);
 }
@@ -524,7 +603,7 @@ proactive_probing_callback(void *ptr)
   /* Grab the first packet on the send queue to see if the queue is
      empty or not. */
   i = packetqueue_first(&c->send_queue);
-  if(i == NULL) {
+  if(i == NULL && c->sending == 0) {
     /* If there are no packets to send, we go through the list of
        neighbors to find a potential parent for which we do not have a
        link estimate and send a dummy packet to it. This allows us to
@@ -559,98 +638,40 @@ proactive_probing_callback(void *ptr)
 }
 /*---------------------------------------------------------------------------*/
 /**
- * This function is called when a queued packet should be sent
- * out. The function takes the first packet on the output queue, adds
- * the necessary packet attributes, and sends the packet to the
- * next-hop neighbor.
+ * This function is called when queued packets should be sent
+ * out. The function moves packets from the head of the output queue
+ * to free in-flight slots, adds the necessary packet attributes, and
+ * sends the packets to the next-hop neighbor, until the window of
+ * COLLECT_WINDOW outstanding packets is full.
  *
  */
 static void
 send_queued_packet(struct collect_conn *c)
 {
-  struct queuebuf *q;
   struct collect_neighbor *n;
-  struct packetqueue_item *i;
-  struct data_msg_hdr hdr;
-  int max_mac_rexmits;
+  struct collect_inflight *s;
 
-  /* If we are currently sending a packet, we do not attempt to send
-     another one. */
-  if(c->sending) {
-    PRINTF("%d.%d: queue, c is sending\n",
-           linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1]);
-    return;
-  }
-
-
-  /* Grab the first packet on the send queue. */
-  i = packetqueue_first(&c->send_queue);
-  if(i == NULL) {
-    PRINTF("%d.%d: nothing on queue\n",
-           linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1]);
-
-    return;
-  }
+  while(1) {
+    /* If the window is full, we do not attempt to send another
+       packet. */
+    if(c->sending >= COLLECT_WINDOW) {
+      PRINTF("%d.%d: queue, c is sending\n",
+             linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1]);
+      return;
+    }
 
-  /* We should send the first packet from the queue. */
-  q = packetqueue_queuebuf(i);
-  if(q != NULL) {
-    /* Place the queued packet into the packetbuf. */
-    queuebuf_to_packetbuf(q);
+    /* Grab the first packet on the send queue. */
+    if(packetqueue_queuebuf(packetqueue_first(&c->send_queue)) == NULL) {
+      PRINTF("%d.%d: nothing on queue\n",
+             linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1]);
+      return;
+    }
 
     /* Pick the neighbor to which to send the packet. We use the
        parent in the n->parent. */
     n = collect_neighbor_list_find(&c->neighbor_list, &c->parent);
 
-    if(n != NULL) {
-
-      /* If the connection had a neighbor, we construct the packet
-         buffer attributes and set the appropriate flags in the
-         Collect connection structure and send the packet. */
-
-      PRINTF("%d.%d: sending packet to %d.%d with eseqno %d\n",
-	     linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
-	     n->addr.u8[0], n->addr.u8[1],
-             packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
-
-      /* Mark that we are currently sending a packet. */
-      c->sending = 1;
-
-      /* Remember the parent that we sent this packet to. */
-      linkaddr_copy(&c->current_parent, &c->parent);
-
-      /* This is the first time we transmit this packet, so set
-         transmissions to zero. */
-      c->transmissions = 0;
-
-      /* Remember that maximum amount of retransmissions we should
-         make. This is stored inside a packet attribute in the packet
-         on the send queue. */
-      c->max_rexmits = packetbuf_attr(PACKETBUF_ATTR_MAX_REXMIT);
-
-      /* Set the packet attributes: this packet wants an ACK, so we
-         sent the PACKETBUF_ATTR_RELIABLE flag; the MAC should retry
-         MAX_MAC_REXMITS times; and the PACKETBUF_ATTR_PACKET_ID is
-         set to the current sequence number on the connection. */
-      packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, 1);
-
-      max_mac_rexmits = c->max_rexmits > MAX_MAC_REXMITS?
-        MAX_MAC_REXMITS : c->max_rexmits;
-      packetbuf_set_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS, max_mac_rexmits);
-      packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, c->seqno);
-
-      stats.datasent++;
-
-      /* Copy our rtmetric into the packet header of the outgoing
-         packet. */
-      memset(&hdr, 0, sizeof(hdr));
-      hdr.rtmetric = c->rtmetric;
-      memcpy(packetbuf_dataptr(), &hdr, sizeof(struct data_msg_hdr));
-
-      /* Send the packet. */
-      send_packet(c, n);
-
-    } else {
+    if(n == NULL) {
 #if COLLECT_ANNOUNCEMENTS
 #if COLLECT_CONF_WITH_LISTEN
       PRINTF("listen\n");
@@ -659,113 +680,112 @@ send_queued_packet(struct collect_conn *c)
                  send_queued_packet, c);
 #else /* COLLECT_CONF_WITH_LISTEN */
       if(c->is_router) {
-	announcement_set_value(&c->announcement, RTMETRIC_MAX);
-	announcement_bump(&c->announcement);
+        announcement_set_value(&c->announcement, RTMETRIC_MAX);
+        announcement_bump(&c->announcement);
       }
 #endif /* COLLECT_CONF_WITH_LISTEN */
 #endif /* COLLECT_ANNOUNCEMENTS */
+      return;
     }
+
+    for(s = c->inflight; s->buf != NULL; s++);
+
+    /* The packet leaves the send queue: from now on its lifetime is
+       bounded by its number of retransmissions. */
+    s->buf = packetqueue_dequeue_queuebuf(&c->send_queue);
+    c->sending++;
+
+    /* Place the packet into the packetbuf. */
+    queuebuf_to_packetbuf(s->buf);
+
+    PRINTF("%d.%d: sending packet to %d.%d with eseqno %d\n",
+           linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
+           n->addr.u8[0], n->addr.u8[1],
+           packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
+
+    /* Remember the parent that we sent this packet to. */
+    linkaddr_copy(&c->current_parent, &c->parent);
+    linkaddr_copy(&s->parent, &c->parent);
+
+    /* This is the first time we transmit this packet, so set
+       transmissions to zero. */
+    s->transmissions = 0;
+
+    /* Remember that maximum amount of retransmissions we should
+       make. This is stored inside a packet attribute in the packet
+       on the send queue. */
+    s->max_rexmits = packetbuf_attr(PACKETBUF_ATTR_MAX_REXMIT);
+
+    /* Each packet in flight has its own sequence number, which the
+       ACK from the parent refers to. */
+    s->seqno = c->seqno;
+    c->seqno = (c->seqno + 1) % (1 << COLLECT_PACKET_ID_BITS);
+
+    /* Send the packet. */
+    send_packet(c, s, n);
   }
 }
 /*---------------------------------------------------------------------------*/
 /**
- * This function is called to retransmit the first packet on the send
- * queue.
+ * This function is called to retransmit an in-flight packet.
  *
  */
 static void
-retransmit_current_packet(struct collect_conn *c)
+retransmit_packet(struct collect_inflight *s)
 {
-  struct queuebuf *q;
+  struct collect_conn *c = s->c;
   struct collect_neighbor *n;
-  struct packetqueue_item *i;
-  struct data_msg_hdr hdr;
-  int max_mac_rexmits;
 
-  /* Grab the first packet on the send queue, which is the one we are
-     about to retransmit. */
-  i = packetqueue_first(&c->send_queue);
-  if(i == NULL) {
-      PRINTF("%d.%d: nothing on queue\n",
-	     linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1]);
-    /* No packet on the queue, so there is nothing for us to send. */
-    return;
-  }
+  update_rtmetric(c);
 
-  /* Get hold of the queuebuf. */
-  q = packetqueue_queuebuf(i);
-  if(q != NULL) {
+  /* Place the packet into the packetbuf. */
+  queuebuf_to_packetbuf(s->buf);
 
-    update_rtmetric(c);
-    
-    /* Place the queued packet into the packetbuf. */
-    queuebuf_to_packetbuf(q);
-
-    /* Pick the neighbor to which to send the packet. If we have found
-       a better parent while we were transmitting this packet, we
-       chose that neighbor instead. If so, we need to attribute the
-       transmissions we made for the parent to that neighbor. */
-    if(!linkaddr_cmp(&c->current_parent, &c->parent)) {
-      /*      struct collect_neighbor *current_neighbor;
-      current_neighbor = collect_neighbor_list_find(&c->neighbor_list,
-                                                    &c->current_parent);
-      if(current_neighbor != NULL) {
-        collect_neighbor_tx(current_neighbor, c->max_rexmits);
-        }*/
-
-      PRINTF("parent change from %d.%d to %d.%d after %d tx\n",
-             c->current_parent.u8[0], c->current_parent.u8[1],
-             c->parent.u8[0], c->parent.u8[1],
-             c->transmissions);
-
-      linkaddr_copy(&c->current_parent, &c->parent);
-      c->transmissions = 0;
-    }
-    n = collect_neighbor_list_find(&c->neighbor_list, &c->current_parent);
+  /* Pick the neighbor to which to send the packet. If we have found
+     a better parent while we were transmitting this packet, we
+     chose that neighbor instead. If so, we need to attribute the
+     transmissions we made for the parent to that neighbor. */
+  if(!linkaddr_cmp(&s->parent, &c->parent)) {
+    PRINTF("parent change from %d.%d to %d.%d after %d tx\n",
+           s->parent.u8[0], s->parent.u8[1],
+           c->parent.u8[0], c->parent.u8[1],
+           s->transmissions);
 
-    if(n != NULL) {
+    linkaddr_copy(&s->parent, &c->parent);
+    s->transmissions = 0;
+  }
+  linkaddr_copy(&c->current_parent, &s->parent);
+  n = collect_neighbor_list_find(&c->neighbor_list, &s->parent);
 
-      /* If the connection had a neighbor, we construct the packet
-         buffer attributes and set the appropriate flags in the
-         Collect connection structure and send the packet. */
+  if(n != NULL) {
+    PRINTF("%d.%d: sending packet to %d.%d with eseqno %d\n",
+           linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
+           n->addr.u8[0], n->addr.u8[1],
+           packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
 
-      PRINTF("%d.%d: sending packet to %d.%d with eseqno %d\n",
-	     linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
-	     n->addr.u8[0], n->addr.u8[1],
-             packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
-
-      /* Mark that we are currently sending a packet. */
-      c->sending = 1;
-      packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, 1);
-      max_mac_rexmits = c->max_rexmits - c->transmissions > MAX_MAC_REXMITS?
-        MAX_MAC_REXMITS : c->max_rexmits - c->transmissions;
-      packetbuf_set_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS, max_mac_rexmits);
-      packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, c->seqno);
-
-      /* Copy our rtmetric into the packet header of the outgoing
-         packet. */
-      memset(&hdr, 0, sizeof(hdr));
-      hdr.rtmetric = c->rtmetric;
-      memcpy(packetbuf_dataptr(), &hdr, sizeof(struct data_msg_hdr));
-
-      /* Send the packet. */
-      send_packet(c, n);
-    }
+    send_packet(c, s, n);
+  } else {
+    /* We have no route at the moment. Count the attempt so that the
+       packet eventually times out, and try again later. */
+    s->transmissions++;
+    ctimer_set(&s->retransmission_timer, REXMIT_TIME,
+               retransmit_callback, s);
   }
-
 }
 /*---------------------------------------------------------------------------*/
 static void
-send_next_packet(struct collect_conn *tc)
+send_next_packet(struct collect_inflight *s)
 {
-  /* Remove the first packet on the queue, the packet that was just sent. */
-  packetqueue_dequeue(&tc->send_queue);
-  tc->seqno = (tc->seqno + 1) % (1 << COLLECT_PACKET_ID_BITS);
+  struct collect_conn *tc = s->c;
+
+  /* Free the in-flight packet, the packet that was just sent. */
+  queuebuf_free(s->buf);
+  s->buf = NULL;
 
   /* Cancel retransmission timer. */
-  ctimer_stop(&tc->retransmission_timer);
-  tc->sending = 0;
-  tc->transmissions = 0;
+  ctimer_stop(&s->retransmission_timer);
+  s->transmissions = 0;
+  tc->sending--;
 
   PRINTF("sending next packet, seqno %d, queue len %d\n",
          tc->seqno, packetqueue_len(&tc->send_queue));
@@ -779,21 +799,24 @@ handle_ack(struct collect_conn *tc)
 {
   struct ack_msg msg;
   struct collect_neighbor *n;
+  struct collect_inflight *s;
+
+  /* The ACK carries the sequence number of the in-flight packet that
+     it acknowledges. */
+  s = find_inflight(tc, packetbuf_attr(PACKETBUF_ATTR_PACKET_ID));
 
-  PRINTF("handle_ack: sender %d.%d current_parent %d.%d, id %d seqno %d\n",
+  PRINTF("handle_ack: sender %d.%d, id %d, %d in flight\n",
          packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0],
          packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1],
-         tc->current_parent.u8[0], tc->current_parent.u8[1],
-         packetbuf_attr(PACKETBUF_ATTR_PACKET_ID), tc->seqno);
-  if(linkaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_SENDER),
-                  &tc->current_parent) &&
-     packetbuf_attr(PACKETBUF_ATTR_PACKET_ID) == tc->seqno) {
+         packetbuf_attr(PACKETBUF_ATTR_PACKET_ID), tc->sending);
+  if(s != NULL &&
+     linkaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_SENDER), &s->parent)) {
 
     /*    PRINTF("rtt %d / %d = %d.%02d\n",
-           (int)(clock_time() - tc->send_time),
+           (int)(clock_time() - s->send_time),
            (int)CLOCK_SECOND,
-           (int)((clock_time() - tc->send_time) / CLOCK_SECOND),
-           (int)(((100 * (clock_time() - tc->send_time)) / CLOCK_SECOND) % 100));*/
+           (int)((clock_time() - s->send_time) / CLOCK_SECOND),
+           (int)(((100 * (clock_time() - s->send_time)) / CLOCK_SECOND) % 100));*/
     
     stats.ackrecv++;
     memcpy(&msg, packetbuf_dataptr(), sizeof(struct ack_msg));
@@ -804,24 +827,24 @@ handle_ack(struct collect_conn *tc)
        transmission counter may still be zero. If this is the case, we
        play it safe by believing that we have sent MAX_MAC_REXMITS
        transmissions. */
-    if(tc->transmissions == 0) {
-      tc->transmissions = MAX_MAC_REXMITS;
+    if(s->transmissions == 0) {
+      s->transmissions = MAX_MAC_REXMITS;
     }
     PRINTF("Updating link estimate with %d transmissions\n",
-           tc->transmissions);
+           s->transmissions);
     n = collect_neighbor_list_find(&tc->neighbor_list,
                                    packetbuf_addr(PACKETBUF_ADDR_SENDER));
 
     if(n != NULL) {
-      collect_neighbor_tx(n, tc->transmissions);
+      collect_neighbor_tx(n, s->transmissions);
       collect_neighbor_update_rtmetric(n, msg.rtmetric);
       update_rtmetric(tc);
     }
 
     PRINTF("%d.%d: ACK from %d.%d after %d transmissions, flags %02x, rtmetric %d\n",
            linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
-           tc->current_parent.u8[0], tc->current_parent.u8[1],
-           tc->transmissions,
+           s->parent.u8[0], s->parent.u8[1],
+           s->transmissions,
            msg.flags,
            msg.rtmetric);
 
@@ -835,30 +858,30 @@ handle_ack(struct collect_conn *tc)
       PRINTF("ACK flag indicated parent was congested.\n");
       if(n != NULL) {
 	collect_neighbor_set_congested(n);
-	collect_neighbor_tx(n, tc->max_rexmits * 2);
+	collect_neighbor_tx(n, s->max_rexmits * 2);
       }
       update_rtmetric(tc);
     }
     if((msg.flags & ACK_FLAGS_DROPPED) == 0) {
       /* If the packet was successfully received, we send the next packet. */
-      send_next_packet(tc);
+      send_next_packet(s);
     } else {
       /* If the packet was lost due to its lifetime being exceeded,
          there is not much more we can do with the packet, so we send
          the next one instead. */
       if((msg.flags & ACK_FLAGS_LIFETIME_EXCEEDED)) {
-        send_next_packet(tc);
+        send_next_packet(s);
       } else {
         /* If the packet was dropped, but without the node being
            congested or the packets lifetime being exceeded, we
            penalize the parent and try sending the packet again. */
         PRINTF("ACK flag indicated packet was dropped by parent.\n");
-        collect_neighbor_tx(n, tc->max_rexmits);
+        collect_neighbor_tx(n, s->max_rexmits);
         update_rtmetric(tc);
 
-        ctimer_set(&tc->retransmission_timer,
+        ctimer_set(&s->retransmission_timer,
                    REXMIT_TIME + (random_rand() % (REXMIT_TIME)),
-                   retransmit_callback, tc);
+                   retransmit_callback, s);
       }
     }
 
@@ -903,29 +926,65 @@ send_ack(struct collect_conn *tc, const linkaddr_t *to, int flags)
   stats.acksent++;
 }
 /*---------------------------------------------------------------------------*/
+static uint8_t
+recent_packets_bucket(const linkaddr_t *originator, uint8_t eseqno)
+{
+  unsigned int h;
+  int i;
+
+  /* Consecutive packets from one originator go to different buckets. */
+  h = eseqno;
+  for(i = 0; i < LINKADDR_SIZE; i++) {
+    h += originator->u8[i] * (2 * i + 3);
+  }
+  return h % NUM_RECENT_BUCKETS;
+}
+/*---------------------------------------------------------------------------*/
 static void
 add_packet_to_recent_packets(struct collect_conn *tc)
 {
+  struct recent_packet *r;
+  uint8_t b;
+
   /* Remember that we have seen this packet for later, but only if
      it has a length that is larger than zero. Packets with size
      zero are keepalive or proactive link estimate probes, so we do
      not record them in our history. */
   if(packetbuf_datalen() > sizeof(struct data_msg_hdr)) {
-    recent_packets[recent_packet_ptr].eseqno =
-      packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID);
-    linkaddr_copy(&recent_packets[recent_packet_ptr].originator,
-                  packetbuf_addr(PACKETBUF_ADDR_ESENDER));
-    recent_packets[recent_packet_ptr].conn = tc;
-    recent_packet_ptr = (recent_packet_ptr + 1) % NUM_RECENT_PACKETS;
+    b = recent_packets_bucket(packetbuf_addr(PACKETBUF_ADDR_ESENDER),
+                              packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
+    r = &recent_packets[b][recent_packet_ptr[b]];
+    r->eseqno = packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID);
+    linkaddr_copy(&r->originator, packetbuf_addr(PACKETBUF_ADDR_ESENDER));
+    r->conn = tc;
+    recent_packet_ptr[b] = (recent_packet_ptr[b] + 1) % RECENT_PACKETS_WAYS;
   }
 }
 /*---------------------------------------------------------------------------*/
+static int
+is_recent_packet(struct collect_conn *tc)
+{
+  struct recent_packet *r;
+  uint8_t eseqno;
+  int i;
+
+  eseqno = packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID);
+  r = recent_packets[recent_packets_bucket(packetbuf_addr(PACKETBUF_ADDR_ESENDER),
+                                           eseqno)];
+  for(i = 0; i < RECENT_PACKETS_WAYS; i++) {
+    if(r[i].conn == tc && r[i].eseqno == eseqno &&
+       linkaddr_cmp(&r[i].originator, packetbuf_addr(PACKETBUF_ADDR_ESENDER))) {
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
 static void
 node_packet_received(struct unicast_conn *c, const linkaddr_t *from)
 {
   struct collect_conn *tc = (struct collect_conn *)
     ((char *)c - offsetof(struct collect_conn, unicast_conn));
-  int i;
   struct data_msg_hdr hdr;
   uint8_t ackflags = 0;
   struct collect_neighbor *n;
@@ -966,29 +1025,25 @@ node_packet_received(struct unicast_conn *c, const linkaddr_t *from)
     /* If the queue is more than half filled, we add the CONGESTED
        flag to our outgoing acks. */
     if(DRAW_TREE) {
-      PRINTF("#A s=%d\n", packetqueue_len(&tc->send_queue));
+      PRINTF("#A s=%d\n", send_queue_len(tc));
     }
-    if(packetqueue_len(&tc->send_queue) >= MAX_SENDING_QUEUE / 2) {
+    if(send_queue_len(tc) >= MAX_SENDING_QUEUE / 2) {
       ackflags |= ACK_FLAGS_CONGESTED;
     }
 
-    for(i = 0; i < NUM_RECENT_PACKETS; i++) {
-      if(recent_packets[i].conn == tc &&
-         recent_packets[i].eseqno == packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID) &&
-         linkaddr_cmp(&recent_packets[i].originator,
-                      packetbuf_addr(PACKETBUF_ADDR_ESENDER))) {
-        /* This is a duplicate of a packet we recently received, so we
-           just send an ACK. */
-        PRINTF("%d.%d: found duplicate packet from %d.%d with seqno %d, via %d.%d\n",
-               linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
-               recent_packets[i].originator.u8[0], recent_packets[i].originator.u8[1],
-               packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID),
-               packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0],
-               packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1]);
-        send_ack(tc, &ack_to, ackflags);
-        stats.duprecv++;
-        return;
-      }
+    if(is_recent_packet(tc)) {
+      /* This is a duplicate of a packet we recently received, so we
+         just send an ACK. */
+      PRINTF("%d.%d: found duplicate packet from %d.%d with seqno %d, via %d.%d\n",
+             linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
+             packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[0],
+             packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[1],
+             packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID),
+             packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0],
+             packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1]);
+      send_ack(tc, &ack_to, ackflags);
+      stats.duprecv++;
+      return;
     }
 
     /* If we are the sink, the packet has reached its final
@@ -1063,7 +1118,7 @@ node_packet_received(struct unicast_conn *c, const linkaddr_t *from)
          memory problems. We first check the size of our sending queue
          to ensure that we always have entries for packets that
          are originated by this node. */
-      if(packetqueue_len(&tc->send_queue) <= MAX_SENDING_QUEUE - MIN_AVAILABLE_QUEUE_ENTRIES &&
+      if(send_queue_len(tc) <= MAX_SENDING_QUEUE - MIN_AVAILABLE_QUEUE_ENTRIES &&
          packetqueue_enqueue_packetbuf(&tc->send_queue,
                                        FORWARD_PACKET_LIFETIME_BASE *
                                        packetbuf_attr(PACKETBUF_ATTR_MAX_REXMIT),
@@ -1095,7 +1150,7 @@ node_packet_received(struct unicast_conn *c, const linkaddr_t *from)
            tc->current_parent.u8[0],
            tc->current_parent.u8[1],
            packetbuf_attr(PACKETBUF_ATTR_PACKET_ID),
-           tc->seqno);
+           tc->sending);
     handle_ack(tc);
     stats.ackrecv++;
   }
@@ -1103,26 +1158,23 @@ node_packet_received(struct unicast_conn *c, const linkaddr_t *from)
 }
 /*---------------------------------------------------------------------------*/
 static void
-timedout(struct collect_conn *tc)
+timedout(struct collect_inflight *s)
 {
+  struct collect_conn *tc = s->c;
   struct collect_neighbor *n;
+
   PRINTF("%d.%d: timedout after %d retransmissions to %d.%d (max retransmissions %d): packet dropped\n",
-	 linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1], tc->transmissions,
-         tc->current_parent.u8[0], tc->current_parent.u8[1],
-         tc->max_rexmits);
-  PRINTF("%d.%d: timedout after %d retransmissions to %d.%d (max retransmissions %d): packet dropped\n",
-	 linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1], tc->transmissions,
-         tc->current_parent.u8[0], tc->current_parent.u8[1],
-         tc->max_rexmits);
+	 linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1], s->transmissions,
+         s->parent.u8[0], s->parent.u8[1],
+         s->max_rexmits);
 
-  tc->sending = 0;
   n = collect_neighbor_list_find(&tc->neighbor_list,
-                                 &tc->current_parent);
+                                 &s->parent);
   if(n != NULL) {
-    collect_neighbor_tx_fail(n, tc->max_rexmits);
+    collect_neighbor_tx_fail(n, s->max_rexmits);
   }
   update_rtmetric(tc);
-  send_next_packet(tc);
+  send_next_packet(s);
   set_keepalive_timer(tc);
 }
 /*---------------------------------------------------------------------------*/
@@ -1131,26 +1183,34 @@ node_packet_sent(struct unicast_conn *c, int status, int transmissions)
 {
   struct collect_conn *tc = (struct collect_conn *)
     ((char *)c - offsetof(struct collect_conn, unicast_conn));
+  struct collect_inflight *s;
 
   /* For data packets, we record the number of transmissions */
   if(packetbuf_attr(PACKETBUF_ATTR_PACKET_TYPE) ==
      PACKETBUF_ATTR_PACKET_TYPE_DATA) {
 
-    tc->transmissions += transmissions;
-    PRINTF("tx %d\n", tc->transmissions);    
+    /* The packet may already have been ACKed if the link-layer ACK
+       was lost. */
+    s = find_inflight(tc, packetbuf_attr(PACKETBUF_ATTR_PACKET_ID));
+    if(s == NULL) {
+      return;
+    }
+
+    s->transmissions += transmissions;
+    PRINTF("tx %d\n", s->transmissions);    
     PRINTF("%d.%d: MAC sent %d transmissions to %d.%d, status %d, total transmissions %d\n",
            linkaddr_node_addr.u8[0], linkaddr_node_addr.u8[1],
            transmissions,
-           tc->current_parent.u8[0], tc->current_parent.u8[1],
-           status, tc->transmissions);
-    if(tc->transmissions >= tc->max_rexmits) {
-      timedout(tc);
+           s->parent.u8[0], s->parent.u8[1],
+           status, s->transmissions);
+    if(s->transmissions >= s->max_rexmits) {
+      timedout(s);
       stats.timedout++;
     } else {
       clock_time_t time = REXMIT_TIME / 2 + (random_rand() % (REXMIT_TIME / 2));
       PRINTF("retransmission time %lu\n", time);
-      ctimer_set(&tc->retransmission_timer, time,
-                 retransmit_callback, tc);
+      ctimer_set(&s->retransmission_timer, time,
+                 retransmit_callback, s);
     }
   }
 }
@@ -1166,32 +1226,31 @@ node_packet_sent(struct unicast_conn *c, int status, int transmissions)
 static void
 retransmit_not_sent_callback(void *ptr)
 {
-  struct collect_conn *c = ptr;
+  struct collect_inflight *s = ptr;
 
-  PRINTF("retransmit not sent, %d transmissions\n", c->transmissions);
-  c->transmissions += MAX_MAC_REXMITS + 1;
-  retransmit_callback(c);
+  PRINTF("retransmit not sent, %d transmissions\n", s->transmissions);
+  s->transmissions += MAX_MAC_REXMITS + 1;
+  retransmit_callback(s);
 }
 /*---------------------------------------------------------------------------*/
 /**
  * This function is called from a ctimer that is setup when a packet
  * is sent. The purpose of this function is to either retransmit the
- * current packet, or timeout the packet. The descision is made
- * depending on how many times the packet has been transmitted. The
- * ctimer is set up in the function node_packet_sent().
+ * packet, or timeout the packet. The descision is made depending on
+ * how many times the packet has been transmitted. The ctimer is set
+ * up in the function node_packet_sent().
  */
 static void
 retransmit_callback(void *ptr)
 {
-  struct collect_conn *c = ptr;
+  struct collect_inflight *s = ptr;
 
-  PRINTF("retransmit, %d transmissions\n", c->transmissions);
-  if(c->transmissions >= c->max_rexmits) {
-    timedout(c);
+  PRINTF("retransmit, %d transmissions\n", s->transmissions);
+  if(s->transmissions >= s->max_rexmits) {
+    timedout(s);
     stats.timedout++;
   } else {
-    c->sending = 0;
-    retransmit_current_packet(c);
+    retransmit_packet(s);
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -1299,6 +1358,8 @@ collect_open(struct collect_conn *tc, uint16_t channels,
              uint8_t is_router,
 	     const struct collect_callbacks *cb)
 {
+  int i;
+
   unicast_open(&tc->unicast_conn, channels + 1, &unicast_callbacks);
   channel_set_attributes(channels + 1, attributes);
   tc->rtmetric = RTMETRIC_MAX;
@@ -1306,6 +1367,11 @@ collect_open(struct collect_conn *tc, uint16_t channels,
   tc->is_router = is_router;
   tc->seqno = 10;
   tc->eseqno = 0;
+  tc->sending = 0;
+  for(i = 0; i < COLLECT_WINDOW; i++) {
+    tc->inflight[i].c = tc;
+    tc->inflight[i].buf = NULL;
+  }
   LIST_STRUCT_INIT(tc, send_queue_list);
   collect_neighbor_list_new(&tc->neighbor_list);
   tc->send_queue.list = &(tc->send_queue_list);
@@ -1386,6 +1452,7 @@ collect_close(struct collect_conn *tc)
   while(packetqueue_first(&tc->send_queue) != NULL) {
     packetqueue_dequeue(&tc->send_queue);
   }
+  drop_inflight(tc);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -1402,8 +1469,9 @@ collect_set_sink(struct collect_conn *tc, int should_be_sink)
       packetqueue_dequeue(&tc->send_queue);
     }
 
-    /* Stop the retransmission timer. */
-    ctimer_stop(&tc->retransmission_timer);
+    /* Drop the packets in flight and stop their retransmission
+       timers. */
+    drop_inflight(tc);
   } else {
     tc->rtmetric = RTMETRIC_MAX;
   }
@@ -100,6 +100,28 @@
                             { PACKETBUF_ATTR_PACKET_TYPE, PACKETBUF_ATTR_BIT }, \
                             UNICAST_ATTRIBUTES
 
+/* COLLECT_CONF_WINDOW is the number of packets that may be in
+   flight to the parent at the same time, each waiting for its own
+   ACK. With the default of one, packets are sent stop-and-wait. */
+#ifdef COLLECT_CONF_WINDOW
+#define COLLECT_WINDOW COLLECT_CONF_WINDOW
+#else /* COLLECT_CONF_WINDOW */
+#define COLLECT_WINDOW 1
+#endif /* COLLECT_CONF_WINDOW */
+
+struct collect_conn;
+
+/* A packet that has been sent to the parent but not yet ACKed. The
+   packet is owned by the slot until it is ACKed or times out. */
+struct collect_inflight {
+  struct collect_conn *c;
+  struct queuebuf *buf;
+  struct ctimer retransmission_timer;
+  linkaddr_t parent;
+  clock_time_t send_time;
+  uint8_t seqno, transmissions, max_rexmits;
+};
+
 struct collect_callbacks {
   void (* recv)(const linkaddr_t *originator, uint8_t seqno,
 		uint8_t hops);
@@ -123,7 +145,7 @@ struct collect_conn {
   struct ctimer transmit_after_scan_timer;
 #endif /* COLLECT_ANNOUNCEMENTS */
   const struct collect_callbacks *cb;
-  struct ctimer retransmission_timer;
+  struct collect_inflight inflight[COLLECT_WINDOW];
   LIST_STRUCT(send_queue_list);
   struct packetqueue send_queue;
   struct collect_neighbor_list neighbor_list;
@@ -136,11 +158,9 @@ struct collect_conn {
   linkaddr_t parent, current_parent;
   uint16_t rtmetric;
   uint8_t seqno;
-  uint8_t sending, transmissions, max_rexmits;
+  uint8_t sending;
   uint8_t eseqno;
   uint8_t is_router;
-
-  clock_time_t send_time;
 };
 
 enum {
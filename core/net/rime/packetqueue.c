@@ -123,6 +123,23 @@ packetqueue_dequeue(struct packetqueue *q)
   }
 }
 /*---------------------------------------------------------------------------*/
+struct queuebuf *
+packetqueue_dequeue_queuebuf(struct packetqueue *q)
+{
+  struct packetqueue_item *i;
+  struct queuebuf *buf;
+
+  i = list_head(*q->list);
+  if(i == NULL) {
+    return NULL;
+  }
+  buf = i->buf;
+  list_remove(*q->list, i);
+  ctimer_stop(&i->lifetimer);
+  memb_free(q->memb, i);
+  return buf;
+}
+/*---------------------------------------------------------------------------*/
 int
 packetqueue_len(struct packetqueue *q)
 {
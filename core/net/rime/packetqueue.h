@@ -178,6 +178,19 @@ struct packetqueue_item *packetqueue_first(struct packetqueue *q);
  */
 void packetqueue_dequeue(struct packetqueue *q);
 
+/**
+ * \brief      Remove the first item on the packet buffer and keep its queuebuf.
+ * \param q    A pointer to a struct packetqueue.
+ * \return     The queuebuf of the first item, or NULL if the queue is empty.
+ *
+ *             This function removes the first item on the packet
+ *             queue like packetqueue_dequeue(), but hands its queuebuf
+ *             over to the caller instead of freeing it. The caller
+ *             must free the queuebuf with queuebuf_free().
+ *
+ */
+struct queuebuf *packetqueue_dequeue_queuebuf(struct packetqueue *q);
+
 /**
  * \brief      Get the length of the packet queue
  * \param q    A pointer to a struct packetqueue.
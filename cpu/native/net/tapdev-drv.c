@@ -42,6 +42,12 @@
 
 #include "tapdev-drv.h"
 
+#ifdef TAPDEV_CONF_MAX_BATCH
+#define TAPDEV_MAX_BATCH TAPDEV_CONF_MAX_BATCH
+#else
+#define TAPDEV_MAX_BATCH 32
+#endif
+
 #define BUF ((struct uip_eth_hdr *)&uip_buf[0])
 #define IPBUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
 
@@ -61,9 +67,15 @@ tapdev_output(void)
 static void
 pollhandler(void)
 {
-  uip_len = tapdev_poll();
+  int count;
 
-  if(uip_len > 0) {
+  /* Drain all frames that are pending on the device, up to a limit so
+     that other processes get to run under sustained load */
+  for(count = 0; count < TAPDEV_MAX_BATCH; count++) {
+    uip_len = tapdev_poll();
+    if(uip_len == 0) {
+      break;
+    }
 #if NETSTACK_CONF_WITH_IPV6
     if(BUF->type == uip_htons(UIP_ETHTYPE_IPV6)) {
       tcpip_input();
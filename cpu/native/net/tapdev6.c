@@ -38,6 +38,7 @@
 
 #if NETSTACK_CONF_WITH_IPV6
 
+#include <errno.h>
 #include <fcntl.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -73,6 +74,7 @@
 #endif
 
 #include "tapdev6.h"
+#include "tapdev-drv.h"
 #include "contiki-net.h"
 
 #define DROP 0
@@ -111,33 +113,48 @@ tapdev_fd(void)
 uint16_t
 tapdev_poll(void)
 {
-  fd_set fdset;
-  struct timeval tv;
   int ret;
-  
-  tv.tv_sec = 0;
-  tv.tv_usec = 0;
-  
-  FD_ZERO(&fdset);
-  if(fd > 0) {
-    FD_SET(fd, &fdset);
-  }
 
-  ret = select(fd + 1, &fdset, NULL, NULL, &tv);
-
-  if(ret == 0) {
+  if(fd <= 0) {
     return 0;
   }
+
+  /* The descriptor is non-blocking, so there is no need to check for
+     pending frames with select() before reading */
   ret = read(fd, uip_buf, UIP_BUFSIZE);
 
   PRINTF("tapdev6: read %d bytes (max %d)\n", ret, UIP_BUFSIZE);
   
   if(ret == -1) {
-    perror("tapdev_poll: read");
+    if(errno != EAGAIN && errno != EWOULDBLOCK) {
+      perror("tapdev_poll: read");
+    }
+    return 0;
   }
   return ret;
 }
 /*---------------------------------------------------------------------------*/
+#if NATIVE_CONF_EPOLL
+static int
+tapdev_set_fd(fd_set *rset, fd_set *wset)
+{
+  FD_SET(fd, rset);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+tapdev_handle_fd(fd_set *rset, fd_set *wset)
+{
+  if(FD_ISSET(fd, rset)) {
+    process_poll(&tapdev_process);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static const struct select_callback tapdev_callback = {
+  tapdev_set_fd, tapdev_handle_fd
+};
+#endif /* NATIVE_CONF_EPOLL */
+/*---------------------------------------------------------------------------*/
 #if defined(__APPLE__)
 static int reqfd = -1, sfd = -1, interface_index;
 
@@ -314,10 +331,18 @@ tapdev_init(void)
   }
 #endif /* Linux */
 
+  if(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1) {
+    perror("tapdev: tapdev_init: fcntl");
+  }
+
 #ifdef __APPLE__
   tapdev_init_darwin_routes();
 #endif
 
+#if NATIVE_CONF_EPOLL
+  select_set_callback(fd, &tapdev_callback);
+#endif /* NATIVE_CONF_EPOLL */
+
   /* Linux (ubuntu)
      snprintf(buf, sizeof(buf), "ip link set tap0 up");
      system(buf);
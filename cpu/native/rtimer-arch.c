@@ -46,6 +46,14 @@
 #include "sys/rtimer.h"
 #include "sys/clock.h"
 
+#if NATIVE_CONF_EPOLL
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#endif /* NATIVE_CONF_EPOLL */
+
 #define DEBUG 0
 #if DEBUG
 #include <stdio.h>
@@ -54,6 +62,125 @@
 #define PRINTF(...)
 #endif
 
+#if NATIVE_CONF_EPOLL
+static int timer_fd = -1;
+static uint64_t deadline;
+static uint8_t armed;
+static struct rtimer_arch_stats stats;
+/*---------------------------------------------------------------------------*/
+static uint64_t
+monotonic_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+static int
+timer_set_fd(fd_set *rset, fd_set *wset)
+{
+  FD_SET(timer_fd, rset);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+timer_handle_fd(fd_set *rset, fd_set *wset)
+{
+  uint64_t expirations;
+  uint64_t jitter;
+
+  if(!FD_ISSET(timer_fd, rset)) {
+    return;
+  }
+  if(read(timer_fd, &expirations, sizeof(expirations)) !=
+     sizeof(expirations) || !armed) {
+    return;
+  }
+  armed = 0;
+
+  jitter = monotonic_ns() - deadline;
+  if(stats.wakeups == 0 || jitter < stats.min_jitter) {
+    stats.min_jitter = jitter;
+  }
+  if(jitter > stats.max_jitter) {
+    stats.max_jitter = jitter;
+  }
+  stats.total_jitter += jitter;
+  stats.wakeups++;
+
+  rtimer_run_next();
+}
+/*---------------------------------------------------------------------------*/
+static const struct select_callback timer_callback = {
+  timer_set_fd, timer_handle_fd
+};
+/*---------------------------------------------------------------------------*/
+rtimer_clock_t
+rtimer_arch_now(void)
+{
+  return (rtimer_clock_t)(monotonic_ns() / 1000);
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_init(void)
+{
+  timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if(timer_fd < 0) {
+    perror("rtimer: timerfd_create");
+    return;
+  }
+  select_set_callback(timer_fd, &timer_callback);
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_schedule(rtimer_clock_t t)
+{
+  struct itimerspec val;
+  int32_t c;
+  uint64_t now;
+
+  if(timer_fd < 0) {
+    return;
+  }
+
+  now = monotonic_ns();
+  c = RTIMER_CLOCK_DIFF(t, (rtimer_clock_t)(now / 1000));
+  if(c < 1) {
+    /* A zero expiration would disarm the timer */
+    c = 1;
+  }
+  deadline = now + (uint64_t)c * 1000;
+  armed = 1;
+
+  PRINTF("rtimer_arch_schedule time %lu in %ld us\n",
+         (unsigned long)t, (long)c);
+
+  val.it_value.tv_sec = deadline / 1000000000ULL;
+  val.it_value.tv_nsec = deadline % 1000000000ULL;
+  val.it_interval.tv_sec = val.it_interval.tv_nsec = 0;
+  timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &val, NULL);
+}
+/*---------------------------------------------------------------------------*/
+const struct rtimer_arch_stats *
+rtimer_arch_get_stats(void)
+{
+  return &stats;
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_print_stats(void)
+{
+  printf("rtimer wake-ups: %lu\n", stats.wakeups);
+  if(stats.wakeups > 0) {
+    printf("rtimer jitter (ns): min %lu avg %lu max %lu\n",
+           stats.min_jitter,
+           (unsigned long)(stats.total_jitter / stats.wakeups),
+           stats.max_jitter);
+  }
+}
+/*---------------------------------------------------------------------------*/
+#else /* NATIVE_CONF_EPOLL */
 /*---------------------------------------------------------------------------*/
 static void
 interrupt(int sig)
@@ -90,3 +217,4 @@ rtimer_arch_schedule(rtimer_clock_t t)
 #endif /* !_WIN32 */
 }
 /*---------------------------------------------------------------------------*/
+#endif /* NATIVE_CONF_EPOLL */
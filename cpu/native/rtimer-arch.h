@@ -42,8 +42,33 @@
 
 #include "contiki-conf.h"
 
+#if NATIVE_CONF_EPOLL
+
+#define RTIMER_ARCH_SECOND 1000000UL
+
+rtimer_clock_t rtimer_arch_now(void);
+
+/**
+ * Wake-up jitter statistics of the timerfd rtimer backend. The
+ * jitter is the delay between the time an rtimer was scheduled for
+ * and the time the event loop actually ran it, in nanoseconds.
+ */
+struct rtimer_arch_stats {
+  unsigned long wakeups;
+  unsigned long min_jitter;
+  unsigned long max_jitter;
+  unsigned long long total_jitter;
+};
+
+const struct rtimer_arch_stats *rtimer_arch_get_stats(void);
+void rtimer_arch_print_stats(void);
+
+#else /* NATIVE_CONF_EPOLL */
+
 #define RTIMER_ARCH_SECOND CLOCK_CONF_SECOND
 
 #define rtimer_arch_now() clock_time()
 
+#endif /* NATIVE_CONF_EPOLL */
+
 #endif /* RTIMER_ARCH_H_ */
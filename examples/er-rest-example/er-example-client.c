@@ -42,6 +42,7 @@
 #include "contiki.h"
 #include "contiki-net.h"
 #include "er-coap-engine.h"
+#include "er-coap-block-window.h"
 #include "dev/button-sensor.h"
 
 #define DEBUG 0
@@ -90,11 +91,22 @@ client_chunk_handler(void *response)
 
   printf("|%.*s", len, (char *)chunk);
 }
+/* Passed to coap_window_get(), blocks may come in any order. */
+void
+client_block_handler(void *response, uint32_t offset)
+{
+  const uint8_t *chunk;
+
+  int len = coap_get_payload(response, &chunk);
+
+  printf("|%lu:%.*s", (unsigned long)offset, len, (char *)chunk);
+}
 PROCESS_THREAD(er_example_client, ev, data)
 {
   PROCESS_BEGIN();
 
   static coap_packet_t request[1];      /* This way the packet can be treated as pointer as usual. */
+  static struct coap_window_state window;
 
   SERVER_NODE(&server_ipaddr);
 
@@ -130,6 +142,20 @@ PROCESS_THREAD(er_example_client, ev, data)
 
       printf("\n--Done--\n");
 
+      /* fetch a larger resource with COAP_BLOCK_WINDOW blocks in flight */
+      coap_init_message(request, COAP_TYPE_CON, COAP_GET, 0);
+      coap_set_header_uri_path(request, "test/chunks");
+
+      printf("--Requesting test/chunks--\n");
+
+      PROCESS_PT_SPAWN(&window.pt,
+                       coap_window_get(&window, ev, &server_ipaddr,
+                                       REMOTE_PORT, request,
+                                       client_block_handler, -1));
+
+      printf("\n--%s--\n",
+             window.status == COAP_WINDOW_DONE ? "Done" : "Failed");
+
       etimer_reset(&et);
 
 #if PLATFORM_HAS_BUTTON
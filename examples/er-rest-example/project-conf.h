@@ -84,6 +84,13 @@
 #undef COAP_MAX_OPEN_TRANSACTIONS
 #define COAP_MAX_OPEN_TRANSACTIONS     4
 
+/* Opens the block window of the client: two requests in flight to one
+   server, blocks of a windowed transfer included. RFC 7252 allows one by
+   default, which makes COAP_WINDOW_GET() stop-and-wait. The window
+   follows NSTART, see er-coap-block-window.h. */
+#undef COAP_CONF_NSTART
+#define COAP_CONF_NSTART               2
+
 /* Must be <= open transactions, default is COAP_MAX_OPEN_TRANSACTIONS-1. */
 /*
    #undef COAP_MAX_OBSERVERS
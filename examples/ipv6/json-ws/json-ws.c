@@ -313,15 +313,10 @@ PT_THREAD(send_values(struct httpd_ws_state *s))
     s->outbuf_pos = 15;
 
   } else {
-    /* Get value */
-    while(jsontree_print_next(&s->json) && s->json.path <= s->json.depth) {
-      if(s->outbuf_pos >= UIP_TCP_MSS) {
-        SEND_STRING(&s->sout, s->outbuf, UIP_TCP_MSS);
-        s->outbuf_pos -= UIP_TCP_MSS;
-        if(s->outbuf_pos > 0) {
-          memcpy(s->outbuf, &s->outbuf[UIP_TCP_MSS], s->outbuf_pos);
-        }
-      }
+    /* Get value, one full segment at a time */
+    while((s->outbuf_pos = jsontree_print_chunk(&s->json, s->outbuf,
+                                                UIP_TCP_MSS)) > 0) {
+      SEND_STRING(&s->sout, s->outbuf, s->outbuf_pos);
     }
   }
 
@@ -79,6 +79,12 @@ border_router_cmd_handler(const uint8_t *data, int len)
       /* We need to know that this is from the slip-radio here. */
       printf("Channel is:%d\n", data[2]);
       return 1;
+    } else if(data[1] == 'L' && len >= 4 &&
+              command_context == CMD_CONTEXT_RADIO) {
+      /* We need to know that this is from the slip-radio here. */
+      slip_radio_mtu = (data[2] << 8) | data[3];
+      printf("Radio MTU is:%u\n", slip_radio_mtu);
+      return 1;
     } else if(data[1] == 'R' && command_context == CMD_CONTEXT_RADIO) {
       /* We need to know that this is from the slip-radio here. */
       PRINTF("Packet data report for sid:%d st:%d tx:%d\n",
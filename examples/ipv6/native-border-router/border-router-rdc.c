@@ -65,6 +65,8 @@ struct tx_callback {
 };
 
 static struct tx_callback callbacks[MAX_CALLBACKS];
+
+uint16_t slip_radio_mtu;
 /*---------------------------------------------------------------------------*/
 void packet_sent(uint8_t sessionid, uint8_t status, uint8_t tx)
 {
@@ -124,6 +126,11 @@ send_packet(mac_callback_t sent, void *ptr)
     if(size < 0 || size + packetbuf_totlen() + 3 > sizeof(buf)) {
       PRINTF("br-rdc: send failed, too large header\n");
       mac_call_sent_callback(sent, ptr, MAC_TX_ERR_FATAL, 1);
+    } else if(slip_radio_mtu > 0 &&
+              size + packetbuf_totlen() + 3 > slip_radio_mtu) {
+      /* The radio would drop the frame without reporting back */
+      PRINTF("br-rdc: send failed, frame larger than radio MTU\n");
+      mac_call_sent_callback(sent, ptr, MAC_TX_ERR_FATAL, 1);
     } else {
       sid = setup_callback(sent, ptr);
 
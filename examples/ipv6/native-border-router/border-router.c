@@ -50,6 +50,10 @@
 #include "cmd.h"
 #include "border-router.h"
 #include "border-router-cmds.h"
+#if WITH_COAP_PROXY
+#include "rest-engine.h"
+#include "er-coap-proxy.h"
+#endif /* WITH_COAP_PROXY */
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -237,6 +241,8 @@ static void
 request_mac(void)
 {
   write_to_slip((uint8_t *)"?M", 2);
+  /* Radios that predate ?L do not answer and keep the default */
+  write_to_slip((uint8_t *)"?L", 2);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -258,6 +264,9 @@ border_router_print_stat()
 {
   printf("bytes received over SLIP: %ld\n", slip_received);
   printf("bytes sent over SLIP: %ld\n", slip_sent);
+#if NATIVE_CONF_EPOLL
+  rtimer_arch_print_stats();
+#endif /* NATIVE_CONF_EPOLL */
 }
 
 /*---------------------------------------------------------------------------*/
@@ -348,6 +357,12 @@ PROCESS_THREAD(border_router_process, ev, data)
      packet reception rates. */
   NETSTACK_MAC.off(1);
 
+#if WITH_COAP_PROXY
+  /* forward proxy for backend services, see er-coap-proxy.h */
+  rest_init_engine();
+  coap_proxy_init();
+#endif /* WITH_COAP_PROXY */
+
   while(1) {
     etimer_set(&et, CLOCK_SECOND * 2);
     PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
@@ -44,6 +44,10 @@
 int border_router_cmd_handler(const uint8_t *data, int len);
 int slip_config_handle_arguments(int argc, char **argv);
 void write_to_slip(const uint8_t *buf, int len);
+int slip_can_buffer_packet(void);
+
+/* Largest frame the slip-radio accepts, zero until it has told us */
+extern uint16_t slip_radio_mtu;
 
 void border_router_set_prefix_64(const uip_ipaddr_t *prefix_64);
 void border_router_set_mac(const uint8_t *data);
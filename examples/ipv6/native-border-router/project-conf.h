@@ -54,6 +54,19 @@
 #undef NETSTACK_CONF_RDC
 #define NETSTACK_CONF_RDC border_router_rdc_driver
 
+#if WITH_COAP_PROXY
+#define COAP_PROXY_OPTION_PROCESSING 1
+/* for keeping hot entries fresh */
+#define COAP_OBSERVE_CLIENT 1
+#undef REST_MAX_CHUNK_SIZE
+#define REST_MAX_CHUNK_SIZE 256
+#undef COAP_MAX_OPEN_TRANSACTIONS
+#define COAP_MAX_OPEN_TRANSACTIONS 16
+#define COAP_PROXY_CONF_MAX_ENTRIES 16
+#define COAP_PROXY_CONF_MAX_WAITERS 16
+#define COAP_PROXY_CONF_URI_LEN 64
+#endif /* WITH_COAP_PROXY */
+
 /* used by wpcap (see /cpu/native/net/wpcap-drv.c) */
 #define SELECT_CALLBACK 1
 
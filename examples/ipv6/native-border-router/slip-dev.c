@@ -53,6 +53,7 @@
 
 #include "net/netstack.h"
 #include "net/packetbuf.h"
+#include "dev/slip-codec.h"
 #include "cmd.h"
 #include "border-router-cmds.h"
 
@@ -70,9 +71,18 @@ extern speed_t slip_config_b_rate;
 #define SEND_DELAY 0
 #endif
 
-int devopen(const char *dev, int flags);
+#ifdef SLIP_DEV_CONF_BUFFER_SIZE
+#define BUFFER_SIZE SLIP_DEV_CONF_BUFFER_SIZE
+#else
+#define BUFFER_SIZE 16384
+#endif
+
+/* Room needed in the output buffer for one more IP packet: all its
+   6LoWPAN fragments with serialized attributes, escaped in the worst
+   case. */
+#define PACKET_RESERVE (4 * UIP_BUFSIZE)
 
-static FILE *inslip;
+int devopen(const char *dev, int flags);
 
 /* for statistics */
 long slip_sent = 0;
@@ -83,10 +93,7 @@ int slipfd = 0;
 //#define PROGRESS(s) fprintf(stderr, s)
 #define PROGRESS(s) do { } while(0)
 
-#define SLIP_END     0300
-#define SLIP_ESC     0333
-#define SLIP_ESC_END 0334
-#define SLIP_ESC_ESC 0335
+#define SLIP_END     SLIP_CODEC_END
 
 /*---------------------------------------------------------------------------*/
 static void *
@@ -169,119 +176,114 @@ slip_packet_input(unsigned char *data, int len)
   NETSTACK_RDC.input();
 }
 /*---------------------------------------------------------------------------*/
-/*
- * Read from serial, when we have a packet call slip_packet_input. No output
- * buffering, input buffered by stdio.
- */
-void
-serial_input(FILE *inslip)
+static void
+frame_input(unsigned char *frame, int len)
 {
-  static unsigned char inbuf[2048];
-  static int inbufptr = 0;
-  int ret,i;
-  unsigned char c;
-
-#ifdef linux
-  ret = fread(&c, 1, 1, inslip);
-  if(ret == -1 || ret == 0) err(1, "serial_input: read");
-  goto after_fread;
-#endif
+  int i;
 
- read_more:
-  if(inbufptr >= sizeof(inbuf)) {
-     fprintf(stderr, "*** dropping large %d byte packet\n", inbufptr);
-     inbufptr = 0;
-  }
-  ret = fread(&c, 1, 1, inslip);
-#ifdef linux
- after_fread:
-#endif
-  if(ret == -1) {
-    err(1, "serial_input: read");
+  /* Echo all printable characters for verbose==4 */
+  if(slip_config_verbose == 4) {
+    for(i = 0; i < len; i++) {
+      unsigned char c = frame[i];
+      if(c == 0 || c == '\r' || c == '\n' || c == '\t' || (c >= ' ' && c <= '~')) {
+        fwrite(&c, 1, 1, stdout);
+      }
+    }
+  } else if(slip_config_verbose >= 2) {
+    /* Echo lines as they are received for verbose=2,3,5+ */
+    for(i = 0; i < len; i++) {
+      if(frame[i] == '\n' && is_sensible_string(frame, i + 1)) {
+        fwrite(frame, i + 1, 1, stdout);
+        frame += i + 1;
+        len -= i + 1;
+        i = -1;
+      }
+    }
   }
-  if(ret == 0) {
-    clearerr(inslip);
+
+  if(len <= 0) {
     return;
   }
-  slip_received++;
-  switch(c) {
-  case SLIP_END:
-    if(inbufptr > 0) {
-      if(inbuf[0] == '!') {
-	command_context = CMD_CONTEXT_RADIO;
-	cmd_input(inbuf, inbufptr);
-      } else if(inbuf[0] == '?') {
+
+  if(frame[0] == '!') {
+    command_context = CMD_CONTEXT_RADIO;
+    cmd_input(frame, len);
+  } else if(frame[0] == '?') {
 #define DEBUG_LINE_MARKER '\r'
-      } else if(inbuf[0] == DEBUG_LINE_MARKER) {
-	fwrite(inbuf + 1, inbufptr - 1, 1, stdout);
-      } else if(is_sensible_string(inbuf, inbufptr)) {
-        if(slip_config_verbose == 1) {   /* strings already echoed below for verbose>1 */
-          fwrite(inbuf, inbufptr, 1, stdout);
-        }
-      } else {
-        if(slip_config_verbose > 2) {
-          printf("Packet from SLIP of length %d - write TUN\n", inbufptr);
-          if(slip_config_verbose > 4) {
+  } else if(frame[0] == DEBUG_LINE_MARKER) {
+    fwrite(frame + 1, len - 1, 1, stdout);
+  } else if(is_sensible_string(frame, len)) {
+    if(slip_config_verbose == 1) {   /* strings already echoed above for verbose>1 */
+      fwrite(frame, len, 1, stdout);
+    }
+  } else {
+    if(slip_config_verbose > 2) {
+      printf("Packet from SLIP of length %d - write TUN\n", len);
+      if(slip_config_verbose > 4) {
 #if WIRESHARK_IMPORT_FORMAT
-            printf("0000");
-	    for(i = 0; i < inbufptr; i++) printf(" %02x", inbuf[i]);
+        printf("0000");
+        for(i = 0; i < len; i++) printf(" %02x", frame[i]);
 #else
-            printf("         ");
-            for(i = 0; i < inbufptr; i++) {
-              printf("%02x", inbuf[i]);
-              if((i & 3) == 3) printf(" ");
-              if((i & 15) == 15) printf("\n         ");
-            }
-#endif
-            printf("\n");
-          }
+        printf("         ");
+        for(i = 0; i < len; i++) {
+          printf("%02x", frame[i]);
+          if((i & 3) == 3) printf(" ");
+          if((i & 15) == 15) printf("\n         ");
         }
-	slip_packet_input(inbuf, inbufptr);
+#endif
+        printf("\n");
       }
-      inbufptr = 0;
     }
-    break;
-
-  case SLIP_ESC:
-    if(fread(&c, 1, 1, inslip) != 1) {
-      clearerr(inslip);
-      /* Put ESC back and give up! */
-      ungetc(SLIP_ESC, inslip);
-      return;
-    }
-
-    switch(c) {
-    case SLIP_ESC_END:
-      c = SLIP_END;
-      break;
-    case SLIP_ESC_ESC:
-      c = SLIP_ESC;
-      break;
-    }
-    /* FALLTHROUGH */
-  default:
-    inbuf[inbufptr++] = c;
+    slip_packet_input(frame, len);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Read from serial, when we have a packet call slip_packet_input. No
+ * output buffering. Input is read in bulk and each frame is unescaped
+ * in place in the input buffer.
+ */
+void
+serial_input(void)
+{
+  static unsigned char inbuf[2048];
+  static int inbuflen = 0;
+  unsigned char *frame, *end, *p;
+  uint8_t esc;
+  int ret;
 
-    /* Echo lines as they are received for verbose=2,3,5+ */
-    /* Echo all printable characters for verbose==4 */
-    if(slip_config_verbose == 4) {
-      if(c == 0 || c == '\r' || c == '\n' || c == '\t' || (c >= ' ' && c <= '~')) {
-	fwrite(&c, 1, 1, stdout);
-      }
-    } else if(slip_config_verbose >= 2) {
-      if(c == '\n' && is_sensible_string(inbuf, inbufptr)) {
-        fwrite(inbuf, inbufptr, 1, stdout);
-        inbufptr = 0;
-      }
+  ret = read(slipfd, inbuf + inbuflen, sizeof(inbuf) - inbuflen);
+  if(ret == -1 && (errno == EAGAIN || errno == EINTR)) {
+    return;
+  }
+  if(ret == -1 || ret == 0) {
+    err(1, "serial_input: read");
+  }
+  slip_received += ret;
+  inbuflen += ret;
+
+  frame = inbuf;
+  end = inbuf + inbuflen;
+  while((p = memchr(frame, SLIP_END, end - frame)) != NULL) {
+    if(p > frame) {
+      esc = 0;
+      frame_input(frame, slip_codec_decode(frame, frame, p - frame, &esc));
     }
-    break;
+    frame = p + 1;
   }
 
-  goto read_more;
+  /* Keep the start of the next frame */
+  inbuflen = end - frame;
+  if(inbuflen == sizeof(inbuf)) {
+    fprintf(stderr, "*** dropping large %d byte packet\n", inbuflen);
+    inbuflen = 0;
+  } else if(inbuflen > 0 && frame != inbuf) {
+    memmove(inbuf, frame, inbuflen);
+  }
 }
-
-unsigned char slip_buf[2048];
-int slip_end, slip_begin, slip_packet_end, slip_packet_count;
+/*---------------------------------------------------------------------------*/
+unsigned char slip_buf[BUFFER_SIZE];
+int slip_end, slip_begin, slip_packet_end, slip_last_packet_end;
 static struct timer send_delay_timer;
 /* delay between slip packets */
 static clock_time_t send_delay = SEND_DELAY;
@@ -297,7 +299,7 @@ slip_send(int fd, unsigned char c)
   slip_sent++;
   if(c == SLIP_END) {
     /* Full packet received. */
-    slip_packet_count++;
+    slip_last_packet_end = slip_end;
     if(slip_packet_end == 0) {
       slip_packet_end = slip_end;
     }
@@ -310,16 +312,27 @@ slip_empty()
   return slip_packet_end == 0;
 }
 /*---------------------------------------------------------------------------*/
+int
+slip_can_buffer_packet(void)
+{
+  return sizeof(slip_buf) - slip_end >= PACKET_RESERVE;
+}
+/*---------------------------------------------------------------------------*/
 void
 slip_flushbuf(int fd)
 {
   int n;
+  int flush_end;
 
   if(slip_empty()) {
     return;
   }
 
-  n = write(fd, slip_buf + slip_begin, slip_packet_end - slip_begin);
+  /* Without an inter-packet delay, all complete packets are written
+     with a single system call */
+  flush_end = send_delay > 0 ? slip_packet_end : slip_last_packet_end;
+
+  n = write(fd, slip_buf + slip_begin, flush_end - slip_begin);
 
   if(n == -1 && errno != EAGAIN) {
     err(1, "slip_flushbuf write failed");
@@ -327,15 +340,14 @@ slip_flushbuf(int fd)
     PROGRESS("Q");		/* Outqueue is full! */
   } else {
     slip_begin += n;
-    if(slip_begin == slip_packet_end) {
-      slip_packet_count--;
-      if(slip_end > slip_packet_end) {
-        memcpy(slip_buf, slip_buf + slip_packet_end,
-               slip_end - slip_packet_end);
+    if(slip_begin == flush_end) {
+      if(slip_end > flush_end) {
+        memmove(slip_buf, slip_buf + flush_end, slip_end - flush_end);
       }
-      slip_end -= slip_packet_end;
+      slip_end -= flush_end;
+      slip_last_packet_end -= flush_end;
       slip_begin = slip_packet_end = 0;
-      if(slip_end > 0) {
+      if(slip_last_packet_end > 0) {
         /* Find end of next slip packet */
         for(n = 1; n < slip_end; n++) {
           if(slip_buf[n] == SLIP_END) {
@@ -385,21 +397,12 @@ write_to_serial(int outfd, const uint8_t *inbuf, int len)
    */
   /* slip_send(outfd, SLIP_END); */
 
-  for(i = 0; i < len; i++) {
-    switch(p[i]) {
-    case SLIP_END:
-      slip_send(outfd, SLIP_ESC);
-      slip_send(outfd, SLIP_ESC_END);
-      break;
-    case SLIP_ESC:
-      slip_send(outfd, SLIP_ESC);
-      slip_send(outfd, SLIP_ESC_ESC);
-      break;
-    default:
-      slip_send(outfd, p[i]);
-      break;
-    }
+  if(slip_end + SLIP_CODEC_MAX_ENCODED(len) >= sizeof(slip_buf)) {
+    err(1, "slip_send overflow");
   }
+  i = slip_codec_encode(slip_buf + slip_end, p, len);
+  slip_end += i;
+  slip_sent += i;
   slip_send(outfd, SLIP_END);
   PROGRESS("t");
 }
@@ -475,7 +478,7 @@ static void
 handle_fd(fd_set *rset, fd_set *wset)
 {
   if(FD_ISSET(slipfd, rset)) {
-    serial_input(inslip);
+    serial_input();
   }
 
   if(FD_ISSET(slipfd, wset)) {
@@ -538,9 +541,5 @@ slip_init(void)
 
   timer_set(&send_delay_timer, 0);
   slip_send(slipfd, SLIP_END);
-  inslip = fdopen(slipfd, "r");
-  if(inslip == NULL) {
-    err(1, "main: fdopen");
-  }
 }
 /*---------------------------------------------------------------------------*/
@@ -69,6 +69,13 @@ extern const char *slip_config_ipaddr;
 extern char slip_config_tundev[32];
 extern uint16_t slip_config_basedelay;
 
+/* The maximum number of packets read from the tun device per wakeup */
+#ifdef TUN_BRIDGE_CONF_MAX_BATCH
+#define TUN_BRIDGE_MAX_BATCH TUN_BRIDGE_CONF_MAX_BATCH
+#else
+#define TUN_BRIDGE_MAX_BATCH 32
+#endif
+
 #ifndef __CYGWIN__
 static int tunfd;
 
@@ -209,6 +216,11 @@ tun_init()
   tunfd = tun_alloc(slip_config_tundev);
   if(tunfd == -1) err(1, "main: open");
 
+  /* Non-blocking, so that all pending packets can be drained at once */
+  if(fcntl(tunfd, F_SETFL, fcntl(tunfd, F_GETFL) | O_NONBLOCK) == -1) {
+    err(1, "main: fcntl");
+  }
+
   select_set_callback(tunfd, &tun_select_callback);
 
   fprintf(stderr, "opened %s device ``/dev/%s''\n",
@@ -237,8 +249,12 @@ int
 tun_input(unsigned char *data, int maxlen)
 {
   int size;
-  if((size = read(tunfd, data, maxlen)) == -1)
+  if((size = read(tunfd, data, maxlen)) == -1) {
+    if(errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
     err(1, "tun_input: read");
+  }
   return size;
 }
 
@@ -269,7 +285,11 @@ const struct uip_fallback_interface rpl_interface = {
 static int
 set_fd(fd_set *rset, fd_set *wset)
 {
-  FD_SET(tunfd, rset);
+  /* Leave packets on the tun device until the SLIP output buffer has
+     room for a whole one; the SLIP write interest wakes us up again */
+  if(slip_can_buffer_packet()) {
+    FD_SET(tunfd, rset);
+  }
   return 1;
 }
 
@@ -292,19 +312,31 @@ handle_fd(fd_set *rset, fd_set *wset)
 
   if(delaymsec==0) {
     int size;
+    int count;
 
     if(FD_ISSET(tunfd, rset)) {
-      size = tun_input(&uip_buf[UIP_LLH_LEN], sizeof(uip_buf));
-      /* printf("TUN data incoming read:%d\n", size); */
-      uip_len = size;
-      tcpip_input();
-
-      if(slip_config_basedelay) {
-        struct timeval tv;
-      	gettimeofday(&tv, NULL) ;
-      	delaymsec=slip_config_basedelay;
-      	delaystartsec =tv.tv_sec;
-      	delaystartmsec=tv.tv_usec/1000;
+      /* Drain the packets that are pending on the tun device, as long
+         as the SLIP output buffer can take them */
+      for(count = 0; count < TUN_BRIDGE_MAX_BATCH; count++) {
+        if(!slip_can_buffer_packet()) {
+          break;
+        }
+        size = tun_input(&uip_buf[UIP_LLH_LEN], sizeof(uip_buf));
+        if(size <= 0) {
+          break;
+        }
+        /* printf("TUN data incoming read:%d\n", size); */
+        uip_len = size;
+        tcpip_input();
+
+        if(slip_config_basedelay) {
+          struct timeval tv;
+          gettimeofday(&tv, NULL) ;
+          delaymsec=slip_config_basedelay;
+          delaystartsec =tv.tv_sec;
+          delaystartmsec=tv.tv_usec/1000;
+          break;
+        }
       }
     }
   }
@@ -146,6 +146,15 @@ slip_radio_cmd_handler(const uint8_t *data, int len)
       uip_len = 10;
       cmd_send(uip_buf, uip_len);
       return 1;
+    } else if(data[1] == 'L') {
+      /* Largest SLIP frame that the radio can receive */
+      uip_buf[0] = '!';
+      uip_buf[1] = 'L';
+      uip_buf[2] = (UIP_BUFSIZE - UIP_LLH_LEN) >> 8;
+      uip_buf[3] = (UIP_BUFSIZE - UIP_LLH_LEN) & 0xff;
+      uip_len = 4;
+      cmd_send(uip_buf, uip_len);
+      return 1;
     }
   }
   return 0;
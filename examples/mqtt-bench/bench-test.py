@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+#
+# Runs mqtt-bench against a broker stand-in on the host and checks that
+# publishes are acknowledged, and that acknowledgements the stand-in leaves
+# out are reported by the node as lost.
+#
+# The node is built for minimal-net, the host platform that talks to the
+# host through tap0 (native only has a radio or SLIP), so this needs root.
+# The stand-in listens on fe80::1 on tap0. "make test" builds the node for
+# it and runs this script.
+
+import os
+import select
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+BROKER_IP = "fe80::1"
+BROKER_PORT = 1883
+DEVICE = "tap0"
+RUN_TIME = 25          # long enough for the 10 s ack timeout to show
+DROP_EVERY = 100       # publishes the stand-in leaves unacknowledged
+
+dropped = 0
+received = 0
+
+
+def serve(conn):
+    global dropped, received
+    buf = b""
+    while True:
+        data = conn.recv(4096)
+        if not data:
+            return
+        buf += data
+        while len(buf) >= 2:
+            # fixed header, then the remaining length in up to 4 bytes
+            length, mult, i = 0, 1, 1
+            while i < len(buf) and i < 5:
+                length += (buf[i] & 0x7F) * mult
+                mult *= 128
+                i += 1
+                if buf[i - 1] & 0x80 == 0:
+                    break
+            else:
+                break
+            if len(buf) < i + length:
+                break
+            fhdr, body = buf[0], buf[i:i + length]
+            buf = buf[i + length:]
+            kind = fhdr >> 4
+            if kind == 1:                            # CONNECT
+                conn.sendall(bytes([0x20, 2, 0, 0]))
+            elif kind == 3:                          # PUBLISH
+                qos = (fhdr >> 1) & 3
+                if qos == 0:
+                    received += 1
+                    continue
+                topic_len = (body[0] << 8) | body[1]
+                mid = body[2 + topic_len:4 + topic_len]
+                received += 1
+                if received % DROP_EVERY == 0:
+                    dropped += 1
+                    continue
+                conn.sendall(bytes([0x40 if qos == 1 else 0x50, 2]) + mid)
+            elif kind == 6:                          # PUBREL
+                conn.sendall(bytes([0x70, 2]) + body[0:2])
+            elif kind == 8:                          # SUBSCRIBE
+                conn.sendall(bytes([0x90, 3]) + body[0:2] + bytes([0]))
+            elif kind == 12:                         # PINGREQ
+                conn.sendall(bytes([0xD0, 0]))
+            elif kind == 14:                         # DISCONNECT
+                return
+
+
+def broker(sock):
+    while True:
+        conn, addr = sock.accept()
+        print("stand-in: connection from", addr[0])
+        threading.Thread(target=serve, args=(conn,), daemon=True).start()
+
+
+def main():
+    node = sys.argv[1] if len(sys.argv) > 1 else "./mqtt-bench.minimal-net"
+
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("::", BROKER_PORT))
+    sock.listen(1)
+    threading.Thread(target=broker, args=(sock,), daemon=True).start()
+
+    proc = subprocess.Popen([node], stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT)
+    for i in range(50):
+        if os.path.exists("/sys/class/net/" + DEVICE):
+            break
+        time.sleep(0.1)
+    # uIP keeps one IPv6 neighbor per link-layer address, so the host must
+    # not show up on tap0 under an address of its own besides BROKER_IP
+    for conf in ("addr_gen_mode=1", "router_solicitations=0"):
+        subprocess.check_call(["sysctl", "-q",
+                               "net.ipv6.conf.%s.%s" % (DEVICE, conf)])
+    subprocess.check_call(["ip", "-6", "address", "flush", "dev", DEVICE])
+    subprocess.check_call(["ip", "-6", "address", "add", BROKER_IP + "/64",
+                           "dev", DEVICE, "nodad"])
+
+    publishes = lost = 0
+    end = time.time() + RUN_TIME
+    out = b""
+    while time.time() < end:
+        if select.select([proc.stdout], [], [], 0.5)[0]:
+            data = os.read(proc.stdout.fileno(), 4096)
+            if not data:
+                break
+            out += data
+            while b"\n" in out:
+                line, out = out.split(b"\n", 1)
+                line = line.decode(errors="replace")
+                print(line)
+                if "publishes/s" in line:
+                    fields = line.replace(",", " ").split()
+                    publishes += int(fields[0])
+                    lost += int(fields[fields.index("lost)") - 1])
+    proc.terminate()
+    proc.wait()
+
+    print("stand-in: %d publishes received, %d left unacknowledged"
+          % (received, dropped))
+    print("node: %d publishes acknowledged, %d reported lost"
+          % (publishes, lost))
+    if (publishes == 0 or publishes > received - dropped or
+            lost == 0 or lost > dropped):
+        print("FAIL")
+        return 1
+    print("OK")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
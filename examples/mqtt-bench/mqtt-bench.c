@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         Benchmark for MQTT publish throughput
+ *
+ *         Connects to the broker at BENCH_BROKER_IP and keeps the outgoing
+ *         queue and the in-flight window of the MQTT engine full with
+ *         publishes of BENCH_PAYLOAD_LEN bytes. Once per BENCH_INTERVAL the
+ *         number of publishes acknowledged (or written, for QoS 0) per second
+ *         is printed. Any broker on the host does, e.g. mosquitto, with the
+ *         node routed to it as usual for native builds.
+ */
+
+#include "contiki.h"
+#include "contiki-net.h"
+#include "mqtt.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef BENCH_CONF_BROKER_IP
+#define BENCH_BROKER_IP BENCH_CONF_BROKER_IP
+#else
+#define BENCH_BROKER_IP "fd00::1"
+#endif
+
+#ifdef BENCH_CONF_QOS
+#define BENCH_QOS BENCH_CONF_QOS
+#else
+#define BENCH_QOS MQTT_QOS_LEVEL_1
+#endif
+
+#define BENCH_BROKER_PORT 1883
+#define BENCH_KEEP_ALIVE  60
+#define BENCH_PAYLOAD_LEN 16
+#define BENCH_INTERVAL    (CLOCK_SECOND * 5)
+#define BENCH_MSS         1220
+
+static struct mqtt_connection conn;
+static char client_id[] = "contiki-mqtt-bench";
+static char topic[] = "bench/publish";
+/* never changed, so that queued publishes can all point at it */
+static uint8_t payload[BENCH_PAYLOAD_LEN] = "0123456789abcdef";
+static unsigned long delivered;
+static unsigned long refused;
+static unsigned long lost;
+/*---------------------------------------------------------------------------*/
+PROCESS(mqtt_bench_process, "MQTT benchmark");
+AUTOSTART_PROCESSES(&mqtt_bench_process);
+/*---------------------------------------------------------------------------*/
+static void
+mqtt_event(struct mqtt_connection *m, mqtt_event_t event, void *data)
+{
+  switch(event) {
+  case MQTT_EVENT_CONNECTED:
+    printf("Connected to %s\n", BENCH_BROKER_IP);
+    break;
+  case MQTT_EVENT_DISCONNECTED:
+    printf("Disconnected (%u)\n", *((mqtt_event_t *)data));
+    break;
+  case MQTT_EVENT_PUBACK:
+  case MQTT_EVENT_PUBCOMP:
+    delivered++;
+    break;
+  case MQTT_EVENT_ACK_TIMEOUT:
+    lost++;
+    break;
+  default:
+    break;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+fill(void)
+{
+  while(mqtt_ready(&conn)) {
+    if(mqtt_publish(&conn, NULL, topic, payload, sizeof(payload),
+                    BENCH_QOS, MQTT_RETAIN_OFF) != MQTT_STATUS_OK) {
+      refused++;
+      break;
+    }
+    /* An enum, so not something the preprocessor can compare */
+    if(BENCH_QOS == MQTT_QOS_LEVEL_0) {
+      delivered++;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(mqtt_bench_process, ev, data)
+{
+  static struct etimer report;
+  static clock_time_t start;
+  clock_time_t elapsed;
+
+  PROCESS_BEGIN();
+
+  mqtt_register(&conn, &mqtt_bench_process, client_id, mqtt_event,
+                BENCH_MSS);
+  mqtt_connect(&conn, BENCH_BROKER_IP, BENCH_BROKER_PORT, BENCH_KEEP_ALIVE);
+
+  printf("MQTT benchmark, QoS %u, %u byte payloads, window %u, queue %u\n",
+         BENCH_QOS, BENCH_PAYLOAD_LEN, MQTT_MAX_INFLIGHT,
+         MQTT_OUT_QUEUE_SIZE);
+
+  start = clock_time();
+  etimer_set(&report, BENCH_INTERVAL);
+
+  while(1) {
+    PROCESS_WAIT_EVENT();
+
+    if(ev == mqtt_update_event) {
+      fill();
+    } else if(ev == PROCESS_EVENT_TIMER && data == &report) {
+      elapsed = clock_time() - start;
+      printf("%8lu publishes %8lu publishes/s (%lu refused, %lu lost)\n",
+             delivered,
+             (unsigned long)((unsigned long long)delivered * CLOCK_SECOND /
+                             elapsed),
+             refused, lost);
+      delivered = 0;
+      refused = 0;
+      lost = 0;
+      start = clock_time();
+      etimer_reset(&report);
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
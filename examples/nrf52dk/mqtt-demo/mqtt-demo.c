@@ -295,12 +295,12 @@ mqtt_event(struct mqtt_connection *m, mqtt_event_t event, void *data)
     if(msg_ptr->first_chunk) {
       msg_ptr->first_chunk = 0;
       DBG("APP - Application received a publish on topic '%s'. Payload "
-          "size is %i bytes. Content:\n\n",
-          msg_ptr->topic, msg_ptr->payload_length);
+          "size is %lu bytes. Content:\n\n",
+          msg_ptr->topic, (unsigned long)msg_ptr->payload_length);
     }
 
     pub_handler(msg_ptr->topic, strlen(msg_ptr->topic), msg_ptr->payload_chunk,
-                msg_ptr->payload_length);
+                msg_ptr->payload_chunk_length);
     break;
   }
   case MQTT_EVENT_SUBACK: {
@@ -620,7 +620,7 @@ state_machine(void)
        * packet after retries, or to timeout and notify us.
        */
       DBG("Publishing... (MQTT state=%d, q=%u)\n", conn.state,
-          conn.out_queue_full);
+          conn.out_queue_count);
     }
     break;
   case STATE_DISCONNECTED:
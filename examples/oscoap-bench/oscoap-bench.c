@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         Benchmark for OSCOAP group message protection
+ *
+ *         Requests are protected with the sender context of the node
+ *         and unprotected again with a recipient context that holds
+ *         the same keys, for at least BENCH_TIME each. The number of
+ *         messages per second is printed for the protection mode the
+ *         module was built with, see OSCOAP_CONF_SIGN in er-oscoap-int.h:
+ *
+ *         make TARGET=native DEFINES=OSCOAP_CONF_SIGN=0
+ *
+ *         Then VERIFY_CASES signed requests, some with a broken
+ *         signature, are received through the CoAP engine and the ones
+ *         that reach the resource are printed. The verify queue modes,
+ *         inline (the default here), batched in steps by the crypto
+ *         process and batched in one go, must accept the same requests:
+ *
+ *         make TARGET=native DEFINES=OSCOAP_CONF_VERIFY_QUEUE=4
+ *         make TARGET=native DEFINES=OSCOAP_CONF_VERIFY_QUEUE=4,OSCOAP_CONF_CRYPTO_ASYNC=0
+ */
+
+#include "contiki.h"
+#include "contiki-net.h"
+#include "dev/watchdog.h"
+#include "rest-engine.h"
+#include "er-coap.h"
+#include "er-coap-engine.h"
+#include "er-oscoap.h"
+#include "er-oscoap-int.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_TIME CLOCK_SECOND
+
+/* Requests received through the engine, and the ones with a bad signature */
+#define VERIFY_CASES 8
+#define VERIFY_BAD(i) ((i) == 2 || (i) == 5)
+
+#if OSCOAP_SIGN != OSCOAP_SIGN_ED25519 || OSCOAP_VERIFY_QUEUE == 0
+#define VERIFY_NAME "inline"
+#elif OSCOAP_CRYPTO_ASYNC
+#define VERIFY_NAME "async"
+#else
+#define VERIFY_NAME "batch"
+#endif
+
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+#define MODE_NAME "ed25519"
+#elif OSCOAP_SIGN == OSCOAP_SIGN_FIXED
+#define MODE_NAME "fixed signature"
+#else
+#define MODE_NAME "no signature"
+#endif
+
+static coap_packet_t request[1];
+static coap_packet_t received[1];
+static uint8_t message[COAP_MAX_PACKET_SIZE + 1];
+static uint8_t copy[COAP_MAX_PACKET_SIZE + 1];
+static size_t message_len;
+static uip_ipaddr_t *dest;
+static OSCOAP_COMMON_CONTEXT *ctx;
+static OSCOAP_RECIPIENT_CONTEXT *recipient;
+static uint16_t mid;
+static int status;
+static const char payload[] = "Contiki multicast OSCOAP bench";
+static uint16_t verify_mid[VERIFY_CASES];
+static uint8_t verify_accepted[VERIFY_CASES];
+/*---------------------------------------------------------------------------*/
+static void res_hello_get_handler(void *request, void *response,
+                                  uint8_t *buffer, uint16_t preferred_size,
+                                  int32_t *offset);
+
+RESOURCE(res_hello, "title=\"Bench\"", res_hello_get_handler,
+         NULL, NULL, NULL);
+
+static void
+res_hello_get_handler(void *request, void *response, uint8_t *buffer,
+                      uint16_t preferred_size, int32_t *offset)
+{
+  coap_packet_t *const coap_req = (coap_packet_t *)request;
+  int i;
+
+  for(i = 0; i < VERIFY_CASES; i++) {
+    if(verify_mid[i] == coap_req->mid) {
+      verify_accepted[i] = 1;
+    }
+  }
+  REST.set_response_payload(response, "ok", 2);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_protect(void)
+{
+  coap_init_message(request, COAP_TYPE_NON, COAP_GET, mid++);
+  coap_set_header_uri_path(request, "test/hello");
+  coap_set_payload(request, payload, sizeof(payload) - 1);
+  request->context = ctx;
+  request->ipaddr = dest;
+  coap_set_header_object_security(request);
+  message_len = coap_serialize_message(request, message);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_unprotect(void)
+{
+  /* the same message every time, so it must not count as a replay */
+  recipient->RECIPIENT_SEQ = 0;
+  recipient->REPLAY_WINDOW = 0;
+  /* decryption is done in place */
+  memcpy(copy, message, message_len);
+  status = coap_parse_message(received, copy, message_len);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_both(void)
+{
+  bench_protect();
+  bench_unprotect();
+}
+/*---------------------------------------------------------------------------*/
+/* Receive a protected request as if it had come from the network */
+static void
+verify_receive(int i)
+{
+  bench_protect();
+  verify_mid[i] = request->mid;
+  if(VERIFY_BAD(i)) {
+    /* a bit of s, in the last 64 bytes */
+    message[message_len - 40] ^= 1;
+  }
+
+  uip_appdata = &uip_buf[UIP_LLH_LEN + UIP_IPUDPH_LEN];
+  memcpy(uip_appdata, message, message_len);
+  uip_len = message_len;
+  uip_ipaddr_copy(&UIP_IP_BUF->srcipaddr, dest);
+  uip_ipaddr_copy(&UIP_IP_BUF->destipaddr, dest);
+  UIP_UDP_BUF->srcport = UIP_HTONS(COAP_DEFAULT_PORT);
+
+  coap_receive_datagram(uip_appdata, uip_len, dest,
+                        UIP_HTONS(COAP_DEFAULT_PORT), dest);
+}
+/*---------------------------------------------------------------------------*/
+static void
+run(const char *name, void (*op)(void))
+{
+  clock_time_t start, elapsed;
+  unsigned long calls = 0;
+
+  start = clock_time();
+  do {
+    op();
+    calls++;
+    watchdog_periodic();
+    elapsed = clock_time() - start;
+  } while(elapsed < BENCH_TIME);
+
+  printf("%-10s %8lu msgs %10lu msgs/s\n", name, calls,
+         (unsigned long)((unsigned long long)calls * CLOCK_SECOND / elapsed));
+}
+/*---------------------------------------------------------------------------*/
+PROCESS(oscoap_bench_process, "OSCOAP benchmark");
+AUTOSTART_PROCESSES(&oscoap_bench_process);
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(oscoap_bench_process, ev, data)
+{
+  static struct etimer et;
+  static int i, j;
+  OSCOAP_SENDER_CONTEXT *sender;
+  uip_ds6_addr_t *lladdr;
+
+  PROCESS_BEGIN();
+
+  oscoap_ctx_store_init();
+  ctx = oscoap_new_ctx();
+  if(ctx == NULL) {
+    printf("Error creating context!\n");
+    PROCESS_EXIT();
+  }
+  oscoap_set_ctx();
+
+  /* the node receives its own messages */
+  sender = ctx->SENDER_CONTEXT;
+  recipient = oscoap_new_recipient_ctx(ctx, sender->SENDER_ID);
+  if(recipient == NULL) {
+    printf("Error creating recipient context!\n");
+    PROCESS_EXIT();
+  }
+  memcpy(recipient->RECIPIENT_KEY, sender->SENDER_KEY, CONTEXT_KEY_LEN);
+  memcpy(recipient->RECIPIENT_IV, sender->SENDER_IV, CONTEXT_INIT_VECT_LEN);
+#if OSCOAP_SIGN == OSCOAP_SIGN_ED25519
+  edsign_prepare_public(&recipient->RECIPIENT_SIGN_KEY,
+                        sender->SENDER_SIGN_KEY.pub);
+#endif
+
+  /* the request URI in the AAD is built from the link-local address */
+  lladdr = uip_ds6_get_link_local(-1);
+  if(lladdr == NULL) {
+    printf("No link-local address!\n");
+    PROCESS_EXIT();
+  }
+  dest = &lladdr->ipaddr;
+
+  bench_both();
+  if(message_len == 0 || status != NO_ERROR) {
+    printf("Round trip failed (%u bytes, status %d)\n",
+           (unsigned)message_len, status);
+    PROCESS_EXIT();
+  }
+
+  printf("OSCOAP benchmark, %s, %u byte messages\n", MODE_NAME,
+         (unsigned)message_len);
+  run("protect", bench_protect);
+  run("unprotect", bench_unprotect);
+  printf("last message %s\n", status == NO_ERROR ? "accepted" : "REJECTED");
+  run("both", bench_both);
+
+  rest_init_engine();
+  rest_activate_resource(&res_hello, "test/hello");
+
+  /* no more at a time than the verify queue takes, the rest would be
+     dropped for the sender to retransmit */
+  for(i = 0; i < VERIFY_CASES; i += j) {
+    for(j = 0; i + j < VERIFY_CASES &&
+        (OSCOAP_VERIFY_QUEUE == 0 || j < OSCOAP_VERIFY_QUEUE); j++) {
+      verify_receive(i + j);
+    }
+    etimer_set(&et, CLOCK_SECOND / 2);
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
+  }
+
+  printf("verify %-6s accepted", VERIFY_NAME);
+  for(i = 0; i < VERIFY_CASES; i++) {
+    printf(" %d", verify_accepted[i]);
+  }
+  printf("\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
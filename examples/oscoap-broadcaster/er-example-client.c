@@ -128,7 +128,7 @@ PROCESS_THREAD(er_example_client, ev, data)
   if(oscoap_new_ctx() == 0){ 
     printf("Error creating context!\n");
   }
-  oscoap_set_ctx(1);
+  oscoap_set_ctx();
   printf("server ip poither %p\n", &server_ipaddr);
 
   etimer_set(&et, TOGGLE_INTERVAL * CLOCK_SECOND);
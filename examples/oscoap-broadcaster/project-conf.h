@@ -98,4 +98,8 @@
 
 /* Enable client-side support for COAP observe */
 #define COAP_OBSERVE_CLIENT 1
+
+/* The multicaster signs, and keeps retransmissions out of the way */
+#define OSCOAP_CONF_ROLE               OSCOAP_ROLE_GROUP_SENDER
+#define COAP_FIXED_RETRANSMIT_INTERVAL (160 * CLOCK_SECOND)
 #endif /* __PROJECT_ERBIUM_CONF_H__ */
@@ -173,8 +173,8 @@ PROCESS_THREAD(er_example_server, ev, data)
   if(oscoap_new_ctx() == 0) 
     printf("Error creating context!\n");
 
-  oscoap_set_ctx(1);
-  oscoap_set_ctx(0);
+  oscoap_set_ctx();
+  /* recipient contexts are derived when a sender is first heard from */
   //oscoap_recipient_ctx_create();
 
   /*
@@ -98,4 +98,6 @@
 
 /* Enable client-side support for COAP observe */
 #define COAP_OBSERVE_CLIENT 1
+
+#define OSCOAP_CONF_ROLE               OSCOAP_ROLE_GROUP_RECEIVER
 #endif /* __PROJECT_ERBIUM_CONF_H__ */
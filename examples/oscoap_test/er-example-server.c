@@ -165,12 +165,14 @@ PROCESS_THREAD(er_example_server, ev, data)
 oscoap_ctx_store_init();
 
 uint8_t cid[CONTEXT_ID_LEN] = { 0, 0, 0, 0, 0, 0, 0, 2};
-char receiver_key[] =   {0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41};
-char sender_key[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02};
-char receiver_iv[] = {0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47 };
-char sender_iv[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 };
-
-if(oscoap_new_ctx( cid, sender_key, sender_iv, receiver_key, receiver_iv) == 0){
+uint8_t sid[ID_LEN] = { 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB };
+uint8_t rid[ID_LEN] = { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA };
+uint8_t receiver_key[] =   {0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41};
+uint8_t sender_key[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02};
+uint8_t receiver_iv[] = {0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47 };
+uint8_t sender_iv[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+if(oscoap_new_unicast_ctx(cid, sid, rid, sender_key, sender_iv, receiver_key, receiver_iv) == NULL){
   printf("Error: Could not create new Context!\n");
 }
 
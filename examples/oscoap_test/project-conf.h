@@ -96,6 +96,9 @@
 #undef COAP_PROXY_OPTION_PROCESSING
 #define COAP_PROXY_OPTION_PROCESSING   0
 
+/* Point-to-point OSCOAP with keys set by the application, see er-oscoap-int.h */
+#define OSCOAP_CONF_ROLE OSCOAP_ROLE_UNICAST
+
 /* Enable client-side support for COAP observe */
 #define COAP_OBSERVE_CLIENT 1
 #endif /* __PROJECT_ERBIUM_CONF_H__ */
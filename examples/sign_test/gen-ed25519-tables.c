@@ -0,0 +1,97 @@
+/* Generate ed25519-tables.h, the precomputed base point multiples used
+ * by ed25519_smult_base() and ed25519_smult_vartime().
+ *
+ * This is a host program:
+ *
+ *     cc -I ../../apps/er-oscoap-group -o gen-ed25519-tables \
+ *         gen-ed25519-tables.c ../../apps/er-oscoap-group/ed25519.c \
+ *         ../../apps/er-oscoap-group/f25519.c
+ *     ./gen-ed25519-tables > ../../apps/er-oscoap-group/ed25519-tables.h
+ *
+ * This file is in the public domain.
+ */
+
+#include <stdio.h>
+#include "ed25519.h"
+
+static void print_fe(const char *indent, const uint8_t *x, int last)
+{
+	int i;
+
+	printf("%s{", indent);
+	for (i = 0; i < F25519_SIZE; i++) {
+		if (i && !(i & 7))
+			printf(",\n%s ", indent);
+		else if (i)
+			printf(", ");
+		printf("0x%02x", x[i]);
+	}
+	printf("}%s\n", last ? "" : ",");
+}
+
+static void print_pt(const char *indent, const struct ed25519_pt *p,
+		     int last)
+{
+	uint8_t x[F25519_SIZE];
+	uint8_t y[F25519_SIZE];
+	char inner[16];
+
+	snprintf(inner, sizeof(inner), "%s\t", indent);
+	ed25519_unproject(x, y, p);
+	printf("%s{\n", indent);
+	print_fe(inner, x, 0);
+	print_fe(inner, y, 1);
+	printf("%s}%s\n", indent, last ? "" : ",");
+}
+
+int main(void)
+{
+	struct ed25519_pt p;
+	struct ed25519_pt q;
+	int g;
+	int i;
+
+	printf("/* Precomputed multiples of the Ed25519 base point, as affine\n"
+	       " * (x, y) pairs. Generated by gen-ed25519-tables.c, do not edit.\n"
+	       " */\n\n"
+	       "#ifndef ED25519_TABLES_H_\n"
+	       "#define ED25519_TABLES_H_\n\n");
+
+	/* Odd multiples for wNAF in verification */
+	printf("/* B, 3B, 5B, ..., 15B */\n"
+	       "static const uint8_t ed25519_base_odd[8][2][F25519_SIZE] = {\n");
+	ed25519_double(&q, &ed25519_base);
+	ed25519_copy(&p, &ed25519_base);
+	for (i = 0; i < 8; i++) {
+		print_pt("\t", &p, i == 7);
+		ed25519_add(&p, &p, &q);
+	}
+	printf("};\n\n");
+
+	/* Comb groups 16^g B, 2 * 16^g B, ..., 8 * 16^g B. Only even g
+	 * are needed for spacings of 2 and up.
+	 */
+	printf("/* Group i holds jB * 16^(i * ED25519_COMB_SPACING),"
+	       " for j = 1..8 */\n"
+	       "static const uint8_t ed25519_comb[64 / ED25519_COMB_SPACING]"
+	       "[8][2][F25519_SIZE] = {\n");
+	ed25519_copy(&p, &ed25519_base);
+	for (g = 0; g < 64; g++) {
+		if (!(g & 1)) {
+			printf("#if (%d %% ED25519_COMB_SPACING) == 0\n"
+			       "\t{\n", g);
+			ed25519_copy(&q, &p);
+			for (i = 0; i < 8; i++) {
+				print_pt("\t\t", &q, i == 7);
+				ed25519_add(&q, &q, &p);
+			}
+			printf("\t}%s\n#endif\n", g == 62 ? "" : ",");
+		}
+
+		for (i = 0; i < 4; i++)
+			ed25519_double(&p, &p);
+	}
+	printf("};\n\n#endif\n");
+
+	return 0;
+}
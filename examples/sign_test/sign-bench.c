@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Benchmark for the Ed25519 field arithmetic and signatures
+ *
+ *         Each operation is repeated for at least BENCH_TIME and the
+ *         average time is printed, together with the number of CPU
+ *         cycles when the clock frequency is known. The frequency is
+ *         taken from F_CPU or can be given with
+ *         SIGN_BENCH_CONF_CPU_HZ, e.g. on native:
+ *
+ *         make TARGET=native sign-bench DEFINES=SIGN_BENCH_CONF_CPU_HZ=2400000000
+ *
+ *         The field backend is selected with F25519_CONF_RADIX, see
+ *         f25519.c.
+ */
+
+#include "contiki.h"
+#include "dev/watchdog.h"
+#include "f25519.h"
+#include "ed25519.h"
+#include "edsign.h"
+
+#include <stdio.h>
+
+#ifdef SIGN_BENCH_CONF_CPU_HZ
+#define CPU_HZ SIGN_BENCH_CONF_CPU_HZ
+#elif defined(F_CPU)
+#define CPU_HZ F_CPU
+#else
+#define CPU_HZ 0
+#endif
+
+#define BENCH_TIME CLOCK_SECOND
+
+static uint8_t fa[F25519_SIZE];
+static uint8_t fb[F25519_SIZE];
+static uint8_t scalar[ED25519_EXPONENT_SIZE];
+static struct ed25519_pt point;
+static uint8_t secret[EDSIGN_SECRET_KEY_SIZE];
+static uint8_t public[EDSIGN_PUBLIC_KEY_SIZE];
+static uint8_t signature[EDSIGN_SIGNATURE_SIZE];
+static const uint8_t message[32] = "Contiki multicast OSCOAP bench";
+static uint8_t verified;
+static struct edsign_secret_key secret_key;
+static struct edsign_public_key public_key;
+static struct edsign_batch batch[EDSIGN_BATCH_SIZE];
+/*---------------------------------------------------------------------------*/
+static void
+bench_mul(void)
+{
+  f25519_mul__distinct(fb, fa, fa);
+  f25519_mul__distinct(fa, fb, fb);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_inv(void)
+{
+  f25519_inv__distinct(fb, fa);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_smult(void)
+{
+  ed25519_smult(&point, &ed25519_base, scalar);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_smult_base(void)
+{
+  ed25519_smult_base(&point, scalar);
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_sign(void)
+{
+  edsign_sign(signature, public, secret, message, sizeof(message));
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_verify(void)
+{
+  verified = edsign_verify(signature, public, message, sizeof(message));
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_sign_prepared(void)
+{
+  edsign_sign_prepared(signature, &secret_key, message, sizeof(message));
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_verify_prepared(void)
+{
+  verified = edsign_verify_prepared(signature, &public_key, message,
+                                    sizeof(message));
+}
+/*---------------------------------------------------------------------------*/
+static void
+bench_verify_batch(void)
+{
+  verified = edsign_verify_batch(batch, EDSIGN_BATCH_SIZE);
+}
+/*---------------------------------------------------------------------------*/
+static void
+run(const char *name, void (*op)(void), unsigned ops_per_call)
+{
+  clock_time_t start, elapsed;
+  unsigned long calls = 0;
+  unsigned long long nsec;
+
+  start = clock_time();
+  do {
+    op();
+    calls++;
+    watchdog_periodic();
+    elapsed = clock_time() - start;
+  } while(elapsed < BENCH_TIME);
+
+  nsec = (unsigned long long)elapsed * 1000000000 / CLOCK_SECOND /
+    (calls * ops_per_call);
+  printf("%-7s %8lu runs %12llu ns", name, calls * ops_per_call, nsec);
+  if(CPU_HZ > 0) {
+    printf(" %12llu cycles", nsec * (CPU_HZ / 1000) / 1000000);
+  }
+  printf("\n");
+}
+/*---------------------------------------------------------------------------*/
+PROCESS(sign_bench_process, "Ed25519 benchmark");
+AUTOSTART_PROCESSES(&sign_bench_process);
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(sign_bench_process, ev, data)
+{
+  int i;
+
+  PROCESS_BEGIN();
+
+  for(i = 0; i < F25519_SIZE; i++) {
+    fa[i] = i * 37 + 11;
+    scalar[i] = i * 91 + 5;
+    secret[i] = i * 13 + 7;
+  }
+  ed25519_prepare(scalar);
+  edsign_sec_to_pub(public, secret);
+  edsign_sign(signature, public, secret, message, sizeof(message));
+  edsign_prepare_secret(&secret_key, secret);
+  edsign_prepare_public(&public_key, public);
+  for(i = 0; i < EDSIGN_BATCH_SIZE; i++) {
+    batch[i].signature = signature;
+    batch[i].pub = public;
+    batch[i].message = message;
+    batch[i].len = sizeof(message);
+  }
+
+  printf("Ed25519 benchmark, %lu Hz CPU\n", (unsigned long)CPU_HZ);
+  run("mul", bench_mul, 2);
+  run("inv", bench_inv, 1);
+  run("smult", bench_smult, 1);
+  run("smultb", bench_smult_base, 1);
+  run("sign", bench_sign, 1);
+  run("verify", bench_verify, 1);
+  printf("signature %s\n", verified ? "verified" : "NOT verified");
+  run("signp", bench_sign_prepared, 1);
+  run("verifyp", bench_verify_prepared, 1);
+  printf("signature %s\n", verified ? "verified" : "NOT verified");
+  run("verifyb", bench_verify_batch, EDSIGN_BATCH_SIZE);
+  printf("batch of %d %s\n", EDSIGN_BATCH_SIZE,
+         verified ? "verified" : "NOT verified");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -231,6 +231,11 @@ typedef unsigned long rtimer_clock_t;
 /* Turn off example-provided putchars */
 #define SLIP_BRIDGE_CONF_NO_PUTCHAR 1
 
+/* Runs of SLIP output go to the serial log with slip_arch_write() */
+#ifndef SLIP_CONF_BULK_WRITE
+#define SLIP_CONF_BULK_WRITE 1
+#endif /* SLIP_CONF_BULK_WRITE */
+
 
 #define CFS_CONF_OFFSET_TYPE	long
 
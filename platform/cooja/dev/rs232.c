@@ -47,6 +47,7 @@ char simSerialReceivingFlag;
 static int (* input_handler)(unsigned char) = NULL;
 
 void simlog_char(char c);
+void simlog_write(const char *data, int len);
 /*-----------------------------------------------------------------------------------*/
 void rs232_init(void) { }
 /*-----------------------------------------------------------------------------------*/
@@ -74,6 +75,12 @@ slip_arch_writeb(unsigned char c)
   simlog_char(c);
 }
 /*-----------------------------------------------------------------------------------*/
+void
+slip_arch_write(const uint8_t *buf, int len)
+{
+  simlog_write((const char *)buf, len);
+}
+/*-----------------------------------------------------------------------------------*/
 static void
 doInterfaceActionsBeforeTick(void)
 {
@@ -85,6 +85,19 @@ simlog(const char *message)
 }
 /*-----------------------------------------------------------------------------------*/
 void
+simlog_write(const char *data, int len)
+{
+  if (simLoggedLength + len > MAX_LOG_LENGTH) {
+    /* Dropping data due to buffer overflow */
+    return;
+  }
+
+  memcpy(simLoggedData + simLoggedLength, data, len);
+  simLoggedLength += len;
+  simLoggedFlag = 1;
+}
+/*-----------------------------------------------------------------------------------*/
+void
 log_message(const char *part1, const char *part2)
 {
   simlog(part1);
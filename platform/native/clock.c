@@ -41,7 +41,31 @@
 #include <time.h>
 #include <sys/time.h>
 
+#if NATIVE_CONF_EPOLL
 /*---------------------------------------------------------------------------*/
+/* CLOCK_MONOTONIC is not affected by adjustments of the wall clock, so
+   timers neither jump nor drift when the host time is changed. */
+clock_time_t
+clock_time(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+/*---------------------------------------------------------------------------*/
+unsigned long
+clock_seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec;
+}
+/*---------------------------------------------------------------------------*/
+#else /* NATIVE_CONF_EPOLL */
 clock_time_t
 clock_time(void)
 {
@@ -62,6 +86,8 @@ clock_seconds(void)
   return tv.tv_sec;
 }
 /*---------------------------------------------------------------------------*/
+#endif /* NATIVE_CONF_EPOLL */
+/*---------------------------------------------------------------------------*/
 void
 clock_delay(unsigned int d)
 {
@@ -44,6 +44,21 @@ struct select_callback {
 };
 int select_set_callback(int fd, const struct select_callback *callback);
 
+/* On Linux, the main loop waits on epoll and rtimers are driven by a
+   CLOCK_MONOTONIC timerfd with microsecond resolution. */
+#ifndef NATIVE_CONF_EPOLL
+#ifdef __linux__
+#define NATIVE_CONF_EPOLL              1
+#else /* __linux__ */
+#define NATIVE_CONF_EPOLL              0
+#endif /* __linux__ */
+#endif /* NATIVE_CONF_EPOLL */
+
+#if NATIVE_CONF_EPOLL
+typedef uint32_t rtimer_clock_t;
+#define RTIMER_CLOCK_DIFF(a, b)        ((int32_t)((a) - (b)))
+#endif /* NATIVE_CONF_EPOLL */
+
 #define CC_CONF_REGISTER_ARGS          1
 #define CC_CONF_FUNCTION_POINTER_ARGS  1
 #define CC_CONF_VA_ARGS                1
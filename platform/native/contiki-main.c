@@ -44,6 +44,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <sys/select.h>
 #include <errno.h>
@@ -55,6 +56,10 @@
 #include "contiki.h"
 #include "net/netstack.h"
 
+#if NATIVE_CONF_EPOLL
+#include <sys/epoll.h>
+#endif /* NATIVE_CONF_EPOLL */
+
 #include "ctk/ctk.h"
 #include "ctk/ctk-curses.h"
 
@@ -74,6 +79,9 @@
 
 #ifdef SELECT_CONF_MAX
 #define SELECT_MAX SELECT_CONF_MAX
+#elif NATIVE_CONF_EPOLL
+/* The callbacks take fd_sets, so descriptors are bounded by FD_SETSIZE */
+#define SELECT_MAX FD_SETSIZE
 #else
 #define SELECT_MAX 8
 #endif
@@ -81,6 +89,20 @@
 static const struct select_callback *select_callback[SELECT_MAX];
 static int select_max = 0;
 
+#if NATIVE_CONF_EPOLL
+#define EPOLL_MAX_EVENTS 32
+
+/* Events currently registered with epoll for each descriptor */
+static uint32_t epoll_registered[SELECT_MAX];
+/* Descriptors that epoll does not support (regular files) are polled
+   on every iteration of the main loop, as select() reports them ready */
+static uint8_t epoll_unsupported[SELECT_MAX];
+/* Events requested this iteration for the descriptors epoll does not
+   support, reported back as ready like select() would */
+static uint32_t epoll_unsupported_events[SELECT_MAX];
+static int epoll_fd = -1;
+#endif /* NATIVE_CONF_EPOLL */
+
 SENSORS(&pir_sensor, &vib_sensor, &button_sensor);
 
 static uint8_t serial_id[] = {0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08};
@@ -101,6 +123,17 @@ select_set_callback(int fd, const struct select_callback *callback)
 
     select_callback[fd] = callback;
 
+#if NATIVE_CONF_EPOLL
+    if(callback == NULL) {
+      if(epoll_registered[fd] != 0 && epoll_fd >= 0) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+      }
+      epoll_registered[fd] = 0;
+      epoll_unsupported[fd] = 0;
+      epoll_unsupported_events[fd] = 0;
+    }
+#endif /* NATIVE_CONF_EPOLL */
+
     /* Update fd max */
     if(callback != NULL) {
       if(fd > select_max) {
@@ -130,9 +163,15 @@ static void
 stdin_handle_fd(fd_set *rset, fd_set *wset)
 {
   char c;
+  int n;
   if(FD_ISSET(STDIN_FILENO, rset)) {
-    if(read(STDIN_FILENO, &c, 1) > 0) {
+    n = read(STDIN_FILENO, &c, 1);
+    if(n > 0) {
       serial_line_input_byte(c);
+    } else if(n == 0) {
+      /* End of input: a file or /dev/null would otherwise be reported
+         ready on every iteration of the main loop */
+      select_set_callback(STDIN_FILENO, NULL);
     }
   }
 }
@@ -250,7 +289,123 @@ main(int argc, char **argv)
   setvbuf(stdout, (char *)NULL, _IONBF, 0);
 
   select_set_callback(STDIN_FILENO, &stdin_fd);
+#if NATIVE_CONF_EPOLL
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if(epoll_fd < 0) {
+    perror("epoll_create1");
+    exit(1);
+  }
+#endif /* NATIVE_CONF_EPOLL */
   while(1) {
+#if NATIVE_CONF_EPOLL
+    struct epoll_event events[EPOLL_MAX_EVENTS];
+    fd_set fdr;
+    fd_set fdw;
+    int always_ready;
+    int timeout;
+    int i;
+    int retval;
+
+    retval = process_run();
+
+    /* Let the callbacks express their interest and mirror it into the
+       epoll set, which only changes when a callback's interest does */
+    FD_ZERO(&fdr);
+    FD_ZERO(&fdw);
+    for(i = 0; i <= select_max; i++) {
+      if(select_callback[i] != NULL) {
+        select_callback[i]->set_fd(&fdr, &fdw);
+      }
+    }
+    always_ready = 0;
+    for(i = 0; i <= select_max; i++) {
+      struct epoll_event ev;
+
+      memset(&ev, 0, sizeof(ev));
+      if(select_callback[i] != NULL) {
+        ev.events = (FD_ISSET(i, &fdr) ? EPOLLIN : 0) |
+          (FD_ISSET(i, &fdw) ? EPOLLOUT : 0);
+      }
+      if(epoll_unsupported[i]) {
+        epoll_unsupported_events[i] = ev.events;
+        always_ready |= ev.events != 0;
+        continue;
+      }
+      if(ev.events == epoll_registered[i]) {
+        continue;
+      }
+      ev.data.fd = i;
+      if(ev.events == 0) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, i, NULL);
+      } else if(epoll_ctl(epoll_fd, epoll_registered[i] == 0 ?
+                          EPOLL_CTL_ADD : EPOLL_CTL_MOD, i, &ev) < 0 &&
+                /* The descriptor may have been closed and reopened */
+                (errno != ENOENT ||
+                 epoll_ctl(epoll_fd, EPOLL_CTL_ADD, i, &ev) < 0)) {
+        if(errno == EPERM) {
+          epoll_unsupported[i] = 1;
+          epoll_unsupported_events[i] = ev.events;
+          always_ready = 1;
+        } else {
+          perror("epoll_ctl");
+        }
+        continue;
+      }
+      epoll_registered[i] = ev.events;
+    }
+
+    /* Sleep until the next etimer expires; rtimers have their own
+       timerfd in the epoll set */
+    if(retval || always_ready) {
+      timeout = 0;
+    } else if(etimer_pending()) {
+      long diff = (long)(etimer_next_expiration_time() - clock_time());
+      timeout = diff > 0 ? MIN(diff, 1000) : 0;
+    } else {
+      timeout = 1000;
+    }
+
+    retval = epoll_wait(epoll_fd, events, EPOLL_MAX_EVENTS, timeout);
+    if(retval < 0) {
+      if(errno != EINTR) {
+        perror("epoll_wait");
+      }
+    } else if(retval > 0 || always_ready) {
+      FD_ZERO(&fdr);
+      FD_ZERO(&fdw);
+      for(i = 0; i < retval; i++) {
+        /* Errors and hangups are reported to the callbacks as
+           readiness, as select() does */
+        if(events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+          FD_SET(events[i].data.fd, &fdr);
+        }
+        if(events[i].events & (EPOLLOUT | EPOLLERR)) {
+          FD_SET(events[i].data.fd, &fdw);
+        }
+      }
+      for(i = 0; i <= select_max; i++) {
+        if(epoll_unsupported[i] && select_callback[i] != NULL) {
+          if(epoll_unsupported_events[i] & EPOLLIN) {
+            FD_SET(i, &fdr);
+          }
+          if(epoll_unsupported_events[i] & EPOLLOUT) {
+            FD_SET(i, &fdw);
+          }
+        }
+      }
+      for(i = 0; i < retval; i++) {
+        int fd = events[i].data.fd;
+        if(select_callback[fd] != NULL) {
+          select_callback[fd]->handle_fd(&fdr, &fdw);
+        }
+      }
+      for(i = 0; i <= select_max; i++) {
+        if(epoll_unsupported[i] && select_callback[i] != NULL) {
+          select_callback[i]->handle_fd(&fdr, &fdw);
+        }
+      }
+    }
+#else /* NATIVE_CONF_EPOLL */
     fd_set fdr;
     fd_set fdw;
     int maxfd;
@@ -286,6 +441,8 @@ main(int argc, char **argv)
       }
     }
 
+#endif /* NATIVE_CONF_EPOLL */
+
     etimer_request_poll();
 
 #if WITH_GUI
@@ -24,7 +24,8 @@
       <identifier>sky1</identifier>
       <description>Sky Mote Type #1</description>
       <source EXPORT="discard">[CONTIKI_DIR]/examples/collect/collect-view-shell.c</source>
-      <commands EXPORT="discard">make collect-view-shell.sky TARGET=sky</commands>
+      <commands EXPORT="discard">make clean TARGET=sky
+make collect-view-shell.sky TARGET=sky</commands>
       <firmware EXPORT="copy">[CONTIKI_DIR]/examples/collect/collect-view-shell.sky</firmware>
       <moteinterface>org.contikios.cooja.interfaces.Position</moteinterface>
       <moteinterface>org.contikios.cooja.interfaces.IPAddress</moteinterface>
@@ -333,6 +334,11 @@ print_stats()
 	  total_dups + " dups, " +
 	  (total_dups / nrNodes) + " dups/node, " +
 	  (total_hops / total_received) + " hops/message\n");
+  if(time &gt; start_time) {
+    log.log("Goodput " + (unique_received * 1000000 / (time - start_time)) +
+            " messages/s, " + (unique_bytes * 1000000 / (time - start_time)) +
+            " bytes/s\n");
+  }
   log.log("Received:\n");
   for(i = 1; i &lt;= nrNodes; i++) {
       log.log("Node " + i + " ");
@@ -363,6 +369,9 @@ total_lost = 0;
 total_hops = 0;
 total_dups = 0;
 total_reorder = 0;
+unique_received = 0;
+unique_bytes = 0;
+start_time = 0;
 
 total_cpu = total_lpm = total_listen = total_transmit = 0;
 
@@ -405,6 +414,7 @@ YIELD_THEN_WAIT_UNTIL(msg.equals("continue"));
 node = sink_node;
 log.log("Writing netcmd\n");
 node.write("netcmd { repeat 11 30 { randwait 30 collect-view-data | blink | send } }");
+start_time = time;
 
 while(true) {
   YIELD();
@@ -450,6 +460,8 @@ while(true) {
     dups = received[source].substr(seqno, 1);
     if(dups == "_") {
         dups = 1;
+        unique_received++;
+        unique_bytes += 2 * len;
     } else if(dups &lt; 9) {
         dups++;
     }
@@ -479,6 +491,10 @@ while(true) {
 
   if(num_reported == nrNodes - 1) {
       print_stats();
+      /* Baseline for 02-sky-shell-collect-window.csc */
+      goodput = new java.io.FileWriter("01-sky-shell-collect.goodput");
+      goodput.write("" + (unique_bytes * 1000000 / (time - start_time)));
+      goodput.close();
       log.testOK();
   }
 }</script>
@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/*
+ * Throughput benchmark for the native border router
+ * (examples/ipv6/native-border-router).
+ *
+ * br-replay emulates the slip-radio: it listens on a TCP port that the
+ * border router connects to with "-a localhost -p <port>", answers the
+ * MAC address request and acknowledges every frame the border router
+ * hands to the radio. Once the border router is up, the IPv6 packets of
+ * a pcap file are injected into its tun interface, and the number of
+ * packets and radio frames per second is reported.
+ *
+ * Usage (as root):
+ *   br-replay -p 60001 -i tun0 -n 10 capture.pcap &
+ *   border-router.native -a localhost -p 60001 -t tun0 fd00::1/64
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <err.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <net/if.h>
+
+#include <linux/if_packet.h>
+#include <linux/if_ether.h>
+
+#define SLIP_END     0300
+#define SLIP_ESC     0333
+#define SLIP_ESC_END 0334
+#define SLIP_ESC_ESC 0335
+
+#define LINKTYPE_ETHERNET   1
+#define LINKTYPE_RAW        101
+#define LINKTYPE_LINUX_SLL  113
+#define LINKTYPE_IPV6       229
+
+#define MAX_PACKETS 65536
+
+struct packet {
+  uint8_t *data;
+  int len;
+};
+
+static struct packet packets[MAX_PACKETS];
+static int packet_count;
+
+static unsigned long frames_received;
+static unsigned long bytes_received;
+
+static uint8_t frame[4096];
+static int frame_len;
+static int frame_esc;
+/*---------------------------------------------------------------------------*/
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+/*---------------------------------------------------------------------------*/
+static uint32_t
+get32(const uint8_t *p, int swap)
+{
+  if(swap) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | p[2] << 8 | p[3];
+  }
+  return (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | p[1] << 8 | p[0];
+}
+/*---------------------------------------------------------------------------*/
+/* Read the IPv6 packets of a pcap file into memory */
+static void
+load_pcap(const char *filename)
+{
+  FILE *f;
+  uint8_t hdr[24];
+  uint8_t rec[16];
+  uint8_t buf[65536];
+  uint32_t magic, linktype, caplen;
+  int swap, offset;
+
+  f = fopen(filename, "rb");
+  if(f == NULL) {
+    err(1, "can't open ``%s''", filename);
+  }
+  if(fread(hdr, sizeof(hdr), 1, f) != 1) {
+    errx(1, "%s: short pcap header", filename);
+  }
+
+  magic = get32(hdr, 0);
+  if(magic == 0xa1b2c3d4 || magic == 0xa1b23c4d) {
+    swap = 0;
+  } else if(magic == 0xd4c3b2a1 || magic == 0x4d3cb2a1) {
+    swap = 1;
+  } else {
+    errx(1, "%s: not a pcap file", filename);
+  }
+
+  linktype = get32(&hdr[20], swap);
+  switch(linktype) {
+  case LINKTYPE_RAW:
+  case LINKTYPE_IPV6:
+    offset = 0;
+    break;
+  case LINKTYPE_ETHERNET:
+    offset = 14;
+    break;
+  case LINKTYPE_LINUX_SLL:
+    offset = 16;
+    break;
+  default:
+    errx(1, "%s: unsupported link type %u", filename, linktype);
+  }
+
+  while(packet_count < MAX_PACKETS && fread(rec, sizeof(rec), 1, f) == 1) {
+    caplen = get32(&rec[8], swap);
+    if(caplen > sizeof(buf) || fread(buf, caplen, 1, f) != 1) {
+      break;
+    }
+    /* Only replay complete IPv6 packets */
+    if(caplen <= offset + 40 || (buf[offset] >> 4) != 6 ||
+       caplen - offset != 40 + (buf[offset + 4] << 8 | buf[offset + 5])) {
+      continue;
+    }
+    packets[packet_count].len = caplen - offset;
+    packets[packet_count].data = malloc(caplen - offset);
+    if(packets[packet_count].data == NULL) {
+      err(1, "malloc");
+    }
+    memcpy(packets[packet_count].data, &buf[offset], caplen - offset);
+    packet_count++;
+  }
+  fclose(f);
+
+  if(packet_count == 0) {
+    errx(1, "%s: no IPv6 packets", filename);
+  }
+  fprintf(stderr, "loaded %d IPv6 packets from %s\n", packet_count, filename);
+}
+/*---------------------------------------------------------------------------*/
+static void
+slip_write(int fd, const uint8_t *data, int len)
+{
+  uint8_t buf[2 * 64 + 2];
+  int i, pos;
+
+  pos = 0;
+  buf[pos++] = SLIP_END;
+  for(i = 0; i < len && pos < sizeof(buf) - 3; i++) {
+    if(data[i] == SLIP_END) {
+      buf[pos++] = SLIP_ESC;
+      buf[pos++] = SLIP_ESC_END;
+    } else if(data[i] == SLIP_ESC) {
+      buf[pos++] = SLIP_ESC;
+      buf[pos++] = SLIP_ESC_ESC;
+    } else {
+      buf[pos++] = data[i];
+    }
+  }
+  buf[pos++] = SLIP_END;
+  if(write(fd, buf, pos) != pos) {
+    err(1, "radio: write");
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Handle one frame from the border router the way slip-radio does */
+static void
+radio_frame(int fd, const uint8_t *data, int len)
+{
+  uint8_t reply[10];
+
+  if(len >= 3 && data[0] == '!' && data[1] == 'S') {
+    frames_received++;
+    bytes_received += len - 3;
+    reply[0] = '!';
+    reply[1] = 'R';
+    reply[2] = data[2];
+    reply[3] = 0; /* MAC_TX_OK */
+    reply[4] = 1;
+    slip_write(fd, reply, 5);
+  } else if(len >= 2 && data[0] == '?' && data[1] == 'M') {
+    reply[0] = '!';
+    reply[1] = 'M';
+    memcpy(&reply[2], "\x02\x12\x74\x01\x00\x01\x01\x01", 8);
+    slip_write(fd, reply, 10);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+radio_input(int fd)
+{
+  uint8_t buf[8192];
+  int i, n;
+
+  n = read(fd, buf, sizeof(buf));
+  if(n <= 0) {
+    if(n < 0 && errno == EAGAIN) {
+      return;
+    }
+    errx(1, "radio: border router disconnected");
+  }
+
+  for(i = 0; i < n; i++) {
+    uint8_t c = buf[i];
+    if(c == SLIP_END) {
+      if(frame_len > 0) {
+        radio_frame(fd, frame, frame_len);
+      }
+      frame_len = 0;
+      frame_esc = 0;
+      continue;
+    }
+    if(frame_esc) {
+      c = c == SLIP_ESC_END ? SLIP_END : c == SLIP_ESC_ESC ? SLIP_ESC : c;
+      frame_esc = 0;
+    } else if(c == SLIP_ESC) {
+      frame_esc = 1;
+      continue;
+    }
+    if(frame_len < sizeof(frame)) {
+      frame[frame_len++] = c;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+radio_accept(int port)
+{
+  struct sockaddr_in6 addr;
+  int fd, s, on = 1;
+
+  s = socket(AF_INET6, SOCK_STREAM, 0);
+  if(s < 0) {
+    err(1, "socket");
+  }
+  setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin6_family = AF_INET6;
+  addr.sin6_addr = in6addr_any;
+  addr.sin6_port = htons(port);
+  if(bind(s, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(s, 1) < 0) {
+    err(1, "can't listen on port %d", port);
+  }
+  fprintf(stderr, "waiting for the border router on port %d\n", port);
+  fd = accept(s, NULL, NULL);
+  if(fd < 0) {
+    err(1, "accept");
+  }
+  close(s);
+  return fd;
+}
+/*---------------------------------------------------------------------------*/
+static int
+tun_open(const char *tundev, struct sockaddr_ll *sll)
+{
+  int s;
+
+  s = socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_IPV6));
+  if(s < 0) {
+    err(1, "can't open packet socket (root required)");
+  }
+  memset(sll, 0, sizeof(*sll));
+  sll->sll_family = AF_PACKET;
+  sll->sll_protocol = htons(ETH_P_IPV6);
+  sll->sll_ifindex = if_nametoindex(tundev);
+  if(sll->sll_ifindex == 0) {
+    err(1, "no interface ``%s''", tundev);
+  }
+  return s;
+}
+/*---------------------------------------------------------------------------*/
+static void
+usage(void)
+{
+  fprintf(stderr, "usage: br-replay [-p port] [-i tundev] [-n loops]"
+          " [-r packets/s] [-w wait] file.pcap\n");
+  exit(1);
+}
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char **argv)
+{
+  struct sockaddr_ll sll;
+  struct pollfd pfd;
+  const char *tundev = "tun0";
+  int port = 60001, loops = 1, rate = 0, wait = 5;
+  unsigned long sent = 0;
+  double start, end, next;
+  int c, radiofd, tunsock, i, l;
+
+  while((c = getopt(argc, argv, "p:i:n:r:w:h")) != -1) {
+    switch(c) {
+    case 'p':
+      port = atoi(optarg);
+      break;
+    case 'i':
+      tundev = optarg;
+      break;
+    case 'n':
+      loops = atoi(optarg);
+      break;
+    case 'r':
+      rate = atoi(optarg);
+      break;
+    case 'w':
+      wait = atoi(optarg);
+      break;
+    default:
+      usage();
+    }
+  }
+  if(optind != argc - 1) {
+    usage();
+  }
+
+  load_pcap(argv[optind]);
+  radiofd = radio_accept(port);
+
+  /* Let the border router configure its tun interface and MAC */
+  pfd.fd = radiofd;
+  pfd.events = POLLIN;
+  end = now() + wait;
+  while(now() < end) {
+    if(poll(&pfd, 1, 100) > 0) {
+      radio_input(radiofd);
+    }
+  }
+  tunsock = tun_open(tundev, &sll);
+
+  frames_received = bytes_received = 0;
+  start = next = now();
+  for(l = 0; l < loops; l++) {
+    for(i = 0; i < packet_count; i++) {
+      if(sendto(tunsock, packets[i].data, packets[i].len, 0,
+                (struct sockaddr *)&sll, sizeof(sll)) < 0) {
+        if(errno != ENOBUFS && errno != EAGAIN) {
+          err(1, "tun: sendto");
+        }
+      } else {
+        sent++;
+      }
+      /* Keep serving the emulated radio while replaying */
+      while(poll(&pfd, 1, 0) > 0) {
+        radio_input(radiofd);
+      }
+      if(rate > 0) {
+        next += 1.0 / rate;
+        while(now() < next) {
+          if(poll(&pfd, 1, 1) > 0) {
+            radio_input(radiofd);
+          }
+        }
+      }
+    }
+  }
+  end = now();
+
+  /* Collect the frames that are still on their way to the radio */
+  while(poll(&pfd, 1, 1000) > 0) {
+    radio_input(radiofd);
+  }
+
+  printf("packets injected: %lu in %.3f s (%.0f packets/s)\n",
+         sent, end - start, sent / (end - start));
+  printf("radio frames: %lu, %lu payload bytes (%.0f frames/s)\n",
+         frames_received, bytes_received, frames_received / (now() - start));
+  close(tunsock);
+  close(radiofd);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
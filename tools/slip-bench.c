@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, agent <agent@local>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/*
+ * Benchmark for the SLIP codec in core/dev/slip-codec.c.
+ *
+ * Frames of random data are escaped and unescaped with the codec and
+ * with the byte at a time loops it replaces, and the throughput of
+ * both is printed. Every frame is checked to survive the round trip.
+ *
+ * Usage:
+ *   slip-bench [-s frame size] [-n frames] [-e special bytes per 1000]
+ */
+
+#include "dev/slip-codec.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <err.h>
+
+#define SLIP_END     0300
+#define SLIP_ESC     0333
+#define SLIP_ESC_END 0334
+#define SLIP_ESC_ESC 0335
+
+#define NFRAMES 64
+
+static uint8_t frames[NFRAMES][2048];
+static uint8_t encoded[NFRAMES][2 * 2048];
+static int encoded_len[NFRAMES];
+static uint8_t decoded[2048];
+/*---------------------------------------------------------------------------*/
+static int
+encode_bytewise(uint8_t *dst, const uint8_t *src, int len)
+{
+  int i, n = 0;
+
+  for(i = 0; i < len; i++) {
+    if(src[i] == SLIP_END) {
+      dst[n++] = SLIP_ESC;
+      dst[n++] = SLIP_ESC_END;
+    } else if(src[i] == SLIP_ESC) {
+      dst[n++] = SLIP_ESC;
+      dst[n++] = SLIP_ESC_ESC;
+    } else {
+      dst[n++] = src[i];
+    }
+  }
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+static int
+decode_bytewise(uint8_t *dst, const uint8_t *src, int len)
+{
+  int i, n = 0, esc = 0;
+
+  for(i = 0; i < len; i++) {
+    if(esc) {
+      if(src[i] == SLIP_ESC_END) {
+        dst[n++] = SLIP_END;
+      } else if(src[i] == SLIP_ESC_ESC) {
+        dst[n++] = SLIP_ESC;
+      }
+      esc = 0;
+    } else if(src[i] == SLIP_ESC) {
+      esc = 1;
+    } else {
+      dst[n++] = src[i];
+    }
+  }
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+static int
+decode_codec(uint8_t *dst, const uint8_t *src, int len)
+{
+  uint8_t esc = 0;
+  return slip_codec_decode(dst, src, len, &esc);
+}
+/*---------------------------------------------------------------------------*/
+static double
+now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+/*---------------------------------------------------------------------------*/
+static void
+run(const char *name, int size, long count,
+    int (*encode)(uint8_t *, const uint8_t *, int),
+    int (*decode)(uint8_t *, const uint8_t *, int))
+{
+  double start, enc, dec;
+  long i;
+  int f;
+
+  start = now();
+  for(i = 0; i < count; i++) {
+    f = i % NFRAMES;
+    encoded_len[f] = encode(encoded[f], frames[f], size);
+  }
+  enc = now() - start;
+
+  start = now();
+  for(i = 0; i < count; i++) {
+    f = i % NFRAMES;
+    if(decode(decoded, encoded[f], encoded_len[f]) != size) {
+      errx(1, "%s: frame %d has wrong length after round trip", name, f);
+    }
+  }
+  dec = now() - start;
+
+  for(f = 0; f < NFRAMES; f++) {
+    if(decode(decoded, encoded[f], encoded_len[f]) != size ||
+       memcmp(decoded, frames[f], size) != 0) {
+      errx(1, "%s: frame %d corrupted by round trip", name, f);
+    }
+  }
+
+  printf("%-9s encode %8.1f MB/s  decode %8.1f MB/s\n", name,
+         size * (double)count / enc / 1e6, size * (double)count / dec / 1e6);
+}
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char **argv)
+{
+  int size = 127;
+  long count = 1000000;
+  int special = 8;
+  int c, f, i;
+
+  while((c = getopt(argc, argv, "s:n:e:")) != -1) {
+    switch(c) {
+    case 's':
+      size = atoi(optarg);
+      break;
+    case 'n':
+      count = atol(optarg);
+      break;
+    case 'e':
+      special = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-s frame size] [-n frames] "
+              "[-e special bytes per 1000]\n", argv[0]);
+      exit(1);
+    }
+  }
+  if(size <= 0 || size > (int)sizeof(frames[0]) || count <= 0) {
+    errx(1, "frame size must be 1..%d", (int)sizeof(frames[0]));
+  }
+
+  srandom(1);
+  for(f = 0; f < NFRAMES; f++) {
+    for(i = 0; i < size; i++) {
+      if(random() % 1000 < special) {
+        frames[f][i] = random() & 1 ? SLIP_END : SLIP_ESC;
+      } else {
+        do {
+          frames[f][i] = random();
+        } while(frames[f][i] == SLIP_END || frames[f][i] == SLIP_ESC);
+      }
+    }
+  }
+
+  printf("%ld frames of %d bytes, %d.%d%% END/ESC\n", count, size,
+         special / 10, special % 10);
+  run("bytewise", size, count, encode_bytewise, decode_bytewise);
+  run("codec", size, count, slip_codec_encode, decode_codec);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/